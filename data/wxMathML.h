@@ -17,1540 +17,1642 @@
 /* along with this program; if not, write to the Free Software                          */
 /* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA            */
 unsigned char wxMathML_lisp_gz[] = {
-  0x1f, 0x8b, 0x08, 0x08, 0x29, 0xb0, 0x0c, 0x5d, 0x00, 0x03, 0x77, 0x78,
+  0x1f, 0x8b, 0x08, 0x08, 0xad, 0x16, 0xd6, 0x6a, 0x00, 0x03, 0x77, 0x78,
   0x4d, 0x61, 0x74, 0x68, 0x4d, 0x4c, 0x2e, 0x6c, 0x69, 0x73, 0x70, 0x00,
-  0xcc, 0x3c, 0x69, 0x73, 0xdb, 0x46, 0x96, 0x9f, 0xe5, 0x5f, 0xd1, 0x45,
-  0x89, 0x16, 0x28, 0x13, 0x3a, 0x9c, 0xd4, 0x6e, 0x56, 0x96, 0x95, 0xf2,
-  0xc4, 0x9b, 0x6b, 0xed, 0x99, 0x54, 0xec, 0x99, 0xa4, 0x6a, 0x9c, 0x75,
-  0x9a, 0x40, 0x93, 0x44, 0x8c, 0xcb, 0x0d, 0x50, 0x24, 0x93, 0xb2, 0x7e,
-  0xd6, 0xfe, 0x81, 0xfd, 0x63, 0xfb, 0x8e, 0xee, 0x46, 0xe3, 0x10, 0xa9,
-  0xd8, 0xf3, 0x61, 0x55, 0x49, 0x08, 0x34, 0xde, 0xd5, 0xaf, 0x5f, 0xbf,
-  0xab, 0x81, 0x04, 0xf3, 0x42, 0x67, 0xb2, 0x16, 0xb5, 0x18, 0x5d, 0x55,
-  0xab, 0xb2, 0xd4, 0xaa, 0xaa, 0xfe, 0xb6, 0xaa, 0xcb, 0x55, 0x7d, 0x3d,
-  0x9a, 0x3c, 0x78, 0xf2, 0x44, 0xac, 0x37, 0x2f, 0xe5, 0x26, 0xc9, 0xa4,
-  0xd8, 0x64, 0xa9, 0x30, 0xc0, 0xc1, 0x4c, 0x56, 0x2a, 0x16, 0x45, 0x2e,
-  0x9e, 0xcb, 0x9b, 0x24, 0x16, 0xcf, 0xf5, 0xb6, 0x8a, 0x65, 0xaa, 0xc4,
-  0x4b, 0x59, 0x2f, 0x5f, 0xbe, 0x10, 0xa5, 0x4e, 0xf2, 0x3a, 0xc9, 0x17,
-  0x44, 0xe0, 0x59, 0x1e, 0x6b, 0xf5, 0x9b, 0xf8, 0x47, 0x11, 0x17, 0x65,
-  0x72, 0xa3, 0xa2, 0xa9, 0x10, 0x8f, 0xcf, 0xcf, 0x3f, 0x0f, 0x1f, 0x9f,
-  0x5f, 0x7c, 0x8e, 0xcf, 0xbf, 0x59, 0xe5, 0xb5, 0xd2, 0xe2, 0xbf, 0xfe,
-  0xf7, 0x7f, 0xf2, 0x64, 0x51, 0x65, 0x32, 0xcf, 0xa7, 0x02, 0x9f, 0x21,
-  0xc0, 0x17, 0x08, 0x20, 0x5e, 0xfd, 0xf0, 0xfc, 0xe7, 0xf0, 0x45, 0x12,
-  0xa9, 0xbc, 0x52, 0xe1, 0x77, 0xb1, 0x02, 0xda, 0xf3, 0x44, 0xe9, 0x4b,
-  0xf1, 0xcd, 0x0f, 0x2f, 0xc2, 0xc7, 0xa7, 0xe7, 0x8f, 0x1e, 0x20, 0x18,
-  0xf3, 0x0e, 0x2d, 0x6f, 0x1c, 0xfa, 0x4a, 0x2b, 0x59, 0x83, 0xa0, 0xb3,
-  0x6d, 0x57, 0xd0, 0xe0, 0xf9, 0xcb, 0xe7, 0x93, 0xa9, 0x78, 0xae, 0x22,
-  0x95, 0xcd, 0x80, 0x3b, 0x48, 0xf4, 0xf8, 0xec, 0x7b, 0x99, 0xaf, 0xa4,
-  0xde, 0xe2, 0xcd, 0x67, 0x80, 0x8e, 0x14, 0xa2, 0xb4, 0xa8, 0x54, 0xba,
-  0x15, 0x6e, 0xc2, 0xf5, 0x52, 0x89, 0x42, 0x27, 0x8b, 0x24, 0x97, 0xa9,
-  0x78, 0xad, 0x7e, 0x16, 0x51, 0x91, 0xdf, 0x28, 0x5d, 0x25, 0xf0, 0x2c,
-  0x2a, 0x62, 0x25, 0x92, 0x5c, 0x64, 0x32, 0xaa, 0xd5, 0xe6, 0x34, 0x4d,
-  0xaa, 0x72, 0x8a, 0x44, 0x40, 0x6b, 0x62, 0xbd, 0x4c, 0xa2, 0x25, 0x61,
-  0xcf, 0x8b, 0x34, 0x2d, 0xd6, 0x20, 0xa1, 0x88, 0xb4, 0x8a, 0x93, 0xba,
-  0x12, 0xb2, 0x2c, 0xd3, 0xed, 0x25, 0x4d, 0x55, 0x04, 0xd1, 0x04, 0xe8,
-  0x94, 0x5b, 0x60, 0xb1, 0xac, 0xc5, 0xc5, 0x7f, 0x7c, 0xf1, 0xef, 0x53,
-  0xf1, 0x23, 0xa0, 0x4a, 0x1d, 0x8b, 0xef, 0x4f, 0xc5, 0xd7, 0x30, 0x1f,
-  0x50, 0x11, 0xc3, 0x82, 0xb2, 0xd2, 0x14, 0xa0, 0xb5, 0x56, 0x51, 0x0d,
-  0x02, 0x00, 0xa5, 0x3c, 0x16, 0x32, 0x06, 0xa2, 0x78, 0x77, 0xc9, 0xaa,
-  0xdf, 0x8a, 0x6f, 0x74, 0xf1, 0x7b, 0x42, 0x5a, 0x3d, 0xbf, 0x60, 0x4c,
-  0x0b, 0x03, 0x73, 0xf0, 0xc0, 0xbf, 0x5f, 0xc5, 0x72, 0x29, 0x5e, 0x26,
-  0xe9, 0x42, 0xcb, 0x4c, 0x04, 0xdf, 0xbf, 0x04, 0x0d, 0xbd, 0x52, 0x65,
-  0xed, 0x54, 0xd4, 0xc7, 0xf6, 0x98, 0x5f, 0x8a, 0xbf, 0x48, 0x5d, 0x83,
-  0x1a, 0x7e, 0x4a, 0x52, 0x98, 0xba, 0x08, 0xfe, 0xf2, 0xe2, 0x27, 0x20,
-  0xf0, 0xb7, 0xa8, 0x2e, 0x7c, 0xf4, 0x97, 0xaa, 0x5e, 0x16, 0xf1, 0x25,
-  0x2d, 0xd9, 0x0f, 0xba, 0x88, 0x57, 0x11, 0xaa, 0x62, 0x4d, 0xd6, 0xa5,
-  0x8b, 0x4c, 0x48, 0x61, 0xec, 0x2d, 0x41, 0xb3, 0x40, 0x1e, 0x6a, 0x43,
-  0x56, 0x89, 0x1a, 0x06, 0xb2, 0x71, 0x91, 0x2b, 0x58, 0x50, 0x44, 0x97,
-  0x42, 0x2b, 0xd4, 0x3d, 0xc0, 0x14, 0x73, 0xd2, 0x6d, 0x29, 0x61, 0x25,
-  0x80, 0x5c, 0xa9, 0x8b, 0x08, 0x50, 0x4e, 0x85, 0xf8, 0x7a, 0x95, 0xc7,
-  0x32, 0x03, 0x93, 0x01, 0x55, 0x6d, 0xa7, 0x42, 0x22, 0x5e, 0xad, 0x65,
-  0x1b, 0xcd, 0xe3, 0x50, 0x6b, 0xa5, 0x90, 0x4d, 0x49, 0xa2, 0xb1, 0xed,
-  0x10, 0x65, 0x5d, 0xa0, 0x56, 0x68, 0x3d, 0xd7, 0x49, 0xbd, 0xc4, 0x45,
-  0xd3, 0x05, 0x18, 0x1b, 0x2c, 0x88, 0xa8, 0x56, 0xb3, 0xaa, 0x4e, 0xea,
-  0x55, 0xb3, 0x08, 0xa0, 0x94, 0x62, 0x91, 0x93, 0x96, 0x0c, 0x13, 0x44,
-  0x4c, 0xf2, 0x79, 0xb2, 0x11, 0x67, 0x40, 0x4c, 0x99, 0x8b, 0xa2, 0xaa,
-  0xf9, 0x0a, 0xb6, 0x55, 0xb4, 0xc4, 0x4b, 0xad, 0x52, 0xc9, 0x74, 0x00,
-  0xb5, 0xda, 0x66, 0xb3, 0x22, 0x85, 0x79, 0xfc, 0x43, 0xea, 0xa4, 0x58,
-  0x55, 0x64, 0x92, 0x4b, 0x99, 0x2f, 0x14, 0xb0, 0xd1, 0x0a, 0xb0, 0xc0,
-  0xe2, 0xea, 0x02, 0xe8, 0x83, 0xc8, 0x15, 0xfe, 0xc2, 0xee, 0x34, 0x9b,
-  0x70, 0x0d, 0xcb, 0x20, 0xd2, 0xe4, 0x9d, 0x22, 0xf9, 0x61, 0x7e, 0xab,
-  0xb4, 0xae, 0x4e, 0x41, 0xef, 0x81, 0xb7, 0xe5, 0xd7, 0x1b, 0x50, 0x7c,
-  0x58, 0xd5, 0xb0, 0x72, 0x67, 0xb8, 0xe1, 0x91, 0xc1, 0x6b, 0x24, 0x06,
-  0xff, 0xe4, 0x0a, 0x75, 0x88, 0x1b, 0x02, 0x38, 0x64, 0x12, 0x08, 0xcd,
-  0x13, 0xd8, 0x3a, 0x38, 0xbd, 0x38, 0xc1, 0x55, 0x2f, 0xe0, 0x51, 0x0e,
-  0xca, 0xad, 0x98, 0x2f, 0xec, 0x84, 0x5a, 0x82, 0xf9, 0x57, 0xa5, 0x8a,
-  0x12, 0xb4, 0x0d, 0x30, 0x5a, 0xdc, 0x09, 0x9a, 0xc4, 0x5e, 0x17, 0xfa,
-  0x9d, 0x80, 0xc5, 0x00, 0x53, 0x00, 0xe3, 0x8f, 0x8b, 0x35, 0xc8, 0x12,
-  0xa0, 0x56, 0xf3, 0x07, 0x42, 0x1c, 0x3e, 0xaa, 0x66, 0x51, 0x2a, 0x82,
-  0x4a, 0xd5, 0x73, 0x51, 0xcd, 0xc2, 0x24, 0x2b, 0xd3, 0xcb, 0xcb, 0x93,
-  0x58, 0xcd, 0x25, 0x48, 0x1d, 0xaa, 0x0d, 0x9b, 0x42, 0xc8, 0x92, 0x9f,
-  0x88, 0xcb, 0xbf, 0xbf, 0xfe, 0x3a, 0xfc, 0x02, 0xc4, 0x85, 0x0d, 0x93,
-  0xe4, 0x61, 0x29, 0xa3, 0x77, 0x72, 0xa1, 0xc4, 0x65, 0x46, 0xa6, 0xc3,
-  0xe3, 0xb1, 0x8a, 0x52, 0xd0, 0x51, 0x58, 0x17, 0xe5, 0x03, 0xdc, 0x58,
-  0x56, 0xac, 0xb4, 0x28, 0x05, 0xac, 0x9c, 0x38, 0x4a, 0x72, 0x94, 0x70,
-  0x42, 0x0f, 0x4f, 0xd0, 0x04, 0x04, 0x6b, 0x23, 0x9d, 0x95, 0xe6, 0x4a,
-  0xcf, 0xca, 0x09, 0x11, 0x03, 0xf9, 0xff, 0x5e, 0x81, 0x12, 0x0b, 0x9c,
-  0x40, 0x8c, 0x66, 0x06, 0x16, 0xb5, 0x54, 0x15, 0x68, 0x09, 0x37, 0x37,
-  0xc8, 0xa4, 0xc1, 0x3d, 0x55, 0x68, 0x2c, 0x46, 0x66, 0x94, 0x00, 0x66,
-  0xf3, 0x5e, 0x1c, 0xa5, 0xd9, 0x06, 0xf9, 0x88, 0xc3, 0x37, 0xc1, 0xa4,
-  0x19, 0xd5, 0xfe, 0x28, 0x73, 0x78, 0x26, 0xe6, 0x6a, 0x2d, 0x6e, 0x60,
-  0xa5, 0xe5, 0x2c, 0x05, 0x62, 0xeb, 0x25, 0xf8, 0x1e, 0xb8, 0x4f, 0x57,
-  0x4a, 0x44, 0x32, 0x17, 0x33, 0x85, 0x2a, 0x9e, 0x27, 0x8b, 0x15, 0xf8,
-  0x0d, 0xde, 0x2c, 0xd6, 0x39, 0xf3, 0x7c, 0xe7, 0x80, 0x2b, 0x4e, 0xd6,
-  0x9b, 0xb0, 0x4c, 0x8b, 0x3a, 0xcc, 0x57, 0xd9, 0x89, 0x38, 0x17, 0xa3,
-  0xd7, 0xb0, 0xfa, 0x95, 0xd2, 0x38, 0x75, 0x18, 0xc2, 0xad, 0x68, 0xac,
-  0x3e, 0x5a, 0x69, 0x9c, 0x86, 0x40, 0xe8, 0xd1, 0xc4, 0x23, 0x71, 0xb4,
-  0xde, 0xe0, 0x4a, 0xe3, 0xd2, 0x8a, 0xd1, 0x88, 0x29, 0xb8, 0x81, 0x0e,
-  0xb2, 0x0b, 0x0f, 0xb8, 0xbe, 0xd5, 0x52, 0xa9, 0x1e, 0x29, 0xb0, 0x95,
-  0x16, 0xa5, 0xc6, 0x76, 0x76, 0xd3, 0x01, 0xdb, 0x05, 0x25, 0x24, 0x79,
-  0x97, 0x9e, 0xcc, 0x01, 0xac, 0x56, 0x6f, 0xe5, 0x0a, 0x56, 0x36, 0x95,
-  0x60, 0x82, 0x49, 0x2a, 0x46, 0xcf, 0xe0, 0x0e, 0x86, 0x93, 0x08, 0xf7,
-  0xb9, 0xc0, 0xf1, 0x19, 0x18, 0x05, 0xd8, 0xf0, 0x5a, 0x30, 0x02, 0x6e,
-  0xa9, 0x2f, 0x5b, 0xb4, 0xd6, 0x1b, 0x58, 0x53, 0xfd, 0x15, 0xa8, 0xf4,
-  0x79, 0xa2, 0x9d, 0x78, 0x69, 0x11, 0x11, 0x70, 0x23, 0x51, 0x5a, 0x14,
-  0xef, 0xec, 0x3a, 0xe3, 0xc0, 0x71, 0x65, 0xd6, 0x81, 0x94, 0xd2, 0x13,
-  0x71, 0xbd, 0xf9, 0x56, 0xa5, 0xe5, 0x6e, 0x92, 0x95, 0x92, 0x3a, 0x02,
-  0xfb, 0x21, 0xaa, 0x4b, 0x00, 0xbf, 0x8b, 0x14, 0xc3, 0xbf, 0x80, 0x48,
-  0xf2, 0xc2, 0x12, 0xb9, 0x27, 0x55, 0x8c, 0x3e, 0xc3, 0x54, 0x41, 0x87,
-  0xb8, 0xe4, 0x6f, 0xab, 0xe4, 0x77, 0x25, 0x8e, 0x83, 0x20, 0x03, 0xd0,
-  0x5a, 0x54, 0xb0, 0xe7, 0x26, 0xe2, 0x8b, 0xf3, 0x73, 0xf1, 0x6f, 0xe7,
-  0xe7, 0x13, 0x63, 0x36, 0x08, 0x01, 0x0b, 0x8e, 0x5a, 0x44, 0x94, 0xaa,
-  0x4b, 0x87, 0x15, 0x62, 0xe3, 0x5f, 0xcd, 0x58, 0x4e, 0x1e, 0x33, 0xee,
-  0x90, 0x4a, 0xda, 0x76, 0x5d, 0x2c, 0x88, 0xd1, 0x71, 0x58, 0xe4, 0xe9,
-  0x36, 0x94, 0xe0, 0x82, 0x17, 0xb9, 0xe0, 0x9f, 0x0e, 0xa7, 0x75, 0x12,
-  0x2f, 0x54, 0x5d, 0xf5, 0x58, 0xfd, 0xc4, 0xe3, 0x96, 0x57, 0xc3, 0x1c,
-  0xb6, 0xe6, 0x0a, 0x63, 0xc1, 0x69, 0x57, 0x66, 0x74, 0xd6, 0x91, 0x4e,
-  0x4a, 0x40, 0xc2, 0x5d, 0x2a, 0xc4, 0xe8, 0x47, 0x76, 0xd6, 0x30, 0x57,
-  0x08, 0xe8, 0xe0, 0x0c, 0xb7, 0x29, 0xbb, 0x74, 0x86, 0x1a, 0xd4, 0x5d,
-  0x99, 0x2f, 0x22, 0x99, 0xe8, 0x82, 0x8d, 0x0f, 0x7d, 0xc3, 0x22, 0x5f,
-  0xe1, 0x13, 0x30, 0x0e, 0xf7, 0x0c, 0x9c, 0x56, 0x46, 0x79, 0x02, 0xae,
-  0x87, 0xd3, 0x61, 0x63, 0x84, 0x99, 0x4f, 0xb1, 0x48, 0xe3, 0xb7, 0x86,
-  0x06, 0x12, 0x05, 0xa7, 0xc0, 0x5e, 0xe1, 0x3f, 0xab, 0x48, 0x96, 0xe0,
-  0x75, 0x53, 0x76, 0xa8, 0xc6, 0xd7, 0xe6, 0x0a, 0x5c, 0x80, 0xc2, 0x47,
-  0x18, 0xee, 0xc0, 0xe9, 0xfe, 0xfc, 0xf2, 0x85, 0xa1, 0xba, 0xca, 0x8d,
-  0xf7, 0x82, 0x68, 0x02, 0x93, 0xd1, 0x08, 0x10, 0x6c, 0xc8, 0xcd, 0x81,
-  0xb3, 0x9c, 0x83, 0x03, 0xa2, 0xb1, 0x52, 0xc0, 0xd8, 0x41, 0x90, 0x2a,
-  0x70, 0xa7, 0x41, 0x50, 0x67, 0x65, 0xb8, 0xb1, 0x8f, 0x42, 0x17, 0xcf,
-  0x60, 0xd7, 0x3e, 0x94, 0x59, 0xf9, 0x64, 0x04, 0x7e, 0xea, 0x21, 0x20,
-  0x00, 0x86, 0xe0, 0xbf, 0x5d, 0x18, 0x69, 0x4d, 0x08, 0x57, 0x82, 0x60,
-  0xee, 0x89, 0xb4, 0x60, 0xa4, 0xeb, 0x3f, 0x85, 0x74, 0x78, 0xf1, 0x19,
-  0x61, 0xfd, 0xa8, 0xea, 0x95, 0xce, 0x3f, 0x0a, 0xf5, 0x45, 0x92, 0xab,
-  0x39, 0x6a, 0xf3, 0x63, 0x90, 0xff, 0xaa, 0xd6, 0x29, 0xe0, 0x5b, 0x5c,
-  0x42, 0xe6, 0xeb, 0x07, 0x4c, 0x64, 0xe3, 0xe2, 0xc7, 0x33, 0xcc, 0xfa,
-  0xc8, 0xe5, 0xad, 0xc0, 0xeb, 0x60, 0x48, 0x8d, 0x8a, 0x2c, 0x5b, 0xe5,
-  0xe0, 0xb1, 0x80, 0xe4, 0x1a, 0x17, 0x15, 0xc6, 0x62, 0xd8, 0xb5, 0xe8,
-  0xd3, 0x12, 0xce, 0x34, 0x21, 0x30, 0xd7, 0xab, 0x6a, 0x26, 0x29, 0x7f,
-  0x4c, 0xab, 0x9a, 0x49, 0xb5, 0x9c, 0x37, 0xe7, 0x25, 0x68, 0xee, 0x7a,
-  0x95, 0xe7, 0x98, 0xf8, 0x3a, 0x33, 0x40, 0x63, 0x77, 0x04, 0x82, 0x87,
-  0x90, 0x02, 0xd4, 0x86, 0x22, 0x8b, 0x77, 0xf8, 0x28, 0x22, 0x2f, 0x11,
-  0xcc, 0x93, 0x3c, 0xa9, 0x96, 0x61, 0x41, 0x79, 0xbf, 0xb1, 0x14, 0xbf,
-  0x2e, 0xb0, 0x44, 0xae, 0x6f, 0xe5, 0xd5, 0x99, 0x77, 0x37, 0x1e, 0x89,
-  0xa0, 0x6b, 0x6b, 0x0f, 0x0e, 0xf0, 0x8f, 0x35, 0x48, 0x89, 0xad, 0x38,
-  0x3e, 0xaa, 0xc0, 0x5f, 0xc2, 0x34, 0x2d, 0xf3, 0xc9, 0x7e, 0xf6, 0x68,
-  0xfe, 0x4f, 0x60, 0xaa, 0x3f, 0x41, 0xaa, 0x05, 0xe3, 0x9c, 0xe0, 0xa0,
-  0xc2, 0x30, 0xfb, 0x50, 0x79, 0x54, 0x50, 0xd1, 0x80, 0xa6, 0x8d, 0x1a,
-  0xc4, 0xbc, 0xbb, 0xc9, 0x36, 0x44, 0x46, 0xb9, 0x73, 0x24, 0x41, 0xd1,
-  0x44, 0xc4, 0x78, 0x04, 0x50, 0x6f, 0x55, 0x63, 0xf0, 0x57, 0x55, 0x59,
-  0xe4, 0x31, 0x22, 0xa3, 0xc3, 0xb0, 0xc9, 0x08, 0x0a, 0x14, 0x20, 0x79,
-  0x96, 0x0a, 0xc6, 0x3f, 0x7b, 0x3c, 0x31, 0x29, 0x09, 0x1a, 0x81, 0x92,
-  0x59, 0x37, 0x11, 0x11, 0x27, 0x55, 0x11, 0xbd, 0x53, 0x75, 0x08, 0xf3,
-  0xcb, 0x39, 0x0d, 0x3e, 0x99, 0xf0, 0x36, 0x55, 0xf5, 0xe5, 0xaa, 0x9e,
-  0x63, 0x8e, 0xb2, 0x8b, 0x6e, 0xb4, 0x02, 0x89, 0xb2, 0x26, 0xd1, 0x41,
-  0x7f, 0x1d, 0xe2, 0xf4, 0x50, 0xba, 0x93, 0x2e, 0x25, 0x9e, 0xcc, 0x6a,
-  0x3e, 0x4f, 0x31, 0x13, 0xc8, 0x4a, 0x00, 0xd6, 0x61, 0x5e, 0xd4, 0xe0,
-  0xe2, 0x17, 0x69, 0x31, 0xc3, 0xc8, 0xe7, 0xe5, 0x52, 0x94, 0xff, 0x24,
-  0x90, 0xc7, 0x43, 0x3e, 0x05, 0x72, 0x5f, 0x66, 0x84, 0x88, 0xa2, 0x9a,
-  0x84, 0x5f, 0x98, 0x07, 0x2d, 0x52, 0x13, 0xe7, 0x9c, 0x64, 0x84, 0xee,
-  0xad, 0x08, 0xd7, 0x52, 0xe7, 0xe4, 0x43, 0x70, 0xce, 0x76, 0xe5, 0x88,
-  0xc5, 0xaf, 0x01, 0xa4, 0xa2, 0x31, 0x62, 0xce, 0x40, 0x89, 0xb0, 0xf0,
-  0x41, 0x40, 0xce, 0xd3, 0xa1, 0x1c, 0x1e, 0x1b, 0xa6, 0x66, 0x00, 0xf6,
-  0xc7, 0x81, 0x93, 0xa7, 0xc5, 0xb6, 0x0f, 0xea, 0x36, 0xe2, 0xd4, 0xe7,
-  0xcb, 0x3a, 0xfc, 0x15, 0xdd, 0x16, 0x78, 0x2d, 0xab, 0x3e, 0x5b, 0xb8,
-  0x86, 0x10, 0xfd, 0xa2, 0x77, 0x21, 0xa4, 0x47, 0x0a, 0x6d, 0x8a, 0xd6,
-  0x43, 0xd4, 0x93, 0x49, 0x8b, 0x46, 0x18, 0x80, 0x37, 0x26, 0xf9, 0x89,
-  0xd8, 0x04, 0xa8, 0x51, 0x1a, 0x6a, 0x80, 0x6c, 0xf2, 0x88, 0x1b, 0x88,
-  0x42, 0x93, 0x8d, 0x57, 0xa1, 0x0d, 0x31, 0xc1, 0x8d, 0xd9, 0x22, 0xc6,
-  0x77, 0xc6, 0x17, 0x22, 0x80, 0x44, 0x9e, 0x93, 0xfd, 0xc3, 0x37, 0xa7,
-  0xe2, 0xc6, 0x08, 0x1f, 0x6c, 0x15, 0x6e, 0x3c, 0xf4, 0x1c, 0xea, 0xbd,
-  0xb8, 0x81, 0x64, 0x2c, 0xbe, 0xb0, 0x8f, 0xe2, 0xc7, 0x5d, 0x24, 0x71,
-  0x49, 0x69, 0xb8, 0x08, 0x2e, 0x1e, 0x11, 0x9c, 0x01, 0xcc, 0x20, 0xab,
-  0x5e, 0x7a, 0x44, 0xcc, 0x63, 0x11, 0x3f, 0xb6, 0x10, 0xb4, 0xaf, 0x3b,
-  0x00, 0xf0, 0x70, 0x62, 0x7d, 0x50, 0x40, 0xf1, 0xfd, 0xb8, 0x15, 0xe7,
-  0x03, 0xac, 0x94, 0x54, 0x88, 0x35, 0xd6, 0x02, 0xbc, 0x11, 0x0a, 0xda,
-  0x1b, 0x24, 0xce, 0x13, 0xdc, 0x2e, 0xf5, 0xa4, 0x51, 0x0b, 0xc5, 0x2c,
-  0xd6, 0xc8, 0x5b, 0xc8, 0x41, 0x01, 0x16, 0x4c, 0x9b, 0x02, 0xd6, 0xdd,
-  0xcf, 0xdf, 0x5a, 0xd5, 0x59, 0x38, 0xb3, 0xa9, 0xa8, 0xba, 0x09, 0x39,
-  0xc3, 0x3d, 0xee, 0x22, 0x41, 0x0e, 0x62, 0x83, 0xf9, 0xc8, 0x5f, 0x14,
-  0xf0, 0x6a, 0xb3, 0x55, 0x02, 0xd1, 0x12, 0xaa, 0xa9, 0x42, 0x04, 0xcd,
-  0x5a, 0xc0, 0x52, 0x18, 0x85, 0x27, 0x1b, 0x50, 0x59, 0x94, 0x86, 0xe8,
-  0x69, 0x2f, 0x4f, 0xcc, 0xf2, 0x11, 0x52, 0x58, 0x27, 0x99, 0x3a, 0x61,
-  0xcd, 0x59, 0xd5, 0xce, 0x93, 0xf9, 0xbd, 0xc0, 0x63, 0xf0, 0xcb, 0xb0,
-  0x09, 0x56, 0xfa, 0x5e, 0xd0, 0xe0, 0xb6, 0x40, 0x14, 0xf0, 0x5b, 0x3a,
-  0xbe, 0x8f, 0x28, 0x49, 0x8e, 0x91, 0x05, 0x14, 0x83, 0xfb, 0xf3, 0x1e,
-  0x08, 0x0c, 0x58, 0xa1, 0xf4, 0x1a, 0x56, 0x75, 0x27, 0x82, 0x33, 0x84,
-  0xc6, 0xa7, 0x77, 0x73, 0xb4, 0x4b, 0x71, 0x2b, 0xd1, 0x9d, 0x77, 0xb3,
-  0xb3, 0x01, 0x54, 0xca, 0xaa, 0xfa, 0x99, 0x97, 0x47, 0xa1, 0x9d, 0xab,
-  0x0d, 0x90, 0x18, 0xe6, 0x7d, 0x82, 0x19, 0x3d, 0x66, 0xd6, 0x76, 0xa7,
-  0x9d, 0xdc, 0x8d, 0x4a, 0xf3, 0x13, 0x31, 0x84, 0x4e, 0xc0, 0xfe, 0x7c,
-  0x7a, 0x7c, 0x1e, 0x87, 0xb7, 0x8f, 0xbd, 0x1f, 0xc1, 0x3f, 0x97, 0xad,
-  0x1f, 0x60, 0x62, 0x9d, 0x0a, 0x19, 0x0a, 0xaf, 0x3f, 0x2e, 0x2b, 0x2d,
-  0x96, 0x59, 0x03, 0xa3, 0xd9, 0x01, 0xde, 0xdf, 0x42, 0xb5, 0x2e, 0xea,
-  0x6d, 0xa9, 0xfa, 0x12, 0x43, 0xa9, 0x56, 0x0f, 0x89, 0xfb, 0x6a, 0x5b,
-  0xd5, 0x2a, 0x73, 0x48, 0xfc, 0x0f, 0xc5, 0xcd, 0xaa, 0x98, 0xd7, 0x6b,
-  0xaa, 0x4f, 0xe1, 0xd9, 0xc4, 0xbb, 0xb7, 0x6a, 0x03, 0xa3, 0x90, 0xd1,
-  0x12, 0xb2, 0x0b, 0x86, 0x18, 0x20, 0x8e, 0x65, 0x81, 0xc0, 0x52, 0x59,
-  0x51, 0x83, 0x83, 0x5c, 0x89, 0x2f, 0x1e, 0x6e, 0xfc, 0x32, 0x6c, 0x03,
-  0xfc, 0x29, 0x62, 0x9d, 0x05, 0x1a, 0xa4, 0x67, 0xc5, 0x1d, 0x20, 0x79,
-  0x3b, 0xbe, 0x1d, 0x5b, 0x43, 0x83, 0xbc, 0x38, 0x89, 0x95, 0xb4, 0xe5,
-  0x63, 0x53, 0x04, 0x42, 0xb6, 0x83, 0x01, 0x3e, 0xa9, 0x2e, 0x6f, 0xc7,
-  0x58, 0x8f, 0xb9, 0x1a, 0x97, 0x45, 0x00, 0x40, 0xcb, 0xbe, 0x55, 0xaf,
-  0x0d, 0x2d, 0x0f, 0xd6, 0x51, 0x2d, 0x78, 0x53, 0x88, 0x19, 0xd9, 0x46,
-  0x8d, 0x1b, 0xc9, 0x9c, 0x23, 0x59, 0xbc, 0xd5, 0xaa, 0x2c, 0xd0, 0xed,
-  0xf6, 0xf2, 0x1e, 0xbf, 0x94, 0x90, 0x02, 0xb2, 0xac, 0x72, 0x89, 0xe5,
-  0xa5, 0x20, 0x07, 0x25, 0xd0, 0xed, 0x61, 0x5e, 0xcf, 0x30, 0x53, 0xd3,
-  0xe0, 0x8b, 0x0b, 0xea, 0x86, 0x60, 0x67, 0x06, 0xfe, 0x4b, 0x05, 0x69,
-  0x65, 0x93, 0x39, 0x2c, 0x48, 0x17, 0xd4, 0x42, 0x38, 0x05, 0xf1, 0x7a,
-  0xec, 0xbe, 0x9b, 0x0b, 0xd0, 0x44, 0x93, 0xdc, 0x00, 0xcf, 0x86, 0x08,
-  0xb0, 0x85, 0x20, 0x35, 0x03, 0xc5, 0x4f, 0x45, 0x52, 0x9b, 0x06, 0xd5,
-  0x4c, 0xce, 0x20, 0xbd, 0x72, 0x0d, 0x33, 0x98, 0x0c, 0x36, 0x58, 0x44,
-  0x05, 0xd6, 0x0c, 0x9b, 0x63, 0x46, 0x45, 0x4c, 0x96, 0xd4, 0xd8, 0x01,
-  0x05, 0x3a, 0x5a, 0x0d, 0xb2, 0xbd, 0x1d, 0x63, 0x21, 0xe5, 0x91, 0x80,
-  0x4d, 0x25, 0xb1, 0xdd, 0x49, 0xd3, 0xbe, 0x91, 0x49, 0x8a, 0xdd, 0x08,
-  0x21, 0xeb, 0x21, 0x64, 0xbc, 0x5d, 0xd6, 0x75, 0x59, 0x5d, 0x9e, 0x9d,
-  0x55, 0xb0, 0x87, 0x22, 0x05, 0xcf, 0x16, 0xea, 0x34, 0x57, 0xf5, 0x59,
-  0x79, 0xc6, 0x9e, 0xe4, 0x0c, 0x88, 0x56, 0x43, 0xc8, 0xaf, 0x48, 0x3a,
-  0xe2, 0xc9, 0x6b, 0x40, 0xfd, 0x93, 0xa6, 0x3d, 0x8a, 0x3a, 0x3b, 0xe6,
-  0x16, 0xae, 0x78, 0x9d, 0x60, 0x9e, 0x75, 0x0c, 0x55, 0x6d, 0xfe, 0x8e,
-  0xdb, 0xb0, 0x40, 0xa3, 0x94, 0x8b, 0xe1, 0x39, 0xbd, 0x2e, 0x0c, 0xc5,
-  0x96, 0x72, 0xa6, 0xa4, 0xdf, 0x0c, 0x72, 0x06, 0xb1, 0x04, 0xff, 0x06,
-  0xcf, 0x5e, 0x35, 0x22, 0x0b, 0x19, 0x91, 0xde, 0x4f, 0xd1, 0x68, 0xfb,
-  0x14, 0x9f, 0x59, 0xf5, 0xdb, 0xc5, 0x6c, 0xcc, 0x81, 0xd2, 0x79, 0x6a,
-  0x56, 0xce, 0x65, 0xa4, 0x3a, 0x4b, 0xe3, 0x6c, 0x08, 0xf8, 0x0f, 0x8b,
-  0xea, 0x17, 0xcc, 0x9f, 0xa2, 0xfe, 0x05, 0x64, 0xca, 0xab, 0xd9, 0x29,
-  0x64, 0x55, 0x67, 0x96, 0x5e, 0x18, 0xab, 0x1b, 0x95, 0x16, 0x25, 0xec,
-  0xd0, 0x33, 0xeb, 0xd7, 0xcf, 0x92, 0xaa, 0x5a, 0xa9, 0xea, 0x4b, 0xde,
-  0x80, 0xb0, 0xc3, 0x9e, 0xc6, 0x50, 0x46, 0x3e, 0xac, 0x40, 0x59, 0x4f,
-  0x23, 0x6e, 0x97, 0x3f, 0xc4, 0x34, 0x5d, 0x3d, 0x05, 0xbc, 0xfc, 0xa3,
-  0x97, 0x0d, 0x0a, 0x23, 0x41, 0x9c, 0x86, 0x97, 0x6c, 0x88, 0xee, 0x0f,
-  0xa9, 0xc2, 0x69, 0x53, 0x0a, 0x07, 0xc6, 0x0b, 0x0f, 0x9c, 0x01, 0x03,
-  0x59, 0x30, 0x7b, 0xda, 0x1f, 0x9a, 0x18, 0xaf, 0x25, 0x28, 0x27, 0xc5,
-  0xf4, 0x6c, 0x6b, 0x84, 0x50, 0xf1, 0x6e, 0xb2, 0x49, 0x1e, 0xa5, 0xab,
-  0x58, 0x75, 0x3a, 0xf0, 0x98, 0x42, 0xe8, 0xcc, 0xb4, 0x51, 0xb0, 0xab,
-  0xeb, 0x38, 0x30, 0xd5, 0xcb, 0x21, 0x8a, 0xe1, 0xa7, 0xfc, 0x35, 0x04,
-  0x5b, 0x79, 0xcc, 0xbf, 0x9e, 0x49, 0x2b, 0x61, 0x3b, 0x81, 0xff, 0x84,
-  0xb5, 0x84, 0x92, 0xe2, 0x38, 0x18, 0x5d, 0xdd, 0x5c, 0x8f, 0xa0, 0xaa,
-  0x3b, 0x83, 0x9f, 0x56, 0xb6, 0xcb, 0x95, 0xdc, 0x02, 0x13, 0xa9, 0x8d,
-  0x28, 0xfd, 0x86, 0x01, 0xe5, 0x69, 0xd8, 0x30, 0x10, 0x01, 0x3e, 0xc6,
-  0xa7, 0x03, 0x98, 0x52, 0x6b, 0xcc, 0x90, 0x36, 0x22, 0x15, 0x5a, 0x3c,
-  0x94, 0xab, 0x8d, 0x98, 0x7b, 0x44, 0x20, 0x37, 0x3d, 0xce, 0xde, 0x73,
-  0x45, 0x18, 0x44, 0x12, 0x84, 0xa2, 0x62, 0x9b, 0xdb, 0xa1, 0x73, 0x1c,
-  0x8a, 0x35, 0xb5, 0x24, 0x4c, 0xe1, 0x0c, 0x23, 0xad, 0x81, 0xd4, 0x94,
-  0x9a, 0x08, 0x0b, 0x54, 0xd0, 0xfd, 0xa6, 0x26, 0xb5, 0x1d, 0x5d, 0x25,
-  0xd7, 0x57, 0x25, 0xce, 0xc6, 0x0d, 0x9c, 0xe1, 0xed, 0x83, 0x03, 0x5b,
-  0xcb, 0x1f, 0x67, 0xd4, 0xb2, 0xb5, 0xbf, 0x4d, 0xb0, 0x6a, 0xb8, 0xcb,
-  0x86, 0xd9, 0x20, 0x2b, 0x54, 0x1c, 0xb0, 0xd1, 0xa4, 0x34, 0x5b, 0xe0,
-  0x5a, 0x6e, 0x38, 0x4a, 0x8d, 0xe5, 0x63, 0x8c, 0x2c, 0xb4, 0xaf, 0x6c,
-  0xda, 0xc5, 0x2c, 0x20, 0x15, 0xcc, 0xb1, 0x08, 0xb6, 0xf5, 0x32, 0x21,
-  0x9a, 0x19, 0x3a, 0x32, 0x9a, 0x65, 0x76, 0x0d, 0x88, 0x86, 0xfa, 0xd5,
-  0x59, 0x82, 0x1c, 0x70, 0xe9, 0xa6, 0xbc, 0x70, 0xc2, 0x46, 0x35, 0x43,
-  0x37, 0xa5, 0x81, 0x56, 0xed, 0x86, 0x2d, 0x7b, 0x5c, 0x74, 0x28, 0x58,
-  0xc0, 0x4d, 0xc1, 0x05, 0x23, 0xfc, 0xfa, 0x6b, 0xc0, 0x42, 0xe0, 0x23,
-  0xae, 0x06, 0xa6, 0x53, 0x84, 0x98, 0x4e, 0x11, 0xa6, 0x93, 0x6a, 0x1b,
-  0xb8, 0x36, 0x89, 0xa0, 0x21, 0xed, 0x6a, 0x7b, 0x00, 0x98, 0x78, 0xb7,
-  0x44, 0xca, 0xa7, 0xd5, 0x6f, 0xa3, 0x04, 0xb9, 0x5a, 0x9b, 0xfe, 0x54,
-  0x91, 0xc6, 0xd4, 0x0d, 0xdf, 0xb0, 0xdd, 0xd0, 0x61, 0x08, 0x54, 0x47,
-  0xbe, 0x06, 0xed, 0x98, 0x57, 0x36, 0x39, 0xac, 0x89, 0x67, 0x67, 0xf9,
-  0x2a, 0x4d, 0x1b, 0x02, 0x62, 0x63, 0x57, 0x9a, 0xe5, 0x52, 0x39, 0x46,
-  0x93, 0x63, 0xd7, 0xaa, 0x20, 0xf2, 0x5c, 0x39, 0x6d, 0xa0, 0x3e, 0x6b,
-  0x18, 0xd3, 0x23, 0x27, 0xa0, 0x85, 0xec, 0xcd, 0xa1, 0x37, 0x85, 0x07,
-  0xae, 0xfb, 0xe1, 0x11, 0xc6, 0x92, 0xcc, 0x91, 0xa6, 0x3f, 0xae, 0xe5,
-  0xbf, 0xa6, 0xdc, 0x7d, 0xad, 0x38, 0x1e, 0x91, 0x6b, 0x32, 0xd6, 0x53,
-  0x99, 0x7c, 0x02, 0x0f, 0x79, 0xb0, 0xa5, 0xad, 0xec, 0x99, 0x0b, 0x9e,
-  0x45, 0x6e, 0x79, 0xc3, 0xd1, 0x49, 0x4c, 0x52, 0x57, 0x44, 0x0a, 0xbd,
-  0x38, 0x18, 0xaa, 0xcc, 0xe1, 0xde, 0x5f, 0x3f, 0x73, 0x0a, 0xf2, 0xd6,
-  0xf5, 0x33, 0x71, 0x83, 0x3e, 0x2c, 0x4a, 0x73, 0x7e, 0x17, 0xc0, 0x15,
-  0x56, 0xc8, 0xac, 0xbf, 0x55, 0x9e, 0x42, 0x15, 0xcd, 0x86, 0x47, 0xfd,
-  0x41, 0x7f, 0x97, 0x6c, 0x06, 0x0b, 0xc9, 0x8d, 0xb3, 0xf3, 0xb8, 0x60,
-  0xa3, 0xae, 0xac, 0x5d, 0x3b, 0xf4, 0xa3, 0x12, 0x12, 0xbc, 0x4a, 0x20,
-  0xab, 0x63, 0x36, 0xa9, 0x46, 0x1c, 0x03, 0x05, 0xcf, 0x3a, 0x86, 0xd7,
-  0x13, 0x1c, 0x54, 0xf0, 0xff, 0x4b, 0x74, 0x15, 0x0f, 0x0b, 0xef, 0x00,
-  0xca, 0xa6, 0xef, 0x6a, 0xc5, 0x6b, 0x5c, 0xa9, 0xe5, 0xa0, 0xa9, 0x75,
-  0x19, 0xd2, 0x71, 0x8e, 0x87, 0xe9, 0x6c, 0xda, 0x34, 0x19, 0xe8, 0x08,
-  0xc5, 0x5a, 0x14, 0xec, 0xbf, 0xed, 0x0c, 0x0b, 0x75, 0x48, 0xbe, 0x6b,
-  0xd3, 0x77, 0x0b, 0x23, 0x0c, 0x73, 0xb6, 0xa6, 0x26, 0x70, 0xa0, 0x21,
-  0x5c, 0xc3, 0x81, 0xb6, 0x0e, 0x9f, 0x10, 0x88, 0xd1, 0xdb, 0x11, 0x1d,
-  0xdc, 0x89, 0x4b, 0x64, 0x1b, 0xa2, 0x83, 0xab, 0x0d, 0xdc, 0x61, 0xb8,
-  0xc0, 0xe6, 0xd1, 0x09, 0xc6, 0xd6, 0x1a, 0x53, 0x8f, 0x13, 0xdc, 0x3a,
-  0xe5, 0x36, 0x74, 0x03, 0x54, 0xc4, 0x3b, 0x0d, 0x19, 0x78, 0x2e, 0xe8,
-  0x1d, 0x0c, 0x0b, 0xe3, 0x11, 0x99, 0x88, 0x4b, 0x96, 0xd6, 0xcd, 0x7b,
-  0xbd, 0x04, 0x7f, 0x0c, 0x42, 0x35, 0x3d, 0x68, 0x98, 0x9c, 0x9b, 0x21,
-  0x4f, 0xf7, 0x11, 0x02, 0x08, 0xd7, 0x0b, 0xb1, 0x9b, 0x2a, 0xbc, 0xf1,
-  0xda, 0x2a, 0x04, 0x79, 0x2e, 0x68, 0x67, 0xf5, 0xa0, 0x42, 0x54, 0x07,
-  0xcb, 0x45, 0x1a, 0x76, 0xfd, 0xf0, 0x01, 0x6f, 0x20, 0x46, 0x47, 0x23,
-  0x61, 0xf0, 0x7a, 0x1c, 0x3f, 0x82, 0x4e, 0x8f, 0x06, 0xe4, 0x88, 0xe0,
-  0xa2, 0x16, 0x39, 0x24, 0x36, 0xa1, 0xd2, 0xba, 0xd0, 0x15, 0x3b, 0xfb,
-  0x4e, 0xdb, 0x85, 0x51, 0xb9, 0xca, 0x27, 0x25, 0x51, 0xf3, 0x30, 0xb8,
-  0x46, 0x53, 0xc8, 0x17, 0x90, 0xa3, 0x58, 0x19, 0xc5, 0x79, 0x13, 0x88,
-  0x0a, 0xc2, 0x43, 0x1a, 0x44, 0x13, 0xa3, 0x6d, 0xfb, 0xa8, 0xe3, 0xf8,
-  0x08, 0xbc, 0x08, 0x47, 0x97, 0xe0, 0xa9, 0x4f, 0x0a, 0x4d, 0x64, 0x60,
-  0x98, 0x39, 0xd8, 0x47, 0x47, 0x1c, 0xf6, 0x87, 0xb6, 0x80, 0x07, 0xe0,
-  0x14, 0x35, 0xb0, 0xcb, 0x8d, 0x2e, 0x6c, 0x86, 0x83, 0xc7, 0x26, 0x18,
-  0xb7, 0x21, 0x8b, 0xab, 0xbf, 0x02, 0xf3, 0x7a, 0xfa, 0x66, 0x74, 0xfb,
-  0x07, 0x94, 0x6d, 0x1f, 0xde, 0x8c, 0x30, 0xc6, 0x62, 0x9f, 0x59, 0x7b,
-  0x17, 0x18, 0xfe, 0xcc, 0x5c, 0x83, 0xcc, 0xa8, 0x79, 0x63, 0x67, 0x8f,
-  0x93, 0x0f, 0x2c, 0x7f, 0xb7, 0xe8, 0xc7, 0x24, 0xc2, 0xba, 0xd0, 0x2c,
-  0xa2, 0xcf, 0x18, 0xc3, 0x28, 0x12, 0xc6, 0x3c, 0xc8, 0x2d, 0xb8, 0x25,
-  0x06, 0x31, 0xc4, 0xd3, 0x64, 0x1b, 0x2d, 0x27, 0xb4, 0xdc, 0xa0, 0x01,
-  0x88, 0xb5, 0xe6, 0xee, 0xdf, 0x0e, 0x6e, 0x93, 0x89, 0x8d, 0x00, 0xed,
-  0xf4, 0x29, 0x5f, 0x65, 0xf6, 0xed, 0x1a, 0x59, 0x17, 0x99, 0xdf, 0xd6,
-  0xd2, 0x82, 0x9a, 0x3c, 0x25, 0x76, 0x07, 0xd5, 0xa6, 0x2c, 0x72, 0xd5,
-  0x70, 0x0e, 0xa8, 0x5f, 0x14, 0x04, 0xc6, 0x7a, 0x4a, 0xc1, 0xc8, 0x07,
-  0x03, 0x62, 0x80, 0xf4, 0x7f, 0xdc, 0x46, 0xb7, 0x1f, 0x78, 0x06, 0x81,
-  0xc2, 0x73, 0xa7, 0x18, 0xec, 0x8b, 0x30, 0xdc, 0x02, 0xd5, 0x16, 0xd7,
-  0xe6, 0x2d, 0x1d, 0xb8, 0xd6, 0x63, 0x2b, 0x0d, 0xac, 0x0a, 0xbf, 0x24,
-  0x72, 0xac, 0x00, 0xe5, 0xb2, 0xc6, 0x8e, 0xe4, 0xa1, 0xd9, 0x0f, 0xa1,
-  0x7a, 0xbf, 0x82, 0xdc, 0xc0, 0x21, 0x1a, 0x81, 0x29, 0x4e, 0x37, 0xb3,
-  0x39, 0xe8, 0x99, 0x47, 0x57, 0x60, 0xb7, 0x46, 0x28, 0xe2, 0x41, 0x23,
-  0x83, 0xd3, 0x8d, 0xd9, 0x4d, 0x39, 0xbf, 0x14, 0xa2, 0xd8, 0x97, 0x7b,
-  0x82, 0x05, 0xf6, 0x81, 0x9e, 0xf0, 0x21, 0xc5, 0xc1, 0x1d, 0x92, 0xb6,
-  0x8c, 0x21, 0xc0, 0xa8, 0xfe, 0xd4, 0xe4, 0xa7, 0x4e, 0x5e, 0x71, 0xf8,
-  0xe6, 0x11, 0xdb, 0x55, 0x47, 0x0f, 0x51, 0xec, 0x83, 0x35, 0x29, 0x68,
-  0x1f, 0xce, 0x07, 0x1b, 0x98, 0xbf, 0x4d, 0x04, 0x31, 0x2d, 0x6c, 0x69,
-  0xe2, 0x6a, 0x79, 0x7d, 0x72, 0x75, 0xb6, 0xbc, 0xbe, 0x52, 0x38, 0x7e,
-  0x71, 0x4e, 0x63, 0x2d, 0x80, 0x33, 0x78, 0x82, 0x29, 0xa9, 0x25, 0x31,
-  0x60, 0x3d, 0xc3, 0x36, 0x48, 0x6e, 0xad, 0x84, 0x68, 0x98, 0x92, 0x83,
-  0xdd, 0x66, 0x9c, 0x8e, 0x95, 0xe8, 0x63, 0x8d, 0x41, 0x16, 0xba, 0x09,
-  0x62, 0xf0, 0x8b, 0x19, 0xbc, 0x1f, 0xc1, 0x7a, 0x64, 0x9c, 0x87, 0xea,
-  0x9f, 0x49, 0xfa, 0x6b, 0x7d, 0x2b, 0x47, 0x44, 0xae, 0x9d, 0x35, 0x97,
-  0x1c, 0x06, 0xee, 0x17, 0xed, 0x18, 0xbd, 0x8f, 0x6d, 0xec, 0xad, 0xe3,
-  0x44, 0x79, 0x4e, 0xec, 0x42, 0x8d, 0x5f, 0x61, 0x43, 0x09, 0x54, 0x5a,
-  0x1b, 0xd4, 0xf3, 0x09, 0x64, 0x0c, 0x87, 0x6f, 0x8e, 0xf0, 0xf0, 0x73,
-  0xe2, 0x6c, 0x45, 0xbd, 0xf7, 0x96, 0xd5, 0x85, 0x21, 0xc6, 0xb8, 0xf0,
-  0x57, 0x7c, 0x3f, 0x4b, 0xb2, 0xb7, 0x0e, 0xc7, 0xc3, 0x37, 0xe3, 0x16,
-  0x7d, 0x30, 0xc1, 0xa3, 0x1c, 0x9b, 0x46, 0x49, 0x55, 0x1a, 0xc4, 0xe1,
-  0xa8, 0x73, 0x3c, 0x62, 0xab, 0x1e, 0x92, 0xe8, 0xa0, 0x2f, 0xa7, 0x27,
-  0xe8, 0x11, 0xf6, 0xf5, 0x0c, 0x7d, 0xcb, 0x76, 0x90, 0xc5, 0x97, 0x23,
-  0x33, 0x09, 0x0f, 0xb9, 0xb6, 0x43, 0x03, 0xaa, 0xef, 0xad, 0xb9, 0xc5,
-  0xbe, 0x93, 0x05, 0x6c, 0x33, 0xaf, 0x5a, 0x9d, 0xb8, 0x35, 0xc4, 0xcd,
-  0xd7, 0x0c, 0x0f, 0x15, 0x9f, 0xe0, 0x9c, 0x5a, 0xb5, 0xa7, 0x77, 0x0c,
-  0xeb, 0x8a, 0x38, 0xe3, 0xe2, 0x4c, 0xf1, 0x65, 0xfd, 0x10, 0x2e, 0x3b,
-  0x17, 0xb7, 0x1d, 0x47, 0xbc, 0x61, 0xdd, 0x99, 0x85, 0xec, 0x57, 0xc1,
-  0x5e, 0x88, 0xd9, 0x07, 0x69, 0x5c, 0x8f, 0x4c, 0x13, 0x59, 0xd9, 0x15,
-  0x19, 0xd8, 0x72, 0x83, 0xd0, 0x86, 0xb4, 0x7f, 0x6c, 0x4f, 0x0b, 0x8a,
-  0x8a, 0x36, 0x67, 0xd4, 0x3d, 0x45, 0x6f, 0x2c, 0x13, 0xf4, 0x60, 0x24,
-  0xd4, 0x0c, 0x6d, 0xa8, 0xc4, 0xc3, 0x58, 0x82, 0x88, 0xe9, 0xe8, 0xcb,
-  0xbf, 0x71, 0x95, 0x67, 0x8b, 0xb2, 0xbf, 0x49, 0x21, 0x46, 0xcb, 0x37,
-  0xa3, 0x91, 0x77, 0xda, 0x8d, 0x1c, 0x06, 0x2d, 0xe5, 0xaa, 0xaa, 0xaf,
-  0x0d, 0x20, 0x56, 0xb0, 0x78, 0xe7, 0x54, 0x84, 0x6d, 0x82, 0x66, 0x1a,
-  0x9d, 0x48, 0x79, 0xf8, 0x07, 0x35, 0xa2, 0xb9, 0x97, 0xf0, 0x4f, 0xca,
-  0x09, 0xfe, 0x7b, 0x7a, 0xfb, 0xe1, 0x97, 0x0f, 0x14, 0x40, 0xb9, 0xba,
-  0x62, 0x12, 0x61, 0x9c, 0x64, 0x2a, 0xaf, 0xa8, 0x58, 0xda, 0x38, 0x2d,
-  0xd9, 0x02, 0xea, 0x4e, 0x06, 0x26, 0x14, 0x1b, 0x4a, 0x83, 0xa7, 0xd7,
-  0xa6, 0xd2, 0x6b, 0x3c, 0x18, 0xef, 0xba, 0xbb, 0xdd, 0x50, 0xcb, 0x93,
-  0x3d, 0x1b, 0x91, 0x38, 0xfe, 0xba, 0x29, 0x99, 0xed, 0x98, 0xf0, 0x2b,
-  0x02, 0x80, 0xc9, 0x3e, 0xfb, 0x05, 0x45, 0xfb, 0x60, 0x65, 0xb3, 0x67,
-  0xce, 0xdc, 0x6d, 0xa7, 0xc6, 0xbd, 0x37, 0x51, 0xeb, 0xae, 0x70, 0x38,
-  0x2c, 0xe6, 0x68, 0x6c, 0xc7, 0xc1, 0x37, 0x3f, 0x3e, 0xfb, 0xe1, 0x5b,
-  0xf1, 0xfc, 0x3b, 0xfa, 0x9d, 0xec, 0x54, 0x40, 0x63, 0xdd, 0x48, 0xa1,
-  0x44, 0xb3, 0x03, 0x86, 0xab, 0x08, 0x7c, 0x39, 0xd0, 0x9b, 0xfd, 0x06,
-  0xb5, 0xa6, 0xc1, 0xe7, 0xa3, 0x35, 0x5c, 0xcb, 0x41, 0xcf, 0x5d, 0x8d,
-  0x9c, 0x54, 0xbd, 0x08, 0x0e, 0xeb, 0xce, 0xaf, 0x0c, 0x5c, 0x0f, 0xbc,
-  0x29, 0x20, 0x1a, 0x92, 0x8d, 0xb6, 0x96, 0xb2, 0x5a, 0x86, 0x5c, 0x43,
-  0xec, 0x50, 0xd9, 0xb7, 0x00, 0xf5, 0x1a, 0x81, 0x3e, 0xd8, 0x36, 0x96,
-  0xdb, 0x7d, 0xed, 0xb4, 0x37, 0x68, 0x97, 0x54, 0x0c, 0x57, 0x0f, 0xed,
-  0xbd, 0xcd, 0xc4, 0xe5, 0x40, 0xda, 0xbd, 0xb4, 0xb1, 0xc6, 0x83, 0x76,
-  0x6c, 0xa6, 0x97, 0x58, 0xbd, 0xbb, 0xd7, 0x2c, 0xab, 0x24, 0x07, 0x7d,
-  0x69, 0xec, 0xce, 0x6b, 0xec, 0x6b, 0xe6, 0x38, 0x02, 0xb5, 0xde, 0x54,
-  0xcc, 0xf0, 0x28, 0x23, 0xaf, 0x6a, 0x28, 0x14, 0x10, 0x19, 0xdf, 0xcf,
-  0x64, 0x4a, 0x88, 0x22, 0xed, 0x8b, 0x9f, 0xd8, 0x92, 0x05, 0x87, 0xa5,
-  0x7b, 0x6f, 0xec, 0x18, 0xe3, 0x35, 0x8e, 0xcc, 0xf7, 0xa8, 0xe4, 0xbb,
-  0xcc, 0x52, 0xb4, 0xbb, 0x79, 0xf3, 0x3c, 0xe3, 0x7e, 0x1e, 0x5d, 0x34,
-  0x89, 0x1c, 0xf7, 0x08, 0x6c, 0x67, 0xab, 0xd3, 0xc9, 0x9a, 0xe7, 0x4d,
-  0x1f, 0x0b, 0xd5, 0xda, 0x6f, 0x90, 0xc1, 0x13, 0xdd, 0x10, 0xc1, 0x4d,
-  0x06, 0xd5, 0x33, 0x1d, 0x94, 0x4f, 0x5c, 0x95, 0x4c, 0xa8, 0x96, 0x30,
-  0x92, 0x3d, 0x23, 0xba, 0x9c, 0x60, 0x89, 0xbb, 0xda, 0x6e, 0x8d, 0x24,
-  0x7a, 0xc0, 0x91, 0xc3, 0x35, 0xdb, 0x61, 0x5b, 0x09, 0x3c, 0xf3, 0x17,
-  0x17, 0x26, 0xab, 0xa3, 0x2e, 0xa5, 0x9d, 0xda, 0xb1, 0xc3, 0x09, 0x6b,
-  0x95, 0x95, 0xa9, 0xac, 0x95, 0x2d, 0xa0, 0x5e, 0x3c, 0x76, 0xc2, 0x36,
-  0x95, 0x67, 0x4b, 0xd7, 0x36, 0x83, 0xe7, 0x39, 0x52, 0xfc, 0x71, 0x4d,
-  0x47, 0xd8, 0xf2, 0x25, 0x0e, 0x1c, 0x1e, 0x07, 0xa9, 0xcc, 0x66, 0xb1,
-  0x84, 0x58, 0x7d, 0x21, 0x14, 0xbe, 0xbe, 0x61, 0x5a, 0x9a, 0xe6, 0x16,
-  0x7e, 0x7e, 0xc5, 0x2d, 0x49, 0xf9, 0xa3, 0x98, 0xc2, 0xed, 0x54, 0xe1,
-  0x11, 0xbc, 0x00, 0x81, 0x5f, 0x3c, 0x76, 0xac, 0x79, 0xca, 0xfd, 0x39,
-  0xdb, 0x97, 0x7f, 0xd1, 0xa5, 0x0d, 0xad, 0xbd, 0x1f, 0xc1, 0xfc, 0x10,
-  0x66, 0x34, 0x96, 0x54, 0x10, 0x71, 0xc2, 0xba, 0x08, 0xfd, 0x20, 0xda,
-  0x55, 0x11, 0x01, 0x4d, 0xac, 0x91, 0x6b, 0x47, 0x72, 0x1f, 0xa9, 0x01,
-  0x6d, 0x3b, 0x52, 0x46, 0x1a, 0x4d, 0x24, 0x37, 0x83, 0xbd, 0x4d, 0xb4,
-  0x10, 0x0d, 0xd6, 0x59, 0x63, 0xe3, 0x92, 0xa3, 0x40, 0xdb, 0x06, 0x36,
-  0x03, 0xfa, 0xc8, 0xf1, 0xa5, 0xe3, 0xee, 0xf2, 0x63, 0x8b, 0xa0, 0x28,
-  0xfd, 0xde, 0x31, 0x29, 0x08, 0x92, 0x54, 0x1b, 0xca, 0x8d, 0x4b, 0xc4,
-  0x36, 0x6c, 0x90, 0xe1, 0xd9, 0x77, 0x05, 0xf4, 0xe8, 0xb7, 0x95, 0xbd,
-  0x75, 0x92, 0x2b, 0x7c, 0xeb, 0xc2, 0x4b, 0xae, 0x50, 0xd4, 0x13, 0x12,
-  0x95, 0x06, 0x46, 0x36, 0xdd, 0x36, 0x4e, 0xe6, 0xe0, 0xe0, 0x89, 0x69,
-  0x9f, 0x22, 0xe7, 0xa2, 0x6c, 0x25, 0x7c, 0xd8, 0x9a, 0x41, 0x5d, 0xa1,
-  0x04, 0x2e, 0x3a, 0x4d, 0xbc, 0x6b, 0x9a, 0x99, 0x2f, 0xc0, 0x5d, 0x6a,
-  0x6f, 0xa8, 0xb4, 0x96, 0x4d, 0x04, 0xdb, 0xa6, 0x45, 0x45, 0xf7, 0x6a,
-  0x53, 0x87, 0xd8, 0x78, 0x86, 0x7f, 0xbd, 0x11, 0xcd, 0xef, 0x38, 0x4f,
-  0xba, 0x55, 0x22, 0x15, 0x5d, 0x5b, 0x67, 0xde, 0x1d, 0xaf, 0xc3, 0x0a,
-  0x9f, 0x88, 0x27, 0xc6, 0xd1, 0xf1, 0x39, 0x62, 0x5e, 0xe0, 0x79, 0x19,
-  0x2e, 0x97, 0x71, 0x2c, 0x4c, 0x85, 0xc4, 0xd8, 0x4e, 0x3e, 0x96, 0xd6,
-  0x54, 0xd4, 0x45, 0x61, 0x4b, 0x4e, 0xec, 0xc0, 0x21, 0x5d, 0xec, 0x20,
-  0xe3, 0x64, 0xec, 0xa4, 0x68, 0x4e, 0x0c, 0xa3, 0xe9, 0xd6, 0x6b, 0xf1,
-  0x5a, 0xfe, 0xc2, 0xce, 0xb7, 0x28, 0x9d, 0x45, 0xf6, 0x44, 0xf4, 0xca,
-  0xc5, 0x3c, 0xb5, 0x2d, 0xf3, 0x3c, 0xf5, 0x9c, 0x24, 0x02, 0x52, 0xf2,
-  0x98, 0x5a, 0xd5, 0x81, 0xed, 0xa6, 0x96, 0xde, 0x3d, 0x30, 0x79, 0x1f,
-  0xe1, 0x62, 0x35, 0x24, 0xc8, 0x82, 0xb6, 0x56, 0x0e, 0xba, 0x4b, 0x4d,
-  0xfb, 0x6c, 0xc0, 0x0d, 0xd8, 0xf4, 0xd5, 0xa2, 0xd3, 0xda, 0x41, 0xe8,
-  0xd8, 0xe0, 0x51, 0x60, 0xe7, 0x33, 0x05, 0x08, 0xf8, 0x74, 0xe4, 0x08,
-  0x46, 0xfd, 0x04, 0x90, 0x0c, 0x00, 0x89, 0x00, 0x8f, 0xd8, 0x8a, 0x2a,
-  0x7c, 0xe3, 0x2d, 0xa1, 0x7e, 0x30, 0xd1, 0x49, 0xd5, 0xbc, 0x9e, 0x0a,
-  0x6d, 0x46, 0x05, 0x7d, 0x61, 0x72, 0x4a, 0xdc, 0xe8, 0x8b, 0x05, 0xfc,
-  0xd5, 0xdc, 0x85, 0xb6, 0xf1, 0xa9, 0xb2, 0x5f, 0xbc, 0x20, 0xaa, 0x25,
-  0x43, 0xc0, 0xf4, 0x86, 0x1d, 0x66, 0x1d, 0xf6, 0x3c, 0x14, 0xbf, 0x9b,
-  0x98, 0xd2, 0x33, 0xfa, 0xee, 0x20, 0x56, 0xfc, 0xf2, 0xab, 0xc2, 0x63,
-  0x3b, 0x72, 0xfe, 0x15, 0x9d, 0xbc, 0x5a, 0x22, 0x33, 0x3c, 0x91, 0xab,
-  0x14, 0x9e, 0xdb, 0x79, 0x8e, 0x0e, 0x5c, 0x48, 0xee, 0xe5, 0xde, 0xbe,
-  0xe5, 0x52, 0x7e, 0xef, 0x72, 0x74, 0x4e, 0xf7, 0x8d, 0x8d, 0x91, 0xa3,
-  0x0f, 0xd0, 0xb4, 0x4c, 0xf7, 0xd7, 0x38, 0x71, 0xbb, 0x45, 0x3a, 0x31,
-  0xac, 0xd5, 0x01, 0x6e, 0x2f, 0x39, 0x53, 0xc2, 0x12, 0xf7, 0xea, 0xa9,
-  0xf3, 0x66, 0x33, 0xcf, 0xe7, 0xd8, 0x41, 0x3d, 0xe3, 0x1d, 0xe7, 0x75,
-  0xf8, 0xae, 0x7d, 0x04, 0xa4, 0xe6, 0xc3, 0x3a, 0x02, 0x2d, 0x99, 0x42,
-  0x8e, 0x8e, 0xde, 0x34, 0x30, 0x51, 0x70, 0x5f, 0x4f, 0x28, 0x7a, 0x7f,
-  0x5d, 0xe1, 0x07, 0x07, 0x33, 0x45, 0x6f, 0x33, 0xe2, 0x97, 0x45, 0x60,
-  0x61, 0x12, 0xf7, 0x91, 0xac, 0xe9, 0x1b, 0x10, 0x48, 0x84, 0x2b, 0x01,
-  0x28, 0x2b, 0xa8, 0x15, 0x74, 0xba, 0xe5, 0x19, 0xd8, 0x9e, 0x87, 0x39,
-  0x91, 0x8b, 0x62, 0xf6, 0xdc, 0x9e, 0x0f, 0x74, 0x7a, 0x24, 0x88, 0xb6,
-  0x04, 0xe8, 0x0c, 0x29, 0xdd, 0xc1, 0xd7, 0x1b, 0x38, 0x13, 0x0c, 0x0b,
-  0x9d, 0x40, 0x0e, 0x0a, 0x92, 0x30, 0x5a, 0x32, 0x4f, 0xb6, 0x94, 0x2d,
-  0x23, 0x37, 0xef, 0xdc, 0xd0, 0xc5, 0x08, 0x1a, 0x03, 0x2e, 0xe8, 0x0f,
-  0xf0, 0xd5, 0xe5, 0x60, 0xf0, 0x71, 0x6b, 0x01, 0x4d, 0x31, 0x3c, 0x44,
-  0x6d, 0xd8, 0x97, 0xd2, 0xd7, 0x34, 0x2d, 0x7d, 0xf2, 0xf7, 0x35, 0x9f,
-  0x46, 0x95, 0x62, 0x71, 0x8b, 0x6a, 0x2b, 0x3a, 0x7f, 0x1a, 0x71, 0xe3,
-  0xfe, 0x1b, 0xda, 0x14, 0xe9, 0x3e, 0x8d, 0xa6, 0xf9, 0x86, 0xa8, 0x6d,
-  0x58, 0xe6, 0xbb, 0xa2, 0x16, 0xe5, 0x41, 0x92, 0xfd, 0xcc, 0xc9, 0xa7,
-  0xd3, 0x24, 0x63, 0x3e, 0xa5, 0xfa, 0x2e, 0x6f, 0x3f, 0x10, 0xca, 0xd9,
-  0xc4, 0x5b, 0xb1, 0x9c, 0xf7, 0xe3, 0xa6, 0x93, 0x91, 0x6a, 0x77, 0x84,
-  0x4b, 0x1b, 0x95, 0x8e, 0x70, 0xa9, 0x8b, 0x05, 0x78, 0x03, 0x89, 0xa4,
-  0xc9, 0xaa, 0x61, 0x32, 0x2b, 0xf0, 0x5b, 0xec, 0xf9, 0xa6, 0x70, 0x0f,
-  0xcf, 0xed, 0x27, 0x7f, 0xe6, 0xe3, 0x29, 0x11, 0x4c, 0xc5, 0x89, 0x38,
-  0x3d, 0x3d, 0x9d, 0x08, 0xf2, 0x4f, 0x35, 0xf6, 0xd4, 0x6b, 0xfc, 0x38,
-  0x84, 0x9d, 0x1b, 0x53, 0x52, 0xfc, 0x42, 0x70, 0x82, 0x6f, 0x6b, 0x05,
-  0xea, 0x74, 0x71, 0x2a, 0x46, 0xbf, 0x8c, 0x04, 0x6c, 0x00, 0x70, 0x85,
-  0x10, 0xb1, 0x40, 0xa0, 0xc9, 0xa8, 0x3b, 0x37, 0x4e, 0x74, 0xd8, 0x69,
-  0x53, 0x2f, 0xcc, 0xe6, 0x14, 0x1c, 0x7e, 0x40, 0xbf, 0xda, 0xc6, 0x5f,
-  0x1b, 0xdf, 0xac, 0xb3, 0x72, 0xe1, 0xa9, 0x49, 0x64, 0x76, 0x86, 0x18,
-  0xa0, 0x45, 0x6c, 0x7a, 0x8a, 0x60, 0x6c, 0x8a, 0x54, 0xf7, 0x24, 0xe2,
-  0x05, 0xaa, 0x81, 0xac, 0xff, 0xc0, 0x3b, 0x78, 0x3f, 0x70, 0xc1, 0x8a,
-  0x8f, 0x2b, 0xff, 0x5a, 0xac, 0xdd, 0x61, 0xe5, 0x8e, 0x83, 0xca, 0x9b,
-  0x04, 0x0b, 0x1d, 0x8c, 0x21, 0xf5, 0x96, 0x16, 0xa6, 0xea, 0x5b, 0x05,
-  0xd7, 0x41, 0x03, 0x66, 0x61, 0xdf, 0x03, 0xf0, 0x0f, 0xf9, 0x5d, 0xba,
-  0xd5, 0xb8, 0x51, 0x4c, 0x60, 0xad, 0x11, 0xb3, 0xeb, 0xee, 0xb2, 0x60,
-  0x5f, 0xe0, 0x73, 0xa0, 0x6f, 0xe7, 0xd0, 0xa9, 0xa2, 0x5f, 0x7b, 0x0c,
-  0x12, 0x2f, 0xaa, 0x66, 0xc5, 0xd0, 0xe9, 0xdb, 0x55, 0x31, 0xc5, 0x0d,
-  0x5e, 0xd9, 0xcb, 0x75, 0x2e, 0xf1, 0xcc, 0xc6, 0x93, 0xa0, 0x9d, 0x9f,
-  0x77, 0x84, 0x27, 0xc5, 0x51, 0x5c, 0xe9, 0x22, 0x34, 0x80, 0xff, 0x9a,
-  0x69, 0xda, 0x9d, 0xbe, 0x4b, 0x95, 0x4d, 0xfd, 0x30, 0xc0, 0x03, 0xb7,
-  0x57, 0x47, 0xd0, 0x5e, 0x3a, 0x5e, 0x78, 0x1c, 0x7a, 0x85, 0x65, 0xba,
-  0x5f, 0x48, 0xf7, 0x71, 0xe3, 0xce, 0xda, 0xc6, 0xd4, 0x2d, 0x03, 0x6a,
-  0xb0, 0x91, 0x09, 0x9f, 0x43, 0xd2, 0xd1, 0xa4, 0xdf, 0x73, 0x7e, 0x49,
-  0x8e, 0x89, 0xdb, 0xac, 0xc5, 0x65, 0x43, 0x58, 0x84, 0x17, 0x65, 0xa7,
-  0xdc, 0xa1, 0x82, 0x66, 0x50, 0xd5, 0x8e, 0x4b, 0xec, 0x48, 0xd4, 0x5a,
-  0x26, 0x29, 0x9d, 0xee, 0x97, 0x9f, 0x5a, 0xe2, 0xf4, 0xea, 0xdc, 0x5e,
-  0xce, 0x9f, 0x02, 0xcd, 0x5e, 0xbf, 0xbd, 0x69, 0xa7, 0xf2, 0x81, 0xe0,
-  0xee, 0x2e, 0x3a, 0x1d, 0xa1, 0x8d, 0x44, 0xca, 0x6f, 0x6c, 0xdb, 0xfc,
-  0x69, 0xa0, 0x3d, 0x87, 0x0d, 0x20, 0xee, 0xad, 0xde, 0xf5, 0x22, 0x10,
-  0x69, 0x67, 0xe3, 0x75, 0xfd, 0xfd, 0x9e, 0xa7, 0xe9, 0xfc, 0x9b, 0x21,
-  0xa0, 0x6a, 0x06, 0xa8, 0xd3, 0x68, 0x46, 0x4d, 0xe9, 0x62, 0xeb, 0x83,
-  0xdd, 0x65, 0x66, 0x1b, 0x87, 0x56, 0xdc, 0x60, 0xf4, 0x7b, 0x34, 0x1d,
-  0x41, 0xb1, 0xff, 0x7a, 0xb7, 0xa4, 0xe6, 0x00, 0xb0, 0x47, 0xc6, 0x52,
-  0xa1, 0x6f, 0xd2, 0x66, 0xc9, 0x62, 0x9e, 0x16, 0xb2, 0x36, 0x4b, 0xd3,
-  0xbe, 0x35, 0xb1, 0xc6, 0xb0, 0xc4, 0x57, 0x32, 0x7d, 0x10, 0xb7, 0x2b,
-  0xcc, 0xfb, 0x0a, 0xf6, 0x84, 0xd7, 0x94, 0x3f, 0xc1, 0xbc, 0x6c, 0x25,
-  0xb4, 0x2d, 0x13, 0xe8, 0x12, 0xe9, 0x98, 0x0d, 0x46, 0x45, 0x6a, 0xa7,
-  0xf8, 0x44, 0xb8, 0xcd, 0x92, 0xdb, 0x37, 0x80, 0xfc, 0x59, 0x50, 0x77,
-  0x06, 0x0b, 0x58, 0x6c, 0x04, 0xcd, 0xd2, 0x22, 0x7a, 0x67, 0x7a, 0x42,
-  0xc2, 0xd3, 0x84, 0x07, 0x7f, 0x04, 0x91, 0x5d, 0x71, 0xc1, 0x8b, 0x57,
-  0x64, 0xbb, 0xe2, 0x2e, 0xd8, 0xb9, 0x4c, 0x2b, 0x45, 0xb0, 0x74, 0xc5,
-  0xc0, 0x1e, 0x6c, 0x4f, 0x90, 0xde, 0xde, 0x37, 0xca, 0xec, 0xc3, 0x05,
-  0x4d, 0xf4, 0xf7, 0xc2, 0xfe, 0x44, 0x34, 0x96, 0xd6, 0x42, 0x22, 0xb3,
-  0xd8, 0x4f, 0x9b, 0xad, 0x87, 0x49, 0xd7, 0xd7, 0xff, 0xe4, 0x9d, 0x89,
-  0xf2, 0xff, 0x82, 0x97, 0x3b, 0x59, 0x1c, 0x61, 0x5a, 0xb1, 0x97, 0x03,
-  0x41, 0x39, 0x06, 0x7f, 0x34, 0x0c, 0x3e, 0xec, 0x65, 0x90, 0xc9, 0x59,
-  0x75, 0x8f, 0x29, 0x20, 0x94, 0x61, 0x20, 0x89, 0xf6, 0x99, 0xdc, 0x23,
-  0x38, 0x6c, 0xf6, 0xdf, 0x56, 0x0b, 0xfa, 0xa0, 0x6c, 0xaf, 0xf8, 0x0d,
-  0xac, 0xe1, 0x11, 0xfd, 0xc6, 0x4c, 0xe0, 0x77, 0x27, 0x97, 0xf1, 0x9f,
-  0xe0, 0x32, 0xfe, 0x68, 0x2e, 0x90, 0xbb, 0x6d, 0x2c, 0x7d, 0x77, 0xd9,
-  0x59, 0x62, 0x39, 0x0c, 0xd3, 0x23, 0x73, 0x71, 0x7e, 0xea, 0x7d, 0xd1,
-  0xbd, 0xe3, 0x71, 0x8a, 0x8f, 0xbb, 0x3c, 0xf6, 0x50, 0xe8, 0x41, 0xf8,
-  0x44, 0x9a, 0x10, 0x88, 0x30, 0x83, 0xe1, 0xef, 0xce, 0xbc, 0xc7, 0x64,
-  0xc5, 0xcb, 0x94, 0xd2, 0xe2, 0xa1, 0x2e, 0x6d, 0x3b, 0xb4, 0x91, 0x67,
-  0x00, 0x68, 0xa3, 0x56, 0xdd, 0x8b, 0x43, 0x3d, 0x87, 0x61, 0x5e, 0xc7,
-  0x34, 0x12, 0xfa, 0x77, 0x03, 0x13, 0xb0, 0xef, 0x6e, 0xfe, 0xe9, 0x39,
-  0xf8, 0xbd, 0x66, 0xfb, 0x4e, 0x23, 0x6c, 0x76, 0xd1, 0x7b, 0x63, 0xd2,
-  0xef, 0x39, 0xbb, 0x10, 0xdb, 0xc4, 0xd8, 0x56, 0x61, 0x30, 0xe7, 0x57,
-  0x02, 0x76, 0x85, 0x5d, 0xed, 0x85, 0x5d, 0x36, 0xf9, 0xdf, 0x55, 0x2d,
-  0x01, 0x63, 0x71, 0x8d, 0x17, 0x57, 0x67, 0x8b, 0x3b, 0x5d, 0xe3, 0x78,
-  0x37, 0x24, 0x05, 0x04, 0xae, 0x1b, 0xbe, 0xd1, 0x4a, 0xbd, 0xf3, 0xff,
-  0x57, 0x07, 0xe6, 0x51, 0xc3, 0x74, 0x2c, 0xd3, 0x72, 0xc9, 0xc4, 0xf8,
-  0x72, 0x17, 0xe3, 0xa3, 0x06, 0x78, 0x3f, 0xec, 0x78, 0x66, 0xa5, 0xa4,
-  0xab, 0x9d, 0xb0, 0x0e, 0x74, 0x2f, 0xe4, 0x78, 0x21, 0xb3, 0xcc, 0x90,
-  0xa5, 0xcb, 0x9d, 0x8a, 0x6a, 0x80, 0xf7, 0xc2, 0x1e, 0x8d, 0x63, 0x95,
-  0x5a, 0x81, 0xe9, 0x72, 0x27, 0x74, 0x03, 0xbc, 0x1f, 0x76, 0xac, 0xca,
-  0x2a, 0x49, 0xf1, 0xe3, 0x78, 0xa4, 0x6d, 0x6e, 0x76, 0x62, 0xf8, 0x08,
-  0xf7, 0x81, 0x6f, 0x2c, 0x62, 0xbc, 0xcf, 0x78, 0x40, 0x1a, 0x0b, 0xba,
-  0x0f, 0xd2, 0x02, 0xee, 0xa5, 0x08, 0xc9, 0xa8, 0xa5, 0x49, 0x97, 0x3b,
-  0xa1, 0x1b, 0xe0, 0xfd, 0xb0, 0xe3, 0xa4, 0xb0, 0x84, 0xf1, 0x6a, 0x27,
-  0xac, 0x03, 0xdd, 0x0b, 0x39, 0x7e, 0x07, 0xbb, 0xd0, 0x90, 0xa5, 0xcb,
-  0x9d, 0xd0, 0x0d, 0xf0, 0x7e, 0xd8, 0xb1, 0x39, 0x88, 0x21, 0xd2, 0x7c,
-  0xbd, 0x13, 0xde, 0x03, 0xbf, 0x07, 0xf4, 0x38, 0x5b, 0x31, 0xe5, 0x6c,
-  0xb5, 0x13, 0xce, 0x80, 0xed, 0x81, 0x1a, 0xe7, 0x86, 0x5a, 0xbe, 0x1b,
-  0xce, 0x80, 0xed, 0x81, 0x1a, 0x6f, 0x12, 0xa6, 0xb6, 0x49, 0x76, 0xc2,
-  0x19, 0xb0, 0x3d, 0x50, 0xe3, 0x22, 0x4b, 0x22, 0x6d, 0x77, 0x8c, 0xb9,
-  0xd9, 0x89, 0xe1, 0x23, 0xdc, 0x07, 0x7e, 0x5c, 0xa2, 0x20, 0xd5, 0x35,
-  0xfc, 0x5e, 0x9d, 0x55, 0x77, 0xc3, 0x95, 0x2c, 0x6f, 0xb9, 0x47, 0x5e,
-  0xbd, 0x2c, 0x58, 0x56, 0xb8, 0xd8, 0x09, 0x69, 0x01, 0xf7, 0xc1, 0x8d,
-  0xab, 0x64, 0x61, 0xfd, 0x1c, 0x5d, 0xee, 0x84, 0x6e, 0x80, 0xf7, 0xc3,
-  0x8e, 0x6b, 0x69, 0x16, 0x1e, 0x2e, 0x76, 0xef, 0x54, 0x03, 0xb8, 0x0f,
-  0x6e, 0xbc, 0xf2, 0xfd, 0xdb, 0xea, 0xff, 0xda, 0xfb, 0xf6, 0x3e, 0xc7,
-  0x6d, 0xe4, 0xc0, 0xbf, 0x7b, 0x3e, 0x05, 0xa2, 0x51, 0x6f, 0x4b, 0xed,
-  0x56, 0x4f, 0x3f, 0xd6, 0x49, 0xb6, 0xe7, 0x11, 0x7b, 0xbd, 0xde, 0xc4,
-  0x89, 0xbd, 0x9e, 0xb3, 0xbd, 0xb7, 0xb9, 0xc4, 0xb1, 0x4c, 0x49, 0x54,
-  0x8b, 0x3b, 0x14, 0xa9, 0x21, 0xa9, 0x7e, 0x38, 0x9d, 0xfe, 0xec, 0x57,
-  0x0f, 0x14, 0x1e, 0x24, 0xf8, 0x98, 0xf1, 0xc4, 0xbf, 0xbb, 0xfc, 0xbc,
-  0x97, 0xf3, 0xa8, 0x89, 0x42, 0xa1, 0x00, 0x14, 0x0a, 0x85, 0x42, 0x55,
-  0x61, 0x80, 0xbc, 0x72, 0x2b, 0x0c, 0x81, 0x3f, 0xdc, 0x6d, 0x34, 0x7b,
-  0xc1, 0x8f, 0x4e, 0x48, 0x01, 0xec, 0x83, 0x3b, 0x5c, 0x0a, 0xc6, 0x65,
-  0x0f, 0xa4, 0x00, 0xf6, 0xc1, 0x1d, 0x42, 0x3f, 0x34, 0x8d, 0x65, 0x0f,
-  0x8d, 0x1a, 0xb0, 0x0f, 0x0e, 0x18, 0x3f, 0xbe, 0x8e, 0x64, 0x0d, 0xc0,
-  0xcf, 0x9e, 0x15, 0x20, 0xc0, 0xbd, 0xb0, 0x0f, 0xe3, 0xc3, 0x4f, 0x71,
-  0xff, 0x7e, 0x60, 0xdc, 0x9f, 0xf6, 0xed, 0xe5, 0x0f, 0x63, 0x07, 0x7c,
-  0x00, 0xf4, 0xe1, 0xef, 0x41, 0xb0, 0x6b, 0xe4, 0xbf, 0xef, 0x91, 0xf1,
-  0x0f, 0x63, 0x0b, 0xdc, 0x0f, 0x7b, 0xf8, 0x8f, 0xb8, 0x8f, 0x6b, 0xd4,
-  0xff, 0xd8, 0xb7, 0xa7, 0x3f, 0x8c, 0x1d, 0xf0, 0x01, 0xd0, 0x87, 0x7f,
-  0xc0, 0xbd, 0x5c, 0x63, 0xff, 0x43, 0xdf, 0xbe, 0xfe, 0x30, 0x76, 0xc0,
-  0x07, 0x40, 0x1f, 0x7e, 0xce, 0x9c, 0xae, 0xf1, 0x7f, 0xde, 0xcf, 0xf7,
-  0x0f, 0x63, 0xaf, 0xca, 0xa0, 0x1a, 0x87, 0xff, 0x66, 0xc7, 0xfe, 0xdf,
-  0x7a, 0xc7, 0xd3, 0x02, 0xf7, 0xc3, 0x1e, 0x7e, 0x6e, 0x10, 0x7f, 0xde,
-  0x07, 0x6b, 0x40, 0x7b, 0x21, 0x31, 0xc0, 0xd3, 0xe0, 0xfd, 0xae, 0x4f,
-  0x23, 0x78, 0x18, 0x3b, 0xe0, 0x03, 0xa0, 0x0f, 0xbf, 0xc8, 0x0d, 0xf2,
-  0x2f, 0x7a, 0xf4, 0x82, 0x87, 0xb1, 0x05, 0xee, 0x87, 0x3d, 0xfc, 0x17,
-  0xd4, 0x06, 0x34, 0xea, 0x7f, 0xe9, 0xd3, 0x0c, 0x1e, 0xc6, 0x0e, 0xf8,
-  0x00, 0xe8, 0xc3, 0x2f, 0x49, 0x1d, 0xd0, 0xe8, 0xbf, 0xec, 0xd5, 0x0d,
-  0x1e, 0xc6, 0x6e, 0x85, 0x21, 0xf0, 0x87, 0x5f, 0xed, 0x35, 0xf6, 0xaf,
-  0x3a, 0xa5, 0xfb, 0xc3, 0x58, 0x00, 0xfb, 0xe0, 0x0e, 0xff, 0x24, 0x18,
-  0xff, 0xd4, 0x03, 0x29, 0x80, 0x7d, 0x70, 0x87, 0xff, 0x9a, 0x68, 0x8c,
-  0xff, 0xda, 0x29, 0x29, 0x1f, 0xc6, 0x02, 0xd8, 0x07, 0x77, 0xf8, 0x35,
-  0xeb, 0x06, 0x1a, 0xed, 0xd7, 0xfd, 0x9a, 0xc2, 0xc3, 0xd8, 0xab, 0x32,
-  0xa8, 0xc6, 0xe1, 0x37, 0x9b, 0x5c, 0xb7, 0xf0, 0x4d, 0xf7, 0x3e, 0xff,
-  0x30, 0x36, 0xa0, 0xbd, 0x90, 0x87, 0xdf, 0xe2, 0xde, 0xae, 0xf1, 0x7e,
-  0xdb, 0xb7, 0xcf, 0x3f, 0x8c, 0x1d, 0xf0, 0x01, 0xd0, 0x87, 0xdf, 0x45,
-  0x32, 0x7d, 0xdf, 0x75, 0xef, 0xf7, 0xb0, 0x06, 0x05, 0xb4, 0x17, 0xf2,
-  0xf0, 0xcf, 0x9e, 0xcc, 0xfb, 0xf3, 0x10, 0x09, 0xe6, 0x55, 0x19, 0x54,
-  0xe3, 0xf0, 0xf5, 0x46, 0x18, 0xe5, 0x75, 0xf7, 0x2e, 0xfd, 0x30, 0x36,
-  0xa0, 0xbd, 0x90, 0x87, 0x9f, 0x19, 0xac, 0x9f, 0xf5, 0xc1, 0x1a, 0xd0,
-  0x5e, 0xc8, 0xc3, 0xd7, 0xa5, 0xa1, 0xb5, 0x7b, 0xff, 0x07, 0x5a, 0x05,
-  0xb4, 0x17, 0x12, 0x38, 0x19, 0xf6, 0x7c, 0xc3, 0xd5, 0xbd, 0xfb, 0xbf,
-  0x03, 0x3e, 0x00, 0xfa, 0xf0, 0xb5, 0x21, 0xb9, 0x8f, 0x62, 0x21, 0xb8,
-  0x09, 0x57, 0x3b, 0xd8, 0xb1, 0xf6, 0xdd, 0xad, 0x7c, 0x1f, 0xc6, 0x0c,
-  0x15, 0x77, 0x42, 0x25, 0xd9, 0x9a, 0xc0, 0xe0, 0xdf, 0x4e, 0xb8, 0x2d,
-  0x03, 0x56, 0xaf, 0x66, 0x64, 0x02, 0x0d, 0x57, 0xf0, 0x2c, 0x50, 0x1c,
-  0x3b, 0xa0, 0x46, 0xfc, 0x6f, 0x3b, 0xdc, 0xdb, 0x7d, 0x6e, 0xcc, 0x8d,
-  0xfa, 0xf2, 0x30, 0x60, 0x10, 0x64, 0xa8, 0x09, 0x52, 0x70, 0xc4, 0x36,
-  0x21, 0xc7, 0xb8, 0xd8, 0x04, 0xb4, 0x70, 0x2d, 0x1d, 0xd2, 0x70, 0x17,
-  0x67, 0xe7, 0x9e, 0xf5, 0xcf, 0x03, 0x21, 0x13, 0x18, 0x17, 0xf2, 0x95,
-  0x63, 0x80, 0x2e, 0x82, 0x21, 0xb2, 0xae, 0x3a, 0xc9, 0x22, 0x38, 0x0b,
-  0xd6, 0x46, 0x15, 0x81, 0x9d, 0xff, 0x7d, 0xbb, 0x49, 0x92, 0x00, 0x2e,
-  0xce, 0x3a, 0x89, 0x1e, 0x40, 0xb3, 0x26, 0xb9, 0x97, 0x66, 0xe5, 0x80,
-  0x75, 0xd0, 0xec, 0x92, 0x9c, 0x06, 0x48, 0xee, 0xa4, 0x78, 0x85, 0x19,
-  0x9d, 0xe2, 0x3e, 0xa2, 0x35, 0x14, 0xd3, 0xfd, 0xb2, 0x93, 0x6e, 0x0d,
-  0xea, 0x40, 0xb6, 0x91, 0xae, 0x21, 0xbb, 0xa8, 0xd7, 0x20, 0x3d, 0x1d,
-  0xe0, 0xb0, 0xec, 0xfe, 0x2e, 0x30, 0x9c, 0x1e, 0xfc, 0xde, 0x5e, 0x30,
-  0xb4, 0x0b, 0xdc, 0xd1, 0x11, 0x06, 0xee, 0xe9, 0x0a, 0x03, 0x75, 0x75,
-  0x26, 0x2a, 0x0a, 0xf4, 0x05, 0xe8, 0xee, 0x09, 0x03, 0x51, 0x37, 0x66,
-  0xaf, 0x3a, 0x7b, 0xc1, 0x90, 0x0e, 0x60, 0x5b, 0x0f, 0x18, 0xf0, 0xe2,
-  0xe3, 0x36, 0xe2, 0x6b, 0xe5, 0x4d, 0xc2, 0xd7, 0x11, 0x66, 0x9d, 0x41,
-  0xff, 0x2a, 0x2d, 0x4b, 0xf4, 0xf5, 0x79, 0x80, 0x7c, 0x0b, 0x4a, 0x5d,
-  0xf8, 0x9b, 0xce, 0x1e, 0x58, 0x60, 0x0b, 0xdb, 0xd6, 0x09, 0x0b, 0x7b,
-  0xfe, 0xb7, 0x1d, 0x37, 0x0f, 0xf1, 0xdd, 0xce, 0xdc, 0x42, 0xd9, 0xdf,
-  0xd3, 0x26, 0xcc, 0xf9, 0x6f, 0xdb, 0x67, 0x93, 0x01, 0x2e, 0x7f, 0xd7,
-  0x3a, 0x95, 0x87, 0xe5, 0x7e, 0xab, 0x7e, 0xd7, 0x2a, 0x4a, 0x0e, 0x77,
-  0x94, 0x07, 0xb9, 0x52, 0xbf, 0xfb, 0xb8, 0x8e, 0x82, 0xf2, 0x19, 0xa3,
-  0x0b, 0x1f, 0x79, 0x07, 0xce, 0xa2, 0xec, 0x3a, 0x8d, 0x67, 0x8b, 0x22,
-  0xc2, 0x44, 0x2d, 0x3a, 0x5d, 0x6a, 0xb6, 0xc4, 0xf6, 0x4f, 0x55, 0xf4,
-  0x03, 0x0c, 0x0a, 0xde, 0xa9, 0x6f, 0x60, 0x76, 0xa2, 0x1f, 0x7e, 0xc8,
-  0x38, 0xa7, 0xea, 0x69, 0xf3, 0x92, 0x81, 0xe8, 0xf5, 0xae, 0x18, 0x5c,
-  0xff, 0x3f, 0xb9, 0x60, 0xf0, 0xdd, 0xb3, 0xb0, 0xce, 0xac, 0xa4, 0xb4,
-  0x44, 0xbe, 0xc3, 0x53, 0xdd, 0x0d, 0x2e, 0x6a, 0xad, 0xdd, 0x70, 0x83,
-  0xd3, 0x61, 0x90, 0x1d, 0x4d, 0x84, 0xdc, 0x1c, 0x1c, 0x5c, 0x21, 0xef,
-  0x65, 0x4c, 0xff, 0x80, 0x2e, 0xc2, 0xc6, 0xfb, 0x4a, 0x0f, 0x90, 0xa6,
-  0x68, 0x0d, 0x95, 0x22, 0xf6, 0x31, 0x71, 0xe9, 0xbc, 0x03, 0x10, 0xeb,
-  0x17, 0x69, 0x3c, 0x47, 0xac, 0x43, 0xbb, 0xce, 0x08, 0x99, 0x64, 0xab,
-  0xf8, 0x4e, 0x51, 0x20, 0xa4, 0xf5, 0x6e, 0x0e, 0xa5, 0xdd, 0x80, 0x36,
-  0xa6, 0x8e, 0xbb, 0x90, 0xc9, 0xbd, 0x81, 0xdf, 0xd1, 0x01, 0x88, 0x69,
-  0x70, 0xbe, 0x74, 0xa7, 0xde, 0x88, 0xdb, 0x72, 0x6f, 0x1c, 0x84, 0xfc,
-  0x8b, 0x6a, 0x19, 0x37, 0xb8, 0x05, 0xa6, 0x37, 0xdc, 0x0c, 0x74, 0x22,
-  0x5b, 0x3a, 0x59, 0x15, 0x9c, 0x86, 0xf1, 0x32, 0xfe, 0xe5, 0xf7, 0x23,
-  0xbc, 0xbc, 0xe6, 0xb0, 0x61, 0x6e, 0xf6, 0xa0, 0x06, 0xa6, 0x93, 0x76,
-  0xb8, 0x6e, 0xd7, 0x03, 0xf2, 0x76, 0xc8, 0xf0, 0xf8, 0x1e, 0x2a, 0x7a,
-  0x99, 0x59, 0xf7, 0x0f, 0xec, 0x40, 0x23, 0x81, 0x47, 0x28, 0x3b, 0x88,
-  0x93, 0xbb, 0xc3, 0x9d, 0xb9, 0xef, 0xd8, 0xaf, 0x97, 0xa3, 0x42, 0xdd,
-  0xc9, 0x93, 0xf0, 0x5b, 0x9c, 0xc4, 0xed, 0x16, 0x73, 0x93, 0x95, 0x3b,
-  0x85, 0xbc, 0xc0, 0xfd, 0x90, 0x34, 0xa0, 0x94, 0x0c, 0x1c, 0x9d, 0x70,
-  0x31, 0x67, 0xd0, 0x8c, 0x92, 0x91, 0x62, 0x72, 0x8e, 0x52, 0x9c, 0x6e,
-  0xf7, 0x99, 0x49, 0xe3, 0x4d, 0xf5, 0xfc, 0xab, 0x3a, 0x44, 0x27, 0xf7,
-  0x8c, 0x37, 0xa8, 0xb5, 0xdd, 0xc8, 0xd4, 0x99, 0xcb, 0x36, 0x8a, 0xbe,
-  0x8e, 0xc3, 0x6e, 0x78, 0x98, 0xf2, 0xd1, 0x04, 0x98, 0x99, 0x08, 0x64,
-  0xc6, 0x3a, 0x79, 0x41, 0x3f, 0xd4, 0xf9, 0x99, 0x75, 0xc0, 0xe6, 0xb6,
-  0xe9, 0xb3, 0x8d, 0x70, 0x35, 0x2d, 0x75, 0xb4, 0xe2, 0xd7, 0x6d, 0xe4,
-  0x4b, 0x19, 0x4a, 0xac, 0x52, 0xce, 0xec, 0xba, 0xf7, 0x84, 0x6d, 0x6b,
-  0x59, 0x2f, 0xf9, 0xfa, 0x62, 0xee, 0x5a, 0xca, 0x3e, 0xf7, 0x74, 0xdd,
-  0x8d, 0x3a, 0xac, 0x4d, 0xc3, 0x83, 0xf3, 0xd0, 0xca, 0xd3, 0x07, 0xba,
-  0xbc, 0xce, 0xcc, 0x0d, 0x3f, 0x33, 0x1d, 0xc2, 0x54, 0x63, 0x9c, 0x86,
-  0x7f, 0xb5, 0x27, 0x47, 0x3e, 0x1c, 0x43, 0x69, 0xff, 0x14, 0x8a, 0xdd,
-  0xef, 0xe2, 0x28, 0x33, 0x47, 0x44, 0x9f, 0xfc, 0xdb, 0xc6, 0x50, 0xcc,
-  0x4d, 0x21, 0x56, 0xf2, 0x17, 0x59, 0x9d, 0xa3, 0x86, 0x30, 0x94, 0x97,
-  0x66, 0x27, 0xcc, 0x51, 0x3f, 0x87, 0xa1, 0x78, 0x1b, 0x66, 0xe6, 0x08,
-  0xed, 0xe6, 0x21, 0xb0, 0xf3, 0xcb, 0x8f, 0x5b, 0x37, 0x74, 0x03, 0xf2,
-  0xdb, 0x76, 0xed, 0x0c, 0x05, 0x19, 0x07, 0xbf, 0xdc, 0x89, 0x8b, 0x71,
-  0x40, 0x77, 0x10, 0x28, 0x54, 0x58, 0x4e, 0x1d, 0x85, 0xa5, 0xa1, 0xdb,
-  0xb4, 0x01, 0x36, 0x35, 0x1b, 0x81, 0x3c, 0x3f, 0x6f, 0xd7, 0x48, 0x0c,
-  0xcc, 0x59, 0xbb, 0x52, 0xb2, 0x1d, 0x42, 0xbf, 0x10, 0x25, 0xf1, 0x39,
-  0x2d, 0xd4, 0x5b, 0xda, 0x8f, 0x3b, 0x69, 0xd7, 0x54, 0x5d, 0xb4, 0x53,
-  0xde, 0x80, 0x68, 0xd0, 0xad, 0xa3, 0x8d, 0xba, 0x09, 0x17, 0xa0, 0x3e,
-  0xca, 0x2d, 0x5c, 0x0f, 0xe9, 0x02, 0xd8, 0x41, 0x7b, 0x00, 0x24, 0xa0,
-  0x09, 0xbe, 0x2d, 0x84, 0x45, 0xed, 0xcf, 0x40, 0x8e, 0x00, 0x2c, 0x1b,
-  0xe6, 0xb9, 0x4b, 0xc2, 0xe0, 0x2d, 0x7b, 0x7f, 0x38, 0x2b, 0x84, 0x44,
-  0xc4, 0x5b, 0xf6, 0x51, 0x09, 0xbb, 0x76, 0xfb, 0x27, 0xf0, 0x84, 0x1f,
-  0x08, 0xa0, 0xb5, 0xe3, 0xff, 0xdd, 0x3c, 0xad, 0x53, 0x19, 0x29, 0xec,
-  0xcf, 0x7a, 0x2d, 0x00, 0x04, 0x6b, 0x41, 0xbb, 0x8c, 0x00, 0x04, 0x7a,
-  0x7e, 0x71, 0xe1, 0x0e, 0x30, 0x88, 0xcc, 0x15, 0x48, 0xc3, 0x5c, 0x45,
-  0x0b, 0x49, 0x51, 0xdd, 0x56, 0xef, 0x32, 0x34, 0xea, 0x8e, 0x6b, 0x8d,
-  0x21, 0xdc, 0x1d, 0xd6, 0x0f, 0xef, 0x96, 0x5c, 0xf3, 0xcb, 0xd1, 0x7b,
-  0x49, 0x97, 0x6b, 0x91, 0x45, 0xe0, 0xa7, 0x2a, 0x73, 0x84, 0x65, 0x7d,
-  0x62, 0x51, 0x62, 0xae, 0xa1, 0x28, 0x38, 0xb7, 0xdd, 0x0e, 0x49, 0x63,
-  0x7a, 0x48, 0xc3, 0xb8, 0x74, 0xd1, 0x1f, 0x33, 0x0a, 0x5a, 0x69, 0xe1,
-  0x45, 0x17, 0xa4, 0x31, 0x76, 0x18, 0x44, 0x7f, 0xaf, 0x9e, 0x1e, 0x8d,
-  0x25, 0x2a, 0x48, 0xb4, 0xea, 0x89, 0x5b, 0x59, 0x39, 0xd5, 0x8c, 0xc2,
-  0xdf, 0x08, 0x6c, 0x68, 0x69, 0x59, 0xbc, 0x3f, 0x9f, 0x3f, 0xd7, 0xc8,
-  0xf8, 0xad, 0x08, 0x7a, 0x75, 0x05, 0xce, 0x1f, 0xfc, 0x71, 0xaa, 0x9f,
-  0x58, 0x98, 0xaa, 0x48, 0x2d, 0xa6, 0x14, 0x89, 0xe0, 0x1d, 0x6d, 0x02,
-  0xc1, 0x00, 0x66, 0x84, 0x7e, 0x64, 0xff, 0x29, 0x72, 0xe9, 0x64, 0x6c,
-  0xec, 0xd3, 0xf9, 0x62, 0xf7, 0xec, 0x95, 0x8d, 0xb6, 0xd5, 0xe7, 0x1d,
-  0xda, 0x35, 0x7d, 0x6e, 0xc1, 0x0d, 0x55, 0xbe, 0x44, 0x12, 0x07, 0x3b,
-  0xb4, 0x09, 0xe3, 0x38, 0x69, 0xbd, 0x26, 0x77, 0x8d, 0x56, 0xab, 0x1a,
-  0x3a, 0xea, 0x95, 0x13, 0x13, 0xb9, 0x4e, 0x90, 0x31, 0x92, 0x6c, 0x1d,
-  0x03, 0x07, 0x2c, 0x63, 0x13, 0x9c, 0xd5, 0xd4, 0xc6, 0xab, 0x85, 0x32,
-  0x60, 0x56, 0x05, 0x72, 0xd2, 0xed, 0x19, 0x6c, 0x12, 0x23, 0xd5, 0x86,
-  0xcb, 0x0f, 0x18, 0x07, 0xbc, 0xba, 0x82, 0xc1, 0xaa, 0x8a, 0xfc, 0x96,
-  0x5e, 0xae, 0x79, 0xf9, 0x88, 0x69, 0xe5, 0x53, 0xf9, 0x2d, 0x79, 0x01,
-  0x0c, 0x0f, 0x71, 0x7b, 0x02, 0x6d, 0x1a, 0x54, 0x84, 0x67, 0xa4, 0x46,
-  0xe4, 0x0c, 0xeb, 0x29, 0xfd, 0xb6, 0x96, 0xe0, 0x6d, 0xad, 0xe5, 0x25,
-  0xe1, 0xd0, 0xf9, 0x1d, 0x5e, 0xd6, 0x1e, 0x8c, 0x09, 0x8d, 0x92, 0x7e,
-  0x86, 0xe6, 0x35, 0x29, 0x64, 0x2d, 0x23, 0x55, 0x85, 0x6a, 0x3a, 0x9a,
-  0x23, 0x87, 0x36, 0x67, 0x6e, 0x68, 0xf3, 0xbd, 0x4d, 0x01, 0x11, 0x62,
-  0xce, 0xfb, 0xa9, 0xd3, 0x4d, 0x83, 0x74, 0x5b, 0xc1, 0x7a, 0xdf, 0x56,
-  0x2b, 0xf8, 0x4f, 0xb9, 0x8b, 0x96, 0x31, 0xb2, 0x25, 0xfd, 0xf9, 0x0c,
-  0x4b, 0x46, 0x6e, 0x1d, 0xa2, 0xc9, 0xd4, 0xaf, 0x9f, 0xa4, 0xee, 0xa7,
-  0x92, 0x94, 0xa7, 0x89, 0x7b, 0xd4, 0x2c, 0xf3, 0x1a, 0x31, 0xa5, 0xf2,
-  0x9d, 0x2b, 0x39, 0x59, 0x09, 0xcc, 0xea, 0xc2, 0xbf, 0x90, 0xe3, 0x9f,
-  0xd1, 0x68, 0xd8, 0x83, 0x3c, 0xa8, 0xbf, 0x12, 0x5c, 0x87, 0x16, 0x11,
-  0x0c, 0xfc, 0x29, 0xf2, 0x15, 0xda, 0x2c, 0xf2, 0x1b, 0x9d, 0xdf, 0x15,
-  0x93, 0x73, 0x15, 0xa8, 0x1d, 0x9f, 0x50, 0x1c, 0xab, 0xc2, 0xf7, 0x1c,
-  0x5e, 0xbc, 0xd4, 0xe7, 0x6e, 0xf8, 0xb1, 0x49, 0xae, 0x37, 0x8c, 0x89,
-  0xa5, 0x26, 0xd4, 0xc5, 0xf7, 0x3e, 0xd4, 0x16, 0xdd, 0xc1, 0xd7, 0x69,
-  0x7c, 0x97, 0x60, 0xf6, 0xb4, 0xd3, 0x53, 0x4c, 0x12, 0xd0, 0xb4, 0xc1,
-  0xe8, 0xcd, 0x55, 0x7e, 0xf9, 0x56, 0x98, 0xd4, 0x42, 0xa4, 0x2d, 0x20,
-  0x62, 0xa8, 0xe9, 0xc2, 0x33, 0xee, 0x6b, 0x68, 0xdc, 0xdf, 0xd0, 0xb8,
-  0xb5, 0x21, 0xee, 0x7b, 0x1c, 0x95, 0x49, 0x7a, 0x8f, 0x51, 0xb9, 0x31,
-  0xbd, 0x95, 0x54, 0xe5, 0xf8, 0x44, 0x43, 0x9e, 0x9d, 0x70, 0xc0, 0x6a,
-  0x19, 0x2f, 0xab, 0x13, 0x95, 0x63, 0xe6, 0x84, 0x7c, 0xd7, 0x0c, 0x0c,
-  0xc2, 0x46, 0x03, 0x71, 0xff, 0xd0, 0xee, 0xe8, 0x45, 0xc9, 0x79, 0xb4,
-  0x81, 0xe1, 0x11, 0xca, 0x9e, 0x8e, 0xa8, 0xd9, 0xeb, 0xbc, 0xaa, 0x22,
-  0x0c, 0x2b, 0xc5, 0xe7, 0xc1, 0x28, 0xc9, 0x34, 0x3e, 0x9e, 0x04, 0x3b,
-  0xf3, 0x0d, 0x07, 0x4e, 0x94, 0xe7, 0x8d, 0xdd, 0x10, 0xa5, 0x83, 0xbb,
-  0xf5, 0x15, 0x18, 0xbb, 0x82, 0x41, 0x65, 0x7b, 0x7a, 0x66, 0x82, 0xaa,
-  0xf1, 0xe4, 0xc2, 0xc7, 0x11, 0xff, 0x7a, 0x89, 0xb3, 0x1e, 0x17, 0x69,
-  0xb2, 0x4d, 0xaa, 0x91, 0x1b, 0x5e, 0x8a, 0xe1, 0xff, 0xf8, 0xf6, 0x15,
-  0xe7, 0xd3, 0xb4, 0x3b, 0xa6, 0xfe, 0xe9, 0xb0, 0x5f, 0xbd, 0x59, 0x27,
-  0x94, 0xab, 0x7e, 0x90, 0xf8, 0x71, 0x72, 0x02, 0x3d, 0x3f, 0xf9, 0x84,
-  0xda, 0x36, 0x0b, 0xda, 0x9c, 0xaf, 0xb6, 0xd9, 0xb3, 0x57, 0xb2, 0x13,
-  0x9b, 0xd2, 0x93, 0x4f, 0xa0, 0xab, 0x7a, 0x1b, 0x2e, 0xb7, 0xc2, 0xe3,
-  0x4d, 0x2d, 0xae, 0x6d, 0x9c, 0x8d, 0xda, 0xe1, 0x1d, 0x6f, 0x91, 0x45,
-  0x1d, 0xe9, 0xe2, 0x95, 0x21, 0x57, 0xe9, 0xbe, 0xe1, 0x24, 0x09, 0x39,
-  0xee, 0x84, 0x21, 0xcf, 0xc8, 0x84, 0x4d, 0x7f, 0xb1, 0xf9, 0xe0, 0x50,
-  0x4a, 0x3d, 0x25, 0x56, 0x87, 0x39, 0x19, 0x3c, 0x23, 0xbc, 0xc1, 0xe5,
-  0xbb, 0x14, 0xd3, 0x32, 0x18, 0x6a, 0x0b, 0x56, 0xc1, 0x9c, 0x14, 0x18,
-  0x83, 0xa7, 0x53, 0x39, 0xf3, 0x69, 0xb5, 0x28, 0xf8, 0xc2, 0x8d, 0x58,
-  0x99, 0x3d, 0x6a, 0xcc, 0x6b, 0xcf, 0xc4, 0xb2, 0x10, 0x20, 0x31, 0x55,
-  0x58, 0xcf, 0xfc, 0x24, 0xa8, 0x28, 0x8f, 0x3b, 0xc0, 0xea, 0x7c, 0x92,
-  0xd4, 0xb5, 0x52, 0x66, 0x94, 0x01, 0xd3, 0x67, 0x06, 0xe2, 0xf9, 0x73,
-  0xdd, 0x1e, 0x3e, 0x1c, 0x17, 0x43, 0x37, 0x4b, 0xf5, 0x4c, 0xfd, 0x46,
-  0xf1, 0x84, 0xde, 0x44, 0x01, 0x2d, 0x33, 0xc8, 0x09, 0xa8, 0x65, 0x99,
-  0xd7, 0xd1, 0x64, 0x6c, 0xf5, 0x2e, 0x65, 0x53, 0x17, 0x42, 0xed, 0x4b,
-  0x13, 0x73, 0xe4, 0xe9, 0x38, 0xb0, 0x3a, 0xa1, 0x63, 0xc0, 0x8c, 0xb4,
-  0xfb, 0x6a, 0x6e, 0xa4, 0xfd, 0x01, 0x47, 0x56, 0x27, 0x7b, 0xd0, 0x2b,
-  0xab, 0x7c, 0xb5, 0xa2, 0x7b, 0x4b, 0x5d, 0x7c, 0xc3, 0x59, 0x80, 0x8c,
-  0x85, 0xc9, 0x55, 0x80, 0x90, 0x43, 0x90, 0x32, 0x0c, 0xcd, 0xdf, 0x6f,
-  0x29, 0xed, 0xb7, 0x26, 0xe5, 0x63, 0x13, 0xfa, 0x44, 0x43, 0x86, 0xdb,
-  0x85, 0xf4, 0x14, 0xdf, 0x1d, 0xb8, 0xec, 0x1c, 0x34, 0x9e, 0x77, 0xc0,
-  0x7b, 0x0e, 0xdb, 0x1d, 0x45, 0xa5, 0xc2, 0x76, 0x72, 0xa6, 0xf7, 0xee,
-  0x4d, 0xe2, 0x61, 0xfa, 0x6d, 0x27, 0x26, 0x27, 0x46, 0xbd, 0x36, 0x1e,
-  0x76, 0x04, 0x90, 0xbb, 0x80, 0x3e, 0x93, 0x02, 0xc3, 0x32, 0x1f, 0x97,
-  0x6d, 0x92, 0xd6, 0x22, 0x3d, 0x74, 0xaa, 0x65, 0xf0, 0x14, 0x0f, 0x5f,
-  0x63, 0xe8, 0xa6, 0x0d, 0xde, 0xa5, 0x35, 0x2c, 0xdb, 0x80, 0xfd, 0x5d,
-  0xbf, 0x30, 0x46, 0xeb, 0x74, 0xcf, 0xc5, 0x13, 0xc1, 0x0c, 0xb9, 0x77,
-  0x22, 0xc0, 0x8e, 0xbb, 0xb0, 0x5a, 0x79, 0xf0, 0xf0, 0xc6, 0xa4, 0xda,
-  0x83, 0x80, 0xa2, 0xf8, 0x2f, 0x0c, 0x6a, 0x33, 0x29, 0xd6, 0x4f, 0x54,
-  0x1a, 0x61, 0x62, 0x06, 0xc9, 0x5c, 0x1b, 0x15, 0xd7, 0xb8, 0x2d, 0x52,
-  0xcd, 0x96, 0x45, 0xa5, 0xdf, 0x01, 0xe9, 0x90, 0x8a, 0x54, 0xdb, 0x24,
-  0xb1, 0x21, 0x91, 0xba, 0x5f, 0x20, 0x59, 0xda, 0x90, 0x07, 0xc7, 0x51,
-  0x7a, 0x1d, 0x69, 0x15, 0x17, 0x59, 0x1c, 0x01, 0x97, 0x8c, 0xc2, 0x42,
-  0x92, 0xfa, 0x28, 0x32, 0x92, 0x9f, 0x2b, 0x31, 0x99, 0x35, 0x4f, 0xe4,
-  0xb9, 0x93, 0x61, 0x82, 0x4e, 0x27, 0xc3, 0xa2, 0xe7, 0x54, 0x24, 0x87,
-  0xce, 0x64, 0xbc, 0x4b, 0xf7, 0x65, 0x70, 0x41, 0xa6, 0x5b, 0x3e, 0x74,
-  0x00, 0x5d, 0xfa, 0xc4, 0xe1, 0x2c, 0x48, 0xee, 0x0b, 0x1a, 0xcd, 0x3f,
-  0x42, 0x1b, 0xa2, 0xc7, 0x76, 0xae, 0x24, 0x4c, 0xb7, 0xfe, 0x5a, 0x1c,
-  0x93, 0x21, 0xf1, 0xfd, 0xdb, 0x13, 0xdf, 0x85, 0xa1, 0xed, 0x91, 0x26,
-  0x73, 0x9b, 0x94, 0xf1, 0xfb, 0x37, 0xd9, 0xdb, 0x54, 0x63, 0xa9, 0x98,
-  0x48, 0xc5, 0xc8, 0x11, 0xef, 0xa8, 0x7b, 0x61, 0xdc, 0xba, 0x8a, 0xaa,
-  0xc9, 0x2a, 0x59, 0xaf, 0x27, 0xeb, 0x09, 0x4c, 0xdb, 0xc9, 0xdd, 0xcb,
-  0x68, 0x5a, 0xe7, 0xd9, 0x7a, 0xc8, 0x61, 0xaf, 0x4c, 0xf7, 0x33, 0x64,
-  0x50, 0xa2, 0xde, 0x3e, 0x99, 0xdd, 0xb1, 0x0f, 0xa2, 0x99, 0x20, 0xaa,
-  0x58, 0x1b, 0x50, 0x28, 0x3f, 0x18, 0xc0, 0x5a, 0x8e, 0xf1, 0x33, 0xb4,
-  0x61, 0xcc, 0x09, 0x51, 0xe5, 0x6e, 0x77, 0xcf, 0x9f, 0x2f, 0x92, 0x2c,
-  0xdf, 0x52, 0x92, 0x8c, 0x3c, 0x5e, 0xaf, 0x93, 0x25, 0xda, 0x4e, 0x4a,
-  0x7f, 0x88, 0x0c, 0x08, 0xf7, 0x78, 0xb9, 0xc9, 0x51, 0x1f, 0x14, 0x89,
-  0x52, 0x1f, 0x10, 0x5d, 0xec, 0x0e, 0x0a, 0xe8, 0x5e, 0x9f, 0xa4, 0x4f,
-  0x64, 0x37, 0xde, 0xf1, 0x9b, 0xc6, 0xb0, 0x7b, 0x64, 0x39, 0x6e, 0x1d,
-  0x6b, 0x7c, 0xd6, 0x20, 0x36, 0x7f, 0xe2, 0xf4, 0xc9, 0x2e, 0x3d, 0x74,
-  0x5f, 0x34, 0xb8, 0x65, 0xfe, 0x03, 0x08, 0xde, 0x01, 0xc3, 0xb3, 0x35,
-  0x1d, 0xcf, 0x2d, 0x9a, 0x46, 0xf8, 0x53, 0x61, 0xd8, 0xa6, 0x88, 0x42,
-  0x6a, 0x01, 0x7e, 0xed, 0xb0, 0x21, 0x72, 0xf1, 0x79, 0xe0, 0xa6, 0xd8,
-  0x0c, 0x23, 0x80, 0xf8, 0x51, 0xe2, 0x8e, 0x69, 0xeb, 0x2e, 0x60, 0xef,
-  0xd9, 0xa2, 0x6c, 0x10, 0x83, 0x8a, 0xfd, 0x3d, 0x6d, 0xc2, 0x9c, 0x9f,
-  0xb5, 0x4b, 0xe9, 0x3a, 0x40, 0xd8, 0xc6, 0x46, 0x50, 0xa1, 0x9b, 0x65,
-  0xb9, 0x25, 0x86, 0x53, 0x34, 0xde, 0xea, 0x2c, 0x1b, 0xb9, 0x52, 0x9c,
-  0xfc, 0x0c, 0x85, 0xb9, 0x18, 0x10, 0xb9, 0x54, 0xbd, 0x3a, 0x3d, 0xd5,
-  0x46, 0xf1, 0xc2, 0x66, 0x2f, 0xad, 0x1d, 0x9e, 0x5d, 0xd3, 0x8e, 0x9f,
-  0xc0, 0xc8, 0x7b, 0x70, 0x30, 0x68, 0x7b, 0xf2, 0xf2, 0x2b, 0xb9, 0x31,
-  0xfd, 0x94, 0x0c, 0x02, 0x3b, 0x55, 0xe8, 0xcc, 0x47, 0xa4, 0x89, 0xf4,
-  0x67, 0x24, 0xe0, 0x5a, 0x5a, 0xc4, 0xdf, 0xd5, 0xc8, 0xc3, 0x51, 0xe3,
-  0x54, 0x15, 0x2a, 0x9d, 0xe2, 0x1f, 0x3a, 0x20, 0x1b, 0xa1, 0x1b, 0x96,
-  0xaa, 0x03, 0x55, 0xbf, 0x65, 0x12, 0x43, 0x87, 0xa1, 0x02, 0x9a, 0xe7,
-  0xf1, 0x64, 0x44, 0xf6, 0xb2, 0x4b, 0xd9, 0xa3, 0xbc, 0xb9, 0x26, 0xf2,
-  0x13, 0x35, 0xd9, 0xa4, 0x15, 0x5c, 0xd7, 0x81, 0xff, 0xc8, 0xdc, 0xa3,
-  0x1e, 0x1c, 0x38, 0x53, 0xc3, 0x5d, 0x4e, 0x05, 0xde, 0x1f, 0x20, 0x06,
-  0xd5, 0x32, 0x28, 0x4b, 0x25, 0x9d, 0xf0, 0xcf, 0xe8, 0x40, 0x1b, 0xfd,
-  0xef, 0x46, 0xbe, 0xcd, 0xd9, 0x61, 0x69, 0xab, 0xf7, 0x44, 0x2f, 0xfe,
-  0x94, 0x6e, 0xca, 0x68, 0xf6, 0x1c, 0xc3, 0x90, 0x49, 0xd8, 0xd1, 0xdc,
-  0x28, 0xf4, 0xed, 0x1a, 0xf3, 0x55, 0xbb, 0xdb, 0x1c, 0x43, 0x4d, 0x9c,
-  0x9e, 0xb4, 0xe8, 0x4b, 0x0c, 0x68, 0xe1, 0xda, 0x2c, 0xe6, 0x0c, 0x77,
-  0x7e, 0x16, 0x12, 0x16, 0x2d, 0x10, 0x0d, 0xff, 0x97, 0xf1, 0x63, 0x8f,
-  0x9a, 0x07, 0x00, 0xa4, 0xe3, 0x3d, 0x76, 0xa9, 0x78, 0x00, 0x64, 0x61,
-  0x5a, 0xc8, 0x05, 0x18, 0xe7, 0x3a, 0xad, 0x2e, 0x5e, 0xa8, 0x34, 0x68,
-  0xbf, 0xe7, 0x9e, 0x24, 0x59, 0x0f, 0x9d, 0x08, 0xa1, 0xd3, 0x34, 0x26,
-  0x99, 0x64, 0x69, 0x6c, 0x19, 0xe0, 0x04, 0xf5, 0x01, 0x0f, 0xb2, 0x6d,
-  0x88, 0x01, 0xb2, 0x43, 0x71, 0xf5, 0x4a, 0x9b, 0x34, 0xf3, 0xc1, 0xb8,
-  0x87, 0x6c, 0x9d, 0x88, 0x08, 0x67, 0xfb, 0x65, 0x27, 0x57, 0x30, 0xa0,
-  0x85, 0x6b, 0x23, 0x99, 0xe1, 0x3a, 0xa8, 0xae, 0x03, 0x04, 0x6e, 0x36,
-  0xf3, 0x6a, 0x10, 0xed, 0x06, 0x8e, 0x38, 0xe4, 0x69, 0xe7, 0x21, 0xc0,
-  0xc0, 0x76, 0x50, 0x16, 0x80, 0x69, 0x12, 0x77, 0x4d, 0xcf, 0x27, 0x15,
-  0xbb, 0x3e, 0xe2, 0x0c, 0x1c, 0x11, 0x87, 0x0f, 0xdf, 0x76, 0xd2, 0x67,
-  0xc0, 0x3d, 0xe8, 0xb6, 0x41, 0x36, 0xd0, 0x1d, 0xbd, 0x09, 0xc0, 0x04,
-  0x7a, 0x13, 0xbf, 0xed, 0xef, 0x09, 0xc2, 0x98, 0x5e, 0x74, 0x7b, 0x2a,
-  0x12, 0xac, 0x0f, 0xda, 0xda, 0x07, 0x04, 0xed, 0xa2, 0xdf, 0x2f, 0x6f,
-  0xd2, 0x8e, 0x6f, 0x6d, 0xf4, 0x12, 0xcf, 0x40, 0x4c, 0x7d, 0xda, 0x33,
-  0x07, 0x0c, 0xeb, 0x81, 0xb6, 0x11, 0xcf, 0xa0, 0x1d, 0xd4, 0xd7, 0x01,
-  0x42, 0xe4, 0xf7, 0x0f, 0x7d, 0x6a, 0x87, 0x3e, 0xed, 0x1b, 0xfa, 0xd4,
-  0x0c, 0x7d, 0xda, 0x37, 0xf4, 0x69, 0xcf, 0xd0, 0xa7, 0x7d, 0x43, 0x8f,
-  0x96, 0xf1, 0xbe, 0xfd, 0x86, 0x52, 0xf5, 0x91, 0x9c, 0x73, 0x9e, 0x7f,
-  0xc0, 0x8f, 0xa0, 0x4a, 0xc3, 0x3f, 0x3d, 0x32, 0x12, 0x01, 0x59, 0x48,
-  0x5a, 0xd8, 0xb6, 0xee, 0x20, 0xec, 0xdf, 0x75, 0xf9, 0xb1, 0x66, 0x92,
-  0xd1, 0xae, 0xcd, 0xcb, 0x00, 0x21, 0x46, 0xf6, 0x6e, 0x03, 0x5b, 0x83,
-  0x4f, 0xfa, 0x30, 0x27, 0x9f, 0xdb, 0x7c, 0x0f, 0xb8, 0xb2, 0x57, 0xa7,
-  0xdd, 0xb5, 0x15, 0x60, 0xff, 0xb6, 0x7d, 0xe0, 0xfd, 0xe2, 0x66, 0x4f,
-  0xf2, 0xa2, 0xa7, 0x23, 0x79, 0x51, 0xef, 0x47, 0x5e, 0x0c, 0xec, 0x06,
-  0x55, 0x75, 0x6b, 0xb4, 0x76, 0x02, 0x20, 0x3f, 0x6e, 0xef, 0x83, 0x57,
-  0xca, 0x5d, 0xf0, 0xca, 0x49, 0x6b, 0xd6, 0xea, 0xba, 0xfd, 0x3d, 0x6d,
-  0xc2, 0x5c, 0xb4, 0xfb, 0xc7, 0xd4, 0xca, 0x9b, 0x5e, 0x0e, 0xab, 0xb8,
-  0x48, 0x6e, 0xa2, 0x2a, 0xb9, 0x11, 0xe3, 0x67, 0xfd, 0xc3, 0xb4, 0x0d,
-  0xbc, 0xe3, 0x6c, 0xe4, 0x81, 0x9d, 0xb7, 0x3b, 0xb6, 0x8c, 0xf1, 0x60,
-  0x3e, 0xa4, 0x5d, 0x06, 0xec, 0x68, 0x51, 0x03, 0x84, 0xdb, 0x72, 0x92,
-  0x29, 0x9b, 0x36, 0x1a, 0xd7, 0xe3, 0x94, 0x2c, 0x9b, 0x01, 0x16, 0x8b,
-  0x22, 0xbe, 0x11, 0xfd, 0x5f, 0xae, 0xcd, 0x8d, 0xfb, 0xd5, 0x24, 0x5f,
-  0xad, 0x4a, 0x9b, 0x8a, 0xe3, 0xcc, 0x1e, 0x15, 0x04, 0x94, 0x9d, 0x73,
-  0x7d, 0x30, 0x7e, 0x62, 0xa0, 0xe1, 0x3a, 0xb9, 0x9a, 0x71, 0x6b, 0x94,
-  0x2c, 0xcc, 0xbf, 0x75, 0x37, 0x20, 0x4d, 0x57, 0x85, 0x95, 0xf1, 0x21,
-  0x51, 0xbe, 0xb3, 0xc1, 0xaa, 0xcd, 0x8b, 0xc4, 0x7b, 0x4d, 0xca, 0xe9,
-  0x25, 0x54, 0xb7, 0x63, 0x10, 0x01, 0x81, 0x3b, 0xcc, 0x41, 0xc4, 0xef,
-  0xfb, 0x86, 0x26, 0xf3, 0xd2, 0x9f, 0x81, 0x56, 0xb8, 0x0b, 0x7f, 0x22,
-  0xcc, 0xb1, 0xc4, 0x6b, 0xbb, 0xb2, 0xc6, 0x10, 0xdd, 0xec, 0x20, 0x46,
-  0x6b, 0x81, 0xaa, 0xcd, 0xfd, 0x41, 0xa0, 0x41, 0x93, 0xbe, 0xaf, 0xce,
-  0x17, 0x7a, 0x16, 0x66, 0xce, 0xb3, 0x60, 0xe9, 0xfc, 0x26, 0x2a, 0x4a,
-  0x95, 0xce, 0x61, 0x55, 0x97, 0x9c, 0x88, 0x0c, 0x3e, 0xcc, 0x35, 0x67,
-  0x5a, 0x2b, 0x11, 0x1a, 0x7f, 0x1c, 0xab, 0x4e, 0x9a, 0xa3, 0x7f, 0xd1,
-  0x26, 0x49, 0x63, 0xa5, 0x31, 0xac, 0x24, 0xaf, 0x2f, 0xd1, 0xa3, 0x71,
-  0xb8, 0xc9, 0xdd, 0xf8, 0x37, 0x43, 0xf7, 0x1b, 0xae, 0xb9, 0x05, 0xf4,
-  0x27, 0x4f, 0x14, 0xbd, 0x31, 0x72, 0x8e, 0xc6, 0x53, 0x8d, 0x02, 0x69,
-  0x9d, 0x52, 0x8b, 0x66, 0xc4, 0x89, 0x40, 0x3a, 0xa5, 0x4b, 0xd3, 0xee,
-  0x63, 0x4c, 0xfa, 0x70, 0xc6, 0x94, 0xd2, 0xc1, 0x49, 0xd3, 0x41, 0x18,
-  0x74, 0xe7, 0xf5, 0x77, 0x42, 0x6e, 0x7b, 0x2a, 0xcf, 0xc7, 0x68, 0x74,
-  0x6d, 0x63, 0x6a, 0x73, 0x91, 0xa1, 0xdb, 0x37, 0x4c, 0x0b, 0x59, 0xe3,
-  0xbc, 0x74, 0x36, 0x48, 0xcb, 0x84, 0x5b, 0xa2, 0x45, 0xa3, 0x0c, 0xc4,
-  0x99, 0x5b, 0xe6, 0x5a, 0x11, 0xb8, 0xa3, 0x47, 0x13, 0xe7, 0x85, 0x11,
-  0x38, 0xed, 0x0b, 0x85, 0x07, 0x74, 0x91, 0x22, 0xe8, 0x0c, 0x36, 0x7e,
-  0xfc, 0x0b, 0x93, 0xb0, 0x0e, 0xbf, 0xad, 0xa9, 0x9b, 0xeb, 0xe8, 0xdd,
-  0x43, 0xb5, 0x82, 0x1d, 0xfa, 0x5c, 0x6e, 0xf0, 0x30, 0xf9, 0xa3, 0x18,
-  0xe7, 0x46, 0x53, 0xd7, 0x7c, 0x47, 0xa5, 0x93, 0x56, 0x1e, 0x23, 0x1a,
-  0xa5, 0x27, 0xce, 0xc3, 0x86, 0xc1, 0xe1, 0x34, 0xe3, 0xf8, 0xfc, 0xb9,
-  0x92, 0x77, 0x31, 0x37, 0x36, 0x05, 0xae, 0xb3, 0x12, 0xb0, 0x14, 0xd3,
-  0xf2, 0x27, 0x15, 0xfb, 0xdf, 0x48, 0x2d, 0x7c, 0xd4, 0x14, 0xef, 0x82,
-  0xc9, 0x1d, 0x27, 0x52, 0xc6, 0x14, 0xc5, 0xbe, 0x70, 0xf4, 0x0c, 0x31,
-  0x21, 0x99, 0xad, 0x40, 0x16, 0x9e, 0xfa, 0x73, 0x36, 0x46, 0x93, 0xb8,
-  0xaa, 0x68, 0xfc, 0xd0, 0x5e, 0x6f, 0x9c, 0xf2, 0xc5, 0xbe, 0x6e, 0xcc,
-  0x34, 0x8b, 0x98, 0x8d, 0xfd, 0x6b, 0x72, 0x5d, 0xa9, 0x12, 0x4c, 0x3f,
-  0x8a, 0xb5, 0x9a, 0xb3, 0x4e, 0x49, 0x98, 0x75, 0x8a, 0x66, 0x6a, 0xb9,
-  0x64, 0x8b, 0x2d, 0x88, 0xe6, 0x73, 0x75, 0xaf, 0x2e, 0xea, 0x6c, 0xe1,
-  0x72, 0x85, 0x31, 0xef, 0x4e, 0xce, 0x3d, 0xc0, 0x0f, 0xc1, 0x23, 0x16,
-  0xf7, 0x1d, 0x27, 0x07, 0x9f, 0xac, 0xd0, 0xea, 0x70, 0xd4, 0x78, 0x27,
-  0x72, 0xb4, 0x1a, 0xa9, 0x51, 0xc9, 0xa2, 0x18, 0x1f, 0x4e, 0x89, 0x0b,
-  0xbe, 0x67, 0x45, 0xc7, 0x67, 0x75, 0x42, 0x95, 0xe0, 0x4f, 0x32, 0x50,
-  0xa8, 0x93, 0x4f, 0x74, 0xc3, 0xea, 0xb9, 0x5a, 0xfd, 0x90, 0x29, 0x02,
-  0xa7, 0x47, 0x0f, 0x10, 0x7f, 0x9c, 0xe5, 0x5b, 0x65, 0x52, 0x32, 0x73,
-  0x8e, 0x76, 0x7b, 0xbd, 0x5c, 0xf7, 0x4d, 0x99, 0x2c, 0x54, 0x2c, 0x8e,
-  0x24, 0x3f, 0x4e, 0xb8, 0xa1, 0x93, 0x09, 0x39, 0x67, 0x27, 0xeb, 0xfb,
-  0xc8, 0x25, 0x62, 0xa1, 0x4e, 0xe2, 0xa9, 0x3c, 0x51, 0x67, 0x4c, 0x35,
-  0x96, 0xf1, 0x2c, 0x83, 0xd3, 0x33, 0x98, 0xd2, 0x32, 0x20, 0x10, 0xf6,
-  0x98, 0x7a, 0xa8, 0xb9, 0x97, 0x88, 0x0f, 0x3a, 0x88, 0x54, 0x03, 0xf0,
-  0x09, 0x30, 0x44, 0xd0, 0x27, 0x8c, 0x27, 0xa3, 0x69, 0x59, 0x2f, 0xd0,
-  0x09, 0xa8, 0xee, 0x1a, 0x4e, 0x1f, 0x6b, 0xab, 0x52, 0xde, 0x73, 0x48,
-  0xd6, 0x75, 0xd5, 0xcc, 0x31, 0xf8, 0x20, 0x90, 0xa7, 0xc8, 0x61, 0x46,
-  0xdb, 0x06, 0x7c, 0xcf, 0x9b, 0xa7, 0xd4, 0xba, 0x5e, 0xe2, 0x35, 0x4a,
-  0x8c, 0x80, 0x10, 0x77, 0x1d, 0xb7, 0xc1, 0x10, 0x62, 0xbb, 0x17, 0x50,
-  0x6f, 0x31, 0xb1, 0xaa, 0xe3, 0xa5, 0x48, 0xa9, 0x1c, 0xed, 0x26, 0x31,
-  0x79, 0x65, 0x2f, 0x6b, 0x11, 0x72, 0x0a, 0xec, 0x6c, 0xb6, 0x0c, 0x25,
-  0xee, 0x63, 0x62, 0x22, 0x64, 0x9f, 0xb6, 0x40, 0x8d, 0x49, 0xfc, 0x56,
-  0xef, 0x23, 0xfc, 0x89, 0xdf, 0xda, 0x32, 0xef, 0x2c, 0xb2, 0x03, 0x83,
-  0x8c, 0x2c, 0x83, 0x1c, 0x71, 0x12, 0xc3, 0xa9, 0xb1, 0xbf, 0x9a, 0x22,
-  0xdf, 0x90, 0x58, 0x9f, 0x17, 0x02, 0x91, 0xb1, 0x70, 0xc7, 0x4c, 0x66,
-  0x2b, 0xa6, 0x84, 0x88, 0xb5, 0xf1, 0x37, 0x35, 0xc2, 0x52, 0xd6, 0x31,
-  0xfb, 0xa2, 0x5b, 0x54, 0xa8, 0x69, 0xaf, 0xe5, 0xb6, 0x76, 0x03, 0x9c,
-  0x22, 0x35, 0xc2, 0x7d, 0x38, 0x18, 0xc6, 0x3e, 0x4d, 0xd8, 0xc0, 0xcc,
-  0x73, 0x43, 0x1d, 0x9d, 0xe3, 0x6e, 0x19, 0x86, 0x70, 0x86, 0xdb, 0x71,
-  0x02, 0x85, 0x1e, 0x15, 0x4d, 0xd3, 0xe5, 0x4a, 0x22, 0x25, 0xcd, 0xaf,
-  0x69, 0xbd, 0xfc, 0xb2, 0xfd, 0xa8, 0xe1, 0x95, 0x36, 0xac, 0x8f, 0xab,
-  0xdc, 0x58, 0xed, 0x9c, 0xdf, 0x01, 0x98, 0xcb, 0x9e, 0xbb, 0xdf, 0x85,
-  0xf3, 0xc4, 0xa7, 0x96, 0xc4, 0x5c, 0xe2, 0xa6, 0x20, 0x25, 0xea, 0xb4,
-  0x7d, 0x7e, 0x82, 0x55, 0x82, 0x69, 0x4c, 0x39, 0x4f, 0x7c, 0x3f, 0xb2,
-  0xa2, 0x0d, 0x19, 0xef, 0x4b, 0xe8, 0xf4, 0x04, 0x93, 0x70, 0x54, 0xc1,
-  0x76, 0x97, 0x54, 0x31, 0x67, 0xea, 0x6f, 0x4a, 0x2a, 0x34, 0xf2, 0x37,
-  0x5c, 0xb8, 0x67, 0x4e, 0x8e, 0x56, 0x84, 0xd0, 0xd7, 0x0c, 0x23, 0x8f,
-  0xb7, 0x02, 0xa8, 0x92, 0x50, 0x82, 0xef, 0x1a, 0x32, 0x7c, 0x31, 0x67,
-  0x00, 0x3a, 0x26, 0x4c, 0xe3, 0xd1, 0x2f, 0x26, 0xeb, 0xb1, 0xb0, 0x57,
-  0xe2, 0xda, 0xc9, 0xd3, 0x3c, 0x42, 0x3c, 0x02, 0x05, 0x00, 0xbd, 0x2a,
-  0xb3, 0xed, 0x68, 0xea, 0x5c, 0x9d, 0x1b, 0x57, 0x57, 0x8d, 0x80, 0x2d,
-  0x78, 0xe7, 0xca, 0xdc, 0x72, 0xf3, 0x3e, 0xc1, 0x57, 0x1b, 0xf2, 0x4d,
-  0x05, 0xb0, 0x83, 0xd2, 0x69, 0xd1, 0x9b, 0xca, 0x6d, 0xd8, 0xfd, 0x2b,
-  0x73, 0x8d, 0xde, 0x7c, 0x7c, 0x62, 0x9d, 0x18, 0x9d, 0x26, 0xca, 0x2a,
-  0xde, 0x99, 0x26, 0x5c, 0x14, 0x52, 0xdd, 0xdc, 0xa9, 0x87, 0x6a, 0x67,
-  0xf1, 0x5d, 0x65, 0x09, 0x14, 0xd8, 0x3a, 0x81, 0x65, 0x72, 0xd7, 0x81,
-  0xa3, 0xda, 0x14, 0x7b, 0x67, 0x0c, 0x35, 0x6c, 0x1d, 0x07, 0x0b, 0xce,
-  0x12, 0x14, 0xe1, 0xac, 0xd1, 0x45, 0x8a, 0x34, 0x24, 0xd3, 0x0e, 0x79,
-  0x86, 0xb9, 0x50, 0x2d, 0x6d, 0xd2, 0x86, 0x60, 0x1b, 0x25, 0x41, 0xe5,
-  0x55, 0x63, 0xcc, 0x55, 0xb3, 0x26, 0x8b, 0x79, 0x77, 0xce, 0xbd, 0x4a,
-  0x2a, 0xd0, 0xd8, 0x2a, 0xb7, 0xe0, 0x31, 0x2e, 0x8a, 0x4d, 0x78, 0x1d,
-  0x0a, 0x3f, 0xfb, 0x3c, 0x38, 0x8c, 0xe3, 0x88, 0x5c, 0x0b, 0x94, 0x64,
-  0x01, 0xb6, 0xf9, 0x75, 0x4e, 0x86, 0xcc, 0x49, 0x43, 0xca, 0xc8, 0x1b,
-  0x0c, 0xd9, 0xee, 0x7f, 0x74, 0x12, 0xf1, 0xce, 0xf7, 0x91, 0x68, 0x63,
-  0xaa, 0xf0, 0xbd, 0x1b, 0x9d, 0x36, 0xbb, 0x39, 0x36, 0xcd, 0x8d, 0xcc,
-  0x85, 0x9f, 0x90, 0xc1, 0x98, 0xd2, 0xef, 0xd6, 0xcc, 0xc5, 0xde, 0xd6,
-  0x87, 0x55, 0x06, 0xe1, 0x66, 0x48, 0xc0, 0x0a, 0x28, 0x43, 0xe8, 0xd0,
-  0xf1, 0xeb, 0x58, 0x23, 0x82, 0x51, 0xdd, 0x1d, 0x33, 0x6b, 0x36, 0x26,
-  0x37, 0xa5, 0x77, 0xa5, 0x5b, 0x62, 0x8a, 0x56, 0xe6, 0x41, 0xae, 0xda,
-  0x2b, 0x58, 0xfc, 0x3a, 0x6b, 0x24, 0x8f, 0x15, 0x88, 0x3a, 0x85, 0xc3,
-  0x8a, 0x8a, 0x89, 0x1f, 0x04, 0x90, 0x2e, 0xd2, 0x57, 0x93, 0xc7, 0x4f,
-  0xa7, 0x8f, 0x9f, 0xaa, 0x17, 0xcf, 0xf0, 0x0f, 0xf6, 0xf4, 0xf7, 0xf2,
-  0x82, 0x0f, 0x7c, 0x68, 0xd4, 0x1c, 0x05, 0xb5, 0xa6, 0xe5, 0xf5, 0xd0,
-  0x8b, 0xcc, 0xd4, 0x7c, 0x1f, 0x78, 0xb6, 0xa1, 0x91, 0x64, 0x38, 0x8d,
-  0xfd, 0xc1, 0x08, 0x99, 0xfc, 0xa3, 0x45, 0x9c, 0x06, 0xa1, 0xea, 0x03,
-  0x4a, 0xfb, 0x2b, 0xc6, 0x24, 0x85, 0x13, 0x8b, 0xeb, 0x9b, 0x68, 0xf8,
-  0x7f, 0xbc, 0x16, 0xed, 0xb3, 0x61, 0xcc, 0x8b, 0x57, 0x49, 0x96, 0xc0,
-  0x39, 0x36, 0x95, 0xa7, 0x07, 0xd5, 0xd3, 0xef, 0x4f, 0xa7, 0xc8, 0x9b,
-  0x0d, 0x07, 0x0e, 0xd3, 0x50, 0xad, 0xdd, 0x06, 0x5d, 0xdb, 0x7b, 0x7c,
-  0x55, 0x26, 0x8d, 0x8c, 0x60, 0x7d, 0xfa, 0xd1, 0x12, 0x5f, 0x1d, 0xa5,
-  0x58, 0x89, 0xa4, 0xdc, 0xcc, 0xa0, 0xd6, 0x6e, 0x5f, 0x79, 0xa7, 0xa6,
-  0x63, 0x72, 0xb9, 0x99, 0x2d, 0x93, 0x62, 0x89, 0xcf, 0x90, 0xb3, 0x54,
-  0x83, 0x52, 0x9f, 0xa3, 0x82, 0x09, 0xf0, 0x79, 0x81, 0xd2, 0x6b, 0x0f,
-  0x05, 0xe7, 0x5e, 0x77, 0x4e, 0x29, 0x78, 0xba, 0x84, 0xb3, 0x25, 0x62,
-  0x5f, 0x6a, 0xa3, 0x10, 0x73, 0xdb, 0x1d, 0x9f, 0x74, 0xaa, 0x0d, 0xe9,
-  0xba, 0x13, 0x0a, 0x26, 0xd8, 0x74, 0x9c, 0x78, 0xba, 0xfa, 0xc0, 0x9d,
-  0xa7, 0x67, 0xd1, 0x8f, 0xa3, 0xb4, 0x9a, 0x71, 0xf7, 0xef, 0x2f, 0x56,
-  0xc7, 0x80, 0x45, 0x0f, 0x86, 0x67, 0xa3, 0x04, 0xd0, 0xb9, 0x06, 0x02,
-  0xf1, 0xba, 0x73, 0xf4, 0xc0, 0x27, 0xfa, 0x28, 0x04, 0xc2, 0xbc, 0xc2,
-  0x07, 0x3c, 0xb3, 0x3c, 0x8b, 0xfd, 0xc3, 0xdc, 0xd8, 0x60, 0xd7, 0x5c,
-  0x57, 0xab, 0x11, 0x95, 0xcb, 0x24, 0x69, 0xad, 0x52, 0xb9, 0x25, 0x4d,
-  0x72, 0x83, 0x18, 0x8d, 0x55, 0xf0, 0xdd, 0xf1, 0xd9, 0xee, 0x0b, 0x56,
-  0x13, 0xf3, 0x2e, 0x66, 0x1e, 0x35, 0xfa, 0x73, 0xf6, 0x26, 0xcb, 0x6f,
-  0x33, 0x25, 0x23, 0x82, 0x7e, 0xe4, 0x23, 0xbf, 0x45, 0xa2, 0x63, 0xcf,
-  0x70, 0x32, 0x23, 0x95, 0xa4, 0xa6, 0x78, 0xa2, 0xf3, 0x53, 0xe8, 0x70,
-  0xa2, 0x39, 0x3a, 0xe7, 0xa6, 0x15, 0xdb, 0x0f, 0x51, 0x26, 0x97, 0x55,
-  0x54, 0x61, 0x48, 0xf3, 0xf2, 0x4d, 0x74, 0xcd, 0x2f, 0xc0, 0x84, 0x1e,
-  0x10, 0x91, 0x90, 0xa5, 0xe6, 0x89, 0xde, 0x17, 0x04, 0xda, 0x93, 0x39,
-  0xdd, 0x73, 0xb0, 0x8f, 0xe3, 0x50, 0x83, 0x0e, 0x34, 0x7e, 0x04, 0x00,
-  0x32, 0xa0, 0x6f, 0x40, 0xc5, 0x65, 0x5d, 0x3e, 0x31, 0x27, 0xde, 0xc5,
-  0x3e, 0x49, 0x57, 0x33, 0xf4, 0xb0, 0x8f, 0x59, 0x96, 0x04, 0x5d, 0xd9,
-  0x0b, 0x15, 0x5b, 0xa7, 0xf6, 0xd8, 0x61, 0x6f, 0x74, 0xe0, 0xe1, 0x9d,
-  0x25, 0xe1, 0x65, 0x00, 0x14, 0xb0, 0xc1, 0x86, 0x46, 0x6d, 0x6b, 0xe4,
-  0xc0, 0x16, 0x11, 0x7b, 0xcf, 0x61, 0x9d, 0x38, 0x6d, 0xe3, 0xce, 0x9d,
-  0x28, 0xee, 0xd3, 0x74, 0x3a, 0xf5, 0x1a, 0x10, 0x44, 0x64, 0xbe, 0xf9,
-  0xb1, 0x86, 0x83, 0x1f, 0x39, 0xde, 0xb6, 0x81, 0x1f, 0x4d, 0x24, 0xc8,
-  0x8f, 0x0c, 0x6c, 0x66, 0x90, 0xfd, 0x2a, 0xbc, 0x1e, 0xb7, 0x2d, 0x4f,
-  0xde, 0xd4, 0xee, 0x54, 0x1a, 0xb3, 0x5c, 0x9f, 0xbf, 0x16, 0x29, 0x19,
-  0x69, 0x42, 0x82, 0xa9, 0x3a, 0x40, 0x7c, 0x8c, 0x3f, 0x71, 0x7d, 0xb1,
-  0x60, 0xdd, 0x89, 0xd7, 0x27, 0x45, 0xff, 0x37, 0x4a, 0x97, 0x52, 0xfa,
-  0x95, 0x72, 0xec, 0x47, 0x93, 0xf1, 0x75, 0x9c, 0x71, 0x43, 0x4f, 0xb4,
-  0xfd, 0x4a, 0x1b, 0xb5, 0xa6, 0xca, 0xc4, 0x05, 0x26, 0xea, 0xaf, 0xf0,
-  0xd7, 0x56, 0x1e, 0xcb, 0x3a, 0x82, 0x3a, 0xd5, 0x5c, 0x84, 0xef, 0xc9,
-  0x1d, 0x95, 0x6b, 0x6b, 0x16, 0x10, 0x06, 0x2d, 0xd1, 0x6f, 0x37, 0xd9,
-  0x80, 0xd9, 0xad, 0xb1, 0x43, 0x5f, 0x85, 0x62, 0xd0, 0xc7, 0x91, 0x17,
-  0x5c, 0xe9, 0xfd, 0xe5, 0x2d, 0x9a, 0x1c, 0x8e, 0x1e, 0xf9, 0x2e, 0x4f,
-  0xef, 0xed, 0x1b, 0x3f, 0xe1, 0x05, 0xb2, 0xcb, 0x97, 0x9b, 0x4d, 0xb4,
-  0x45, 0xfb, 0x58, 0x68, 0x85, 0xd4, 0x96, 0xc7, 0x1b, 0x37, 0xe5, 0x40,
-  0xcd, 0xc6, 0x9c, 0x1a, 0x7b, 0x41, 0x20, 0x7c, 0x2f, 0x71, 0x2e, 0x89,
-  0x59, 0xbe, 0xa3, 0x1d, 0x1a, 0x13, 0xc8, 0x4f, 0xb6, 0xf6, 0xb5, 0x63,
-  0x6b, 0x72, 0x60, 0xde, 0xc9, 0xda, 0xbd, 0x26, 0x6b, 0xee, 0x5b, 0x18,
-  0xd3, 0xe8, 0xda, 0xb1, 0x35, 0x82, 0x37, 0xc3, 0x11, 0x88, 0x19, 0x5b,
-  0x0a, 0x9a, 0x63, 0xef, 0x0c, 0x55, 0x63, 0xec, 0x5a, 0xb8, 0xd3, 0x4e,
-  0x43, 0x88, 0x3f, 0x01, 0xce, 0x28, 0x23, 0xee, 0x73, 0x98, 0x28, 0x2f,
-  0x75, 0x01, 0x5a, 0x0d, 0x0c, 0xd8, 0x51, 0x0d, 0x29, 0x09, 0x64, 0xa9,
-  0x24, 0xf6, 0x99, 0x77, 0x9f, 0x9b, 0x75, 0x16, 0x9a, 0x9c, 0xb6, 0x99,
-  0x21, 0xd7, 0x47, 0x90, 0x2b, 0x17, 0xca, 0x90, 0xe9, 0x9d, 0x42, 0xfc,
-  0x69, 0x8f, 0xd9, 0x3a, 0x85, 0xef, 0x07, 0x8b, 0xe7, 0x34, 0x2b, 0xf7,
-  0xb6, 0x32, 0xdb, 0xfc, 0x42, 0x95, 0x87, 0xd4, 0xad, 0xcf, 0x38, 0xd1,
-  0x46, 0xff, 0x39, 0x77, 0xe0, 0xb4, 0xf1, 0xb0, 0x97, 0x19, 0x6e, 0xf1,
-  0x59, 0xb1, 0x50, 0xf7, 0xfc, 0x87, 0x56, 0xfd, 0x3c, 0x13, 0x4e, 0xad,
-  0x4b, 0xb7, 0x4d, 0xe7, 0x99, 0x84, 0xa9, 0x06, 0x74, 0x8e, 0x0c, 0x14,
-  0x14, 0x8e, 0x01, 0x26, 0x7e, 0x43, 0x08, 0xa6, 0x1f, 0xac, 0x35, 0x31,
-  0x9d, 0xc9, 0x54, 0x44, 0x39, 0x5b, 0xde, 0x9a, 0x14, 0x5a, 0x43, 0xa5,
-  0xe9, 0xe3, 0xe8, 0x64, 0x18, 0x75, 0xcf, 0x2c, 0x79, 0x6e, 0x16, 0x8e,
-  0xe1, 0x33, 0xae, 0x93, 0xbe, 0xd8, 0x59, 0x74, 0xef, 0x84, 0xea, 0xcb,
-  0x6c, 0xd7, 0x58, 0xa3, 0x33, 0x39, 0x4f, 0x0e, 0xe9, 0xf3, 0x6f, 0xdd,
-  0x3e, 0xd7, 0xba, 0xda, 0x14, 0x08, 0x1c, 0xe4, 0xdc, 0x5c, 0xd0, 0xb9,
-  0xcc, 0x00, 0xac, 0xa3, 0xd9, 0x2e, 0x4a, 0x8a, 0x27, 0x6c, 0x20, 0x9f,
-  0x8c, 0xd3, 0xe8, 0x7a, 0x1f, 0x17, 0x45, 0xac, 0x46, 0x5f, 0x8e, 0xd4,
-  0x99, 0x69, 0x80, 0x2f, 0x63, 0x18, 0xff, 0xe1, 0x00, 0x98, 0x71, 0x1a,
-  0xc3, 0x86, 0xb1, 0x2a, 0xe2, 0xf9, 0x4e, 0x8d, 0x5e, 0xb7, 0x63, 0x1a,
-  0x02, 0x65, 0x71, 0xbd, 0x55, 0xa3, 0xff, 0xd5, 0x8f, 0xab, 0x0b, 0x6a,
-  0x0c, 0xca, 0xf4, 0xe2, 0xbe, 0xdc, 0xc4, 0x37, 0x73, 0x18, 0xa3, 0xef,
-  0x5a, 0x91, 0x0d, 0x03, 0x73, 0xb0, 0xed, 0x41, 0xd9, 0x1b, 0x80, 0xad,
-  0x0b, 0x6c, 0xbc, 0xc1, 0xb7, 0x46, 0x31, 0xa1, 0xe3, 0x3f, 0xb5, 0x62,
-  0xea, 0x07, 0x19, 0x97, 0x3b, 0x00, 0x4a, 0x60, 0x07, 0x9e, 0x2f, 0xe2,
-  0xb2, 0x8c, 0xd3, 0xf9, 0x5f, 0xd5, 0xe8, 0x9f, 0x5b, 0x11, 0xbe, 0x13,
-  0x74, 0x13, 0xf7, 0xbd, 0x1a, 0xfd, 0x9f, 0xe1, 0xb8, 0xbb, 0xa0, 0x41,
-  0xbb, 0x2f, 0xf3, 0xe5, 0xbc, 0xc1, 0x11, 0x00, 0xc3, 0xb0, 0x17, 0x0e,
-  0xe6, 0x77, 0x80, 0xad, 0xe3, 0x15, 0xee, 0x18, 0x82, 0xb7, 0x0b, 0x76,
-  0xfc, 0xd7, 0x68, 0x99, 0x2f, 0x12, 0xa7, 0x6d, 0xbc, 0xcf, 0x81, 0x45,
-  0x75, 0xe9, 0xe0, 0x1b, 0x00, 0x83, 0x8a, 0xd5, 0xbc, 0xb6, 0xa2, 0xb0,
-  0xbd, 0xca, 0xa7, 0x6c, 0x10, 0x94, 0x33, 0x3f, 0x9b, 0xa8, 0xd8, 0xe6,
-  0x59, 0xb2, 0xd4, 0x23, 0x6e, 0x7b, 0xa0, 0x2e, 0x83, 0x33, 0x34, 0x08,
-  0x7e, 0x0c, 0x6a, 0x69, 0x11, 0x99, 0x4a, 0x6a, 0xf4, 0x59, 0x0b, 0xb5,
-  0x03, 0xe1, 0x3c, 0x7a, 0xb3, 0x37, 0x71, 0x7a, 0xae, 0x19, 0x1b, 0x0f,
-  0x4f, 0x08, 0xde, 0xc2, 0x4e, 0xfd, 0xc0, 0x0d, 0xcc, 0x17, 0x75, 0xe0,
-  0x8b, 0x0e, 0xcc, 0x21, 0x60, 0xb1, 0x68, 0xd1, 0x61, 0x50, 0xde, 0x81,
-  0x2d, 0x94, 0x15, 0xa1, 0xf6, 0x3d, 0xd8, 0xba, 0x96, 0x32, 0xb4, 0x66,
-  0x5d, 0xaf, 0x61, 0x65, 0xc6, 0x81, 0x9b, 0xf2, 0x0b, 0x96, 0xf4, 0x8a,
-  0xe5, 0x77, 0xf8, 0x1e, 0xb5, 0x36, 0xcd, 0xc9, 0xf1, 0xb2, 0xdc, 0xef,
-  0x76, 0xe4, 0x2c, 0x90, 0x81, 0xbe, 0x35, 0x53, 0x4b, 0x50, 0x68, 0x9e,
-  0xed, 0xa2, 0x12, 0x03, 0x64, 0xf1, 0x35, 0x63, 0x72, 0x6a, 0xcc, 0x8b,
-  0x37, 0x84, 0x43, 0x2b, 0x6a, 0x5b, 0x34, 0x6e, 0x8d, 0x77, 0x78, 0x8f,
-  0x3e, 0xdf, 0x97, 0x71, 0x39, 0xdf, 0x15, 0xc9, 0x36, 0x9e, 0x83, 0x1a,
-  0x32, 0xb7, 0xae, 0x09, 0x25, 0x5b, 0x2d, 0x9a, 0x35, 0x18, 0x98, 0x63,
-  0x07, 0x2f, 0x43, 0x00, 0x84, 0x12, 0x37, 0xab, 0xd5, 0xdc, 0xf8, 0x4f,
-  0x94, 0x43, 0xb1, 0xd3, 0x7f, 0xd0, 0xfb, 0x45, 0xe7, 0x9f, 0xa0, 0x4d,
-  0xeb, 0x48, 0x4e, 0x1b, 0x47, 0x0f, 0xe3, 0xbb, 0x07, 0xfc, 0xef, 0x3d,
-  0xfd, 0xf7, 0xa7, 0x87, 0xa9, 0x63, 0xac, 0xa0, 0x61, 0x3e, 0x3a, 0xdc,
-  0x51, 0x2b, 0x18, 0x2d, 0xe2, 0x4f, 0x8d, 0x7c, 0x9f, 0xd6, 0x2a, 0x8c,
-  0xfb, 0x2b, 0x34, 0x8e, 0x0f, 0x52, 0x23, 0x98, 0xee, 0x11, 0x9d, 0xd3,
-  0x7a, 0x07, 0x17, 0xcd, 0x11, 0x97, 0x4e, 0xe8, 0xaf, 0xb1, 0x33, 0xeb,
-  0x43, 0x9c, 0x36, 0x06, 0x53, 0xf4, 0xa5, 0x35, 0x79, 0xd3, 0x0b, 0x95,
-  0x9a, 0x83, 0x75, 0x73, 0x2f, 0x5e, 0xc2, 0x81, 0xa1, 0x39, 0x35, 0x62,
-  0xcb, 0xd3, 0xaf, 0x30, 0x6a, 0x73, 0x19, 0x8d, 0x66, 0xd6, 0xb4, 0x92,
-  0x8d, 0x8e, 0x9c, 0xf4, 0x1a, 0x55, 0xbd, 0x2a, 0x2b, 0x17, 0x93, 0x11,
-  0xd4, 0x1c, 0x4d, 0x47, 0x8e, 0xfa, 0x69, 0xf4, 0xc3, 0xda, 0xc3, 0x5f,
-  0x4e, 0x3a, 0x0f, 0x31, 0x88, 0xc1, 0x94, 0xa2, 0xe1, 0xfc, 0xd8, 0xa8,
-  0x2a, 0xec, 0x8c, 0x39, 0x12, 0x8f, 0x59, 0xf3, 0x40, 0x75, 0x67, 0x04,
-  0x1f, 0xe3, 0xdc, 0x59, 0xe4, 0x6e, 0x9a, 0x42, 0xad, 0xeb, 0xe0, 0x38,
-  0x35, 0x26, 0xa1, 0x8f, 0x1d, 0x51, 0x8d, 0x7b, 0x41, 0xfd, 0x48, 0xd1,
-  0x2b, 0xf0, 0x23, 0xc7, 0xf3, 0x25, 0x30, 0xb6, 0x76, 0xae, 0xf4, 0x54,
-  0x39, 0x21, 0xf9, 0x93, 0x1b, 0xa3, 0xd6, 0x3d, 0x3d, 0xf2, 0x4c, 0xb4,
-  0xb8, 0xb0, 0x83, 0x5c, 0x2e, 0x37, 0x13, 0xf6, 0x51, 0x6e, 0x99, 0xdc,
-  0x57, 0x86, 0x43, 0xb2, 0xa9, 0xf9, 0x79, 0x63, 0x46, 0x62, 0x02, 0x87,
-  0xb0, 0x02, 0x5d, 0x5c, 0xff, 0x04, 0xab, 0x3c, 0xce, 0xf2, 0xfd, 0xf5,
-  0x46, 0xe9, 0x29, 0x2d, 0x31, 0x0f, 0x5e, 0x70, 0x49, 0x55, 0xb9, 0x35,
-  0x4d, 0x79, 0x2f, 0xb3, 0x3b, 0xea, 0x2f, 0x68, 0x8b, 0xec, 0x69, 0x84,
-  0x96, 0x18, 0x43, 0x81, 0x73, 0xf1, 0x2f, 0xac, 0xa1, 0x27, 0xde, 0xe3,
-  0x2f, 0xad, 0xc1, 0xea, 0x3b, 0x76, 0xaa, 0xd2, 0x60, 0x38, 0x31, 0xd2,
-  0x4c, 0x7b, 0xb9, 0x29, 0x79, 0x55, 0x63, 0xa8, 0x1e, 0x2e, 0x09, 0xf0,
-  0x06, 0xfb, 0x76, 0xed, 0x9a, 0xa7, 0x5e, 0xe6, 0x98, 0x03, 0x55, 0x4f,
-  0x05, 0xd4, 0x45, 0xc1, 0xb0, 0xf6, 0xfd, 0xd6, 0x27, 0x23, 0xaf, 0x72,
-  0xe0, 0x81, 0x38, 0xe7, 0xec, 0x62, 0x6b, 0x4f, 0x6b, 0x94, 0x7a, 0xb6,
-  0x8e, 0xd7, 0x69, 0x5e, 0x55, 0x78, 0x4e, 0xd5, 0x1b, 0x80, 0x67, 0xe8,
-  0xd0, 0x99, 0xd3, 0xb4, 0x07, 0x14, 0x37, 0x6a, 0x7e, 0x35, 0xe5, 0x19,
-  0x16, 0x0d, 0xb3, 0x14, 0x12, 0xa4, 0x6f, 0x26, 0xa4, 0xb6, 0x1c, 0x3b,
-  0xa1, 0x39, 0x85, 0xc3, 0x09, 0x0a, 0xcb, 0x08, 0xa8, 0x66, 0xc0, 0xf7,
-  0x8f, 0xbc, 0x8f, 0x91, 0x7a, 0x8c, 0xe8, 0xc4, 0x0b, 0xff, 0x8c, 0x14,
-  0xb6, 0x41, 0x48, 0xa9, 0x7d, 0xf8, 0x4b, 0x5f, 0x4e, 0xf5, 0x21, 0xf1,
-  0x31, 0x78, 0x95, 0xdd, 0x8b, 0x39, 0xba, 0xd9, 0x49, 0xb6, 0xd1, 0x75,
-  0x3c, 0x5b, 0xe6, 0x7b, 0x4c, 0xec, 0x72, 0xac, 0xce, 0xc4, 0x0d, 0xe1,
-  0x53, 0x18, 0xce, 0xa4, 0xa2, 0x0b, 0x0a, 0x42, 0x80, 0xbe, 0x9b, 0x91,
-  0x3a, 0xbd, 0xce, 0xf6, 0x3b, 0x18, 0x6f, 0xb5, 0x4e, 0x28, 0x7f, 0x83,
-  0x19, 0x3c, 0xfc, 0x38, 0xd3, 0x85, 0x58, 0xc6, 0x23, 0x26, 0x5e, 0xba,
-  0xd9, 0x72, 0x8d, 0x77, 0x48, 0x33, 0x82, 0xca, 0xf6, 0xdb, 0x63, 0x5d,
-  0xe0, 0xd2, 0xbd, 0x8d, 0xee, 0xf2, 0x7d, 0x35, 0x7f, 0x5c, 0xc1, 0xff,
-  0x49, 0x33, 0x23, 0xda, 0x99, 0x76, 0xc9, 0x6a, 0x5a, 0xab, 0xde, 0x43,
-  0xe5, 0x2a, 0xaa, 0xa2, 0x30, 0x89, 0x58, 0xf2, 0x01, 0xe8, 0x43, 0x34,
-  0xdd, 0xc4, 0xf9, 0xcd, 0xda, 0x26, 0x7f, 0x63, 0x32, 0x08, 0x4c, 0xca,
-  0xfd, 0x7a, 0x6d, 0xdc, 0x89, 0x35, 0x11, 0xfe, 0x74, 0xe8, 0x22, 0x42,
-  0x81, 0x6f, 0xbb, 0x13, 0x1e, 0xe2, 0x27, 0xac, 0xdb, 0xb8, 0x20, 0xf3,
-  0x48, 0xdc, 0x65, 0xd7, 0x2e, 0x85, 0x75, 0xc4, 0xc6, 0x4f, 0xaf, 0x0d,
-  0x41, 0x47, 0x65, 0xeb, 0xac, 0x82, 0x99, 0x6f, 0x47, 0x25, 0x1c, 0xa8,
-  0x01, 0x7c, 0x13, 0x91, 0x48, 0x5d, 0x48, 0xfe, 0x51, 0x4a, 0x1b, 0x34,
-  0x5a, 0x45, 0x70, 0xf4, 0x83, 0x52, 0x28, 0x2c, 0xf3, 0x3c, 0xc3, 0x7f,
-  0xb1, 0x3b, 0x93, 0x29, 0x9a, 0xef, 0x8b, 0x8a, 0xcd, 0x92, 0xb2, 0x74,
-  0xe9, 0x82, 0x15, 0x83, 0xf1, 0x29, 0x32, 0x1b, 0x20, 0xee, 0x53, 0x72,
-  0xf2, 0x8c, 0x32, 0xd3, 0x0a, 0x0a, 0x79, 0x90, 0xc9, 0xe5, 0xe8, 0xd4,
-  0xb9, 0x77, 0xe1, 0x51, 0x86, 0x9d, 0x29, 0x8e, 0xb6, 0x74, 0x0b, 0xe9,
-  0xad, 0xde, 0x75, 0xb1, 0xad, 0xec, 0x6d, 0xbb, 0xe4, 0x18, 0xd0, 0x75,
-  0xf2, 0x74, 0x35, 0x17, 0xa6, 0x1e, 0x61, 0x02, 0xfb, 0x0a, 0x0f, 0x99,
-  0x38, 0x3f, 0x30, 0x80, 0x6a, 0x97, 0x2c, 0xcb, 0xe4, 0xa7, 0x58, 0x3d,
-  0xae, 0xe0, 0xff, 0xf8, 0xa9, 0xfa, 0x9f, 0xe2, 0x22, 0x8f, 0xee, 0x92,
-  0xf2, 0xb9, 0x98, 0x16, 0x0c, 0x2a, 0xa8, 0xb0, 0x04, 0x45, 0x35, 0x6f,
-  0xe2, 0xe1, 0xcf, 0xd4, 0x03, 0xb5, 0x88, 0x96, 0x6f, 0xae, 0x29, 0xfb,
-  0x97, 0xfa, 0x1e, 0x6f, 0xea, 0x2b, 0x4c, 0x65, 0x16, 0x67, 0xd0, 0xc7,
-  0x25, 0x0c, 0xd9, 0x3a, 0xcf, 0x30, 0x84, 0x06, 0x33, 0xa4, 0xa4, 0x27,
-  0xe7, 0x67, 0x50, 0x84, 0x5f, 0x4a, 0xd0, 0xce, 0x63, 0x75, 0x7e, 0x7a,
-  0xa6, 0x34, 0x35, 0x27, 0xed, 0xd4, 0x84, 0xba, 0xd1, 0x51, 0xcb, 0x11,
-  0x53, 0x0e, 0x27, 0x98, 0x21, 0xa3, 0xfe, 0xad, 0x93, 0x02, 0xa4, 0x8c,
-  0x74, 0x13, 0x91, 0x59, 0x7b, 0xcb, 0x58, 0x3b, 0x4e, 0x78, 0xa5, 0x35,
-  0xd7, 0xfd, 0x24, 0xab, 0xe6, 0x94, 0x74, 0x0b, 0xfd, 0xc0, 0x95, 0x5d,
-  0x01, 0x98, 0x02, 0x45, 0x7b, 0x38, 0x13, 0x2e, 0x71, 0xfc, 0x33, 0x51,
-  0x0b, 0x69, 0x6e, 0x88, 0x1b, 0xeb, 0x0d, 0xde, 0xe0, 0xba, 0x52, 0x4c,
-  0x56, 0x54, 0x5c, 0xef, 0x69, 0x27, 0x85, 0xe3, 0x00, 0xea, 0xf8, 0xc0,
-  0x2b, 0xba, 0xfe, 0xe9, 0xa8, 0x8e, 0xd8, 0x64, 0x62, 0xdc, 0xa0, 0x7d,
-  0xc9, 0x34, 0x03, 0x7f, 0x75, 0xb5, 0xa3, 0x7b, 0x38, 0xa4, 0x21, 0x6d,
-  0x6c, 0xd3, 0x4d, 0x78, 0x57, 0x5d, 0xd0, 0x59, 0xa7, 0x3b, 0xec, 0xf2,
-  0x90, 0xdb, 0xbe, 0x8b, 0x1b, 0xad, 0x73, 0x0d, 0xc3, 0x1e, 0x97, 0x57,
-  0xec, 0x35, 0x7f, 0x45, 0xd7, 0x5e, 0x50, 0xe3, 0x0a, 0x56, 0x15, 0xe0,
-  0xba, 0x5a, 0xc0, 0x89, 0xa7, 0x52, 0x57, 0x4b, 0xd0, 0xa9, 0xe2, 0x25,
-  0x10, 0xe5, 0x8c, 0x39, 0x09, 0x76, 0xf8, 0x37, 0x82, 0x93, 0xe8, 0x6c,
-  0x5d, 0x44, 0xe4, 0xb4, 0x1b, 0x1f, 0xa3, 0xcf, 0xb1, 0x05, 0x80, 0x09,
-  0x8b, 0x32, 0x58, 0xd8, 0x15, 0xa8, 0xe4, 0x02, 0x12, 0xaa, 0x35, 0xb5,
-  0x13, 0x59, 0x02, 0xff, 0xb2, 0xd7, 0xc7, 0x84, 0x24, 0x42, 0xe9, 0x44,
-  0xa2, 0xa0, 0xa3, 0x66, 0xa8, 0xcd, 0x50, 0x33, 0xb8, 0x85, 0x8d, 0x53,
-  0xd4, 0xbd, 0xf0, 0x4a, 0x4b, 0x1f, 0x6c, 0x7c, 0x37, 0xe5, 0x46, 0x40,
-  0x7d, 0xc7, 0x6b, 0xe9, 0xcf, 0xf1, 0xb6, 0x58, 0x13, 0x64, 0x2b, 0x8e,
-  0x88, 0xda, 0x91, 0x45, 0x24, 0x54, 0x3a, 0x14, 0x45, 0x7b, 0xcc, 0xd9,
-  0x04, 0xfa, 0xdf, 0x91, 0x1c, 0x13, 0x46, 0xc5, 0x3e, 0xcb, 0x30, 0x85,
-  0x9f, 0xc9, 0x32, 0xb8, 0x8a, 0x31, 0xe5, 0xe0, 0x7d, 0x5c, 0x7e, 0x3f,
-  0xa2, 0x44, 0x4e, 0x0e, 0x84, 0x4e, 0x42, 0xe4, 0x81, 0xf0, 0x35, 0x9d,
-  0x47, 0xe2, 0xe1, 0xc8, 0x61, 0x2f, 0xee, 0xb6, 0xd0, 0xd4, 0xd5, 0xf7,
-  0x46, 0xcf, 0x9f, 0x84, 0x44, 0x76, 0xdb, 0x00, 0xf8, 0xdd, 0x1f, 0xd2,
-  0x79, 0x0f, 0xed, 0xba, 0xc0, 0xcb, 0x80, 0x08, 0xb3, 0x2c, 0x76, 0x0d,
-  0x48, 0xdb, 0xf4, 0xaa, 0x00, 0xa5, 0x21, 0x94, 0xa1, 0x11, 0x0c, 0xe3,
-  0x74, 0x2e, 0x16, 0x1b, 0x83, 0x5b, 0xdb, 0x71, 0x75, 0x65, 0x58, 0x64,
-  0xcb, 0x58, 0x6e, 0xd9, 0xe5, 0x38, 0x49, 0x9f, 0xf8, 0x04, 0xc2, 0xa5,
-  0x72, 0x7d, 0xc2, 0xc7, 0x4c, 0xff, 0xdb, 0x4c, 0x0b, 0xad, 0x6d, 0x7c,
-  0x13, 0x89, 0xa2, 0xab, 0x21, 0x34, 0x08, 0x9e, 0x19, 0x44, 0x0d, 0xf4,
-  0xeb, 0x3a, 0xfe, 0xd3, 0x5e, 0x01, 0xf5, 0x28, 0xc3, 0x85, 0xcf, 0x7f,
-  0xf3, 0xb4, 0x79, 0x97, 0xc9, 0x2c, 0x44, 0x8c, 0x74, 0xd2, 0x64, 0x4c,
-  0x25, 0x38, 0xc8, 0x90, 0xd5, 0x2a, 0x32, 0xea, 0x71, 0x36, 0x52, 0xc3,
-  0x95, 0x15, 0xa6, 0x35, 0x31, 0x87, 0x47, 0xd4, 0x47, 0x89, 0x8f, 0xa1,
-  0x11, 0x92, 0x96, 0xa7, 0xb4, 0x60, 0x6f, 0xef, 0xf0, 0xc2, 0x7d, 0x5f,
-  0x2e, 0xf0, 0x08, 0xe7, 0xce, 0xc1, 0xeb, 0x22, 0xde, 0x45, 0xb4, 0x34,
-  0xff, 0x88, 0x9d, 0x53, 0x4f, 0x51, 0x79, 0xd0, 0xfd, 0x9c, 0x6a, 0xb2,
-  0xd7, 0xf2, 0x41, 0x4d, 0x3e, 0x02, 0xa2, 0xdc, 0x52, 0xde, 0xa4, 0xed,
-  0xde, 0x5d, 0xdf, 0xcd, 0x9d, 0x5b, 0x84, 0xf2, 0xbe, 0x04, 0x35, 0x68,
-  0x66, 0x61, 0x41, 0x43, 0x61, 0xc5, 0x8b, 0xf7, 0x14, 0x11, 0x11, 0x47,
-  0x63, 0xbd, 0xa5, 0x5b, 0x95, 0xe0, 0xc2, 0x41, 0x63, 0xb5, 0xb1, 0x9a,
-  0x7a, 0xe6, 0xc0, 0xf0, 0xcc, 0x82, 0x42, 0x04, 0x13, 0x44, 0xd1, 0x2f,
-  0x55, 0x52, 0xed, 0x81, 0xa9, 0x68, 0x98, 0x22, 0x3a, 0x2c, 0xca, 0x91,
-  0x89, 0xe7, 0x4b, 0x52, 0x7f, 0xd6, 0x69, 0xb4, 0xe9, 0x45, 0xad, 0xe0,
-  0x6f, 0xc0, 0x98, 0x8c, 0x7a, 0x74, 0x9a, 0x34, 0xdd, 0xf3, 0x38, 0x3d,
-  0x7a, 0x0e, 0x87, 0x83, 0x91, 0x2d, 0xad, 0x21, 0x11, 0x5f, 0x05, 0x99,
-  0xce, 0xe2, 0x5a, 0x1c, 0xc6, 0x8d, 0x00, 0x88, 0xe4, 0x06, 0x6b, 0x87,
-  0x45, 0xd3, 0x9a, 0x77, 0xfd, 0x34, 0x30, 0x6c, 0x7c, 0x39, 0xd7, 0x4f,
-  0x95, 0x93, 0x14, 0xd4, 0x01, 0xd4, 0xeb, 0xa6, 0x75, 0x10, 0xf5, 0xc2,
-  0xe1, 0x48, 0x0c, 0x39, 0xff, 0x1a, 0xd3, 0xc3, 0x18, 0x29, 0xb9, 0x58,
-  0x61, 0xb0, 0x88, 0xc6, 0x44, 0x83, 0x8e, 0xc9, 0x75, 0x8c, 0x59, 0x81,
-  0xbf, 0x1b, 0xc7, 0x78, 0x9e, 0x3a, 0x6f, 0x45, 0x10, 0x96, 0xb9, 0x26,
-  0x59, 0xfa, 0xd7, 0x0a, 0x2c, 0xfd, 0x47, 0xed, 0x49, 0x9d, 0xe0, 0xa0,
-  0x35, 0x94, 0x3b, 0xa0, 0xcb, 0xfb, 0x39, 0xed, 0x45, 0x66, 0x06, 0xe4,
-  0xc4, 0x0c, 0x6b, 0x5f, 0x15, 0xd4, 0xc2, 0x49, 0xd7, 0x3f, 0xb1, 0xac,
-  0xe9, 0x70, 0x88, 0x08, 0x0d, 0x92, 0x00, 0x86, 0x9b, 0x65, 0x07, 0xa8,
-  0x49, 0x12, 0xfe, 0x8c, 0xcb, 0xd0, 0x6c, 0xdf, 0x06, 0x92, 0x00, 0x81,
-  0xfb, 0x8c, 0x41, 0x14, 0x93, 0xec, 0x42, 0x9f, 0x93, 0x6a, 0x33, 0x27,
-  0xf0, 0xc2, 0x97, 0xa2, 0x56, 0xb8, 0x8a, 0x50, 0xab, 0x55, 0x0c, 0x0b,
-  0xdf, 0xd6, 0x6a, 0xec, 0x5c, 0x98, 0x64, 0xab, 0xfc, 0xb6, 0x9c, 0x7d,
-  0xfd, 0xed, 0xb1, 0x5d, 0x46, 0xc7, 0xb8, 0x3d, 0x41, 0xff, 0xd6, 0x33,
-  0x28, 0xbe, 0xbc, 0x38, 0xd6, 0x79, 0x77, 0x3d, 0x51, 0x8f, 0xab, 0x1f,
-  0x7b, 0x4f, 0x17, 0x82, 0x28, 0x02, 0x1a, 0x22, 0x1f, 0x54, 0xbe, 0x5d,
-  0x65, 0x87, 0xc8, 0x0f, 0x78, 0x44, 0x31, 0x89, 0x95, 0x30, 0xe5, 0x27,
-  0x6d, 0x0b, 0x26, 0xe8, 0xd1, 0x2c, 0x16, 0x72, 0xbb, 0xa5, 0xc8, 0xd8,
-  0x9c, 0x9f, 0x78, 0xd1, 0xb3, 0x66, 0x72, 0x67, 0xe2, 0x67, 0x75, 0xc4,
-  0xae, 0x3d, 0xf5, 0xe2, 0x95, 0x14, 0x8f, 0xb1, 0xfd, 0xb9, 0x08, 0x18,
-  0x79, 0x3e, 0xc5, 0x08, 0x21, 0x5e, 0x05, 0xb9, 0x79, 0x43, 0xc6, 0x88,
-  0x09, 0xa2, 0x9d, 0x27, 0x19, 0xe9, 0xc4, 0x3f, 0xdd, 0xd9, 0x15, 0x67,
-  0x25, 0x91, 0xd9, 0x54, 0xae, 0x5c, 0x86, 0xf1, 0x87, 0x0a, 0x0e, 0x33,
-  0x33, 0x54, 0xcf, 0x79, 0xa4, 0xc2, 0xce, 0x69, 0x78, 0x23, 0x83, 0xa6,
-  0xe0, 0x55, 0x11, 0xdd, 0xc2, 0x3f, 0x88, 0x18, 0xdf, 0x53, 0xc1, 0xed,
-  0x8a, 0x5b, 0x25, 0x7f, 0x23, 0xd7, 0x93, 0x69, 0x0c, 0x68, 0xe7, 0xb7,
-  0xc9, 0xaa, 0xda, 0xc0, 0x82, 0x09, 0x1d, 0x15, 0xa6, 0x14, 0x99, 0xd5,
-  0xa8, 0xb2, 0x21, 0x67, 0x61, 0xac, 0xd3, 0x76, 0x82, 0x60, 0xaa, 0xaa,
-  0xd6, 0x86, 0x57, 0x09, 0xec, 0x21, 0x48, 0x5e, 0xa9, 0x4e, 0xea, 0x95,
-  0x83, 0x1a, 0xc1, 0x8c, 0x7a, 0xc5, 0x3c, 0x52, 0xf2, 0x9c, 0xcf, 0x36,
-  0x71, 0xb4, 0xaa, 0x9d, 0x12, 0x5a, 0x86, 0x00, 0x74, 0xb7, 0x3c, 0x5a,
-  0xc1, 0xe9, 0x13, 0xbe, 0x1b, 0x85, 0x7f, 0x0b, 0xea, 0x6e, 0xb2, 0x03,
-  0x16, 0xa4, 0xc9, 0x98, 0x2d, 0x30, 0x69, 0xb4, 0x56, 0x32, 0x0c, 0x67,
-  0x4e, 0x79, 0x9f, 0xaa, 0x71, 0xaa, 0x51, 0x41, 0x4a, 0x2d, 0x41, 0x44,
-  0x45, 0x89, 0x1c, 0x85, 0xc3, 0xd5, 0x37, 0xf0, 0xb4, 0xdf, 0xa3, 0x92,
-  0x20, 0x88, 0xb7, 0x9c, 0x2a, 0xa9, 0x67, 0xa3, 0x77, 0x8c, 0x36, 0x42,
-  0xd6, 0x03, 0x47, 0x1b, 0xc1, 0xbf, 0x5d, 0x6d, 0x44, 0xc7, 0x4a, 0xb5,
-  0x6a, 0x23, 0xc2, 0xec, 0x1f, 0x54, 0x29, 0x39, 0x30, 0x5e, 0xc1, 0x66,
-  0xb8, 0x6c, 0x04, 0x20, 0x5a, 0x0a, 0xbe, 0xe0, 0x92, 0x39, 0x4b, 0xbc,
-  0x12, 0x8f, 0xb3, 0x27, 0x8a, 0xa6, 0x0a, 0x6d, 0xb8, 0x3c, 0xd1, 0xe8,
-  0xce, 0x05, 0x04, 0xe7, 0xea, 0x1a, 0xf0, 0xec, 0x4b, 0xd4, 0x08, 0xb4,
-  0x60, 0x75, 0x70, 0xb1, 0x78, 0x48, 0xb6, 0x36, 0x3a, 0x6b, 0xa0, 0x26,
-  0x74, 0xe0, 0x24, 0x88, 0xc2, 0xea, 0xdc, 0x67, 0x3f, 0x2b, 0x16, 0x8d,
-  0x82, 0x65, 0xb0, 0x27, 0x07, 0xb6, 0xd4, 0x6e, 0x5e, 0xc6, 0xd9, 0x81,
-  0x37, 0xe3, 0xbe, 0xdd, 0x52, 0x07, 0x2c, 0x1e, 0x38, 0xb8, 0xd8, 0x37,
-  0xc2, 0x6b, 0x9a, 0x3a, 0x24, 0x64, 0x4e, 0xc6, 0xbc, 0x99, 0x32, 0x33,
-  0x6b, 0x38, 0x6d, 0x3d, 0x94, 0x5a, 0xbe, 0xef, 0x9f, 0xc5, 0x55, 0x5f,
-  0x6d, 0xc6, 0xa0, 0x30, 0xd6, 0xab, 0x69, 0x35, 0x87, 0xe1, 0xed, 0xa8,
-  0x60, 0xa7, 0xe9, 0xc4, 0x2e, 0x05, 0x03, 0x3f, 0xa9, 0x4b, 0x24, 0x53,
-  0xc2, 0x3d, 0xe0, 0x0e, 0x8c, 0x46, 0x96, 0xd1, 0x02, 0x93, 0x8f, 0xe2,
-  0x99, 0x18, 0xa0, 0xc4, 0x47, 0xc9, 0xea, 0x0c, 0x00, 0x0b, 0xff, 0x2b,
-  0x1a, 0x4c, 0xcb, 0xab, 0x3a, 0x62, 0xdf, 0x4e, 0xd4, 0x3b, 0xcc, 0xf9,
-  0xcf, 0xd0, 0x80, 0x0f, 0x74, 0x8e, 0xb0, 0x76, 0x2d, 0xd8, 0x15, 0x00,
-  0xad, 0xea, 0xa9, 0xb8, 0xa3, 0xbb, 0x4b, 0xba, 0x95, 0xd1, 0x3e, 0x20,
-  0x9f, 0xe9, 0x80, 0xbf, 0x06, 0xef, 0x3b, 0x4a, 0x48, 0x4d, 0x29, 0x64,
-  0xeb, 0xa3, 0xd9, 0x8a, 0x9c, 0xc3, 0xa9, 0xc6, 0x10, 0x62, 0x4c, 0x55,
-  0x67, 0xcd, 0x76, 0xe6, 0xec, 0x60, 0xcf, 0x77, 0xd1, 0xda, 0xda, 0x90,
-  0xd5, 0x58, 0xd7, 0xe7, 0xdc, 0x2e, 0xde, 0x95, 0x23, 0xbd, 0x8c, 0xd8,
-  0xd4, 0xe5, 0x35, 0x4f, 0x1b, 0x63, 0x96, 0x68, 0x6a, 0x64, 0x52, 0x63,
-  0x34, 0x72, 0x36, 0xb1, 0xba, 0x76, 0x35, 0x77, 0x36, 0xb2, 0xba, 0x8a,
-  0xc5, 0x9b, 0x1c, 0x6f, 0x41, 0x47, 0xb0, 0x97, 0x15, 0x17, 0xab, 0x00,
-  0x26, 0xab, 0xe0, 0x7d, 0x70, 0x5c, 0x17, 0xab, 0x0f, 0x89, 0xed, 0x72,
-  0x30, 0xb6, 0xcb, 0x10, 0x36, 0x6f, 0xc4, 0xde, 0x13, 0x97, 0xb5, 0x30,
-  0x63, 0xd7, 0x7e, 0x53, 0xc4, 0x32, 0xc1, 0xae, 0x91, 0xb9, 0xef, 0xfc,
-  0xfa, 0x01, 0xce, 0xae, 0x5d, 0xe7, 0xd6, 0x9a, 0xf1, 0xa0, 0xff, 0x30,
-  0xda, 0x71, 0x10, 0x75, 0x55, 0xd0, 0xf7, 0x3e, 0x8b, 0xd6, 0xe5, 0xab,
-  0x3d, 0x8e, 0xfe, 0x8c, 0xa3, 0xe8, 0x3b, 0xd3, 0x55, 0x3b, 0x61, 0x3a,
-  0x6e, 0xb1, 0xf5, 0x23, 0xe6, 0x27, 0x48, 0x1d, 0xeb, 0x61, 0x43, 0xcf,
-  0x8f, 0x1f, 0xec, 0xec, 0xf8, 0x8e, 0xe7, 0xc6, 0x77, 0x3a, 0x33, 0xea,
-  0x1e, 0xb3, 0xdd, 0x91, 0xf3, 0x25, 0x78, 0xe9, 0x20, 0x4e, 0x9a, 0x06,
-  0x56, 0x2b, 0xb6, 0x47, 0xb0, 0x17, 0x9b, 0xa7, 0x0e, 0x9d, 0x63, 0xa2,
-  0x5d, 0x11, 0x97, 0xbf, 0xae, 0x88, 0xff, 0x1f, 0x56, 0x84, 0xec, 0xbb,
-  0xef, 0xb4, 0x30, 0x2e, 0x7f, 0x5d, 0x18, 0xc3, 0x17, 0x86, 0xb7, 0x32,
-  0x64, 0x1b, 0x6c, 0xac, 0x0c, 0x33, 0xbe, 0x0c, 0xe3, 0x46, 0xd4, 0x4a,
-  0x64, 0x0d, 0x6d, 0x8b, 0x56, 0xe5, 0x6a, 0xe0, 0x0d, 0xae, 0xb8, 0x41,
-  0x78, 0x2f, 0x03, 0x78, 0xe9, 0x26, 0x48, 0x7b, 0xc1, 0xcc, 0xaf, 0x8b,
-  0x68, 0xb7, 0x49, 0x96, 0x25, 0x1e, 0x1b, 0x6d, 0xbb, 0xb2, 0x18, 0xf7,
-  0x0b, 0x46, 0x98, 0x96, 0x95, 0xb5, 0x1d, 0xd4, 0xce, 0x7a, 0xb4, 0x28,
-  0xcd, 0x71, 0x2f, 0x45, 0x25, 0x3c, 0xa5, 0x48, 0x4e, 0x5e, 0x84, 0x0e,
-  0x8f, 0xa7, 0x53, 0x4a, 0x09, 0x32, 0xd6, 0x3e, 0x35, 0xe9, 0x94, 0xd7,
-  0xf4, 0x81, 0x1c, 0x07, 0xd3, 0x60, 0xe7, 0x03, 0x5d, 0x7f, 0x9f, 0x53,
-  0xbb, 0xa3, 0x68, 0x93, 0x9a, 0x37, 0x27, 0x6d, 0x41, 0x7b, 0xcb, 0xba,
-  0xf6, 0x1a, 0xa3, 0xaf, 0xd6, 0x07, 0xc1, 0x06, 0x11, 0x7b, 0x29, 0x3e,
-  0x34, 0xf4, 0xd2, 0x66, 0xc9, 0x10, 0xbb, 0x7f, 0xc3, 0x37, 0x22, 0xec,
-  0x33, 0x21, 0xe0, 0xbe, 0x9f, 0x42, 0xc0, 0x79, 0xc1, 0xdc, 0x27, 0x18,
-  0x20, 0x18, 0xf0, 0x7a, 0x87, 0x82, 0xe7, 0x07, 0x5d, 0xb1, 0x61, 0x27,
-  0x80, 0x8f, 0x85, 0x5c, 0xe9, 0x89, 0x50, 0xa1, 0x64, 0x26, 0x0d, 0x5d,
-  0xdd, 0x51, 0xd3, 0xd1, 0x6d, 0xde, 0x99, 0x7f, 0x5e, 0x87, 0x46, 0x62,
-  0x34, 0x6d, 0x36, 0xef, 0xa5, 0xa6, 0x07, 0x34, 0x74, 0x59, 0xdb, 0x8e,
-  0xa6, 0x5e, 0x1f, 0xc9, 0x96, 0x9a, 0x38, 0x88, 0x6e, 0x35, 0x6f, 0x50,
-  0x5b, 0xea, 0xb4, 0x9e, 0x07, 0xc4, 0xa5, 0x80, 0x4e, 0xb4, 0x3d, 0xf6,
-  0x33, 0x46, 0xfd, 0x5e, 0xf6, 0x33, 0x6b, 0x2c, 0x7e, 0x0f, 0x33, 0x1a,
-  0x13, 0x57, 0xb5, 0xb6, 0xdf, 0x69, 0x46, 0xf3, 0x9c, 0x98, 0x1a, 0x82,
-  0x42, 0xdc, 0x9e, 0x38, 0xf9, 0xde, 0x3b, 0x4a, 0xd3, 0xee, 0x23, 0xa3,
-  0x96, 0xb1, 0xc6, 0x4f, 0xe5, 0x44, 0x6c, 0x42, 0x96, 0xbf, 0x65, 0xb2,
-  0x5c, 0x3c, 0x7c, 0x91, 0x88, 0x09, 0xfd, 0xc5, 0xe4, 0x53, 0xe6, 0xfb,
-  0x82, 0xde, 0xa2, 0x7b, 0x8c, 0x9e, 0xd1, 0xed, 0xa3, 0xfe, 0x8e, 0xf3,
-  0x6e, 0xbf, 0x8e, 0xf0, 0xdd, 0x42, 0x3c, 0x10, 0xcf, 0xd1, 0xcf, 0x66,
-  0x95, 0x14, 0xaa, 0xbe, 0x60, 0xeb, 0xe5, 0x4d, 0xbe, 0x09, 0x10, 0x42,
-  0x37, 0x9a, 0xbf, 0x3c, 0x25, 0xd6, 0xbd, 0xc7, 0xd7, 0x11, 0x70, 0x39,
-  0xf3, 0x5d, 0x13, 0x5b, 0x23, 0xf0, 0xef, 0x0f, 0x37, 0x57, 0x96, 0x59,
-  0x0a, 0x3a, 0xeb, 0xd7, 0x8f, 0x62, 0xb8, 0x26, 0xe6, 0x46, 0xf9, 0xf9,
-  0x99, 0xf2, 0x1b, 0x16, 0x43, 0x73, 0xdf, 0x72, 0xc2, 0x9c, 0x0d, 0x2f,
-  0x06, 0x2d, 0x92, 0xb5, 0x0b, 0xa4, 0x9a, 0xc0, 0xc6, 0xea, 0x40, 0x09,
-  0x85, 0x68, 0x7b, 0x5b, 0x10, 0x45, 0x84, 0x2e, 0x13, 0x10, 0x58, 0xe8,
-  0x2e, 0xf4, 0xab, 0xe2, 0xfb, 0x3f, 0x47, 0xf1, 0x35, 0x7b, 0x9c, 0x3f,
-  0xc5, 0xf5, 0xc0, 0x68, 0xa3, 0x0c, 0x1f, 0x0c, 0x55, 0x86, 0xeb, 0x80,
-  0xef, 0xad, 0x0c, 0xb7, 0x21, 0x6a, 0x51, 0x86, 0xdb, 0xc0, 0x7f, 0x79,
-  0x65, 0x18, 0xd6, 0x5f, 0x05, 0x92, 0xef, 0x67, 0xae, 0x19, 0x1e, 0x61,
-  0x5e, 0x1f, 0xa5, 0xf2, 0xfe, 0xfa, 0x75, 0x51, 0xfd, 0x3f, 0x6b, 0x5f,
-  0xf1, 0xe6, 0xde, 0x3b, 0x4c, 0x2a, 0xd1, 0x68, 0x3e, 0xdc, 0xf5, 0x7b,
-  0x03, 0x5d, 0xf7, 0xd5, 0x7f, 0x6b, 0xeb, 0x5d, 0xf7, 0xf5, 0xad, 0x95,
-  0xc2, 0xeb, 0xea, 0xbf, 0xcf, 0xfc, 0x82, 0x37, 0x1e, 0x73, 0xb2, 0x1a,
-  0x33, 0xdf, 0xea, 0xd5, 0xf4, 0xae, 0x0d, 0xe9, 0x46, 0x5c, 0xc5, 0x49,
-  0x0c, 0xcf, 0xc6, 0xbf, 0x5e, 0x67, 0x60, 0xfd, 0x7d, 0x54, 0x54, 0x79,
-  0xa6, 0xfe, 0x92, 0xa4, 0xd0, 0xff, 0xa3, 0x12, 0x93, 0x12, 0xed, 0xf6,
-  0x95, 0x49, 0x30, 0x70, 0xfa, 0xa4, 0x96, 0x60, 0x60, 0x4c, 0x0d, 0x22,
-  0xc8, 0x04, 0x18, 0xd8, 0x71, 0xfb, 0xac, 0xee, 0x14, 0x26, 0xbd, 0x93,
-  0x6c, 0x7c, 0xb5, 0x45, 0xb5, 0x53, 0x5e, 0x62, 0x94, 0xb5, 0x8a, 0x09,
-  0x61, 0x92, 0xc5, 0x33, 0x4e, 0xe0, 0xa3, 0xec, 0xc8, 0x4a, 0x74, 0x88,
-  0x7e, 0x1d, 0x5a, 0x3b, 0xbb, 0xe8, 0xa5, 0x87, 0xbb, 0x3c, 0xde, 0x91,
-  0x94, 0xe2, 0x3a, 0x61, 0x1a, 0xa8, 0xc3, 0xf1, 0x7c, 0x1a, 0x30, 0xba,
-  0xef, 0x0f, 0xc2, 0xe8, 0x31, 0xf4, 0x82, 0x59, 0xc6, 0x25, 0x66, 0x17,
-  0x8b, 0x18, 0x81, 0xa5, 0x8c, 0xbb, 0x64, 0x1c, 0x4e, 0xe9, 0xad, 0x71,
-  0x76, 0x27, 0xb0, 0xde, 0xad, 0x8b, 0xdd, 0xb4, 0x26, 0x0e, 0x70, 0x5c,
-  0xce, 0xff, 0xfe, 0x4c, 0xf4, 0x9c, 0x1a, 0x92, 0x22, 0x80, 0xa4, 0x68,
-  0x22, 0x29, 0x7c, 0x24, 0x6e, 0x8a, 0xb1, 0x4a, 0xb2, 0x30, 0xa1, 0x8c,
-  0x90, 0xe1, 0xa0, 0x10, 0x94, 0x33, 0xe5, 0x3a, 0x4f, 0x4e, 0x60, 0xda,
-  0x28, 0xf2, 0x20, 0xb6, 0xa5, 0x3a, 0x1a, 0x4c, 0x12, 0xc6, 0x3b, 0xff,
-  0x13, 0x3f, 0x6b, 0x93, 0xcf, 0xe0, 0x1a, 0x0e, 0x14, 0xf7, 0x4e, 0x2e,
-  0x10, 0x0f, 0x18, 0xc1, 0x16, 0xf9, 0xea, 0x3e, 0x54, 0x08, 0x8c, 0x6b,
-  0x52, 0x16, 0x84, 0x8a, 0x9d, 0x26, 0x31, 0x43, 0x54, 0x27, 0x88, 0x21,
-  0x6b, 0x76, 0xe7, 0xe6, 0xe5, 0x38, 0x29, 0xdd, 0xd8, 0x8c, 0x8e, 0xda,
-  0xee, 0x10, 0x01, 0x8e, 0xfe, 0x1a, 0xf8, 0x3f, 0x00, 0xd4, 0x2a, 0x87,
-  0x09, 0x49, 0xa2, 0x51, 0xbb, 0xb2, 0xb9, 0x86, 0x1f, 0x31, 0x71, 0xef,
-  0x8a, 0xee, 0x2e, 0x8b, 0xb8, 0xda, 0x17, 0x99, 0x8a, 0x14, 0xb7, 0x73,
-  0xfa, 0x78, 0x38, 0x32, 0xf7, 0xa3, 0x86, 0xaf, 0x8e, 0x4e, 0xec, 0x04,
-  0x4d, 0x7b, 0x29, 0x2f, 0x02, 0x10, 0x3a, 0xc8, 0x4f, 0xe7, 0xbf, 0x32,
-  0x84, 0xc8, 0x7c, 0x61, 0xa8, 0x65, 0x1e, 0xc3, 0xd1, 0x04, 0x46, 0x5f,
-  0xae, 0x0a, 0xf5, 0x0b, 0x60, 0x27, 0x32, 0x59, 0x30, 0xfb, 0x52, 0xaf,
-  0x15, 0x3f, 0x2a, 0xf0, 0xb1, 0x89, 0x1d, 0x34, 0xd8, 0xcd, 0xba, 0xc2,
-  0xbc, 0x43, 0x98, 0x65, 0x45, 0xf2, 0x91, 0x69, 0x56, 0xb4, 0xac, 0x76,
-  0xe4, 0xe7, 0x2b, 0x13, 0x54, 0xd6, 0x77, 0x1f, 0xa3, 0xfc, 0x4c, 0x18,
-  0x16, 0xe5, 0x90, 0x7d, 0xe2, 0x0c, 0xb5, 0xf6, 0xe0, 0xfd, 0x62, 0x8b,
-  0xe8, 0xe2, 0x42, 0x5d, 0xb8, 0x4e, 0xdb, 0x55, 0xae, 0x7e, 0x14, 0x81,
-  0x74, 0x44, 0xd6, 0xa9, 0x46, 0xba, 0xb8, 0x53, 0x1d, 0xda, 0xc4, 0x07,
-  0xf9, 0x66, 0x2b, 0xce, 0x9a, 0xd0, 0x96, 0x30, 0x13, 0xe4, 0x45, 0x93,
-  0x23, 0x79, 0x27, 0xf0, 0xe7, 0x91, 0xc9, 0xa3, 0xc6, 0x28, 0x2b, 0x0f,
-  0x05, 0x53, 0xda, 0x8f, 0x47, 0x12, 0x2f, 0xd4, 0x30, 0xd6, 0x07, 0x94,
-  0x5f, 0xe9, 0x68, 0x1b, 0x4e, 0xfd, 0x86, 0x87, 0x37, 0x98, 0x16, 0xa8,
-  0x74, 0x10, 0xd7, 0xcb, 0x50, 0x1a, 0x39, 0xe9, 0x4f, 0xeb, 0xc5, 0x85,
-  0x2d, 0xb6, 0x09, 0x4d, 0x0d, 0x51, 0xf4, 0xea, 0x49, 0x1b, 0x4d, 0xfc,
-  0x24, 0x4a, 0x0b, 0x49, 0xff, 0x7d, 0x34, 0xed, 0xf2, 0xb2, 0xea, 0x1a,
-  0x29, 0x2e, 0xfe, 0x10, 0x74, 0x71, 0xc3, 0x95, 0x95, 0x02, 0x86, 0x2b,
-  0x85, 0x23, 0x4b, 0x9f, 0x25, 0x4f, 0xb5, 0x1f, 0xf3, 0x73, 0xf7, 0x7f,
-  0xbc, 0x01, 0x7f, 0xba, 0xaf, 0xf2, 0x19, 0x9e, 0x82, 0x31, 0x3e, 0xc4,
-  0xa4, 0xf3, 0x79, 0x2e, 0x71, 0xcc, 0x6e, 0x04, 0x6f, 0xba, 0x58, 0xc3,
-  0x8e, 0x77, 0x84, 0xbe, 0x73, 0x58, 0x01, 0x76, 0x77, 0xfa, 0x32, 0x6a,
-  0x84, 0xfa, 0xa6, 0xcb, 0xad, 0x07, 0x46, 0x78, 0x11, 0x2e, 0x44, 0xc0,
-  0xb7, 0x55, 0x54, 0x01, 0x8b, 0xe2, 0x09, 0x3b, 0xd0, 0xbe, 0xb1, 0x22,
-  0xe3, 0xf1, 0x7e, 0x99, 0x6f, 0x77, 0x14, 0xdb, 0x62, 0x4d, 0xc8, 0xdb,
-  0x68, 0x09, 0xca, 0xda, 0x92, 0xde, 0x2b, 0x9a, 0x95, 0x06, 0xd5, 0xec,
-  0xb6, 0x40, 0x51, 0x5f, 0x70, 0x6a, 0xfb, 0xdb, 0x3b, 0xf8, 0x2f, 0x0b,
-  0x96, 0x1f, 0xb5, 0xfe, 0x70, 0x42, 0xdf, 0x9a, 0x27, 0x06, 0xe5, 0x18,
-  0x00, 0xbc, 0x26, 0x29, 0xc1, 0x37, 0x99, 0x30, 0x29, 0x3b, 0xf9, 0x12,
-  0xb6, 0x67, 0xf4, 0x43, 0xdc, 0xc5, 0x4b, 0x7c, 0x43, 0xd2, 0x07, 0xa6,
-  0x09, 0x0a, 0xd8, 0x38, 0x4f, 0xa8, 0xc9, 0x80, 0xc9, 0xc0, 0x24, 0x3d,
-  0x76, 0xce, 0x8a, 0xc6, 0xd0, 0x5f, 0xc4, 0xd6, 0xa8, 0xde, 0xde, 0xd1,
-  0xf1, 0x06, 0x3e, 0xe4, 0xd7, 0x45, 0xb4, 0x45, 0xdd, 0xc8, 0xfc, 0x31,
-  0xed, 0xa9, 0x55, 0xc2, 0x26, 0x80, 0x2f, 0x3d, 0xa1, 0x0a, 0x8d, 0x2e,
-  0x28, 0xf6, 0xcf, 0xbe, 0x9a, 0x8b, 0xa8, 0x28, 0xa5, 0x9a, 0xfc, 0xee,
-  0xab, 0xb3, 0x4b, 0xe2, 0xe5, 0x06, 0x34, 0x3d, 0xd2, 0xbc, 0xf5, 0xef,
-  0xde, 0x76, 0xf2, 0x3b, 0xd3, 0x0c, 0xff, 0xf4, 0x33, 0xad, 0xf0, 0x53,
-  0x03, 0xb6, 0xfb, 0x28, 0xfe, 0xdc, 0x6e, 0xd1, 0xdf, 0x42, 0x20, 0xfd,
-  0x21, 0x2d, 0x73, 0x89, 0xc6, 0xd9, 0xc8, 0x24, 0x40, 0x78, 0x1d, 0x26,
-  0x5e, 0xc5, 0x1c, 0xd4, 0x9c, 0xdc, 0x58, 0x47, 0x51, 0x9f, 0x84, 0x6d,
-  0x1c, 0x65, 0x84, 0x73, 0x1b, 0xaf, 0x12, 0xfd, 0x93, 0x1f, 0x86, 0x06,
-  0x82, 0xaa, 0x15, 0xfd, 0x8b, 0x8f, 0x46, 0xce, 0x0d, 0xa0, 0xf9, 0xab,
-  0x9c, 0xcb, 0xf3, 0x00, 0xcb, 0xd8, 0x96, 0x64, 0x78, 0xba, 0x48, 0x93,
-  0xea, 0x9e, 0x51, 0xa0, 0xf5, 0x00, 0x63, 0xa3, 0xb3, 0x38, 0x2a, 0xe6,
-  0x45, 0x7c, 0xad, 0x03, 0x8a, 0xb9, 0x70, 0xbf, 0x28, 0x23, 0x2c, 0xef,
-  0xef, 0x08, 0x65, 0xb6, 0x93, 0x2e, 0x78, 0xcb, 0xb6, 0x7c, 0xbb, 0x07,
-  0xae, 0x2e, 0xe7, 0xd0, 0x36, 0x79, 0x2e, 0xd4, 0x16, 0xbb, 0x2e, 0x1e,
-  0x35, 0x6b, 0x56, 0xf9, 0x1c, 0x73, 0x2b, 0xcc, 0xcb, 0x3c, 0xbd, 0x89,
-  0xbd, 0x4a, 0x5e, 0x49, 0x43, 0x02, 0x0c, 0xf8, 0x9f, 0x73, 0x56, 0xf8,
-  0x26, 0x66, 0x55, 0x5d, 0x91, 0xd1, 0xae, 0xcc, 0x31, 0x76, 0x0f, 0x9f,
-  0xbe, 0xe6, 0x97, 0x57, 0x75, 0x36, 0x56, 0xfd, 0x7a, 0x82, 0x9f, 0x99,
-  0x4c, 0xed, 0x4b, 0x0a, 0x7f, 0x03, 0x01, 0x49, 0x8e, 0xbf, 0x38, 0x50,
-  0xce, 0xb1, 0xe2, 0x3d, 0x68, 0x92, 0xa0, 0x25, 0xd6, 0x7a, 0x40, 0x84,
-  0x52, 0xb4, 0xb2, 0x98, 0x1d, 0xfa, 0x4c, 0x9c, 0xa3, 0xc1, 0x99, 0x44,
-  0xdd, 0xd3, 0x80, 0x73, 0x06, 0xd0, 0xcd, 0x53, 0xc7, 0xe7, 0xfb, 0x0c,
-  0xdf, 0x97, 0xc6, 0xff, 0x06, 0x22, 0x4b, 0x5f, 0xe0, 0x77, 0x8a, 0xd9,
-  0xa5, 0x1f, 0x23, 0x83, 0x5f, 0xd3, 0x4c, 0xd5, 0xfc, 0xdb, 0x30, 0xc6,
-  0x6a, 0x34, 0xb9, 0x89, 0x11, 0x9e, 0x0d, 0x55, 0xbc, 0xd6, 0x7d, 0x72,
-  0x5a, 0x46, 0x68, 0xbd, 0x43, 0xb5, 0xe5, 0xe7, 0x64, 0xef, 0xb2, 0x7a,
-  0x56, 0xa6, 0xbd, 0xdc, 0x26, 0x48, 0x86, 0x07, 0x3c, 0x29, 0xed, 0xa7,
-  0x0d, 0x82, 0x8d, 0xc5, 0xca, 0xf8, 0x49, 0xef, 0xd1, 0x4b, 0x9a, 0x52,
-  0x57, 0x88, 0x33, 0x9d, 0xd6, 0x6e, 0x47, 0xff, 0x5e, 0xef, 0xaf, 0xef,
-  0x49, 0x49, 0xc6, 0x0c, 0x7a, 0x9a, 0x88, 0x8c, 0x17, 0xfb, 0xe9, 0xd4,
-  0xfc, 0xa2, 0x1f, 0xfa, 0x23, 0xf0, 0xf1, 0x7f, 0x48, 0xd6, 0x7c, 0x7a,
-  0x41, 0xb5, 0xde, 0x6d, 0x0d, 0xc6, 0x20, 0x64, 0xef, 0xe5, 0x51, 0x08,
-  0x45, 0x3f, 0x8e, 0x5e, 0xc8, 0xc8, 0x72, 0xf6, 0x31, 0xf9, 0xe3, 0x05,
-  0x5a, 0xdc, 0x53, 0x58, 0x75, 0xf0, 0x79, 0xf2, 0xf8, 0x9f, 0xf8, 0x12,
-  0xdb, 0x63, 0x84, 0x4f, 0xe1, 0x3d, 0xfe, 0x70, 0xa2, 0x1e, 0xff, 0x6b,
-  0xfa, 0xe2, 0x99, 0x01, 0x18, 0xd9, 0xb4, 0x6d, 0xe6, 0x87, 0x6c, 0x21,
-  0x7a, 0x57, 0x5f, 0xad, 0x68, 0x39, 0xdc, 0x60, 0xac, 0x27, 0x5a, 0x1b,
-  0xd0, 0x10, 0x5d, 0xe5, 0xf4, 0xed, 0x16, 0x55, 0x53, 0xa5, 0x8f, 0x38,
-  0xc6, 0x8b, 0x79, 0x16, 0xad, 0x56, 0x33, 0x01, 0xd7, 0xd3, 0x7b, 0x13,
-  0xa5, 0x3e, 0x47, 0xd1, 0xeb, 0xa4, 0x1a, 0x86, 0xa8, 0xb7, 0x7f, 0x1c,
-  0x36, 0x38, 0x0b, 0x6b, 0xd3, 0x08, 0x68, 0x7a, 0xf0, 0x80, 0xb4, 0xdc,
-  0x17, 0xf8, 0x04, 0x0a, 0x6c, 0x70, 0xbc, 0x94, 0x57, 0x86, 0xc2, 0x72,
-  0x00, 0x79, 0x80, 0x61, 0x66, 0xe1, 0x27, 0x4d, 0xda, 0xa8, 0xee, 0xdc,
-  0x80, 0xcc, 0xa1, 0x12, 0x52, 0x26, 0xee, 0xd4, 0x62, 0x97, 0x0f, 0xf7,
-  0x96, 0x12, 0x47, 0x48, 0x3e, 0xcb, 0x06, 0xea, 0x67, 0x6d, 0xb8, 0x9b,
-  0xeb, 0x91, 0x70, 0x04, 0x46, 0x8f, 0x67, 0x9f, 0x4a, 0xf5, 0xe0, 0xe1,
-  0xaf, 0xb6, 0x71, 0x73, 0x16, 0x24, 0x34, 0x65, 0x96, 0xe3, 0x5c, 0xb8,
-  0x40, 0x74, 0x17, 0x56, 0xae, 0xbc, 0x05, 0x1a, 0x58, 0x77, 0x75, 0x4e,
-  0xa4, 0xd1, 0x62, 0x7b, 0x03, 0x35, 0x5e, 0xbe, 0xa2, 0xe4, 0x7c, 0x3f,
-  0x8c, 0x1f, 0xff, 0x0b, 0xba, 0xea, 0x15, 0x8c, 0x9c, 0x91, 0xab, 0xcb,
-  0x06, 0xdd, 0xb8, 0xc1, 0x1e, 0xd0, 0x6d, 0x04, 0x84, 0x2d, 0xb7, 0x14,
-  0x56, 0x6f, 0xaa, 0x93, 0x00, 0x5f, 0xc5, 0x7c, 0x6f, 0x0b, 0x53, 0x8a,
-  0x2c, 0xa2, 0x9b, 0x0d, 0x48, 0x6b, 0x97, 0x1f, 0x5e, 0x13, 0x1d, 0x4e,
-  0x79, 0x2c, 0xf5, 0x34, 0x5b, 0x74, 0xa6, 0x0f, 0x6e, 0x1d, 0x04, 0xcd,
-  0x2a, 0x40, 0xe5, 0x1f, 0x85, 0x46, 0x4e, 0xe7, 0x81, 0x26, 0xcf, 0x62,
-  0x0f, 0xf3, 0x5e, 0x47, 0x60, 0x86, 0x4d, 0x47, 0x43, 0x9a, 0xcb, 0xfb,
-  0xd6, 0x31, 0xe3, 0xd4, 0xc3, 0x63, 0x0d, 0x37, 0x36, 0x3b, 0x15, 0x5e,
-  0xbd, 0x81, 0x32, 0x6b, 0x1e, 0x1b, 0x71, 0x39, 0xd6, 0x63, 0x2c, 0xbf,
-  0xbe, 0x0e, 0xd4, 0x18, 0x13, 0x75, 0xf6, 0x0c, 0x8f, 0x0e, 0xcd, 0xab,
-  0x38, 0x62, 0x9f, 0xf8, 0x6f, 0xf2, 0x05, 0x6c, 0x33, 0xea, 0x0f, 0xf9,
-  0x2a, 0x89, 0x8b, 0x2b, 0x29, 0xff, 0xdf, 0x66, 0x29, 0xc9, 0x62, 0x44,
-  0xff, 0x48, 0xb5, 0x85, 0xbf, 0xd4, 0x2a, 0xc7, 0x17, 0x22, 0xb0, 0x0d,
-  0x68, 0x3f, 0xc9, 0x4c, 0x33, 0xa0, 0x92, 0x40, 0x19, 0x2e, 0xd4, 0x7b,
-  0xfa, 0xbc, 0xbd, 0xd7, 0x76, 0x72, 0x41, 0xba, 0xd8, 0x57, 0x5c, 0x6a,
-  0xeb, 0x1e, 0x9b, 0x85, 0x26, 0xf9, 0x49, 0x18, 0xd9, 0xb1, 0x59, 0x96,
-  0x9b, 0xa8, 0xdc, 0xd8, 0x8d, 0xe0, 0x0d, 0xd4, 0xa6, 0xc5, 0x63, 0x1d,
-  0xa9, 0x45, 0xdf, 0x4e, 0xae, 0x81, 0x80, 0x98, 0x97, 0x48, 0x3d, 0xf8,
-  0x16, 0xd3, 0x39, 0xd7, 0x7d, 0xa7, 0x71, 0xab, 0x05, 0x74, 0xf8, 0x26,
-  0x9d, 0x7a, 0xfa, 0xfd, 0x58, 0xee, 0x2e, 0xdd, 0xf9, 0xc3, 0xcd, 0xd8,
-  0x1d, 0x5e, 0x04, 0x9f, 0x1a, 0xec, 0xad, 0xb4, 0x6b, 0x53, 0x1c, 0x3e,
-  0x8c, 0xf4, 0x13, 0xee, 0xa1, 0xa5, 0xda, 0x91, 0xfb, 0xc6, 0x46, 0xb3,
-  0x31, 0x67, 0x27, 0xe6, 0x92, 0x04, 0xad, 0x30, 0xae, 0x29, 0x53, 0xd3,
-  0xbc, 0xc0, 0xc3, 0x02, 0x26, 0x29, 0x26, 0x60, 0xda, 0xc7, 0xf5, 0x42,
-  0x3e, 0x98, 0x64, 0xf9, 0xec, 0x36, 0x2a, 0x30, 0x92, 0x95, 0x3f, 0xb4,
-  0xf0, 0x1c, 0x95, 0x1d, 0x34, 0x38, 0x85, 0x55, 0x02, 0x66, 0x14, 0x17,
-  0xb9, 0xe5, 0x0f, 0x5f, 0xb6, 0x85, 0x16, 0x41, 0x4f, 0xf2, 0xea, 0x77,
-  0x55, 0x9a, 0xfa, 0x74, 0x2a, 0xfd, 0xff, 0xd5, 0x67, 0xf9, 0x76, 0x0b,
-  0xc4, 0x2e, 0x23, 0xfd, 0x76, 0x56, 0x75, 0x1b, 0xc7, 0xd6, 0xdb, 0x5e,
-  0xf1, 0x83, 0x9c, 0xf2, 0xc7, 0x02, 0x73, 0x89, 0xdb, 0x2d, 0x01, 0x0b,
-  0x57, 0x49, 0x11, 0x2f, 0xab, 0xbc, 0x48, 0xe2, 0x92, 0xb3, 0x71, 0xf9,
-  0x48, 0x63, 0xda, 0x64, 0xf0, 0xea, 0x80, 0x8e, 0xc9, 0xa0, 0x2a, 0x7a,
-  0x3b, 0x90, 0xf1, 0xea, 0x77, 0xf7, 0x1e, 0x16, 0xa7, 0x66, 0x2f, 0xc5,
-  0x57, 0xb2, 0xba, 0xf6, 0xc5, 0xc3, 0x17, 0x28, 0x33, 0x48, 0xc4, 0xd3,
-  0x8f, 0x80, 0x84, 0x2f, 0x64, 0x16, 0x98, 0xa1, 0x67, 0x74, 0x8e, 0x97,
-  0x14, 0xcf, 0xb5, 0x1b, 0x68, 0x93, 0xb3, 0x5b, 0xcb, 0x84, 0x2a, 0x4e,
-  0x9d, 0x7d, 0xe4, 0x2b, 0x67, 0x1f, 0xa9, 0xab, 0x9d, 0x13, 0xba, 0x7f,
-  0xa6, 0xd6, 0x82, 0xd3, 0x6e, 0x48, 0xae, 0xbf, 0xb3, 0x32, 0x7b, 0xbb,
-  0x8f, 0x8b, 0xfb, 0xa1, 0x3d, 0x2e, 0xb1, 0xcb, 0x9d, 0xdd, 0x6f, 0xea,
-  0xc3, 0xad, 0xea, 0x2f, 0x53, 0xfb, 0x1e, 0x83, 0xf3, 0x4e, 0x03, 0xa3,
-  0x6f, 0xe6, 0xd1, 0xd0, 0x5d, 0x64, 0x66, 0x84, 0x42, 0x9b, 0xa4, 0xab,
-  0xe2, 0xd8, 0x3f, 0xca, 0xc6, 0xd6, 0xdf, 0x60, 0x93, 0x77, 0xde, 0x89,
-  0x2c, 0xee, 0x91, 0x39, 0x46, 0xd4, 0x59, 0xef, 0x48, 0xdc, 0x33, 0xe0,
-  0x40, 0x53, 0x00, 0xa7, 0xf7, 0x03, 0x6a, 0x3f, 0x8e, 0x76, 0xc0, 0x63,
-  0x1d, 0xab, 0x91, 0x64, 0x6b, 0xd8, 0x1e, 0x4c, 0x5a, 0x98, 0x0e, 0xc8,
-  0x4d, 0xb5, 0x4d, 0x19, 0x92, 0x94, 0xe9, 0xe7, 0xdd, 0xd0, 0x55, 0xbe,
-  0xeb, 0x46, 0x6b, 0x6e, 0xb9, 0x60, 0x27, 0xc7, 0x57, 0x6c, 0xfb, 0x09,
-  0x58, 0xc5, 0xdb, 0x81, 0xa4, 0x96, 0xb0, 0x23, 0xc4, 0x3d, 0xa0, 0x26,
-  0x16, 0x54, 0xbb, 0x85, 0x0c, 0x82, 0xdd, 0xe4, 0x65, 0x75, 0xdc, 0x21,
-  0x04, 0x78, 0x0d, 0x1c, 0xa7, 0x92, 0x51, 0xf6, 0x58, 0x2f, 0x86, 0x86,
-  0xfa, 0xe7, 0xae, 0x42, 0x5e, 0xe1, 0x4f, 0x3f, 0x2a, 0x17, 0x4b, 0x60,
-  0xce, 0x38, 0x2b, 0xf7, 0xc0, 0xfd, 0x45, 0x0c, 0xe7, 0x90, 0x45, 0x7a,
-  0xcf, 0xc4, 0xd0, 0x56, 0x24, 0x8b, 0x88, 0xb0, 0x93, 0x55, 0x00, 0x6d,
-  0x7e, 0x24, 0x30, 0x67, 0x98, 0x07, 0x5f, 0x64, 0xc5, 0xd3, 0x19, 0x63,
-  0xea, 0x80, 0x1b, 0xd4, 0x01, 0x19, 0x98, 0x5f, 0xaa, 0x0f, 0xe2, 0x9f,
-  0x33, 0xa0, 0x1b, 0x16, 0xb4, 0x75, 0xe1, 0x96, 0xf6, 0x08, 0xf0, 0x0b,
-  0x6e, 0x69, 0x61, 0x5d, 0x17, 0x34, 0x83, 0xfc, 0xb6, 0xb4, 0x1b, 0x18,
-  0xec, 0x38, 0x98, 0x32, 0x87, 0xb9, 0xf5, 0xa8, 0x94, 0xf3, 0x91, 0xd9,
-  0xc4, 0xee, 0xf9, 0x54, 0x14, 0x71, 0xde, 0x31, 0xdc, 0xad, 0xe8, 0x88,
-  0x94, 0x17, 0x6f, 0x40, 0xd1, 0x88, 0xab, 0x53, 0x4f, 0xfe, 0x2c, 0x57,
-  0x98, 0xde, 0x5b, 0x96, 0xfa, 0x06, 0x96, 0x52, 0x1a, 0x17, 0x24, 0x55,
-  0x45, 0xae, 0xb1, 0x37, 0x9d, 0x12, 0xbd, 0x89, 0x45, 0x29, 0x7a, 0x79,
-  0xc9, 0x99, 0x7b, 0x17, 0x55, 0x1b, 0x9c, 0xe3, 0x1d, 0x52, 0x30, 0xa5,
-  0xff, 0xe0, 0x1c, 0xd8, 0xeb, 0x69, 0xb9, 0xb3, 0x32, 0x25, 0x07, 0x9c,
-  0x92, 0x4e, 0x2a, 0xaa, 0x2b, 0x4b, 0xba, 0xc1, 0x36, 0xb3, 0xdf, 0xa4,
-  0x1e, 0xd6, 0x14, 0xac, 0x57, 0xb8, 0x98, 0x1c, 0x68, 0xfa, 0xd3, 0x36,
-  0x60, 0xc0, 0x56, 0xf1, 0x4d, 0x82, 0x8f, 0x2d, 0x58, 0xb4, 0xfc, 0x61,
-  0x95, 0x48, 0xb6, 0x04, 0x43, 0x27, 0x5e, 0x0b, 0xb3, 0x69, 0x7c, 0xb9,
-  0xa2, 0x31, 0xb9, 0x42, 0x28, 0xb5, 0xdd, 0x03, 0xe6, 0x45, 0x6c, 0xee,
-  0xc4, 0x30, 0xe1, 0x93, 0x60, 0x63, 0x1b, 0x39, 0xa1, 0x79, 0xfa, 0x91,
-  0xc2, 0x99, 0x8a, 0xaf, 0x8b, 0x1c, 0x73, 0x35, 0x2c, 0xd3, 0xab, 0xe5,
-  0x86, 0x7c, 0xe1, 0x34, 0x4d, 0x86, 0x8d, 0xe2, 0xbb, 0xea, 0x6a, 0xb9,
-  0x72, 0xbf, 0x6f, 0xf7, 0x62, 0x19, 0xc3, 0x32, 0x49, 0x59, 0x63, 0xfa,
-  0x3f, 0x75, 0x61, 0x91, 0x57, 0x33, 0x46, 0xb4, 0x84, 0x36, 0xa0, 0xda,
-  0x4c, 0xcf, 0x7f, 0x60, 0xc0, 0x9e, 0x7e, 0x74, 0x8d, 0x6b, 0xa0, 0x4c,
-  0xae, 0x1a, 0xc4, 0x20, 0x0a, 0x62, 0x09, 0x98, 0x74, 0xa2, 0x15, 0x23,
-  0x0b, 0x83, 0x28, 0xd2, 0xfd, 0x32, 0x41, 0xd7, 0x0d, 0x80, 0xc2, 0x0a,
-  0xb8, 0xe9, 0x86, 0xc0, 0x78, 0xb9, 0x95, 0x0b, 0xbc, 0xb3, 0x48, 0xee,
-  0x1a, 0xed, 0xe9, 0x62, 0x7a, 0xba, 0x43, 0x7a, 0xe8, 0xcc, 0x09, 0x7d,
-  0x28, 0x8f, 0x09, 0x01, 0x0e, 0x42, 0x46, 0xb9, 0x1f, 0x2d, 0x87, 0xf8,
-  0x0a, 0xfa, 0xa7, 0x8f, 0x9f, 0x8e, 0x9c, 0xb6, 0xae, 0xe3, 0x6a, 0x79,
-  0x8b, 0x86, 0xc3, 0x67, 0x23, 0x33, 0x19, 0x4b, 0x6c, 0x0e, 0x47, 0x08,
-  0x4a, 0x1c, 0x32, 0xe2, 0xc0, 0x78, 0x08, 0x6b, 0x2b, 0x54, 0xfa, 0xbe,
-  0x5e, 0xaf, 0x13, 0xb4, 0xce, 0xa7, 0xf7, 0x0a, 0xc7, 0x4e, 0xa7, 0x01,
-  0x2b, 0xa9, 0x92, 0xad, 0x73, 0x02, 0x4b, 0x2c, 0x3f, 0x55, 0xbf, 0xe7,
-  0x73, 0x8b, 0xd2, 0x02, 0xc5, 0xc7, 0x54, 0x6e, 0x12, 0x38, 0xcd, 0xe8,
-  0xf3, 0xd1, 0x2a, 0x5e, 0x24, 0x51, 0x46, 0xba, 0xe6, 0x7e, 0xb1, 0xcf,
-  0xaa, 0x3d, 0xda, 0x90, 0xf0, 0x19, 0xa8, 0x92, 0xa2, 0xfd, 0xff, 0x18,
-  0x2f, 0xd4, 0xc5, 0xd9, 0xf9, 0xdf, 0xe1, 0x9b, 0x95, 0x71, 0x09, 0xa7,
-  0xa8, 0x53, 0x67, 0xfa, 0xee, 0xea, 0x63, 0x79, 0x3d, 0x68, 0x28, 0x09,
-  0x9e, 0x4c, 0x67, 0x9e, 0x4a, 0x34, 0xb0, 0x26, 0x37, 0x35, 0xc3, 0xab,
-  0x7e, 0xe1, 0x6a, 0xe6, 0x5f, 0xe4, 0x56, 0x87, 0x0b, 0x91, 0x16, 0xcb,
-  0x4b, 0xcc, 0x2b, 0x34, 0xd7, 0x38, 0x01, 0x30, 0xda, 0x53, 0x2b, 0x5f,
-  0xdd, 0x4b, 0xda, 0xd1, 0x17, 0xa0, 0x39, 0x5c, 0x91, 0x4c, 0xab, 0x36,
-  0xdb, 0xf4, 0x74, 0xb9, 0xdb, 0x5d, 0xa9, 0xcf, 0x90, 0x09, 0x71, 0x85,
-  0x89, 0xbc, 0xe2, 0x27, 0x70, 0xa1, 0xeb, 0x7b, 0x5a, 0x78, 0x91, 0x96,
-  0x79, 0x20, 0xfe, 0xc8, 0x88, 0xad, 0x12, 0x1c, 0x2a, 0x65, 0xa4, 0xbb,
-  0x36, 0xd7, 0x56, 0x98, 0x8a, 0x17, 0x69, 0x3a, 0x25, 0x09, 0x8e, 0x23,
-  0x40, 0xe7, 0x71, 0x5e, 0xbd, 0x32, 0x8c, 0xcd, 0xad, 0xda, 0x7d, 0x95,
-  0x99, 0x05, 0xc1, 0x64, 0x39, 0x35, 0x72, 0xcf, 0xee, 0x12, 0x7f, 0xe1,
-  0x23, 0x16, 0xd0, 0x0b, 0x33, 0xea, 0x49, 0x62, 0x87, 0x66, 0xbd, 0x3e,
-  0xf0, 0x64, 0xbb, 0x8c, 0x32, 0xbc, 0x5a, 0xe7, 0x25, 0x86, 0xa6, 0x67,
-  0xdd, 0x1d, 0x7e, 0x77, 0xd8, 0xeb, 0xd0, 0xd5, 0xe3, 0xe1, 0xe3, 0x6f,
-  0xcc, 0xce, 0xa3, 0x5b, 0xd6, 0xa7, 0xe8, 0x33, 0xb5, 0x0c, 0x5c, 0xc8,
-  0xf9, 0x5b, 0x07, 0x6d, 0x93, 0xe4, 0x60, 0xa4, 0xfc, 0x3d, 0xcf, 0x7d,
-  0x34, 0x09, 0x45, 0x2f, 0xe6, 0x5b, 0x03, 0x56, 0x10, 0x1b, 0xed, 0xe0,
-  0x18, 0xf9, 0xcc, 0x44, 0xc7, 0x8f, 0xb4, 0x1f, 0x90, 0xc6, 0x5a, 0x21,
-  0x56, 0xf6, 0x15, 0x9f, 0xa4, 0x4a, 0xf0, 0xe2, 0x81, 0x15, 0x93, 0xe0,
-  0x9e, 0xe9, 0xf4, 0xd5, 0x3a, 0x32, 0x97, 0xc0, 0x90, 0x35, 0xdc, 0x5a,
-  0x64, 0x98, 0xc2, 0x8f, 0x33, 0xa8, 0x70, 0x5e, 0xb7, 0x5a, 0x8f, 0x9d,
-  0xae, 0x4d, 0x70, 0x22, 0xd8, 0x90, 0x45, 0x19, 0x26, 0x5c, 0xd7, 0x14,
-  0x38, 0xd3, 0x92, 0x71, 0x16, 0x40, 0xac, 0x13, 0xa1, 0x16, 0xeb, 0x16,
-  0xc5, 0x15, 0x87, 0x66, 0xcb, 0x55, 0x7c, 0xb9, 0xc9, 0xf7, 0x29, 0x3b,
-  0x40, 0xa0, 0xa0, 0x87, 0x75, 0x0a, 0x28, 0x6c, 0x0e, 0x35, 0x7e, 0x6a,
-  0x06, 0xda, 0x9c, 0x8c, 0xc9, 0x0a, 0x8d, 0xb8, 0x6b, 0xbe, 0xc2, 0xf2,
-  0x66, 0xbd, 0xf6, 0xfb, 0xa1, 0x53, 0xb4, 0x05, 0xf3, 0x70, 0x84, 0x62,
-  0x54, 0x24, 0xea, 0xb7, 0x6e, 0xde, 0x36, 0xcf, 0x22, 0xf8, 0x73, 0xe3,
-  0xba, 0xe0, 0x3b, 0x6d, 0x4d, 0x3d, 0x82, 0x9d, 0x5c, 0x1d, 0x7e, 0x6d,
-  0xce, 0xda, 0xe1, 0xda, 0xfe, 0x8a, 0xfc, 0x76, 0xa6, 0x93, 0x3a, 0x9b,
-  0x88, 0x13, 0xf8, 0xa6, 0xb3, 0xd2, 0x6a, 0x78, 0xb6, 0xb2, 0xa7, 0x0d,
-  0x40, 0xf8, 0xb6, 0xdf, 0x66, 0x4d, 0xd8, 0xad, 0xf5, 0xba, 0x03, 0x2e,
-  0x37, 0x7d, 0x3b, 0x92, 0x00, 0x1b, 0x97, 0x6e, 0xaa, 0x90, 0x19, 0x17,
-  0x07, 0xa7, 0x88, 0x51, 0x55, 0x05, 0xbe, 0xa2, 0xa5, 0x2f, 0x4e, 0x1b,
-  0xbe, 0x8f, 0x86, 0x94, 0xaa, 0x88, 0xb2, 0x12, 0xf6, 0x04, 0x9d, 0x79,
-  0x04, 0xce, 0x77, 0x45, 0x0e, 0xfc, 0x1f, 0xaf, 0xd5, 0x56, 0x65, 0xf5,
-  0x5a, 0xf1, 0x5b, 0x65, 0xfb, 0x7d, 0x34, 0x46, 0x2d, 0xdd, 0x78, 0x49,
-  0x3a, 0x03, 0xf2, 0x1e, 0x4b, 0x23, 0x99, 0x36, 0x48, 0x84, 0xc6, 0xec,
-  0xd8, 0xd5, 0x1a, 0x73, 0x06, 0x75, 0x70, 0x63, 0xdb, 0x8e, 0xc6, 0x0c,
-  0xf1, 0x81, 0xde, 0x88, 0x05, 0xd0, 0xf9, 0xe4, 0xca, 0x03, 0x5c, 0x7a,
-  0x26, 0x02, 0xca, 0xc0, 0x68, 0x1d, 0x67, 0xd0, 0xd0, 0xb8, 0x2b, 0x1a,
-  0x67, 0xd1, 0x22, 0x51, 0x59, 0x83, 0x52, 0xd3, 0xf3, 0xc0, 0x50, 0x08,
-  0xa5, 0xce, 0x27, 0x9f, 0xd2, 0xad, 0xa5, 0xd4, 0xc0, 0x78, 0x94, 0xf6,
-  0x8c, 0x6b, 0x9d, 0x52, 0x8b, 0x44, 0x6d, 0x9b, 0x13, 0x18, 0x79, 0x83,
-  0x66, 0x61, 0x43, 0x94, 0x53, 0x6b, 0xa3, 0x91, 0x47, 0xd6, 0x10, 0x39,
-  0x20, 0x6b, 0xc4, 0xe6, 0xae, 0x32, 0x82, 0xa0, 0x98, 0x3a, 0x73, 0xd7,
-  0x31, 0x12, 0x85, 0xb9, 0x51, 0x3a, 0x68, 0x08, 0x87, 0x26, 0x09, 0xc6,
-  0x6f, 0x40, 0x3f, 0xdb, 0xe4, 0x49, 0xac, 0xde, 0xb5, 0xe5, 0xe0, 0xb1,
-  0x85, 0x7a, 0xd5, 0x76, 0xf2, 0xa3, 0xdb, 0x7d, 0xf7, 0xdd, 0x2e, 0xbe,
-  0x09, 0xb3, 0x36, 0x70, 0xef, 0x5d, 0x4c, 0xa7, 0x0d, 0x87, 0x31, 0x6b,
-  0x52, 0x44, 0xe3, 0x47, 0x71, 0xa1, 0x1b, 0x00, 0x58, 0x9e, 0x16, 0xfc,
-  0xd8, 0xcb, 0x7f, 0xde, 0xc4, 0xd4, 0x09, 0xa3, 0xef, 0x2e, 0x53, 0x75,
-  0xb7, 0x0c, 0x90, 0xc1, 0x96, 0xbd, 0x28, 0x10, 0xb1, 0xfc, 0xd7, 0x06,
-  0x82, 0xeb, 0x78, 0x72, 0x90, 0x6b, 0xeb, 0x20, 0x10, 0xde, 0x19, 0xc5,
-  0xd7, 0xe7, 0xc8, 0xdd, 0x1c, 0x61, 0xaf, 0x88, 0x6f, 0xe8, 0xf6, 0x95,
-  0x55, 0x82, 0x2f, 0xf1, 0xde, 0x1b, 0x77, 0x3b, 0x6d, 0x8b, 0xb6, 0xb7,
-  0xdc, 0x98, 0xfa, 0x8f, 0x76, 0xca, 0x25, 0xd9, 0xa9, 0x4f, 0xe1, 0x07,
-  0x6d, 0xe8, 0x3d, 0xf7, 0x41, 0xef, 0x71, 0x1b, 0x44, 0x5e, 0x84, 0xee,
-  0x06, 0xf7, 0x5e, 0x17, 0x1c, 0xba, 0xd7, 0xbe, 0x91, 0x5b, 0x94, 0x9a,
-  0x02, 0xef, 0xf9, 0x67, 0xf4, 0x36, 0x23, 0x50, 0x98, 0x39, 0xb9, 0xb5,
-  0x1a, 0x17, 0x01, 0xba, 0x54, 0x17, 0x57, 0x5a, 0xa5, 0x6a, 0x1c, 0xbb,
-  0xd1, 0x61, 0xa0, 0x54, 0x8b, 0xa4, 0x02, 0x9a, 0x4b, 0x16, 0xbd, 0xe8,
-  0x9f, 0x5c, 0x62, 0xc2, 0xe0, 0x88, 0x33, 0x8f, 0xa2, 0xcb, 0xf3, 0x29,
-  0x3f, 0xff, 0x90, 0xaf, 0x40, 0x9d, 0xfd, 0x26, 0xde, 0xa5, 0xd1, 0x32,
-  0x66, 0x0d, 0xd4, 0x60, 0x5b, 0xdc, 0x2b, 0xa3, 0xeb, 0x6f, 0xa2, 0x74,
-  0x0d, 0xe4, 0xdf, 0x53, 0x08, 0xc0, 0x36, 0xf9, 0x09, 0x54, 0xd6, 0x2f,
-  0xbf, 0xf8, 0xf6, 0x35, 0xb0, 0xd5, 0x2a, 0xa6, 0x83, 0xb9, 0x3d, 0x6d,
-  0xdb, 0x77, 0xbe, 0xdc, 0xec, 0x93, 0xf9, 0x76, 0x9e, 0x6c, 0xaf, 0x99,
-  0x90, 0x4a, 0xd1, 0x9a, 0xc0, 0x8b, 0x3d, 0x31, 0x80, 0x45, 0xab, 0xd5,
-  0x45, 0x9a, 0x2d, 0xc9, 0x15, 0x28, 0x5c, 0x69, 0x8c, 0x38, 0x45, 0x67,
-  0x42, 0x67, 0xa8, 0xaa, 0x20, 0x0f, 0xa3, 0xf6, 0x0a, 0x51, 0x76, 0x4f,
-  0xf7, 0x3b, 0xe8, 0x45, 0x51, 0xc9, 0xe3, 0x10, 0xcc, 0xca, 0xc6, 0x07,
-  0x35, 0xe0, 0xdd, 0x74, 0x67, 0x59, 0x5e, 0x07, 0xe4, 0xb5, 0x59, 0x52,
-  0x0e, 0xcc, 0xcb, 0x76, 0xda, 0x2d, 0x96, 0xac, 0x34, 0xe4, 0x1c, 0xcb,
-  0x6c, 0xb2, 0x46, 0xae, 0xe6, 0x37, 0x34, 0x5f, 0x70, 0x16, 0x51, 0x5a,
-  0x72, 0x3a, 0x79, 0xf2, 0x64, 0x92, 0x94, 0xb3, 0x45, 0x9e, 0xa7, 0xb1,
-  0xcc, 0x7f, 0x55, 0xac, 0x66, 0x5b, 0x60, 0x3e, 0x32, 0xd8, 0x06, 0x13,
-  0x8c, 0x06, 0x3e, 0x4a, 0x28, 0xd4, 0x10, 0x52, 0x9a, 0x09, 0x43, 0xf5,
-  0xdb, 0x0b, 0x96, 0xa6, 0x34, 0x79, 0x13, 0x6b, 0x87, 0x6d, 0x8d, 0x91,
-  0x97, 0x00, 0x06, 0xf0, 0xac, 0x23, 0xba, 0x6c, 0x70, 0xae, 0xab, 0x4e,
-  0x5a, 0x69, 0xb6, 0xa9, 0x70, 0x8f, 0x42, 0x5f, 0xe5, 0xd6, 0x29, 0x5c,
-  0xe8, 0xf5, 0x88, 0xa9, 0xe9, 0xea, 0x15, 0x27, 0x44, 0x5d, 0x71, 0x5e,
-  0x59, 0x82, 0xee, 0xa5, 0x4a, 0xfb, 0x46, 0xb4, 0xd1, 0x36, 0x1d, 0x3c,
-  0xbb, 0x9c, 0xc6, 0x7f, 0x82, 0x2f, 0xb5, 0x4f, 0xc6, 0x89, 0x0c, 0xcc,
-  0x84, 0x9e, 0x6e, 0xa7, 0x5b, 0x76, 0x23, 0x0f, 0x57, 0xb9, 0xb9, 0x6a,
-  0xd3, 0x4e, 0xe4, 0xf8, 0xc9, 0xc4, 0xc7, 0x1d, 0xb4, 0xf0, 0x63, 0xe2,
-  0xc7, 0x93, 0x8c, 0x13, 0x4e, 0x67, 0x46, 0xe8, 0xa4, 0x60, 0x08, 0xa1,
-  0x8f, 0xd1, 0xf3, 0x11, 0x61, 0x1b, 0xce, 0xb8, 0xcf, 0x88, 0x69, 0x5f,
-  0xc9, 0xcb, 0xaf, 0xd3, 0x8e, 0xa5, 0x20, 0x6b, 0x46, 0x5f, 0x7d, 0xcb,
-  0x2e, 0x4c, 0x71, 0xa6, 0x65, 0x1c, 0x15, 0xcb, 0x0d, 0xfa, 0x6f, 0x1b,
-  0xf3, 0x7b, 0x52, 0x89, 0xdd, 0x5f, 0x47, 0x25, 0xd6, 0xca, 0xf4, 0x2e,
-  0xf0, 0x5c, 0xfd, 0x11, 0xe5, 0xd7, 0xe7, 0x69, 0x12, 0x95, 0x70, 0x6e,
-  0x05, 0x61, 0xc3, 0x32, 0x2e, 0xbe, 0x03, 0x09, 0xb2, 0xd4, 0x6e, 0x50,
-  0x64, 0x68, 0xc9, 0xd7, 0x2a, 0xdf, 0x17, 0x46, 0x78, 0x1d, 0xe1, 0x73,
-  0xa6, 0x38, 0x9f, 0x55, 0x4c, 0xb7, 0x29, 0x5a, 0xdc, 0xc2, 0x31, 0x08,
-  0xd5, 0x96, 0x19, 0x4a, 0x0a, 0xeb, 0xbe, 0x3d, 0xb1, 0x52, 0xb7, 0x6e,
-  0x73, 0xe0, 0x17, 0xbf, 0xcd, 0x10, 0xb1, 0x5a, 0x33, 0xb3, 0x0f, 0x5c,
-  0x28, 0x47, 0x24, 0x7b, 0xe7, 0x3e, 0xaf, 0x25, 0xdd, 0xb5, 0x60, 0x83,
-  0xfc, 0xe0, 0x29, 0x7a, 0x1a, 0xd1, 0xf6, 0x44, 0x0f, 0x39, 0xcc, 0xe0,
-  0x70, 0x87, 0x36, 0xc5, 0x1b, 0xed, 0x86, 0x13, 0xa3, 0x01, 0x9b, 0x6f,
-  0x8c, 0x6c, 0x86, 0x27, 0x1d, 0xc3, 0x21, 0xf5, 0xe0, 0x4f, 0xf6, 0xed,
-  0xb8, 0x51, 0x57, 0x20, 0xf9, 0xf0, 0x6f, 0x55, 0x69, 0x95, 0x8a, 0xe0,
-  0xd9, 0x7d, 0xcf, 0xe4, 0xed, 0x92, 0x3c, 0x51, 0x65, 0x89, 0xb7, 0xe5,
-  0xd6, 0xbf, 0xe8, 0x06, 0xfd, 0x8b, 0x88, 0xde, 0xab, 0x2b, 0xf6, 0x33,
-  0x9a, 0x3a, 0xe0, 0xae, 0x39, 0xeb, 0xdf, 0x79, 0xdf, 0x44, 0x87, 0x9d,
-  0xff, 0x70, 0xfd, 0x26, 0x02, 0x1d, 0x41, 0xfe, 0xe7, 0x87, 0x39, 0xec,
-  0x12, 0xe0, 0xed, 0x7a, 0xcb, 0xe9, 0x61, 0x73, 0x93, 0x22, 0x16, 0x5a,
-  0x45, 0x3f, 0x3b, 0xea, 0x8a, 0x25, 0x84, 0x12, 0x96, 0xda, 0xf0, 0xed,
-  0x2e, 0x50, 0xda, 0x77, 0x9d, 0x5b, 0x6d, 0xb1, 0xf7, 0x12, 0x0e, 0x39,
-  0xb2, 0xa2, 0xc7, 0xc0, 0xd1, 0x96, 0x4e, 0xce, 0x40, 0x62, 0x52, 0xc4,
-  0xa0, 0x4e, 0x2e, 0x61, 0x20, 0x22, 0xbc, 0xbe, 0xa6, 0x8b, 0x56, 0xc9,
-  0x83, 0xa6, 0x6f, 0x4f, 0xb5, 0x39, 0xda, 0xa9, 0x6f, 0x66, 0x93, 0xb6,
-  0x98, 0x84, 0x7e, 0x2e, 0x23, 0xba, 0x60, 0xbb, 0x3f, 0x41, 0x8f, 0x3d,
-  0xe8, 0x20, 0xb0, 0x21, 0xec, 0x6c, 0xf0, 0x07, 0x3a, 0x2d, 0xd1, 0x48,
-  0x27, 0x9c, 0xe1, 0x4e, 0x90, 0x30, 0x37, 0x67, 0xb8, 0x8d, 0x32, 0x33,
-  0x8b, 0x51, 0x7c, 0x9f, 0xad, 0x80, 0x73, 0x2b, 0x50, 0xdf, 0xc9, 0x74,
-  0xcb, 0xb6, 0xf0, 0x32, 0xa9, 0xf6, 0x11, 0xdf, 0xab, 0xcb, 0x48, 0x34,
-  0xe6, 0x8f, 0x87, 0x4a, 0x1d, 0xe9, 0x67, 0x55, 0xcd, 0x21, 0x5d, 0x8f,
-  0xb7, 0xe6, 0x4b, 0x14, 0x26, 0x34, 0x2c, 0x5b, 0x93, 0x7f, 0xd7, 0xd8,
-  0x93, 0x1b, 0x28, 0x75, 0x9d, 0x20, 0x63, 0x48, 0x25, 0x97, 0x31, 0x26,
-  0x96, 0x31, 0xa6, 0x03, 0x18, 0x43, 0xd0, 0x4f, 0x1d, 0x67, 0x10, 0x79,
-  0x30, 0x48, 0x8d, 0xc4, 0xca, 0x35, 0xaa, 0x5b, 0x56, 0xcc, 0xa2, 0x2c,
-  0x61, 0xcd, 0x46, 0xd5, 0x1e, 0x85, 0xa6, 0xb3, 0xae, 0x68, 0x4b, 0xa5,
-  0x9b, 0x1f, 0x66, 0x10, 0x5e, 0x2e, 0x8e, 0x7d, 0x67, 0xad, 0x3d, 0x12,
-  0x74, 0xb0, 0xf7, 0x24, 0x2c, 0x1b, 0xdc, 0x64, 0xa7, 0x30, 0x5f, 0x9f,
-  0x7f, 0xf9, 0xed, 0xe7, 0x57, 0xea, 0x75, 0x0e, 0x8b, 0x7f, 0x01, 0x2c,
-  0x13, 0x29, 0x7d, 0xb7, 0x21, 0xf0, 0xff, 0x20, 0xaa, 0x43, 0xe7, 0xfa,
-  0xb7, 0x91, 0x90, 0xc6, 0x13, 0xe0, 0x4f, 0xc4, 0x6e, 0x30, 0x82, 0xb7,
-  0x31, 0x28, 0x5b, 0x37, 0xec, 0xf7, 0x19, 0x5b, 0x0d, 0x98, 0x74, 0x38,
-  0x2c, 0x44, 0x16, 0x2b, 0xe2, 0xdb, 0x02, 0x9f, 0xef, 0xd3, 0x6c, 0x61,
-  0xf0, 0x62, 0x1d, 0xc2, 0xa6, 0x17, 0xc8, 0xb3, 0xb2, 0x58, 0x3e, 0xdb,
-  0xe2, 0xd7, 0xd3, 0x94, 0x5e, 0x02, 0xb3, 0x0f, 0xf5, 0x38, 0x0e, 0xe8,
-  0x64, 0xdd, 0x35, 0xf7, 0x7e, 0xda, 0x05, 0x68, 0x0d, 0x82, 0x93, 0x50,
-  0x61, 0x6d, 0x36, 0x62, 0xea, 0xae, 0xea, 0x67, 0xa2, 0xd9, 0x27, 0x35,
-  0x76, 0xdd, 0x96, 0x2c, 0x25, 0xe4, 0xc8, 0x4b, 0x6e, 0x21, 0xa5, 0xba,
-  0xdd, 0x24, 0xcb, 0x0d, 0xa1, 0x32, 0x74, 0x06, 0x1a, 0x8c, 0xef, 0x60,
-  0xb4, 0xca, 0x53, 0x33, 0x1e, 0x7f, 0x01, 0xcc, 0x29, 0x34, 0x81, 0x37,
-  0xb5, 0x70, 0x3a, 0xa8, 0x79, 0x41, 0xb8, 0x62, 0x1f, 0x7f, 0x0b, 0x4d,
-  0x88, 0xd8, 0x42, 0xa0, 0xba, 0x42, 0xc8, 0x60, 0xba, 0x61, 0x04, 0x6f,
-  0x41, 0x01, 0xd6, 0xa3, 0x8a, 0xaa, 0x6d, 0xc6, 0xef, 0x63, 0xe8, 0xaa,
-  0xa7, 0xee, 0x6b, 0x66, 0x9c, 0x4c, 0x57, 0x76, 0xa4, 0x2c, 0x2e, 0x41,
-  0x51, 0xa5, 0xb8, 0x81, 0xf2, 0x58, 0x9d, 0xa9, 0xd1, 0x3f, 0xc1, 0x5c,
-  0x6d, 0x51, 0xbb, 0xa4, 0xad, 0x4b, 0xdf, 0xe4, 0xc2, 0x98, 0x01, 0x07,
-  0x32, 0xec, 0x89, 0xf5, 0xfd, 0xfb, 0x07, 0x37, 0x62, 0xa0, 0x1e, 0x37,
-  0x74, 0x84, 0x08, 0xe6, 0xa0, 0x51, 0x5d, 0x63, 0x26, 0x8f, 0xb9, 0xb4,
-  0x38, 0x0d, 0x40, 0xd2, 0x36, 0xc9, 0x2c, 0xd3, 0x76, 0x96, 0xe0, 0x9d,
-  0x74, 0x62, 0x13, 0x18, 0x3c, 0x31, 0xa2, 0xae, 0x36, 0x88, 0xc2, 0x68,
-  0x54, 0x81, 0xdf, 0x77, 0x39, 0xd5, 0x87, 0x0e, 0xb6, 0x7c, 0xb6, 0x76,
-  0x9e, 0xdc, 0xf6, 0x6d, 0x9e, 0x8a, 0xd6, 0x2b, 0xfd, 0xb6, 0x42, 0xb9,
-  0x6a, 0xbd, 0xbd, 0x23, 0x94, 0x36, 0x95, 0xeb, 0xc0, 0xfb, 0x56, 0xc2,
-  0xdb, 0x1e, 0xe8, 0xd9, 0x6c, 0xb8, 0xee, 0xc5, 0x20, 0x87, 0x2b, 0xd2,
-  0xa5, 0xda, 0xba, 0x39, 0xf9, 0xa8, 0xb5, 0x48, 0x9e, 0x99, 0xf0, 0x8e,
-  0xa8, 0xfa, 0x81, 0x1c, 0x45, 0x86, 0x55, 0xcc, 0x06, 0x33, 0x83, 0x21,
-  0xaa, 0xe2, 0x25, 0xbe, 0xfc, 0x31, 0x09, 0xcf, 0x71, 0x23, 0x93, 0xb2,
-  0x1d, 0x56, 0x3c, 0xd3, 0xe1, 0xf2, 0x33, 0x4b, 0x4f, 0x9a, 0xb8, 0x52,
-  0xdf, 0xa1, 0xd7, 0x87, 0x99, 0x46, 0x11, 0x15, 0xac, 0x8b, 0x01, 0x5b,
-  0xd7, 0x2b, 0x30, 0x32, 0xf2, 0x22, 0xa2, 0x0b, 0x59, 0xbb, 0x54, 0x23,
-  0x8e, 0x85, 0x66, 0x2f, 0x42, 0xc0, 0x83, 0x4b, 0x95, 0x57, 0xce, 0xa9,
-  0x09, 0xe7, 0x68, 0x1d, 0x9d, 0x59, 0xe7, 0xe8, 0x1c, 0x0c, 0x62, 0x22,
-  0xc5, 0x13, 0xd9, 0xea, 0xda, 0x48, 0x88, 0xb4, 0xf5, 0xc7, 0x9b, 0x4f,
-  0xbc, 0xd9, 0x42, 0xe5, 0xeb, 0x6b, 0xd2, 0x3c, 0xe5, 0xba, 0x1b, 0xa3,
-  0x6b, 0xd9, 0x25, 0x8d, 0x1c, 0xd2, 0xb2, 0xf8, 0x56, 0x5d, 0xa7, 0xf9,
-  0x82, 0x3d, 0x82, 0xb4, 0x8b, 0x8a, 0x1e, 0xf8, 0x2d, 0xa5, 0x79, 0xc1,
-  0x6d, 0x1d, 0x37, 0x7b, 0xc7, 0x0d, 0xea, 0x48, 0xfb, 0xcf, 0xfb, 0x8e,
-  0x98, 0x6a, 0x1d, 0xd3, 0xe6, 0x42, 0xa7, 0xdc, 0x2e, 0x82, 0x9f, 0x84,
-  0xef, 0x66, 0x88, 0x7e, 0x5f, 0x59, 0x9e, 0x3e, 0xf9, 0xbf, 0xe7, 0x21,
-  0xf2, 0xc7, 0x68, 0x1e, 0x01, 0x00
+  0xcc, 0x5c, 0xeb, 0x76, 0xdb, 0x46, 0x92, 0xfe, 0x2d, 0x3f, 0x45, 0x1f,
+  0x4a, 0xb6, 0x40, 0x99, 0xd0, 0x2d, 0xd9, 0x19, 0xaf, 0x2c, 0x2b, 0xc7,
+  0x89, 0x73, 0x71, 0x46, 0xce, 0x78, 0x63, 0xcf, 0x24, 0xe7, 0xac, 0xb3,
+  0x0e, 0x08, 0x34, 0x49, 0x8c, 0x71, 0x33, 0x00, 0x8a, 0xe4, 0xe4, 0xd8,
+  0x8f, 0xb5, 0x2f, 0xb0, 0x2f, 0xb6, 0x5f, 0x55, 0x75, 0x37, 0x1a, 0x24,
+  0x2c, 0x7b, 0x92, 0xfd, 0xb1, 0x99, 0x28, 0x24, 0x1b, 0x5d, 0xd5, 0xd5,
+  0x75, 0xaf, 0xea, 0xc6, 0x04, 0xb3, 0xb2, 0xce, 0xa3, 0x56, 0xb5, 0x6a,
+  0x74, 0xd9, 0x2c, 0xab, 0xaa, 0xd6, 0x4d, 0xf3, 0xd7, 0x65, 0x5b, 0x2d,
+  0xdb, 0xab, 0xd1, 0xf8, 0xce, 0xc3, 0x87, 0x6a, 0xb5, 0x7e, 0x16, 0xad,
+  0xd3, 0x3c, 0x52, 0xeb, 0x3c, 0x53, 0x66, 0x72, 0x30, 0x8d, 0x1a, 0x9d,
+  0xa8, 0xb2, 0x50, 0x4f, 0xa2, 0x9b, 0x34, 0x51, 0x4f, 0xea, 0x4d, 0x93,
+  0x44, 0x99, 0x56, 0xcf, 0xa2, 0x76, 0xf1, 0xec, 0x5a, 0x55, 0x75, 0x5a,
+  0xb4, 0x69, 0x31, 0x67, 0x04, 0x8f, 0x8b, 0xa4, 0xd6, 0xff, 0x50, 0x7f,
+  0x2f, 0x93, 0xb2, 0x4a, 0x6f, 0x74, 0x3c, 0x51, 0xea, 0xfc, 0xf4, 0xf4,
+  0xf3, 0xf0, 0xfc, 0xf4, 0xec, 0x73, 0x7a, 0xfe, 0xed, 0xb2, 0x68, 0x75,
+  0xad, 0xfe, 0xf2, 0x3f, 0xff, 0x5d, 0xa4, 0xf3, 0x26, 0x8f, 0x8a, 0x62,
+  0xa2, 0xe8, 0x19, 0x4d, 0x78, 0x40, 0x13, 0xd4, 0x8b, 0xe7, 0x4f, 0x7e,
+  0x0e, 0xaf, 0xd3, 0x58, 0x17, 0x8d, 0x0e, 0x9f, 0x26, 0x1a, 0xb8, 0x67,
+  0xa9, 0xae, 0x2f, 0xd4, 0xb7, 0xcf, 0xaf, 0xc3, 0xf3, 0xe3, 0xd3, 0xfb,
+  0x77, 0x68, 0x9a, 0xac, 0x1d, 0xda, 0xb5, 0x69, 0xe8, 0xab, 0x5a, 0x47,
+  0x2d, 0x08, 0x9d, 0x6e, 0xb6, 0x09, 0x0d, 0x9e, 0x3c, 0x7b, 0x32, 0x9e,
+  0xa8, 0x27, 0x3a, 0xd6, 0xf9, 0x14, 0xab, 0x83, 0xa2, 0xf3, 0x93, 0xef,
+  0xa3, 0x62, 0x19, 0xd5, 0x1b, 0xfa, 0xf1, 0x19, 0xc0, 0x09, 0x43, 0x9c,
+  0x95, 0x8d, 0xce, 0x36, 0xca, 0x6d, 0xb8, 0x5d, 0x68, 0x55, 0xd6, 0xe9,
+  0x3c, 0x2d, 0xa2, 0x4c, 0xbd, 0xd4, 0x3f, 0xab, 0xb8, 0x2c, 0x6e, 0x74,
+  0xdd, 0xa4, 0x78, 0x16, 0x97, 0x89, 0x56, 0x69, 0xa1, 0xf2, 0x28, 0x6e,
+  0xf5, 0xfa, 0x38, 0x4b, 0x9b, 0x6a, 0x42, 0x48, 0xc0, 0x35, 0xb5, 0x5a,
+  0xa4, 0xf1, 0x82, 0xa1, 0x67, 0x65, 0x96, 0x95, 0x2b, 0x50, 0xa8, 0xe2,
+  0x5a, 0x27, 0x69, 0xdb, 0xa8, 0xa8, 0xaa, 0xb2, 0xcd, 0x05, 0x6f, 0x55,
+  0x05, 0xf1, 0x18, 0x78, 0xaa, 0x0d, 0x96, 0x58, 0xb4, 0xea, 0xec, 0xdf,
+  0x1f, 0xfc, 0x79, 0xa2, 0x7e, 0x04, 0x68, 0x54, 0x27, 0xea, 0xfb, 0x63,
+  0xf5, 0x0d, 0xf6, 0x03, 0x16, 0xc9, 0x5c, 0x30, 0x2b, 0xcb, 0x30, 0xbb,
+  0xae, 0x75, 0xdc, 0x82, 0x00, 0x60, 0x2a, 0x12, 0x15, 0x25, 0x40, 0x4a,
+  0xbf, 0x2e, 0x84, 0xf5, 0x1b, 0xf5, 0x6d, 0x5d, 0xfe, 0x33, 0x65, 0xae,
+  0x9e, 0x9e, 0x09, 0xa4, 0x9d, 0x83, 0x3d, 0x78, 0xd3, 0xbf, 0x5f, 0x26,
+  0xd1, 0x42, 0x3d, 0x4b, 0xb3, 0x79, 0x1d, 0xe5, 0x2a, 0xf8, 0xfe, 0x19,
+  0x38, 0xf4, 0x42, 0x57, 0xad, 0x63, 0xd1, 0x2e, 0xb4, 0xb7, 0xf8, 0x85,
+  0xfa, 0x32, 0xaa, 0x5b, 0xb0, 0xe1, 0xa7, 0x34, 0xc3, 0xd6, 0x55, 0xf0,
+  0xe5, 0xf5, 0x4f, 0x40, 0xf0, 0xd7, 0xb8, 0x2d, 0x7d, 0xf0, 0x67, 0xba,
+  0x5d, 0x94, 0xc9, 0x05, 0x8b, 0xec, 0x79, 0x5d, 0x26, 0xcb, 0x98, 0x58,
+  0xb1, 0x62, 0xed, 0xaa, 0xcb, 0x5c, 0x45, 0xca, 0xe8, 0x5b, 0x4a, 0x6a,
+  0x41, 0x6b, 0xe8, 0x35, 0x6b, 0x25, 0x71, 0x18, 0x68, 0x93, 0xb2, 0xd0,
+  0x10, 0x28, 0x81, 0x47, 0xaa, 0xd6, 0xc4, 0x7b, 0xcc, 0x29, 0x67, 0xcc,
+  0xdb, 0x2a, 0x82, 0x24, 0x80, 0xae, 0xaa, 0xcb, 0x18, 0x20, 0xc7, 0x4a,
+  0x7d, 0xb3, 0x2c, 0x92, 0x28, 0x87, 0xca, 0x80, 0x55, 0x9b, 0x89, 0x8a,
+  0x08, 0xae, 0xad, 0xa3, 0x3e, 0x98, 0xb7, 0x42, 0x5b, 0x6b, 0x4d, 0xcb,
+  0x54, 0x4c, 0x9a, 0xe8, 0x0e, 0x63, 0xae, 0x4b, 0xe2, 0x0a, 0xcb, 0x73,
+  0x95, 0xb6, 0x0b, 0x12, 0x5a, 0x5d, 0x42, 0xd9, 0x20, 0x10, 0xd5, 0x2c,
+  0xa7, 0x4d, 0x9b, 0xb6, 0xcb, 0x4e, 0x08, 0x60, 0x4a, 0x39, 0x2f, 0x98,
+  0x4b, 0x66, 0x11, 0x02, 0x4c, 0x8b, 0x59, 0xba, 0x56, 0x27, 0x40, 0xa6,
+  0xcd, 0x97, 0xb2, 0x69, 0xe5, 0x1b, 0xcc, 0x2a, 0x5e, 0xd0, 0xd7, 0x5a,
+  0x67, 0x91, 0xe0, 0x01, 0x68, 0xb3, 0xc9, 0xa7, 0x65, 0x86, 0x7d, 0xfc,
+  0x3d, 0xaa, 0xd3, 0x72, 0xd9, 0xb0, 0x4a, 0x2e, 0xa2, 0x62, 0xae, 0xb1,
+  0x4c, 0xad, 0x01, 0x05, 0x8d, 0x6b, 0x4b, 0xe0, 0x07, 0xc9, 0x0d, 0x7d,
+  0xc2, 0x3a, 0x8d, 0x11, 0xae, 0x20, 0x06, 0x95, 0xa5, 0x6f, 0x34, 0xd3,
+  0x8f, 0xfd, 0x2d, 0xb3, 0xb6, 0x39, 0x06, 0xdf, 0x03, 0xcf, 0xe4, 0x57,
+  0x6b, 0x30, 0x3e, 0x6c, 0x5a, 0x48, 0xee, 0x84, 0x0c, 0x9e, 0x16, 0x78,
+  0x49, 0xc8, 0xf0, 0x6f, 0xa1, 0x89, 0x87, 0x64, 0x10, 0x58, 0x21, 0x8f,
+  0x80, 0x68, 0x96, 0xc2, 0x74, 0x68, 0x7b, 0x49, 0x4a, 0x52, 0x2f, 0xf1,
+  0xa8, 0x00, 0x73, 0x1b, 0x59, 0x17, 0x96, 0xd0, 0x46, 0x50, 0xff, 0xa6,
+  0xd2, 0x71, 0x4a, 0xba, 0x01, 0xa5, 0x25, 0x4b, 0xa8, 0x99, 0xec, 0x55,
+  0x59, 0xbf, 0x51, 0x10, 0x06, 0x54, 0x01, 0xca, 0x9f, 0x94, 0x2b, 0xd0,
+  0x12, 0x10, 0x57, 0x8b, 0x3b, 0x4a, 0xed, 0xdf, 0x6f, 0xa6, 0x71, 0xa6,
+  0x82, 0x46, 0xb7, 0x33, 0xd5, 0x4c, 0xc3, 0x34, 0xaf, 0xb2, 0x8b, 0x8b,
+  0xa3, 0x44, 0xcf, 0x22, 0x50, 0x1d, 0xea, 0xb5, 0xa8, 0x42, 0x28, 0x94,
+  0x1f, 0xa9, 0x8b, 0xbf, 0xbd, 0xfc, 0x26, 0x7c, 0x00, 0x72, 0x61, 0x30,
+  0x69, 0x11, 0x56, 0x51, 0xfc, 0x26, 0x9a, 0x6b, 0x75, 0x91, 0xb3, 0xea,
+  0xc8, 0x78, 0xa2, 0xe3, 0x0c, 0x3c, 0x0a, 0xdb, 0xb2, 0xba, 0x43, 0x86,
+  0x65, 0xc9, 0xca, 0xca, 0x4a, 0x41, 0x72, 0xea, 0x20, 0x2d, 0x88, 0xc2,
+  0x31, 0x3f, 0x3c, 0x22, 0x15, 0x50, 0xc2, 0x8d, 0x6c, 0x5a, 0x99, 0x6f,
+  0xf5, 0xb4, 0x1a, 0x33, 0x32, 0xd0, 0xff, 0xb7, 0x06, 0x4c, 0x2c, 0x69,
+  0x03, 0x09, 0xa9, 0x19, 0x34, 0x6a, 0xa1, 0x1b, 0x70, 0x89, 0x8c, 0x1b,
+  0x34, 0xd5, 0x70, 0x4f, 0x0d, 0x29, 0x8b, 0xa1, 0x99, 0x28, 0xc0, 0x6e,
+  0xde, 0xaa, 0x83, 0x2c, 0x5f, 0xd3, 0x3a, 0x6a, 0xff, 0x55, 0x30, 0xee,
+  0x46, 0x6b, 0x7f, 0x54, 0x56, 0x78, 0xac, 0x66, 0x7a, 0xa5, 0x6e, 0x20,
+  0xe9, 0x68, 0x9a, 0x01, 0xd9, 0x6a, 0x01, 0xdf, 0x83, 0xdf, 0xd9, 0x52,
+  0xab, 0x38, 0x2a, 0xd4, 0x54, 0x13, 0x8b, 0x67, 0xe9, 0x7c, 0x09, 0xbf,
+  0x21, 0xc6, 0x62, 0x9d, 0xb3, 0xec, 0x77, 0x06, 0x58, 0x75, 0xb4, 0x5a,
+  0x87, 0x55, 0x56, 0xb6, 0x61, 0xb1, 0xcc, 0x8f, 0xd4, 0xa9, 0x1a, 0xbd,
+  0x84, 0xf4, 0x1b, 0x5d, 0xd3, 0xd6, 0x31, 0x44, 0xa6, 0x68, 0xb4, 0x3e,
+  0x5e, 0xd6, 0xb4, 0x0d, 0x45, 0xb3, 0x47, 0x63, 0x0f, 0xc5, 0xc1, 0x6a,
+  0x4d, 0x92, 0x26, 0xd1, 0xaa, 0xd1, 0x48, 0x30, 0xb8, 0x81, 0x2d, 0x60,
+  0x17, 0x1e, 0x48, 0xbe, 0xcd, 0x42, 0xeb, 0x1d, 0x54, 0xd0, 0x95, 0x1e,
+  0xa6, 0x4e, 0x77, 0x6e, 0xc7, 0x03, 0xdd, 0x05, 0x13, 0xd2, 0x62, 0x1b,
+  0x5f, 0x54, 0x60, 0x5a, 0xab, 0x5f, 0x47, 0x4b, 0x48, 0x36, 0x8b, 0xa0,
+  0x82, 0x69, 0xa6, 0x46, 0x8f, 0xf1, 0x0b, 0xc3, 0x69, 0x4c, 0x76, 0xae,
+  0x68, 0x7c, 0x0a, 0xa5, 0x80, 0x0e, 0xaf, 0x94, 0x00, 0x90, 0x49, 0x7d,
+  0xd1, 0xc3, 0xb5, 0x5a, 0x43, 0xa6, 0xf5, 0x57, 0x60, 0xe9, 0x93, 0xb4,
+  0x76, 0xe4, 0x65, 0x65, 0xcc, 0x93, 0x3b, 0x8a, 0xb2, 0xb2, 0x7c, 0x63,
+  0xe5, 0x4c, 0x03, 0x87, 0x8d, 0x91, 0x03, 0x33, 0x65, 0x87, 0xc4, 0xd5,
+  0xfa, 0x3b, 0x9d, 0x55, 0xb7, 0xa3, 0x6c, 0x74, 0x54, 0xc7, 0xd0, 0x1f,
+  0xc6, 0xba, 0xc0, 0xf4, 0x0f, 0xa1, 0x92, 0xf9, 0xd7, 0x88, 0x24, 0xd7,
+  0x16, 0xc9, 0x27, 0x62, 0xa5, 0xe8, 0x33, 0x8c, 0x15, 0x3c, 0x24, 0x91,
+  0xbf, 0x6e, 0xd2, 0x7f, 0x6a, 0x75, 0x18, 0x04, 0x39, 0xa6, 0xb6, 0xaa,
+  0x81, 0xcd, 0x8d, 0xd5, 0x83, 0xd3, 0x53, 0xf5, 0xa7, 0xd3, 0xd3, 0xb1,
+  0x51, 0x1b, 0x9a, 0x01, 0x81, 0x13, 0x17, 0x09, 0xa4, 0xd9, 0xc6, 0x23,
+  0x0c, 0xb1, 0xf1, 0xaf, 0x15, 0x28, 0x47, 0x8f, 0x19, 0x77, 0x40, 0x15,
+  0x9b, 0xdd, 0x36, 0x14, 0x62, 0x74, 0x12, 0x96, 0x45, 0xb6, 0x09, 0x23,
+  0xb8, 0xe0, 0x79, 0xa1, 0xe4, 0x63, 0x6b, 0xa5, 0x55, 0x9a, 0xcc, 0x75,
+  0xdb, 0xec, 0x2c, 0xf5, 0x93, 0x8c, 0xdb, 0xb5, 0xba, 0xc5, 0x61, 0x9a,
+  0x4b, 0x8a, 0x05, 0xc7, 0xdb, 0x34, 0x93, 0xb3, 0x8e, 0xeb, 0xb4, 0x02,
+  0x10, 0x59, 0xa9, 0x52, 0xa3, 0x1f, 0xc5, 0x59, 0x63, 0xaf, 0x08, 0xe8,
+  0x70, 0x86, 0x9b, 0x4c, 0x5c, 0xba, 0xcc, 0x1a, 0xe4, 0x5d, 0x55, 0xcc,
+  0xe3, 0x28, 0xad, 0x4b, 0x51, 0x3e, 0xf2, 0x0d, 0xf3, 0x62, 0x49, 0x4f,
+  0xa0, 0x1c, 0xee, 0x19, 0x9c, 0x56, 0xce, 0x79, 0x02, 0xc9, 0xc3, 0xf1,
+  0xb0, 0x53, 0xc2, 0xdc, 0xc7, 0x58, 0x66, 0xc9, 0x6b, 0x83, 0x83, 0x90,
+  0xc2, 0x29, 0x88, 0x57, 0xf8, 0xba, 0x89, 0xa3, 0x0a, 0x5e, 0x37, 0x13,
+  0x87, 0x6a, 0x7c, 0x6d, 0xa1, 0xe1, 0x02, 0x34, 0x3d, 0xa2, 0x70, 0x07,
+  0xa7, 0xfb, 0xf3, 0xb3, 0x6b, 0x83, 0x75, 0x59, 0x18, 0xef, 0x85, 0x68,
+  0x82, 0xcd, 0xd4, 0x34, 0x21, 0x58, 0xb3, 0x9b, 0x83, 0xb3, 0x9c, 0xc1,
+  0x01, 0xf1, 0x58, 0xa5, 0x30, 0xb6, 0x17, 0x64, 0x1a, 0xee, 0x34, 0x08,
+  0xda, 0xbc, 0x0a, 0xd7, 0xf6, 0x51, 0xe8, 0xe2, 0x19, 0xac, 0xf6, 0x5e,
+  0x94, 0x57, 0x0f, 0x47, 0xf0, 0x53, 0xf7, 0x00, 0x00, 0x08, 0x25, 0xff,
+  0xdc, 0x06, 0x91, 0xb5, 0x0c, 0x70, 0xa9, 0x78, 0xce, 0x27, 0x02, 0xcd,
+  0x05, 0xe8, 0xea, 0x5f, 0x02, 0xda, 0x3f, 0xfb, 0x8c, 0xa1, 0x7e, 0xd4,
+  0xed, 0xb2, 0x2e, 0x7e, 0x17, 0xe8, 0x75, 0x5a, 0xe8, 0x19, 0x71, 0xf3,
+  0xf7, 0x00, 0xff, 0xa0, 0x57, 0x19, 0xe0, 0x2d, 0x2c, 0x03, 0xcb, 0xf7,
+  0x3b, 0x82, 0x64, 0xed, 0xe2, 0xc7, 0x53, 0xc9, 0x1d, 0x67, 0x48, 0x22,
+  0x28, 0x82, 0xd4, 0x65, 0x5b, 0xc6, 0x65, 0xc6, 0x63, 0x90, 0x9d, 0xca,
+  0x29, 0xd4, 0x52, 0x58, 0x5f, 0x91, 0xb7, 0xa6, 0x34, 0xae, 0xa6, 0xa4,
+  0x03, 0x21, 0x38, 0x91, 0x24, 0x24, 0x12, 0x34, 0x0b, 0x58, 0x0b, 0xa5,
+  0xbe, 0x8f, 0x5f, 0x7c, 0xf5, 0xf4, 0xa9, 0x7a, 0xf1, 0xf2, 0x67, 0xe4,
+  0x34, 0x5d, 0xa4, 0x15, 0xe5, 0x68, 0x75, 0x96, 0x35, 0x8c, 0xb9, 0xdd,
+  0x54, 0xce, 0x63, 0x9b, 0x15, 0x26, 0x9c, 0x8c, 0x30, 0x2e, 0x78, 0xf4,
+  0x39, 0x32, 0x99, 0xfe, 0x73, 0x52, 0xa6, 0xe9, 0xa6, 0xd5, 0x26, 0x99,
+  0x84, 0xab, 0xcb, 0xca, 0xe2, 0x58, 0x92, 0x82, 0x15, 0xbc, 0xad, 0x33,
+  0xb0, 0x37, 0x05, 0x62, 0xb8, 0x20, 0x5a, 0x2d, 0x34, 0xcc, 0xb6, 0xc3,
+  0x40, 0x0e, 0x12, 0x11, 0x5c, 0x83, 0x57, 0x94, 0x2b, 0x95, 0xcb, 0xd6,
+  0xf8, 0x26, 0x56, 0xd6, 0x96, 0xed, 0x81, 0x12, 0x5f, 0xca, 0xae, 0x69,
+  0xa8, 0x8d, 0xe6, 0xc7, 0x5b, 0xf1, 0x87, 0xd9, 0xe4, 0xb8, 0xc4, 0x56,
+  0xf6, 0x5c, 0xb8, 0xd1, 0x67, 0x97, 0xa4, 0x67, 0x70, 0xb6, 0xbc, 0x55,
+  0x22, 0x59, 0x76, 0x45, 0x56, 0xe6, 0x1b, 0x44, 0xb8, 0x6c, 0x67, 0x0f,
+  0x42, 0xb3, 0x63, 0x92, 0xa9, 0x48, 0x68, 0xff, 0xfe, 0x9c, 0xf2, 0x0e,
+  0x33, 0xde, 0x0d, 0x87, 0x66, 0x18, 0xb5, 0x0e, 0x3d, 0x54, 0xa7, 0x56,
+  0x31, 0x02, 0x44, 0x83, 0x8a, 0x37, 0x80, 0x74, 0x3e, 0x8a, 0xeb, 0xb2,
+  0x69, 0x08, 0x0c, 0x69, 0xe9, 0x9d, 0xbd, 0x3d, 0x0b, 0xc1, 0x85, 0x40,
+  0x40, 0x52, 0x09, 0xf9, 0x6b, 0xbc, 0x60, 0xdd, 0xd8, 0x63, 0x0b, 0x2c,
+  0xe2, 0x19, 0xd1, 0x88, 0xe7, 0x25, 0xa8, 0x0d, 0x82, 0x4b, 0xa9, 0x1b,
+  0xf6, 0xd7, 0x0f, 0xe0, 0x76, 0xcf, 0x68, 0x9a, 0x4c, 0xf4, 0x1f, 0xe0,
+  0xc9, 0xf9, 0xd0, 0x93, 0xb3, 0xd3, 0x53, 0x7a, 0xf6, 0x59, 0xf7, 0xac,
+  0x55, 0x9f, 0x8f, 0xc7, 0x63, 0x4b, 0x2d, 0xd6, 0x19, 0x6f, 0xf1, 0x81,
+  0x95, 0x2b, 0x60, 0x6e, 0xb9, 0xed, 0x06, 0x2c, 0xc0, 0x1d, 0xb6, 0x1b,
+  0x1d, 0xf6, 0xf2, 0xc5, 0xf7, 0x11, 0xfe, 0x97, 0x5c, 0x8c, 0x14, 0x6f,
+  0x31, 0xe4, 0x0c, 0xe6, 0x7c, 0x2c, 0xbc, 0x0f, 0xb6, 0x98, 0x4c, 0xd8,
+  0xc7, 0x06, 0x3f, 0x15, 0x65, 0xb1, 0x8c, 0xf4, 0xcd, 0x81, 0xf4, 0x04,
+  0x9a, 0xab, 0x74, 0x01, 0x84, 0xac, 0x0a, 0xc6, 0x1e, 0xa0, 0x94, 0x58,
+  0x13, 0xca, 0xc9, 0xb5, 0x28, 0xa9, 0x54, 0x5b, 0xbe, 0xd1, 0xe4, 0xa4,
+  0x93, 0x0b, 0xf5, 0x75, 0x44, 0xb5, 0x54, 0x34, 0x17, 0x54, 0x9c, 0x09,
+  0x51, 0xda, 0x63, 0x90, 0x85, 0x78, 0xd2, 0x1c, 0x11, 0x48, 0xad, 0x91,
+  0x08, 0x98, 0x24, 0x1e, 0xe1, 0x11, 0xf8, 0x33, 0xce, 0xa1, 0xda, 0xba,
+  0xf4, 0xd2, 0x53, 0xd9, 0x8c, 0xe0, 0x22, 0x96, 0xc2, 0x4d, 0x2f, 0x1b,
+  0xd6, 0x4f, 0xa4, 0xe7, 0x92, 0xc2, 0xa7, 0x42, 0x2d, 0x05, 0x4a, 0x94,
+  0x34, 0xe4, 0x8b, 0x4b, 0xfc, 0x46, 0x26, 0x55, 0x81, 0x24, 0x51, 0x60,
+  0x49, 0xc8, 0x1b, 0xca, 0x65, 0x22, 0x63, 0x16, 0x62, 0xa3, 0x5f, 0xff,
+  0xf0, 0x1f, 0x13, 0xb3, 0x57, 0x54, 0x34, 0x05, 0xd0, 0x1a, 0x83, 0x03,
+  0x10, 0x2b, 0xac, 0x4c, 0x7b, 0xfc, 0xd5, 0x5f, 0xc4, 0xe2, 0xc8, 0xd1,
+  0x77, 0x76, 0x61, 0x50, 0x11, 0x6e, 0x7f, 0x37, 0x02, 0xf3, 0xe5, 0xd7,
+  0xd7, 0xb0, 0x4c, 0x64, 0xc7, 0xea, 0x8d, 0xd6, 0x95, 0xd0, 0x4c, 0xcc,
+  0xe3, 0xc0, 0xa0, 0x1b, 0xb2, 0x5a, 0x9b, 0xf9, 0x83, 0x1d, 0x82, 0x09,
+  0x9c, 0xa6, 0x9a, 0x36, 0xa1, 0x3d, 0x5d, 0xe6, 0xed, 0x22, 0xbe, 0xe2,
+  0x65, 0x2f, 0x4f, 0xf8, 0xfb, 0xb1, 0xb3, 0x6f, 0x04, 0x32, 0x2a, 0x24,
+  0x9e, 0x23, 0xe4, 0x60, 0xa3, 0x6c, 0xec, 0x4c, 0x75, 0x03, 0x0d, 0x31,
+  0xee, 0x83, 0xd2, 0x06, 0xda, 0x0b, 0xa8, 0xdc, 0x32, 0x5f, 0x23, 0x09,
+  0x2a, 0xea, 0xd8, 0x74, 0x5f, 0x90, 0xd2, 0xf5, 0xe4, 0x39, 0x2c, 0x7e,
+  0xcf, 0x6a, 0x6d, 0x2e, 0xdb, 0x13, 0x2a, 0x6b, 0xd3, 0x61, 0x30, 0xaa,
+  0x91, 0x03, 0xdd, 0xe0, 0xaf, 0xc0, 0x5f, 0x85, 0xbf, 0x19, 0xfe, 0x34,
+  0xfe, 0x5a, 0xfc, 0xa5, 0xf4, 0xbb, 0xe0, 0xff, 0xe4, 0xf8, 0xef, 0x1c,
+  0x7f, 0x0d, 0xfe, 0xde, 0xe2, 0x6f, 0x81, 0xbf, 0xbc, 0xad, 0xf9, 0xbf,
+  0xc9, 0x68, 0xdb, 0x32, 0xec, 0x4a, 0x44, 0x75, 0xe0, 0xd9, 0x06, 0x3c,
+  0x58, 0x28, 0x64, 0xa3, 0x96, 0x70, 0x11, 0x15, 0x23, 0xd6, 0xc9, 0x1b,
+  0xab, 0x87, 0xb6, 0xc0, 0x4f, 0x58, 0x37, 0x41, 0x16, 0xde, 0xb7, 0x84,
+  0x3d, 0xf1, 0x1d, 0xab, 0x05, 0x55, 0x51, 0xb0, 0x61, 0x9a, 0x4f, 0x06,
+  0xca, 0xbe, 0xc3, 0x47, 0xc4, 0xe5, 0x98, 0x0a, 0x9c, 0xf6, 0x51, 0x28,
+  0x25, 0x1f, 0x73, 0x21, 0x0f, 0x30, 0x3e, 0xf6, 0xe3, 0x14, 0x1b, 0x6f,
+  0x50, 0x2c, 0xa1, 0x38, 0x3c, 0x81, 0x3d, 0x4d, 0xb0, 0xaa, 0xd3, 0x56,
+  0x5b, 0x6a, 0x09, 0x9a, 0xbc, 0xb0, 0x87, 0x81, 0x27, 0xd5, 0x1c, 0x37,
+  0x7b, 0xc8, 0x6e, 0x07, 0x53, 0x17, 0x24, 0x49, 0xbb, 0x8c, 0xea, 0xed,
+  0x9f, 0x1d, 0x8b, 0x47, 0xf4, 0x95, 0x4f, 0xb4, 0x80, 0x8c, 0x0d, 0x6d,
+  0x1d, 0xc5, 0x00, 0xb2, 0x9e, 0xf1, 0xb6, 0xa5, 0xbb, 0x8d, 0x29, 0x9f,
+  0x6a, 0xf1, 0xb8, 0x94, 0xc0, 0xa4, 0x45, 0x41, 0x96, 0x4c, 0x51, 0x5a,
+  0xbf, 0x65, 0xe8, 0xe0, 0xec, 0xbe, 0x01, 0xe3, 0x45, 0xd8, 0x45, 0xa2,
+  0xf8, 0xca, 0x66, 0xd6, 0xba, 0x02, 0xd2, 0xfb, 0xe0, 0xca, 0x89, 0x89,
+  0x51, 0x8c, 0x59, 0x84, 0xe2, 0x4d, 0xd9, 0x83, 0x3f, 0x92, 0x0f, 0x65,
+  0x16, 0x38, 0x0b, 0xb7, 0xe6, 0x8f, 0xc7, 0xd8, 0xea, 0xc9, 0xb8, 0x73,
+  0xf0, 0xbc, 0x39, 0x6f, 0x1d, 0x19, 0xb6, 0x85, 0x5f, 0x9f, 0x4e, 0xf9,
+  0x75, 0x3a, 0x88, 0xb6, 0x8b, 0x18, 0xb3, 0x0f, 0x93, 0x3a, 0x44, 0xe3,
+  0xa9, 0xa1, 0xc8, 0x2e, 0xec, 0x58, 0xcb, 0x73, 0x3c, 0xcf, 0xfd, 0xe7,
+  0xb1, 0x62, 0x2d, 0xde, 0xdb, 0x12, 0xa4, 0x84, 0x2f, 0xcf, 0xf9, 0x11,
+  0xd6, 0x5d, 0x07, 0x7b, 0x81, 0x24, 0xa1, 0x55, 0xfb, 0x87, 0x22, 0xb1,
+  0x47, 0x42, 0xf0, 0x1e, 0xd3, 0xcb, 0x0e, 0x75, 0xcf, 0x6e, 0x7c, 0x78,
+  0xf5, 0xe0, 0xbe, 0x78, 0x5b, 0x1a, 0x19, 0x3b, 0x4a, 0x0c, 0x88, 0x34,
+  0x06, 0xf6, 0x3e, 0xb6, 0x83, 0x7f, 0xdb, 0x82, 0xdb, 0xd6, 0x22, 0x21,
+  0x7d, 0x78, 0xca, 0x36, 0xae, 0x3f, 0x09, 0x2e, 0xbb, 0x8b, 0x01, 0x31,
+  0xee, 0x7d, 0x94, 0x95, 0x56, 0x6a, 0x22, 0x6b, 0xb2, 0x17, 0xd2, 0x42,
+  0x56, 0x3f, 0xf9, 0xc7, 0x96, 0xfa, 0xd4, 0x02, 0x64, 0x0f, 0xb8, 0x24,
+  0xef, 0xda, 0x96, 0xe4, 0x09, 0xf3, 0x65, 0x81, 0xf2, 0x95, 0x72, 0x26,
+  0x4e, 0xe2, 0x4a, 0x54, 0xca, 0x0d, 0x17, 0xb8, 0xc6, 0x59, 0x42, 0x99,
+  0xdb, 0x65, 0x33, 0x8d, 0xb8, 0x99, 0x98, 0x35, 0xad, 0xa0, 0xea, 0x55,
+  0xf2, 0xd2, 0xa4, 0xe2, 0xd0, 0xb7, 0x2c, 0x28, 0x32, 0x75, 0x0e, 0x8e,
+  0x2a, 0x1f, 0x87, 0x20, 0xb8, 0x57, 0x93, 0xec, 0x64, 0xc0, 0x66, 0x42,
+  0x31, 0x97, 0x8c, 0xc1, 0x2c, 0x2d, 0xd2, 0xc6, 0x7a, 0x3c, 0xeb, 0x03,
+  0x4d, 0xde, 0xb0, 0xff, 0xaa, 0x71, 0xe9, 0x00, 0x3b, 0xf6, 0x4b, 0x87,
+  0xf3, 0xea, 0x7d, 0x74, 0x79, 0xe2, 0xfd, 0xba, 0x3b, 0x22, 0xb0, 0x7e,
+  0x1d, 0x22, 0x86, 0x65, 0x65, 0xcc, 0x6d, 0x4f, 0x75, 0x78, 0xd0, 0x20,
+  0x30, 0x62, 0xdf, 0x96, 0x1a, 0x9b, 0x34, 0xdc, 0x46, 0x10, 0x55, 0x47,
+  0x0f, 0xb1, 0xf9, 0x9f, 0x4c, 0x76, 0xc9, 0xfd, 0x2f, 0x62, 0x21, 0xd9,
+  0x09, 0x05, 0x13, 0xee, 0x29, 0x93, 0x06, 0x10, 0x4f, 0x25, 0x05, 0xb3,
+  0xcd, 0x28, 0x95, 0x73, 0x6b, 0x35, 0x8e, 0xc0, 0x7a, 0x46, 0x62, 0xf2,
+  0x59, 0x30, 0xbc, 0x69, 0xa9, 0x37, 0xa4, 0x9b, 0x0a, 0x99, 0x19, 0x01,
+  0x53, 0x3d, 0x69, 0x7b, 0x55, 0x44, 0x10, 0x9b, 0xa1, 0x50, 0x85, 0xf1,
+  0xcf, 0x90, 0xf9, 0x48, 0xc7, 0x8a, 0xa2, 0x85, 0x8e, 0xf2, 0xed, 0x3e,
+  0x95, 0x3a, 0x6a, 0xca, 0xf8, 0x8d, 0x6e, 0x61, 0x37, 0xd0, 0x43, 0xee,
+  0x92, 0x1e, 0x8d, 0xa5, 0x8a, 0xd3, 0xed, 0x05, 0x72, 0x25, 0x6a, 0x61,
+  0xdd, 0x86, 0x37, 0x5e, 0x82, 0xa2, 0xbc, 0xeb, 0x83, 0x51, 0x39, 0x1f,
+  0xda, 0x58, 0x79, 0xb4, 0x8d, 0x49, 0x36, 0xb3, 0x9c, 0xcd, 0x32, 0x09,
+  0xac, 0x98, 0x5c, 0x87, 0x45, 0x49, 0xa9, 0xfc, 0x3c, 0x2b, 0xa7, 0xd4,
+  0x18, 0xf1, 0x5a, 0x6d, 0xdc, 0x1e, 0x4b, 0x73, 0xac, 0x34, 0x25, 0xba,
+  0x2f, 0x72, 0x06, 0x24, 0x52, 0x4d, 0x3f, 0x58, 0x99, 0x07, 0x3d, 0x54,
+  0x63, 0x57, 0xbb, 0x52, 0xee, 0xab, 0x8a, 0x32, 0x5c, 0x45, 0x35, 0xa7,
+  0x40, 0xac, 0x16, 0x56, 0x72, 0xbc, 0xc4, 0xaf, 0xc1, 0x02, 0xfb, 0x22,
+  0xc8, 0x29, 0x98, 0x08, 0xd9, 0x53, 0x64, 0x43, 0x6d, 0xed, 0x40, 0xf6,
+  0x0f, 0xcd, 0xa2, 0x66, 0xc0, 0x98, 0xce, 0xc0, 0xb2, 0xbb, 0x53, 0x5d,
+  0xf4, 0x99, 0xf8, 0xeb, 0x0a, 0x0f, 0x7f, 0xb5, 0x7e, 0xcc, 0xb0, 0xcf,
+  0x9e, 0x6b, 0xc0, 0x54, 0x75, 0xfc, 0x26, 0xac, 0x51, 0x44, 0x90, 0x4e,
+  0xb1, 0x3c, 0x14, 0x8c, 0xb6, 0x87, 0x23, 0x0c, 0x90, 0xdb, 0x33, 0xfd,
+  0x8c, 0x6c, 0x0c, 0x6c, 0xec, 0x8c, 0xcc, 0x24, 0x3f, 0x67, 0xe0, 0xce,
+  0x85, 0x6d, 0x67, 0x84, 0xb6, 0x03, 0x11, 0xdc, 0x18, 0xa3, 0x31, 0x91,
+  0x29, 0x39, 0xeb, 0x45, 0xc5, 0x63, 0x75, 0x63, 0x88, 0x0f, 0x36, 0x3a,
+  0xea, 0x42, 0xc1, 0x0d, 0xc2, 0x40, 0x72, 0x66, 0x1f, 0x25, 0xe7, 0xdb,
+  0x40, 0x36, 0x12, 0x92, 0x43, 0xa1, 0x79, 0x66, 0x62, 0x8e, 0xa4, 0x72,
+  0xe1, 0x21, 0x31, 0x8f, 0x55, 0x72, 0x6e, 0x67, 0xb0, 0xa5, 0x6f, 0x4d,
+  0x38, 0x77, 0x56, 0x46, 0x74, 0x52, 0x1e, 0x77, 0xd8, 0x6b, 0x03, 0x05,
+  0xd4, 0x48, 0xd7, 0x21, 0xb5, 0xe0, 0xe7, 0xf0, 0x4f, 0x44, 0xe8, 0xce,
+  0x20, 0xaf, 0x3c, 0x26, 0x73, 0x69, 0xc7, 0xe3, 0x5e, 0xda, 0x76, 0x20,
+  0x1c, 0x79, 0x8d, 0xc4, 0x9c, 0x32, 0xde, 0x44, 0xfa, 0x19, 0x1f, 0x7e,
+  0xfe, 0xda, 0xb2, 0xce, 0xce, 0x33, 0x46, 0xc5, 0xcd, 0xef, 0x50, 0x1a,
+  0xa0, 0x87, 0xdb, 0x40, 0x63, 0x35, 0xb2, 0xa9, 0x6a, 0xaf, 0xd4, 0x83,
+  0x9f, 0x9b, 0x2e, 0xd3, 0x2c, 0x79, 0x9d, 0x16, 0xb3, 0x52, 0x05, 0x9d,
+  0x2c, 0x20, 0x0a, 0xc3, 0xf0, 0x74, 0x0d, 0x96, 0xc5, 0x59, 0x48, 0xbe,
+  0xf7, 0xe2, 0xc8, 0x88, 0x8f, 0x81, 0xc2, 0x36, 0xcd, 0xf5, 0x91, 0x70,
+  0xce, 0xb2, 0x76, 0x96, 0xce, 0x3e, 0x69, 0x7a, 0x02, 0x4f, 0x0d, 0x23,
+  0x58, 0xd6, 0x9f, 0x34, 0x1b, 0x6e, 0x0b, 0xa4, 0xc0, 0x6f, 0xd5, 0xc9,
+  0xa7, 0x90, 0x92, 0x16, 0xd4, 0x78, 0x00, 0x63, 0xb8, 0x68, 0xfc, 0x38,
+  0x80, 0x4c, 0x24, 0x67, 0x9d, 0xd6, 0x90, 0xea, 0xad, 0x00, 0x4e, 0x11,
+  0xba, 0x3a, 0x6f, 0xbb, 0x85, 0x77, 0xa1, 0x50, 0xf7, 0xc1, 0xa3, 0x6f,
+  0x37, 0xef, 0x06, 0x40, 0xb9, 0xe9, 0xb6, 0xdb, 0x98, 0xf3, 0x30, 0xf4,
+  0x5b, 0x79, 0x03, 0x28, 0x86, 0xd7, 0x3e, 0xa2, 0x86, 0x2f, 0x35, 0x5e,
+  0xad, 0xa5, 0x1d, 0x7d, 0x18, 0x94, 0xf7, 0xa7, 0x12, 0x04, 0x53, 0x40,
+  0x7f, 0x3e, 0x39, 0x3c, 0x4d, 0xc2, 0xf7, 0xe7, 0xde, 0x87, 0x92, 0x8f,
+  0x8b, 0xde, 0x07, 0x16, 0xb1, 0x4e, 0x85, 0x15, 0x45, 0xe4, 0x4f, 0x62,
+  0x65, 0x61, 0x19, 0x19, 0x18, 0xce, 0x0e, 0xac, 0xfd, 0x5d, 0x09, 0x4e,
+  0x53, 0x29, 0xbc, 0x4b, 0xf1, 0x02, 0x8f, 0x86, 0xc8, 0x7d, 0xb1, 0x69,
+  0x5a, 0x9d, 0x3b, 0x20, 0xf9, 0x97, 0x43, 0x67, 0x53, 0xce, 0xda, 0x15,
+  0x1f, 0x5f, 0xe0, 0xd9, 0xd8, 0xfb, 0x6d, 0xd9, 0x06, 0xa5, 0x88, 0xa8,
+  0xa1, 0x62, 0x66, 0x0c, 0x20, 0xa7, 0xae, 0xb1, 0xa2, 0x93, 0x14, 0xcd,
+  0xe7, 0x5f, 0xec, 0x4a, 0x7c, 0xf2, 0xc8, 0xf0, 0xab, 0xb0, 0x3f, 0xe1,
+  0x5f, 0x42, 0xb6, 0x25, 0xa0, 0x41, 0x7c, 0x96, 0xdc, 0x01, 0x94, 0xef,
+  0xef, 0xbe, 0xbf, 0xeb, 0x55, 0x9b, 0x69, 0xa2, 0x23, 0x5b, 0x1a, 0x77,
+  0x67, 0x04, 0xc8, 0x7f, 0x4a, 0xae, 0xff, 0x2f, 0xde, 0xdf, 0xa5, 0x76,
+  0xbd, 0x3b, 0x02, 0x11, 0x12, 0x30, 0xd1, 0x2e, 0xdf, 0x6b, 0xe7, 0x0f,
+  0x89, 0x87, 0xda, 0xec, 0xbd, 0xf9, 0xa6, 0x4f, 0x6f, 0x68, 0x1b, 0x75,
+  0x6e, 0x24, 0x77, 0x8e, 0x64, 0xfe, 0x1a, 0x55, 0x77, 0x49, 0x6e, 0xd7,
+  0x38, 0x92, 0x01, 0x1b, 0x41, 0xea, 0x11, 0x29, 0xe4, 0x5d, 0xd5, 0x82,
+  0x4e, 0x1f, 0x14, 0x3b, 0x28, 0xca, 0xf9, 0xb8, 0x4b, 0x24, 0x73, 0x26,
+  0xe6, 0xfc, 0x37, 0x29, 0xb5, 0x54, 0xd1, 0x54, 0x0b, 0x6b, 0x3e, 0xaf,
+  0x68, 0x6c, 0x7a, 0x47, 0xe7, 0x15, 0x73, 0x3e, 0x61, 0x3a, 0x06, 0x79,
+  0x3b, 0xcb, 0x3d, 0x9d, 0x29, 0x70, 0xa2, 0x4b, 0x6e, 0xa8, 0xdf, 0xe6,
+  0x90, 0x60, 0x59, 0x04, 0xa9, 0x29, 0x18, 0x3f, 0xa1, 0xfe, 0x9a, 0x9c,
+  0x5f, 0x4e, 0xa3, 0x69, 0xb6, 0xe9, 0xce, 0x53, 0xb1, 0x19, 0x3a, 0x7f,
+  0x53, 0x0d, 0xb4, 0x19, 0xc6, 0x31, 0xe5, 0x1e, 0x77, 0x9e, 0xb6, 0x74,
+  0x40, 0x4e, 0xcd, 0x0c, 0x3d, 0xb8, 0xec, 0xfb, 0xbb, 0xd4, 0x43, 0xf0,
+  0x50, 0xc0, 0xa8, 0x22, 0x3a, 0x0d, 0xe7, 0x6d, 0xdf, 0x44, 0x69, 0x46,
+  0x87, 0x55, 0x2a, 0x6a, 0x87, 0x80, 0xe9, 0xe7, 0xa2, 0x6d, 0xab, 0xe6,
+  0xe2, 0xe4, 0xa4, 0x81, 0x0d, 0xc5, 0x1a, 0xcf, 0xe6, 0xfa, 0xb8, 0xd0,
+  0xed, 0x49, 0x75, 0x22, 0x9e, 0xe4, 0x04, 0x48, 0x9b, 0x21, 0xe0, 0x17,
+  0x4c, 0x1d, 0xaf, 0x29, 0x32, 0xe0, 0x66, 0x5f, 0x77, 0x7a, 0x4e, 0x3c,
+  0x3b, 0x94, 0x13, 0x7e, 0xf5, 0x32, 0xa5, 0x3c, 0xeb, 0x50, 0x65, 0x69,
+  0xf1, 0x46, 0x4e, 0xe9, 0x81, 0xa3, 0x8a, 0xe6, 0xc3, 0x7b, 0x7a, 0x59,
+  0x1a, 0x8c, 0x3d, 0xe6, 0x4c, 0x98, 0xbf, 0x39, 0x72, 0x06, 0xb5, 0x80,
+  0x7f, 0xc3, 0xb3, 0x17, 0x1d, 0xc9, 0x2a, 0x8a, 0x99, 0xef, 0xc7, 0xa4,
+  0xb4, 0xbb, 0x18, 0x1f, 0x5b, 0xf6, 0x5b, 0x61, 0x76, 0xea, 0xc0, 0x09,
+  0x3e, 0x9f, 0x65, 0xcf, 0xa2, 0x58, 0x6f, 0x89, 0xc6, 0xe9, 0x10, 0xd6,
+  0x1f, 0x26, 0xd5, 0x3f, 0x4f, 0xf9, 0x23, 0xec, 0x9f, 0x23, 0x53, 0x5e,
+  0x4e, 0x8f, 0x91, 0x55, 0x9d, 0x58, 0x7c, 0x61, 0xa2, 0x6f, 0x74, 0x56,
+  0x56, 0xb0, 0xd0, 0x13, 0xeb, 0xd7, 0x4f, 0xd2, 0xa6, 0x59, 0xea, 0xe6,
+  0x0b, 0x31, 0x40, 0x58, 0xd8, 0xa3, 0x44, 0x37, 0xf1, 0xbd, 0x06, 0xcc,
+  0x7a, 0x14, 0xcb, 0x6d, 0x8a, 0x7b, 0x94, 0xa7, 0xeb, 0x47, 0xd4, 0xfa,
+  0xfa, 0xdd, 0x62, 0xfb, 0x41, 0xaf, 0x14, 0xaf, 0x34, 0x2c, 0xb2, 0x21,
+  0xbc, 0xcf, 0x33, 0x4d, 0xdb, 0xe6, 0x14, 0x0e, 0xca, 0x8b, 0x07, 0x4e,
+  0x81, 0x81, 0x16, 0x6a, 0xcf, 0xf6, 0x51, 0xf3, 0xc2, 0xab, 0x08, 0xcc,
+  0xc9, 0x28, 0x3d, 0xdb, 0x18, 0x22, 0x74, 0x72, 0x3b, 0xda, 0xb4, 0x88,
+  0xb3, 0x65, 0xa2, 0xb7, 0x2e, 0x68, 0x50, 0x0a, 0x51, 0xe7, 0xe6, 0x94,
+  0x8d, 0x0e, 0xfd, 0xdd, 0x0a, 0x82, 0xf5, 0x62, 0x08, 0x63, 0xf8, 0x47,
+  0xfe, 0xe9, 0x10, 0xf6, 0xf2, 0x98, 0xff, 0xfb, 0x45, 0xfa, 0x7d, 0x36,
+  0xfc, 0x87, 0x8a, 0xfa, 0x23, 0xea, 0xad, 0x5d, 0xde, 0x5c, 0x8d, 0x50,
+  0xd8, 0x9d, 0xe0, 0x63, 0xab, 0x43, 0x46, 0xc5, 0xdc, 0x9c, 0x12, 0xa9,
+  0xb5, 0xaa, 0xfc, 0xf3, 0x24, 0xce, 0xd3, 0xe8, 0x3c, 0x49, 0x05, 0xf4,
+  0x98, 0x9e, 0x0e, 0x40, 0x46, 0x75, 0x4d, 0x19, 0xd2, 0x5a, 0x65, 0xaa,
+  0x56, 0xf7, 0xa2, 0xe5, 0x5a, 0xcd, 0x3c, 0x24, 0xc8, 0x4d, 0x0f, 0xf3,
+  0xb7, 0x52, 0x12, 0x06, 0x71, 0x04, 0xa2, 0xf8, 0x2c, 0x46, 0x0a, 0xe9,
+  0x19, 0x0d, 0x25, 0x35, 0x9f, 0x58, 0x89, 0x5f, 0x5f, 0x63, 0xa4, 0x37,
+  0x90, 0x99, 0x6a, 0x93, 0xe6, 0x02, 0x0b, 0xb9, 0xdf, 0xcc, 0xa4, 0xb6,
+  0xa3, 0xcb, 0xf4, 0xea, 0xb2, 0xa2, 0xdd, 0xb8, 0x81, 0x13, 0xfa, 0xd9,
+  0xf5, 0x3d, 0x0e, 0x73, 0x3e, 0xd1, 0xb7, 0x9f, 0x5d, 0xb0, 0xea, 0x56,
+  0x8f, 0xba, 0xc5, 0x06, 0x97, 0x22, 0xc6, 0x61, 0x99, 0x9a, 0x99, 0x66,
+  0x2b, 0x5c, 0xbb, 0x1a, 0x8d, 0xf2, 0xbd, 0x83, 0x43, 0x8a, 0x2c, 0x6c,
+  0x57, 0xae, 0x35, 0xce, 0x4b, 0x20, 0x15, 0x2c, 0xa8, 0x0a, 0xb6, 0x25,
+  0x33, 0x03, 0x9a, 0x1d, 0x3a, 0x34, 0xb5, 0xd0, 0xdc, 0x35, 0x6b, 0x1c,
+  0xf6, 0xcb, 0x93, 0x94, 0x56, 0x20, 0xd1, 0x4d, 0x44, 0x70, 0xca, 0x46,
+  0x35, 0x83, 0x37, 0x53, 0x75, 0x27, 0x12, 0xa9, 0xdd, 0xe8, 0x46, 0x07,
+  0x09, 0x1d, 0x05, 0x0b, 0xdc, 0x14, 0xbe, 0x08, 0xc0, 0xaf, 0xbf, 0x06,
+  0x42, 0x04, 0x3d, 0x92, 0x6a, 0x60, 0x32, 0xa1, 0x19, 0x93, 0x09, 0xcd,
+  0xd9, 0x4a, 0xb5, 0xcd, 0xbc, 0x3e, 0x8a, 0xa0, 0x43, 0xed, 0x8a, 0x7b,
+  0x4c, 0x18, 0x7b, 0x3f, 0x19, 0x95, 0x8f, 0x6b, 0xf7, 0x94, 0x2d, 0x28,
+  0xf4, 0xca, 0xb4, 0x71, 0xca, 0x2c, 0xe1, 0x2e, 0xcb, 0x5a, 0xf4, 0x86,
+  0xef, 0xca, 0x70, 0x0f, 0xb3, 0xe3, 0xa0, 0x1d, 0xf3, 0xca, 0x26, 0x07,
+  0x35, 0xf6, 0xf4, 0x8c, 0x9b, 0x8e, 0x0e, 0x81, 0x5a, 0x5b, 0x49, 0x0b,
+  0x5d, 0xba, 0xa0, 0x68, 0x72, 0xe8, 0xba, 0x15, 0x8c, 0x5e, 0x2a, 0xa7,
+  0x35, 0xea, 0xb3, 0x6e, 0x61, 0x7e, 0xe4, 0x08, 0xb4, 0x33, 0x77, 0xf6,
+  0xb0, 0xb3, 0x85, 0x3b, 0xae, 0xfd, 0xe1, 0x21, 0xa6, 0x92, 0xcc, 0xa1,
+  0x36, 0x6d, 0x22, 0xaa, 0xe5, 0xbf, 0xe1, 0xdc, 0x7d, 0xa5, 0x25, 0x1e,
+  0xb1, 0x6b, 0x32, 0xda, 0xd3, 0x98, 0x7c, 0x82, 0x8e, 0x05, 0xe8, 0xc6,
+  0x83, 0xb6, 0x57, 0x72, 0xe8, 0xaa, 0xda, 0x46, 0x0c, 0x8e, 0xdb, 0xfa,
+  0x69, 0xdb, 0x30, 0x2a, 0xf2, 0xe2, 0x50, 0xd4, 0xa8, 0x68, 0x9b, 0x9e,
+  0xfc, 0xcc, 0x25, 0x99, 0xd7, 0xee, 0xb8, 0x9b, 0x0c, 0xf4, 0x5e, 0x59,
+  0x99, 0xeb, 0x5d, 0x01, 0xbe, 0x51, 0x85, 0x2c, 0xfc, 0x5b, 0x16, 0x19,
+  0xaa, 0x68, 0x51, 0x3c, 0x3e, 0x3e, 0xf6, 0xad, 0x64, 0x3d, 0x58, 0x48,
+  0xae, 0x9d, 0x9e, 0x27, 0xa5, 0x28, 0x75, 0x63, 0xf5, 0xda, 0x81, 0x1f,
+  0xd0, 0x81, 0x40, 0xa3, 0x68, 0xa9, 0x43, 0x51, 0xa9, 0x8e, 0x1c, 0x33,
+  0x0b, 0xcf, 0xb6, 0x14, 0x6f, 0x87, 0x70, 0xb0, 0xe0, 0xff, 0x17, 0xe9,
+  0x3a, 0x19, 0x26, 0xde, 0x4d, 0xa8, 0xba, 0x63, 0x79, 0x4b, 0x5e, 0xe7,
+  0x4a, 0xed, 0x0a, 0xd2, 0xeb, 0x0e, 0xf9, 0x8c, 0xcb, 0x83, 0x74, 0x3a,
+  0x6d, 0x9a, 0x0c, 0x7c, 0xc3, 0xc6, 0x6a, 0x14, 0xec, 0x6f, 0x33, 0xa5,
+  0x42, 0x1d, 0xc9, 0x77, 0x6b, 0x5a, 0x6f, 0x61, 0x4c, 0x61, 0xce, 0xd6,
+  0xd4, 0x3c, 0x1d, 0x38, 0x94, 0x6b, 0x38, 0xb0, 0xe9, 0xc8, 0x21, 0xad,
+  0x1a, 0xbd, 0x1e, 0xf1, 0xbd, 0x2e, 0x75, 0x41, 0xcb, 0x86, 0xe4, 0xe0,
+  0x5a, 0x33, 0xcf, 0x1c, 0x8c, 0x1e, 0x51, 0x6c, 0x6d, 0x29, 0xf5, 0x38,
+  0x22, 0xd3, 0xa9, 0x36, 0xa1, 0x1b, 0xe0, 0x22, 0xde, 0x71, 0xc8, 0xcc,
+  0x97, 0x82, 0xde, 0xcd, 0x11, 0x62, 0x3c, 0x24, 0x63, 0x75, 0x21, 0xd4,
+  0xba, 0x7d, 0x73, 0xfb, 0x15, 0x44, 0x75, 0x57, 0x14, 0xb0, 0x39, 0xb7,
+  0x43, 0xd9, 0xee, 0x7d, 0xee, 0xb0, 0xba, 0x5e, 0x88, 0x35, 0xaa, 0xf0,
+  0xc6, 0x6b, 0xab, 0xf0, 0xcc, 0x53, 0x39, 0x33, 0xd9, 0x99, 0x15, 0x12,
+  0x3b, 0x84, 0x2e, 0xe6, 0xb0, 0x3b, 0xdc, 0x19, 0xf0, 0x06, 0x6a, 0x74,
+  0x30, 0x52, 0x06, 0x6e, 0x67, 0xc5, 0xdf, 0x81, 0x67, 0x07, 0x07, 0x72,
+  0x44, 0xb8, 0xa8, 0x79, 0x81, 0xc4, 0x26, 0xd4, 0x75, 0x5d, 0xd6, 0x8d,
+  0x38, 0xfb, 0xad, 0xb6, 0x8b, 0x80, 0x4a, 0x95, 0x2f, 0xe7, 0x28, 0x5b,
+  0x67, 0x03, 0x96, 0x46, 0x39, 0xc8, 0x10, 0xfc, 0x25, 0xc3, 0x11, 0x0e,
+  0x69, 0x6e, 0x83, 0x31, 0xfd, 0x9b, 0x30, 0x87, 0x07, 0xf0, 0x22, 0xa6,
+  0xf3, 0xfd, 0xc8, 0x47, 0x65, 0x8f, 0xa4, 0xb7, 0x86, 0x65, 0x05, 0xfb,
+  0xe8, 0x40, 0xc2, 0xfe, 0x90, 0x09, 0x78, 0x13, 0x1c, 0xa3, 0x06, 0xac,
+  0xdc, 0x1e, 0x9b, 0x79, 0xbd, 0x65, 0x8a, 0xdb, 0xc8, 0xe2, 0xda, 0xaf,
+  0xa0, 0x5e, 0x8f, 0x5e, 0x8d, 0xde, 0xff, 0x86, 0xb2, 0xed, 0xdd, 0xab,
+  0x11, 0xc5, 0x58, 0x6a, 0x35, 0xd7, 0xde, 0x17, 0x0a, 0x7f, 0x66, 0xaf,
+  0x41, 0x6e, 0xd8, 0xbc, 0xb6, 0xbb, 0xa7, 0xcd, 0x07, 0x76, 0x7d, 0x27,
+  0xf4, 0x43, 0x26, 0x61, 0x55, 0xd6, 0x42, 0x62, 0xbf, 0xa9, 0x7d, 0xc3,
+  0x88, 0x29, 0x0f, 0x72, 0x02, 0xb7, 0xc8, 0x10, 0x43, 0x3c, 0x4e, 0xf6,
+  0xc1, 0x0a, 0x06, 0x2b, 0x0c, 0x18, 0xa6, 0x58, 0x6d, 0xde, 0xfe, 0xe7,
+  0x96, 0xd5, 0xfc, 0x83, 0x02, 0x3f, 0x7d, 0x2a, 0x96, 0xb9, 0xbd, 0x7c,
+  0x1d, 0xb5, 0x65, 0xee, 0xb7, 0xb5, 0x6a, 0xc5, 0x4d, 0x9e, 0x8a, 0xba,
+  0x83, 0x7a, 0x5d, 0x95, 0x85, 0xee, 0x56, 0xb6, 0x97, 0x0c, 0x8c, 0xf6,
+  0x54, 0x4a, 0x80, 0xf7, 0x06, 0xc8, 0x00, 0xf5, 0xbf, 0xbd, 0x8f, 0xdf,
+  0xbf, 0x93, 0x1d, 0x04, 0x9a, 0xae, 0x25, 0x25, 0x74, 0xaf, 0x83, 0x20,
+  0x9c, 0x80, 0x5a, 0x0b, 0x6b, 0xf3, 0x96, 0xad, 0x79, 0xbd, 0xc7, 0x96,
+  0x1a, 0x48, 0x45, 0xee, 0x10, 0x1f, 0x6a, 0x80, 0xf4, 0xcf, 0x8d, 0x42,
+  0xfd, 0x76, 0x89, 0xdc, 0xc0, 0x01, 0x1a, 0x82, 0xe5, 0x70, 0xd0, 0xed,
+  0x66, 0x6f, 0x47, 0x3d, 0xb6, 0x09, 0x76, 0x32, 0x22, 0x12, 0xf7, 0x3a,
+  0x1a, 0x1c, 0x6f, 0x8c, 0x35, 0x15, 0x72, 0x67, 0x58, 0x8b, 0x2f, 0xf7,
+  0x08, 0x0b, 0xec, 0x83, 0xda, 0x1c, 0x00, 0xee, 0x7d, 0x80, 0xd2, 0x9e,
+  0x32, 0xb8, 0xf3, 0x37, 0xca, 0x4f, 0x1d, 0xbd, 0x6a, 0xff, 0xd5, 0x7d,
+  0x7b, 0xe0, 0xd8, 0xe3, 0x43, 0x9c, 0xf8, 0xd3, 0xba, 0x14, 0x74, 0x77,
+  0x9e, 0x3f, 0x6d, 0x60, 0xff, 0x36, 0x11, 0xa4, 0xb4, 0xb0, 0xc7, 0x89,
+  0xcb, 0xc5, 0xd5, 0xd1, 0xe5, 0xc9, 0xe2, 0xea, 0x52, 0xd3, 0xf8, 0xd9,
+  0x29, 0x8f, 0xf5, 0x26, 0x9c, 0xe0, 0x09, 0xa5, 0xa4, 0x16, 0xc5, 0x80,
+  0xf6, 0x0c, 0xeb, 0x20, 0xbb, 0xb5, 0x0a, 0xd1, 0x30, 0x63, 0x07, 0xbb,
+  0xc9, 0x25, 0x1d, 0xab, 0xc8, 0xc7, 0x1a, 0x85, 0x2c, 0xeb, 0x2e, 0x88,
+  0xe1, 0x93, 0x32, 0x78, 0x3f, 0x82, 0xed, 0xa0, 0x71, 0x1e, 0x6a, 0xf7,
+  0xca, 0x9a, 0x2f, 0xeb, 0xf7, 0xd1, 0x88, 0xd1, 0xf5, 0xb3, 0xe6, 0x4a,
+  0xc2, 0xc0, 0xa7, 0x45, 0x3b, 0x01, 0xdf, 0x85, 0x36, 0xfa, 0xb6, 0xe5,
+  0x44, 0x65, 0x4f, 0xe6, 0x2c, 0x58, 0xfc, 0x8a, 0x28, 0x4a, 0xa0, 0xb3,
+  0xd6, 0x80, 0x9e, 0x8e, 0x91, 0x31, 0xec, 0xbf, 0x3a, 0xa0, 0xbb, 0x71,
+  0x63, 0xa7, 0x2b, 0xfa, 0x6d, 0xef, 0xe4, 0xd5, 0x84, 0x21, 0x81, 0x38,
+  0xf3, 0x25, 0xfe, 0xf1, 0x25, 0x59, 0xdf, 0xb6, 0x56, 0xdc, 0x7f, 0x75,
+  0xb7, 0x87, 0x1f, 0x2a, 0x78, 0x50, 0x50, 0xd3, 0x28, 0x6d, 0x2a, 0x7b,
+  0x44, 0x39, 0x18, 0x75, 0x0e, 0x47, 0xa2, 0xd5, 0x43, 0x14, 0xed, 0xed,
+  0xd2, 0xe9, 0x11, 0x7a, 0x40, 0x7d, 0x3d, 0x83, 0xdf, 0x2e, 0x3b, 0xb8,
+  0xc4, 0x17, 0x23, 0xb3, 0x09, 0x0f, 0xb8, 0xb5, 0x43, 0x03, 0xac, 0xdf,
+  0x91, 0xb9, 0x85, 0xfe, 0xe0, 0x12, 0x30, 0x33, 0xaf, 0x5a, 0x1d, 0x3b,
+  0x19, 0x92, 0xf1, 0x75, 0xc3, 0x43, 0xc5, 0x27, 0x9c, 0x53, 0xaf, 0xf6,
+  0xf4, 0x6e, 0xe9, 0xb9, 0x22, 0xce, 0x5e, 0xdd, 0x90, 0xe2, 0xcb, 0xfa,
+  0x21, 0x12, 0xbb, 0x14, 0xb7, 0x5b, 0x8e, 0x78, 0x6d, 0xee, 0x14, 0x88,
+  0x20, 0x77, 0xab, 0x60, 0x2f, 0xc4, 0x7c, 0x6c, 0xa6, 0x71, 0x3d, 0x51,
+  0x96, 0x46, 0x8d, 0x3b, 0x80, 0xde, 0x35, 0xb9, 0xc1, 0xd9, 0x06, 0xb5,
+  0x7f, 0xab, 0xd3, 0x9d, 0x40, 0x9b, 0x2b, 0x8c, 0x3b, 0x8c, 0x5e, 0x7b,
+  0x67, 0xf5, 0x42, 0xd4, 0x94, 0x74, 0xa8, 0xa2, 0xd3, 0x58, 0x9e, 0x91,
+  0xf0, 0xd1, 0x97, 0xff, 0xa3, 0x3b, 0x9b, 0xf7, 0x31, 0xfb, 0x46, 0x8a,
+  0x18, 0x1d, 0xbd, 0x1a, 0x8d, 0xbc, 0xcb, 0x90, 0xb4, 0xc2, 0xa0, 0xa6,
+  0x5c, 0x36, 0xed, 0x95, 0x99, 0x48, 0x15, 0x2c, 0xfd, 0x72, 0x2c, 0xa2,
+  0x36, 0x41, 0xb7, 0x8d, 0xad, 0x48, 0xb9, 0xff, 0x1b, 0x37, 0xa2, 0xa5,
+  0x97, 0xf0, 0x9f, 0x9c, 0x13, 0xfc, 0xd7, 0xe4, 0xfd, 0xbb, 0x5f, 0xde,
+  0x71, 0x00, 0x95, 0xea, 0x4a, 0x50, 0x84, 0x49, 0x9a, 0xeb, 0xa2, 0xe1,
+  0x62, 0x69, 0xed, 0xb8, 0x64, 0x0b, 0xa8, 0x0f, 0x2e, 0x60, 0x42, 0xb1,
+  0xc1, 0x34, 0x78, 0x80, 0x6d, 0x2a, 0xbd, 0xce, 0x83, 0x89, 0xd5, 0x7d,
+  0xd8, 0x0d, 0xf5, 0x3c, 0xd9, 0xe3, 0x11, 0x93, 0xe3, 0xcb, 0x4d, 0x47,
+  0xf9, 0x2d, 0x1b, 0x7e, 0xc1, 0x13, 0xb0, 0xd9, 0xc7, 0xbf, 0x10, 0x69,
+  0xef, 0x2c, 0x6d, 0xf6, 0xcc, 0x59, 0xba, 0xed, 0xdc, 0xb8, 0xf7, 0x36,
+  0x6a, 0xdd, 0x15, 0x0d, 0x87, 0xe5, 0x8c, 0x94, 0xed, 0x30, 0xf8, 0xf6,
+  0xc7, 0xc7, 0xcf, 0xbf, 0x53, 0x4f, 0x9e, 0xf2, 0xe7, 0xf8, 0x56, 0x06,
+  0x74, 0xda, 0x4d, 0x18, 0x2a, 0x52, 0x3b, 0x2c, 0xb8, 0x8c, 0xe1, 0xcb,
+  0x81, 0x6f, 0xfa, 0x0f, 0xd4, 0x9a, 0x06, 0x5e, 0x8e, 0xd6, 0x48, 0x96,
+  0x83, 0x9e, 0xbb, 0x19, 0x39, 0xaa, 0x76, 0x22, 0x38, 0xe4, 0x2e, 0xb7,
+  0x06, 0xae, 0x06, 0x2e, 0x0b, 0xa8, 0x0e, 0x65, 0xc7, 0xad, 0x45, 0xd4,
+  0x2c, 0x42, 0xa9, 0x21, 0x6e, 0x61, 0xd9, 0x77, 0x98, 0xf5, 0x92, 0x26,
+  0xbd, 0xb3, 0x6d, 0x2c, 0x67, 0x7d, 0xfd, 0xb4, 0x37, 0xe8, 0x97, 0x54,
+  0x32, 0xaf, 0x1d, 0xb2, 0xbd, 0x75, 0x77, 0xa9, 0xb2, 0xbb, 0xc4, 0xb8,
+  0xa2, 0x83, 0x76, 0x6a, 0xa6, 0x57, 0x54, 0xbd, 0xbb, 0xb7, 0x70, 0x9a,
+  0xb4, 0x00, 0xbf, 0xea, 0x88, 0xaf, 0x08, 0xb6, 0x8b, 0xa8, 0xa0, 0x11,
+  0xd4, 0x7a, 0x13, 0x35, 0xe5, 0xab, 0x6f, 0x4d, 0x8b, 0x42, 0x81, 0x80,
+  0xe9, 0xf5, 0x1d, 0xc1, 0x44, 0x20, 0x91, 0x7d, 0x2f, 0x88, 0x5a, 0xb2,
+  0x70, 0x58, 0xf5, 0xce, 0x85, 0x6e, 0xa3, 0xbc, 0xc6, 0x91, 0xf9, 0x1e,
+  0x95, 0x7d, 0x97, 0x11, 0x45, 0xbf, 0x9b, 0x37, 0x2b, 0x72, 0xe9, 0xe7,
+  0xf1, 0x97, 0x2e, 0x91, 0x93, 0x1e, 0x81, 0xed, 0x6c, 0x6d, 0x75, 0xb2,
+  0x66, 0x45, 0xd7, 0xc7, 0x22, 0xb6, 0xee, 0x36, 0xc8, 0xf0, 0xa4, 0xee,
+  0x90, 0x90, 0x91, 0xa1, 0x7a, 0xe6, 0x83, 0xf2, 0xb1, 0xab, 0x92, 0x19,
+  0xd4, 0x22, 0x26, 0xb4, 0x27, 0x8c, 0x57, 0x12, 0x2c, 0xf5, 0xa1, 0xb6,
+  0x5b, 0x47, 0x49, 0x3d, 0xe0, 0xc8, 0xf1, 0x5d, 0xf4, 0xb0, 0xcf, 0x04,
+  0xd9, 0xf9, 0xf5, 0x99, 0xc9, 0xea, 0xb8, 0x4b, 0x69, 0xb7, 0x76, 0xe8,
+  0x60, 0xc2, 0x56, 0xe7, 0x55, 0x16, 0xb5, 0xda, 0x16, 0x50, 0xd7, 0xe7,
+  0x8e, 0xd8, 0xae, 0xf2, 0xec, 0xf1, 0xda, 0x66, 0xf0, 0xb2, 0x47, 0x8e,
+  0x3f, 0xae, 0xe9, 0x08, 0x93, 0xaf, 0x68, 0x60, 0xff, 0x30, 0xc8, 0xa2,
+  0x7c, 0x9a, 0x44, 0x88, 0xd5, 0x67, 0x4a, 0xd3, 0xf5, 0x0d, 0xd3, 0xd2,
+  0x34, 0x3f, 0xf1, 0xf1, 0x2b, 0x99, 0x24, 0xe7, 0x8f, 0x6a, 0x82, 0x9f,
+  0x13, 0x4d, 0x47, 0xf0, 0x0a, 0x04, 0x5f, 0x9f, 0xbb, 0xa5, 0x65, 0xcb,
+  0xbb, 0x7b, 0xb6, 0xef, 0x86, 0x91, 0x4b, 0x1b, 0x92, 0xbd, 0x1f, 0xc1,
+  0xfc, 0x10, 0x66, 0x38, 0x96, 0x36, 0x88, 0x38, 0xfe, 0xd5, 0xc5, 0x38,
+  0xda, 0x65, 0x11, 0x4f, 0x72, 0x37, 0x87, 0x6b, 0x87, 0xf2, 0x63, 0xa8,
+  0x06, 0xb8, 0xed, 0x50, 0x19, 0x6a, 0x6a, 0x46, 0xb9, 0x1e, 0xec, 0x6d,
+  0x92, 0x86, 0xd4, 0xd0, 0xce, 0x96, 0x1a, 0x97, 0x12, 0x05, 0xfa, 0x3a,
+  0xb0, 0x1e, 0xe0, 0x47, 0x41, 0xef, 0xa4, 0x6d, 0x8b, 0x9f, 0x5a, 0x04,
+  0x65, 0xe5, 0xf7, 0x8e, 0x99, 0x41, 0x48, 0x52, 0x6d, 0x28, 0x37, 0x2e,
+  0x91, 0xda, 0xb0, 0x41, 0x4e, 0x67, 0xdf, 0x0d, 0xf0, 0xf1, 0x67, 0x2f,
+  0x7b, 0xdb, 0x4a, 0xae, 0xe8, 0xd6, 0x85, 0x97, 0x5c, 0x11, 0xa9, 0x47,
+  0x4c, 0x2a, 0x0f, 0x8c, 0x6c, 0xba, 0x6d, 0x9c, 0xcc, 0xde, 0xde, 0x43,
+  0xd3, 0x3e, 0xa5, 0x95, 0xcb, 0xaa, 0x97, 0xf0, 0x51, 0x6b, 0x86, 0x78,
+  0x45, 0x14, 0xb8, 0xe8, 0x34, 0xf6, 0xbe, 0xf3, 0xce, 0x7a, 0xf7, 0xf6,
+  0x3e, 0xc0, 0xf6, 0x0e, 0x4b, 0x4f, 0x6c, 0x2a, 0xd8, 0x74, 0x2d, 0x2a,
+  0xfe, 0xad, 0xd7, 0x6d, 0x48, 0x8d, 0x67, 0xfc, 0x79, 0x23, 0xb5, 0xbc,
+  0x02, 0x37, 0xde, 0xae, 0x12, 0xb9, 0xe8, 0xda, 0x38, 0xf5, 0xde, 0xf2,
+  0x3a, 0xc2, 0xf0, 0xb1, 0x7a, 0x68, 0x1c, 0x9d, 0x9c, 0x23, 0x16, 0x25,
+  0x9d, 0x97, 0x91, 0xb8, 0x8c, 0x63, 0x11, 0x2c, 0x4c, 0xc6, 0x66, 0xfc,
+  0x7b, 0x71, 0x4d, 0x54, 0x5b, 0x96, 0xb6, 0xe4, 0xa4, 0x0e, 0x1c, 0xe1,
+  0xa5, 0x0e, 0x32, 0x6d, 0xc6, 0x6e, 0x8a, 0xf7, 0x24, 0x73, 0x6a, 0xfe,
+  0xe9, 0xb5, 0x78, 0xed, 0xfa, 0xca, 0xee, 0xb7, 0xac, 0xba, 0x1b, 0x95,
+  0xdb, 0x24, 0x7a, 0xe5, 0x62, 0x91, 0xd9, 0x96, 0x79, 0x91, 0x79, 0x4e,
+  0x92, 0x26, 0x72, 0xf2, 0x98, 0x59, 0xd6, 0x41, 0x77, 0x33, 0x8b, 0xef,
+  0x13, 0x20, 0xc5, 0x8e, 0x48, 0x58, 0x1d, 0x0a, 0xd6, 0xa0, 0x8d, 0xa5,
+  0x83, 0x7f, 0x65, 0xa6, 0x7d, 0x36, 0xe0, 0x06, 0x6c, 0xfa, 0x6a, 0xc1,
+  0x59, 0x76, 0x08, 0x1d, 0x6b, 0xbe, 0x1c, 0xdf, 0x7f, 0x8b, 0x15, 0x01,
+  0x9f, 0x8f, 0x1c, 0xa1, 0xd4, 0x0f, 0x01, 0x64, 0x26, 0xd8, 0x0b, 0xdb,
+  0xa2, 0x45, 0x74, 0xa3, 0x9e, 0xfb, 0xc3, 0x06, 0x4f, 0xa6, 0x67, 0xed,
+  0x44, 0xd5, 0x66, 0x54, 0xf1, 0x0b, 0xc8, 0xc7, 0xbc, 0x1a, 0xbf, 0xd0,
+  0x4a, 0x9f, 0xb5, 0x74, 0xa1, 0x6d, 0x7c, 0x6a, 0xec, 0x0b, 0xd1, 0x04,
+  0x6a, 0xd1, 0xf0, 0x64, 0xbe, 0x61, 0x47, 0x59, 0x87, 0x3d, 0x0f, 0xa5,
+  0xd7, 0x6a, 0x27, 0xfc, 0x8c, 0x5f, 0x4b, 0x4d, 0xb4, 0xbc, 0x1b, 0xa5,
+  0xe9, 0xd8, 0x8e, 0x9d, 0x7f, 0xc3, 0x27, 0xaf, 0x16, 0xc9, 0x94, 0x4e,
+  0xe4, 0x1a, 0x4d, 0xe7, 0x76, 0x9e, 0xa3, 0x83, 0x0b, 0x29, 0xbc, 0xdc,
+  0xdb, 0xd7, 0x5c, 0xce, 0xef, 0x5d, 0x8e, 0x2e, 0xe9, 0xbe, 0xd1, 0x31,
+  0x76, 0xf4, 0x01, 0xa9, 0x96, 0xe9, 0xfe, 0x1a, 0x27, 0x6e, 0x4d, 0x64,
+  0x2b, 0x86, 0xf5, 0x3a, 0xc0, 0x7d, 0x91, 0x0b, 0x26, 0x2a, 0x71, 0x2f,
+  0x1f, 0x39, 0x6f, 0x36, 0xf5, 0x7c, 0x8e, 0x1d, 0xac, 0xa7, 0x62, 0x71,
+  0x5e, 0x87, 0xef, 0xca, 0x07, 0x20, 0x6c, 0xfe, 0x5c, 0x87, 0xa0, 0x47,
+  0x53, 0x28, 0xd1, 0xd1, 0xdb, 0x06, 0x25, 0x0a, 0xee, 0xe5, 0x5a, 0xcd,
+  0xaf, 0x37, 0xca, 0xeb, 0x41, 0x9a, 0x6f, 0x33, 0xd2, 0x8b, 0xe7, 0xd0,
+  0xb0, 0x88, 0xec, 0x28, 0xe2, 0x37, 0x78, 0x28, 0x11, 0x6e, 0x14, 0x40,
+  0x96, 0xa8, 0x15, 0xea, 0x6c, 0x23, 0x3b, 0xb0, 0x3d, 0x0f, 0x73, 0x22,
+  0x17, 0x27, 0xe2, 0xb9, 0x3d, 0x1f, 0xe8, 0xf8, 0xc8, 0x33, 0xfa, 0x14,
+  0x90, 0x33, 0xe4, 0x74, 0x87, 0xae, 0x37, 0x48, 0x26, 0x18, 0x96, 0x75,
+  0x8a, 0x1c, 0x14, 0x94, 0x08, 0x58, 0x3a, 0x4b, 0x37, 0x9c, 0x2d, 0xd3,
+  0x6a, 0xde, 0xb9, 0xa1, 0x8b, 0x11, 0x3c, 0x86, 0x55, 0xc8, 0x1f, 0xd0,
+  0x0b, 0x0f, 0xc1, 0xe0, 0xe3, 0x9e, 0x00, 0x4d, 0x31, 0x3c, 0x84, 0x6d,
+  0xd8, 0x97, 0xf2, 0xcb, 0xd6, 0x3d, 0x7e, 0xca, 0xeb, 0xd7, 0x7f, 0x0c,
+  0x2b, 0xc7, 0xe2, 0x1e, 0xd6, 0x5e, 0x74, 0xfe, 0x63, 0xc8, 0x8d, 0xfb,
+  0xef, 0x70, 0x73, 0xa4, 0xfb, 0x63, 0x38, 0xcd, 0x2b, 0xe6, 0x7d, 0xc5,
+  0x32, 0xaf, 0x9d, 0xf7, 0x30, 0x0f, 0xa2, 0xdc, 0xcd, 0x9c, 0x7c, 0x3c,
+  0x5d, 0x32, 0xe6, 0x63, 0x6a, 0x3f, 0xe4, 0xed, 0x07, 0x42, 0xb9, 0xa8,
+  0x78, 0x2f, 0x96, 0x8b, 0x3d, 0xae, 0xb7, 0x32, 0xd2, 0xda, 0x1d, 0xe1,
+  0xb2, 0xa1, 0xf2, 0x11, 0x2e, 0x77, 0xb1, 0x00, 0x37, 0x90, 0x48, 0x9a,
+  0xac, 0x1a, 0x9b, 0x59, 0xc2, 0x6f, 0x89, 0xe7, 0x9b, 0xe0, 0x37, 0x9e,
+  0xdb, 0xff, 0x47, 0x08, 0xf3, 0x6e, 0xbd, 0x0a, 0x26, 0xea, 0x48, 0x1d,
+  0x1f, 0x1f, 0x8f, 0x15, 0xfb, 0xa7, 0x96, 0x7a, 0xea, 0x2d, 0xbd, 0x3b,
+  0x2c, 0xce, 0xed, 0x8e, 0x79, 0x6b, 0x26, 0x91, 0x77, 0xd7, 0x34, 0xf2,
+  0x09, 0x7d, 0x3c, 0x3f, 0x56, 0xa3, 0x5f, 0x46, 0x0a, 0x06, 0x00, 0x57,
+  0x88, 0x88, 0x05, 0x82, 0xfe, 0xb7, 0xbd, 0x6f, 0xef, 0x73, 0xdb, 0x38,
+  0x12, 0xfc, 0x7b, 0xf4, 0x29, 0x70, 0x14, 0x99, 0x21, 0xc7, 0xc3, 0x91,
+  0x66, 0x94, 0xec, 0x6e, 0x46, 0xb2, 0xd6, 0x4e, 0xe2, 0x64, 0x7d, 0x6b,
+  0x27, 0xba, 0xd8, 0xb9, 0xe4, 0x36, 0x8e, 0x69, 0x90, 0x04, 0x87, 0x88,
+  0x40, 0x82, 0x06, 0xc0, 0x79, 0x78, 0x15, 0x7d, 0xf6, 0xab, 0x67, 0x3f,
+  0x80, 0xc6, 0x43, 0xb2, 0x36, 0xbf, 0xbb, 0xfd, 0xc5, 0x9b, 0xd5, 0x80,
+  0x40, 0x75, 0x75, 0x75, 0x77, 0x75, 0x75, 0x75, 0x75, 0x75, 0xd5, 0x6c,
+  0x54, 0x6f, 0x1b, 0x2b, 0x3a, 0x2c, 0xb4, 0xc9, 0x16, 0xa6, 0x3a, 0x05,
+  0x2f, 0x3f, 0xd0, 0xbf, 0x85, 0xae, 0xbf, 0xba, 0xbe, 0xa9, 0xb0, 0x32,
+  0xcb, 0x93, 0x55, 0x64, 0x3a, 0x97, 0x18, 0xc0, 0x45, 0xd5, 0x34, 0x3a,
+  0x82, 0x4b, 0xd3, 0x4a, 0x35, 0x10, 0x89, 0xb3, 0x50, 0x05, 0xb4, 0xfe,
+  0x13, 0xe7, 0xe0, 0xfd, 0xc4, 0x2c, 0x56, 0x7c, 0x5c, 0xf9, 0xdb, 0xfc,
+  0xce, 0x1c, 0x56, 0x76, 0x1c, 0x54, 0xde, 0xa6, 0xb8, 0xd1, 0xc1, 0x35,
+  0xa4, 0x7a, 0xa0, 0x81, 0x29, 0x9b, 0x5c, 0xc1, 0xfb, 0xa0, 0x00, 0x5b,
+  0xa8, 0x1f, 0x80, 0x7b, 0xc8, 0x6f, 0xd4, 0x2d, 0x2b, 0x46, 0x51, 0x81,
+  0x55, 0x26, 0x66, 0xd1, 0x5d, 0xaf, 0x82, 0x65, 0x81, 0x5b, 0x03, 0x85,
+  0x56, 0x40, 0xa1, 0x8a, 0x72, 0xed, 0x0a, 0x28, 0xbe, 0x29, 0xed, 0x88,
+  0xa1, 0xd0, 0xd7, 0x51, 0x91, 0xcd, 0x0d, 0x3e, 0xe9, 0xe3, 0xdd, 0x3e,
+  0xc6, 0x33, 0x1b, 0x87, 0x02, 0x5f, 0x3f, 0xaf, 0x11, 0xcf, 0xb7, 0xa2,
+  0x32, 0x57, 0x5d, 0x6d, 0xb4, 0xf2, 0xc3, 0x34, 0x53, 0x67, 0x7a, 0x57,
+  0x57, 0xda, 0xfd, 0x43, 0xa0, 0x0e, 0x9c, 0x5e, 0x35, 0x42, 0x1b, 0xea,
+  0x78, 0xee, 0xd4, 0xd0, 0xd8, 0x58, 0x66, 0xfd, 0x44, 0x9a, 0xd8, 0x17,
+  0x9d, 0x7b, 0x1b, 0xd9, 0xb7, 0x04, 0xba, 0x41, 0x57, 0x26, 0xfc, 0x0e,
+  0x4a, 0x87, 0x55, 0xbf, 0x37, 0xec, 0x24, 0xc7, 0xc8, 0x55, 0x6b, 0x31,
+  0xda, 0x10, 0x6e, 0xc2, 0xf3, 0x43, 0x6d, 0xbb, 0x43, 0x1b, 0x9a, 0x60,
+  0x57, 0x9b, 0x5a, 0xd6, 0x06, 0x45, 0x55, 0xc4, 0x69, 0x46, 0xa7, 0xfb,
+  0x87, 0x1f, 0xbb, 0xc5, 0x69, 0xec, 0x73, 0x1b, 0x3a, 0x7f, 0x06, 0x38,
+  0x1b, 0xf6, 0x76, 0x6b, 0x4e, 0xe5, 0x03, 0xc1, 0x6e, 0x2b, 0x3a, 0x1d,
+  0xa1, 0x8d, 0xa2, 0x8c, 0x3d, 0xb6, 0x55, 0x7f, 0x0a, 0x98, 0xe7, 0xd0,
+  0x00, 0xc4, 0xb6, 0xd5, 0x36, 0x47, 0x20, 0xea, 0x9d, 0x7b, 0xc7, 0xea,
+  0xef, 0xda, 0x3c, 0xc5, 0xf2, 0x2f, 0xaf, 0x00, 0xab, 0xbc, 0x20, 0x4b,
+  0xa3, 0xbc, 0x95, 0xad, 0x8b, 0xb9, 0xf9, 0xd6, 0xb9, 0xcd, 0xf4, 0xcb,
+  0xc8, 0x65, 0x3a, 0x3e, 0x93, 0x6f, 0xd8, 0x68, 0x6a, 0x84, 0xa2, 0xfd,
+  0xb5, 0x9d, 0x52, 0x39, 0x00, 0x6c, 0xa0, 0x51, 0x2c, 0x14, 0xb2, 0x60,
+  0x99, 0xde, 0x6c, 0xb2, 0x3c, 0xae, 0x64, 0x68, 0xfc, 0x9f, 0xb2, 0xd6,
+  0x48, 0x95, 0xe8, 0x92, 0xe9, 0x82, 0x98, 0x59, 0x21, 0xfe, 0x0a, 0x7a,
+  0xc2, 0x2b, 0xdb, 0x9f, 0xe9, 0xe6, 0xe0, 0x29, 0xb4, 0x1e, 0x0b, 0xd4,
+  0x91, 0xd4, 0xd8, 0x06, 0x57, 0x45, 0x32, 0xa7, 0xb8, 0x48, 0xd8, 0xcc,
+  0xb2, 0x57, 0x0f, 0x20, 0xb7, 0x15, 0x64, 0x9d, 0xc1, 0x0d, 0x2c, 0x1a,
+  0x82, 0x96, 0x59, 0xbe, 0x7a, 0x2d, 0x36, 0xa1, 0xc8, 0xe9, 0x09, 0x07,
+  0x7e, 0x0c, 0x2b, 0x7b, 0xc2, 0x1b, 0x5e, 0x7c, 0x22, 0xde, 0x8d, 0xda,
+  0x60, 0x37, 0x71, 0x56, 0x26, 0x04, 0x4b, 0x4f, 0x0c, 0xec, 0xc0, 0x36,
+  0x08, 0x69, 0xcc, 0x7d, 0xe9, 0xcc, 0x26, 0xdc, 0xd4, 0xae, 0xfe, 0xce,
+  0xb2, 0x3f, 0x8b, 0x2c, 0xa7, 0x79, 0x85, 0x88, 0x2d, 0xfa, 0x71, 0x33,
+  0xf7, 0x30, 0xea, 0xea, 0xe5, 0x9f, 0x79, 0x66, 0x22, 0xfd, 0x7f, 0xc1,
+  0xc7, 0xce, 0x2a, 0xc6, 0xa8, 0x56, 0xf4, 0xd6, 0x40, 0x50, 0xa6, 0x82,
+  0xff, 0xb4, 0x15, 0xfc, 0xad, 0xb7, 0x82, 0x5d, 0xbc, 0x2c, 0x07, 0x34,
+  0x01, 0xa1, 0xa4, 0x82, 0x98, 0x70, 0x3f, 0x89, 0x7b, 0x08, 0x87, 0xc9,
+  0xfe, 0xd7, 0xe3, 0x0d, 0x5d, 0x31, 0xeb, 0x25, 0xdf, 0xc2, 0x4a, 0x1d,
+  0xab, 0xbf, 0x72, 0x25, 0xf0, 0xb7, 0xb3, 0x96, 0xc9, 0x3b, 0xd4, 0x32,
+  0x79, 0xef, 0x5a, 0x40, 0x77, 0xbb, 0x57, 0xfc, 0xe6, 0xb1, 0x36, 0xc4,
+  0x71, 0x18, 0xa6, 0x81, 0xe6, 0xf2, 0xe9, 0x85, 0x13, 0xf0, 0xa7, 0xe3,
+  0x73, 0x86, 0x9f, 0xeb, 0x75, 0xf4, 0x60, 0x68, 0x40, 0xb8, 0x48, 0xec,
+  0x12, 0x88, 0x30, 0xc1, 0xe5, 0xaf, 0x55, 0xef, 0x11, 0xad, 0x78, 0x9b,
+  0x91, 0x5a, 0x1c, 0xb2, 0xd2, 0xfa, 0x4b, 0x1b, 0x49, 0x06, 0x80, 0x96,
+  0x6e, 0x2d, 0x1a, 0xeb, 0x50, 0x43, 0x60, 0x88, 0x3b, 0xa6, 0x50, 0xe8,
+  0xfe, 0x0a, 0x34, 0x40, 0x7d, 0x37, 0xdf, 0xb9, 0x0d, 0xae, 0xad, 0x59,
+  0x7d, 0x1a, 0x61, 0xb2, 0x47, 0x0d, 0x8f, 0x49, 0xd7, 0xe6, 0x6c, 0x96,
+  0x58, 0xbb, 0xc6, 0x7a, 0x1b, 0x83, 0x0d, 0xbb, 0x04, 0x74, 0x2d, 0xbb,
+  0x85, 0xb3, 0xec, 0x32, 0xcb, 0xff, 0x90, 0x54, 0x31, 0x94, 0xb8, 0x79,
+  0x89, 0x0f, 0x2f, 0x9e, 0xdc, 0xb4, 0x8a, 0xc6, 0x49, 0x37, 0x24, 0x2d,
+  0x08, 0xbc, 0x6f, 0xf8, 0x4d, 0x91, 0x24, 0xaf, 0xdd, 0x48, 0x58, 0xf2,
+  0xc9, 0x56, 0x3a, 0x89, 0xb3, 0xc3, 0x96, 0x91, 0xf1, 0x63, 0x57, 0xc5,
+  0x63, 0x0b, 0xdc, 0x0f, 0x3b, 0x59, 0x2a, 0x95, 0xf4, 0xd4, 0x09, 0x6b,
+  0x40, 0x7b, 0x21, 0x27, 0x37, 0xf1, 0x6e, 0x27, 0x68, 0xe9, 0xb1, 0xb3,
+  0xa3, 0x2c, 0x70, 0x2f, 0xec, 0x78, 0xb2, 0x4e, 0x32, 0x25, 0x98, 0x1e,
+  0x3b, 0xa1, 0x2d, 0x70, 0x3f, 0xec, 0x24, 0x39, 0x94, 0x69, 0x86, 0xb1,
+  0x93, 0x10, 0xb7, 0xfc, 0xe8, 0x2c, 0xe1, 0x16, 0x18, 0x02, 0x6f, 0x39,
+  0x62, 0xd2, 0xc7, 0x3c, 0x40, 0x8d, 0x82, 0xf6, 0x41, 0x2a, 0x60, 0x2f,
+  0x46, 0x50, 0x46, 0x15, 0x27, 0x3d, 0x76, 0x42, 0x5b, 0xe0, 0x7e, 0xd8,
+  0x49, 0x9a, 0x2b, 0x62, 0x7c, 0xea, 0x84, 0x35, 0xa0, 0xbd, 0x90, 0x93,
+  0xd7, 0x30, 0x0b, 0x05, 0x2d, 0x3d, 0x76, 0x42, 0x5b, 0xe0, 0x7e, 0xd8,
+  0x89, 0x1c, 0xc4, 0x10, 0x6a, 0x7e, 0xee, 0x84, 0x77, 0xc0, 0x07, 0x40,
+  0x4f, 0x76, 0x47, 0xc6, 0xbc, 0x3b, 0x76, 0xc2, 0x09, 0x58, 0x0f, 0xd4,
+  0x64, 0x2f, 0xd8, 0xf6, 0xdd, 0x70, 0x02, 0xd6, 0x03, 0x35, 0xb9, 0x4f,
+  0x19, 0xdb, 0x7d, 0xda, 0x09, 0x27, 0x60, 0x3d, 0x50, 0x93, 0x7c, 0x97,
+  0xae, 0x0a, 0x9d, 0x31, 0xf2, 0xa3, 0xb3, 0x84, 0x5b, 0x60, 0x08, 0xfc,
+  0xe4, 0x80, 0x84, 0x94, 0x2f, 0xe1, 0xef, 0x8b, 0x27, 0x65, 0x3b, 0xdc,
+  0x81, 0xe9, 0x3d, 0xf4, 0xd0, 0x5b, 0x6c, 0x73, 0xa6, 0x15, 0x1e, 0x3a,
+  0x21, 0x15, 0xb0, 0x0f, 0x6e, 0x52, 0xa6, 0x37, 0x2a, 0xe7, 0xe8, 0xb1,
+  0x13, 0xda, 0x02, 0xf7, 0xc3, 0x4e, 0xaa, 0x58, 0x06, 0x1e, 0x1e, 0xba,
+  0x67, 0xaa, 0x00, 0xf6, 0xc1, 0x4d, 0x8e, 0xae, 0x7c, 0x3b, 0x0e, 0x90,
+  0x57, 0x6e, 0x81, 0x21, 0xf0, 0x93, 0xc3, 0x56, 0xd8, 0x0b, 0x1e, 0x3a,
+  0x21, 0x15, 0xb0, 0x0f, 0x6e, 0xb2, 0x52, 0x8c, 0xab, 0x1e, 0x48, 0x05,
+  0xec, 0x83, 0x9b, 0x40, 0x3b, 0x84, 0xc6, 0xb2, 0x87, 0x46, 0x01, 0xec,
+  0x83, 0x03, 0xc6, 0x4f, 0x6e, 0x62, 0x9d, 0x03, 0xf0, 0xd8, 0x33, 0x03,
+  0x14, 0xb8, 0x17, 0xf6, 0xcd, 0x78, 0xf2, 0x29, 0xae, 0xdf, 0x6f, 0x18,
+  0xf7, 0xa7, 0x7d, 0x6b, 0xf9, 0x9b, 0xb1, 0x03, 0x3e, 0x00, 0x7a, 0xf2,
+  0x0b, 0x10, 0xec, 0x82, 0xfc, 0x17, 0x3d, 0x32, 0xfe, 0xcd, 0xd8, 0x02,
+  0xf7, 0xc3, 0x4e, 0x7e, 0x83, 0xeb, 0xb8, 0xa0, 0xfe, 0x4d, 0xdf, 0x9a,
+  0xfe, 0x66, 0xec, 0x80, 0x0f, 0x80, 0x9e, 0xfc, 0x0a, 0xd7, 0x72, 0xc1,
+  0xfe, 0xab, 0xbe, 0x75, 0xfd, 0xcd, 0xd8, 0x01, 0x1f, 0x00, 0x3d, 0xf9,
+  0x8c, 0x39, 0x5d, 0xf0, 0x7f, 0xd6, 0xcf, 0xf7, 0x6f, 0xc6, 0x5e, 0x91,
+  0x41, 0x25, 0x26, 0xff, 0x61, 0xfb, 0xfe, 0x3f, 0x7a, 0xfb, 0xd3, 0x02,
+  0xf7, 0xc3, 0x4e, 0x3e, 0x33, 0x88, 0x3f, 0xeb, 0x83, 0x35, 0xa0, 0xbd,
+  0x90, 0x78, 0xc1, 0xd3, 0xe0, 0xfd, 0xba, 0x4f, 0x23, 0x78, 0x33, 0x76,
+  0xc0, 0x07, 0x40, 0x4f, 0x3e, 0xcf, 0x0d, 0xf2, 0xcf, 0x7b, 0xf4, 0x82,
+  0x37, 0x63, 0x0b, 0xdc, 0x0f, 0x3b, 0xf9, 0x77, 0xd4, 0x06, 0x04, 0xf5,
+  0xbf, 0xf7, 0x69, 0x06, 0x6f, 0xc6, 0x0e, 0xf8, 0x00, 0xe8, 0xc9, 0x17,
+  0xa4, 0x0e, 0x08, 0xfa, 0x2f, 0x7a, 0x75, 0x83, 0x37, 0x63, 0xb7, 0xc0,
+  0x10, 0xf8, 0xc9, 0x97, 0x47, 0xc1, 0xfe, 0x65, 0xa7, 0x74, 0x7f, 0x33,
+  0x56, 0xc0, 0x3e, 0xb8, 0xc9, 0x6f, 0x15, 0xe3, 0x6f, 0x7b, 0x20, 0x15,
+  0xb0, 0x0f, 0x6e, 0xf2, 0xa7, 0x54, 0x30, 0xfe, 0xa9, 0x53, 0x52, 0xbe,
+  0x19, 0x2b, 0x60, 0x1f, 0xdc, 0xe4, 0x77, 0xac, 0x1b, 0x08, 0xda, 0xdf,
+  0xf5, 0x6b, 0x0a, 0x6f, 0xc6, 0x5e, 0x91, 0x41, 0x25, 0x26, 0xbf, 0xdf,
+  0xe6, 0x52, 0xc3, 0xef, 0xbb, 0xd7, 0xf9, 0x37, 0x63, 0x03, 0xda, 0x0b,
+  0x39, 0xf9, 0x0a, 0xd7, 0x76, 0xc1, 0xfb, 0x55, 0xdf, 0x3a, 0xff, 0x66,
+  0xec, 0x80, 0x0f, 0x80, 0x9e, 0x7c, 0x1d, 0xeb, 0xf0, 0x7d, 0xdd, 0xbd,
+  0xde, 0xc3, 0x1c, 0x54, 0xd0, 0x5e, 0xc8, 0xc9, 0x1f, 0x3c, 0x99, 0xf7,
+  0x87, 0x21, 0x12, 0xcc, 0x2b, 0x32, 0xa8, 0xc4, 0xe4, 0xd5, 0x56, 0x19,
+  0xe5, 0x55, 0xf7, 0x2a, 0xfd, 0x66, 0x6c, 0x40, 0x7b, 0x21, 0x27, 0xbf,
+  0x34, 0x58, 0x7f, 0xd9, 0x07, 0x6b, 0x40, 0x7b, 0x21, 0x27, 0xaf, 0x4a,
+  0x43, 0x6b, 0xf7, 0xfa, 0x0f, 0xb4, 0x2a, 0x68, 0x2f, 0x24, 0x70, 0x32,
+  0xac, 0xf9, 0x86, 0xab, 0x7b, 0xd7, 0x7f, 0x07, 0x7c, 0x00, 0xf4, 0xe4,
+  0x95, 0x21, 0xb9, 0x8f, 0x62, 0x25, 0xb8, 0x09, 0x57, 0xdb, 0xd8, 0xb1,
+  0xf6, 0xdd, 0xad, 0x7c, 0x4f, 0x12, 0x86, 0x4a, 0x3a, 0xa1, 0xd2, 0xfd,
+  0x86, 0xc0, 0xe0, 0x6f, 0x27, 0xdc, 0x8e, 0x01, 0xab, 0x97, 0x73, 0x32,
+  0x81, 0x86, 0x0b, 0x78, 0x16, 0x28, 0xbe, 0x3b, 0x10, 0x8d, 0xf8, 0x6f,
+  0x3b, 0xdc, 0xf7, 0xc7, 0xdc, 0x98, 0x1b, 0xe5, 0xf0, 0x30, 0x60, 0x10,
+  0x64, 0xa8, 0x29, 0x52, 0x70, 0xca, 0x36, 0x21, 0xc7, 0xb8, 0xd8, 0x04,
+  0xb4, 0x70, 0x2d, 0x0d, 0x12, 0xb8, 0xab, 0xa7, 0x97, 0x9e, 0xf5, 0xcf,
+  0x03, 0x21, 0x13, 0x18, 0x7f, 0xe4, 0x23, 0xc7, 0x00, 0x5d, 0x04, 0x43,
+  0x64, 0x5d, 0x77, 0x92, 0x45, 0x70, 0x16, 0xac, 0x8d, 0x2a, 0x02, 0xbb,
+  0xfc, 0x97, 0x76, 0x93, 0x24, 0x01, 0x5c, 0x3d, 0xed, 0x24, 0x7a, 0x00,
+  0xcd, 0x42, 0x72, 0x2f, 0xcd, 0x91, 0x03, 0xd6, 0x41, 0xb3, 0x4b, 0x72,
+  0x16, 0x20, 0xb9, 0x93, 0xe2, 0x35, 0x46, 0x74, 0x4a, 0xfa, 0x88, 0x16,
+  0x28, 0xa6, 0xfb, 0xe3, 0x4e, 0xba, 0x05, 0xd4, 0x81, 0x6c, 0x23, 0x5d,
+  0x20, 0xbb, 0xa8, 0x17, 0x90, 0x9e, 0x06, 0xf0, 0xb5, 0xec, 0xfe, 0x26,
+  0x30, 0x9c, 0x74, 0x7e, 0x6f, 0x2b, 0x18, 0xda, 0x05, 0xee, 0x68, 0x08,
+  0x03, 0xf7, 0x34, 0x85, 0x81, 0xba, 0x1a, 0x13, 0x17, 0x05, 0xfa, 0x02,
+  0x74, 0xb7, 0x84, 0x81, 0xa8, 0x19, 0xf3, 0x97, 0x9d, 0xad, 0x60, 0x48,
+  0x07, 0xb0, 0xad, 0x05, 0x0c, 0x78, 0xf5, 0xb3, 0x36, 0xe2, 0x6b, 0xdf,
+  0x9b, 0x84, 0x6f, 0x62, 0x8c, 0x3a, 0x83, 0xfe, 0x55, 0x22, 0x4b, 0xe4,
+  0xf8, 0x3c, 0x40, 0xbe, 0x05, 0xa5, 0x26, 0xfc, 0x8f, 0xce, 0x16, 0x58,
+  0x60, 0x0b, 0xdb, 0xd6, 0x08, 0x0b, 0x7b, 0xf9, 0x4f, 0x1d, 0x27, 0x0f,
+  0xc9, 0xfd, 0xc1, 0x9c, 0x42, 0xd9, 0xe7, 0x59, 0x13, 0xe6, 0xf2, 0xa7,
+  0xed, 0xa3, 0xc9, 0x00, 0xcf, 0x7e, 0xde, 0x3a, 0x94, 0x93, 0xf2, 0xb8,
+  0x8b, 0x7e, 0xde, 0x2a, 0x4a, 0x26, 0x07, 0x4a, 0x93, 0x51, 0x45, 0x3f,
+  0xff, 0x59, 0x1d, 0x05, 0xa5, 0xbb, 0x40, 0x17, 0x3e, 0xf2, 0x0e, 0x9c,
+  0xc7, 0x18, 0x7b, 0x77, 0xbe, 0x2c, 0x62, 0x0c, 0xd4, 0x22, 0xd1, 0xf4,
+  0xf7, 0x2b, 0xac, 0xff, 0x22, 0x8a, 0xbf, 0x85, 0x4e, 0xc1, 0x33, 0xf5,
+  0x2d, 0x8c, 0x4e, 0xfc, 0xed, 0xb7, 0x7b, 0x0e, 0xb9, 0x7f, 0xd1, 0x3c,
+  0x64, 0x20, 0x7a, 0xbd, 0x23, 0x06, 0xd7, 0xff, 0x4f, 0x0f, 0x18, 0x7c,
+  0xf7, 0x2c, 0x2c, 0x33, 0x2f, 0x29, 0x2c, 0x91, 0xef, 0xf0, 0x54, 0x77,
+  0x83, 0x8b, 0x5b, 0x4b, 0x37, 0xdc, 0xe0, 0xe4, 0x1a, 0x64, 0x47, 0x15,
+  0x21, 0x37, 0x07, 0x07, 0x57, 0xc8, 0x7b, 0x19, 0xc3, 0x3f, 0xa0, 0x8b,
+  0xb0, 0xf1, 0xbe, 0x92, 0x0e, 0x12, 0x8a, 0x36, 0x50, 0x28, 0x66, 0x1f,
+  0x13, 0x97, 0xce, 0x7b, 0x00, 0xb1, 0x7e, 0x91, 0xc6, 0x73, 0xc4, 0x3a,
+  0xb4, 0x4b, 0x8c, 0xc8, 0x74, 0xbf, 0x4e, 0xee, 0x23, 0xba, 0x08, 0x69,
+  0xbd, 0x9b, 0x43, 0x61, 0x37, 0xa0, 0x8e, 0x99, 0xe3, 0x2e, 0x64, 0x62,
+  0x6f, 0xe0, 0x7b, 0x74, 0x00, 0x62, 0x1a, 0x9c, 0x37, 0xdd, 0xa1, 0x37,
+  0x92, 0xb6, 0xd8, 0x1b, 0x27, 0x21, 0xff, 0xa2, 0x5a, 0xc4, 0x0d, 0xae,
+  0x81, 0xe9, 0x0d, 0x57, 0x03, 0x8d, 0xd8, 0xaf, 0x9c, 0xa8, 0x0a, 0x4e,
+  0xc5, 0x78, 0x18, 0xff, 0xf1, 0x37, 0x23, 0x3c, 0xbc, 0xe6, 0x6b, 0xc3,
+  0x5c, 0xed, 0x49, 0x0d, 0x4c, 0x82, 0x76, 0xb8, 0x6e, 0xd7, 0x03, 0xe2,
+  0x76, 0x68, 0xf7, 0xf8, 0x1e, 0x2a, 0x32, 0xcd, 0xac, 0xfb, 0x07, 0x36,
+  0xa0, 0x11, 0xc0, 0x23, 0x14, 0x1d, 0xc4, 0x89, 0xdd, 0xe1, 0x8e, 0xdc,
+  0xd7, 0xec, 0xd7, 0xcb, 0xb7, 0x42, 0xdd, 0xc1, 0xd3, 0xeb, 0xb7, 0x38,
+  0x88, 0xbb, 0x1d, 0xc6, 0x26, 0x2b, 0x0f, 0x11, 0xf2, 0x02, 0xb7, 0x43,
+  0x03, 0x83, 0x52, 0xae, 0x18, 0x0a, 0xe9, 0x1e, 0x97, 0xc9, 0x9c, 0x62,
+  0xd5, 0x63, 0x70, 0x8e, 0x52, 0x9d, 0x6e, 0x8f, 0x7b, 0x93, 0xe5, 0x85,
+  0xca, 0xf9, 0x47, 0x75, 0x88, 0x4e, 0xcf, 0x19, 0x6f, 0x51, 0x6b, 0xbb,
+  0xd5, 0xa1, 0x33, 0x87, 0x6d, 0x74, 0xfb, 0x3a, 0x09, 0xbb, 0xe1, 0x61,
+  0xc8, 0x47, 0x73, 0xc1, 0xcc, 0xdc, 0x40, 0x66, 0xac, 0xd3, 0x17, 0xf4,
+  0x10, 0x5d, 0x3e, 0xb5, 0x0e, 0xd8, 0x5c, 0x37, 0xbd, 0xb6, 0x37, 0x5c,
+  0x4d, 0x4d, 0x1d, 0xb5, 0xf8, 0x65, 0x1b, 0xf1, 0x52, 0x86, 0x12, 0x1b,
+  0x45, 0xce, 0xe8, 0xba, 0xe7, 0x84, 0x6d, 0x73, 0x59, 0xa6, 0x7c, 0x7d,
+  0x32, 0x77, 0x4d, 0x65, 0x9f, 0x7b, 0xba, 0xce, 0x46, 0x1d, 0xd6, 0xa6,
+  0xee, 0xc1, 0x71, 0x68, 0xe5, 0xe9, 0x13, 0xf9, 0x5e, 0x67, 0xe6, 0x86,
+  0x9f, 0x99, 0x5c, 0x61, 0xaa, 0x31, 0x4e, 0xc3, 0xbf, 0xda, 0x93, 0x23,
+  0x1f, 0x8e, 0xa1, 0xc4, 0x3f, 0x85, 0xee, 0xee, 0x77, 0x71, 0x94, 0x19,
+  0x23, 0xa2, 0x4f, 0xff, 0xb6, 0x31, 0x14, 0x73, 0x53, 0x88, 0x95, 0xfc,
+  0x49, 0x56, 0xe7, 0xa8, 0x21, 0x0c, 0xe5, 0x85, 0xd9, 0x09, 0x73, 0xd4,
+  0x8f, 0x61, 0x28, 0x5e, 0x86, 0x99, 0x39, 0x42, 0xab, 0x79, 0x08, 0xec,
+  0xf2, 0xd9, 0xcf, 0x5a, 0x17, 0x74, 0x03, 0xf2, 0xd3, 0x76, 0xed, 0x0c,
+  0x05, 0x19, 0x5f, 0x7e, 0xb9, 0x57, 0x17, 0xe3, 0x80, 0xee, 0xa0, 0x50,
+  0xa8, 0xb0, 0x5c, 0x38, 0x0a, 0x4b, 0x43, 0xb7, 0x69, 0x03, 0x6c, 0x6a,
+  0x36, 0x0a, 0x79, 0x79, 0xd9, 0xae, 0x91, 0x18, 0x98, 0xa7, 0xed, 0x4a,
+  0xc9, 0x6e, 0x08, 0xfd, 0x4a, 0x94, 0xde, 0xcf, 0x69, 0xa1, 0xde, 0xd2,
+  0x7e, 0xd6, 0x49, 0xbb, 0x50, 0x75, 0xd5, 0x4e, 0x79, 0x03, 0xa2, 0x41,
+  0xb7, 0xdc, 0x36, 0xea, 0x26, 0x5c, 0x81, 0xfa, 0x28, 0xb7, 0x70, 0x3d,
+  0xa4, 0x2b, 0x60, 0x07, 0xed, 0x01, 0x90, 0x80, 0x26, 0xf8, 0x7d, 0xa1,
+  0x2c, 0x6a, 0x1f, 0x03, 0x31, 0x02, 0xf0, 0xdb, 0x30, 0xcf, 0x5d, 0x12,
+  0x06, 0xdf, 0xb3, 0xf7, 0x87, 0x33, 0x43, 0x48, 0x44, 0x7c, 0xcf, 0x3e,
+  0x2a, 0x61, 0xd7, 0x6e, 0x7f, 0x07, 0x9e, 0x72, 0xfe, 0x28, 0x9a, 0x3b,
+  0xfe, 0xef, 0xe6, 0x6e, 0x9d, 0xbe, 0x91, 0xc2, 0xfe, 0xa4, 0xd7, 0x02,
+  0x40, 0xb0, 0x16, 0xb4, 0xcb, 0x08, 0x40, 0xa0, 0x97, 0x57, 0x57, 0x6e,
+  0x07, 0x83, 0xc8, 0x5c, 0x83, 0x34, 0xcc, 0xa3, 0x78, 0xa9, 0x21, 0xaa,
+  0xdb, 0xca, 0x3d, 0x0b, 0xf5, 0xba, 0xe3, 0x5a, 0x63, 0x08, 0x77, 0xbb,
+  0xf5, 0xc3, 0xbb, 0x25, 0xd7, 0xfc, 0x72, 0x64, 0x2d, 0xe9, 0x72, 0x2d,
+  0xb2, 0x08, 0xfc, 0x50, 0x65, 0x8e, 0xb0, 0xac, 0x0f, 0x2c, 0x4a, 0xcc,
+  0x0d, 0x7c, 0x0a, 0x8e, 0x6d, 0xb7, 0x43, 0xd2, 0x98, 0xf2, 0xac, 0x19,
+  0x97, 0x2e, 0xfa, 0x31, 0xa7, 0x4b, 0x2b, 0x2d, 0xbc, 0xe8, 0x82, 0x34,
+  0xfa, 0x0e, 0x2f, 0xd1, 0x3f, 0x44, 0x8f, 0x4f, 0xc7, 0x7a, 0x2b, 0x48,
+  0xb5, 0xea, 0xa9, 0x5b, 0x38, 0x72, 0x8a, 0x19, 0x85, 0xbf, 0x71, 0xb1,
+  0xa1, 0xa5, 0x66, 0xf5, 0xfe, 0x7c, 0xfe, 0x5c, 0x90, 0x71, 0x2a, 0x31,
+  0x4a, 0xca, 0x07, 0xfb, 0x0f, 0x7e, 0x39, 0x93, 0x0c, 0x5c, 0xb3, 0x28,
+  0x8e, 0x96, 0x33, 0xba, 0x89, 0xe0, 0x6d, 0x6d, 0x02, 0x97, 0x01, 0x4c,
+  0x0f, 0x7d, 0xc7, 0xfe, 0x53, 0xe4, 0xd2, 0xc9, 0xd8, 0xd8, 0xa7, 0xf3,
+  0xc5, 0xe1, 0xc9, 0x4b, 0x7b, 0xdb, 0x56, 0xf6, 0x3b, 0xb4, 0x6a, 0xfa,
+  0xdc, 0x82, 0x0b, 0xaa, 0xbe, 0x89, 0xf5, 0x1e, 0xec, 0xd0, 0x2a, 0x8c,
+  0xe3, 0xa4, 0xf5, 0x9a, 0x3c, 0x34, 0x6a, 0xad, 0x6a, 0xe8, 0xa8, 0x55,
+  0xce, 0x9d, 0xc8, 0x4d, 0x8a, 0x8c, 0x91, 0xee, 0x37, 0x09, 0x70, 0xc0,
+  0x2a, 0x31, 0x97, 0xb3, 0x9a, 0xda, 0x78, 0xb5, 0x8c, 0x0c, 0x98, 0x55,
+  0x81, 0x9c, 0x70, 0x7b, 0x06, 0x9b, 0xde, 0x91, 0x6a, 0xc3, 0xe5, 0x5f,
+  0x18, 0x07, 0xbc, 0x52, 0xc0, 0x60, 0x8d, 0x8a, 0xfc, 0x8e, 0x12, 0x1b,
+  0x7e, 0xfc, 0x16, 0xc3, 0xca, 0x67, 0xfa, 0xac, 0x71, 0x01, 0x0c, 0x0f,
+  0x71, 0x7d, 0x0a, 0x6d, 0x2a, 0x8c, 0x08, 0x0f, 0xa6, 0x20, 0x41, 0x67,
+  0x58, 0x4f, 0xe9, 0xb7, 0xa5, 0x14, 0x6f, 0x6b, 0x29, 0x2f, 0x08, 0x87,
+  0xc4, 0x77, 0xf8, 0xb8, 0x96, 0x4f, 0x30, 0xd4, 0x4b, 0x92, 0xa5, 0xf0,
+  0x15, 0x29, 0x64, 0x2d, 0x3d, 0x55, 0x85, 0x4a, 0x3a, 0x9a, 0x23, 0x5f,
+  0x6d, 0xde, 0xbb, 0x57, 0x9b, 0x1f, 0x6c, 0x08, 0x88, 0x10, 0x73, 0x3e,
+  0xcc, 0x9c, 0x66, 0x1a, 0xa4, 0xbb, 0x0a, 0xe6, 0xfb, 0xae, 0x5a, 0xc3,
+  0x3f, 0xe5, 0x21, 0x5e, 0x25, 0xc8, 0x96, 0xf4, 0xf3, 0x09, 0x7e, 0x19,
+  0xb9, 0x65, 0x88, 0x26, 0x53, 0xbe, 0xbe, 0x93, 0x7a, 0x98, 0x69, 0x50,
+  0x9e, 0x26, 0xee, 0x51, 0xf3, 0x9b, 0x57, 0x89, 0xf9, 0xaa, 0xef, 0xb9,
+  0x90, 0x13, 0x95, 0xc0, 0xcc, 0x2e, 0xfc, 0x85, 0x1c, 0xff, 0x84, 0x7a,
+  0xc3, 0x6e, 0xe4, 0x41, 0xfd, 0xd5, 0xcb, 0x75, 0x68, 0x11, 0xc1, 0x8b,
+  0x3f, 0x45, 0xbe, 0x46, 0x9b, 0x45, 0x7e, 0x2b, 0xf1, 0x5d, 0x31, 0x38,
+  0x57, 0x81, 0xda, 0xf1, 0x39, 0xdd, 0x63, 0x8d, 0x30, 0xc3, 0xc3, 0x8b,
+  0x8f, 0x65, 0xdf, 0x0d, 0x0f, 0xdb, 0xf4, 0x66, 0xcb, 0x98, 0x58, 0x6a,
+  0x42, 0x59, 0x4c, 0x07, 0x17, 0xed, 0xd0, 0x1d, 0x7c, 0x93, 0x25, 0xf7,
+  0x29, 0x46, 0x4f, 0xbb, 0xb8, 0xc0, 0x20, 0x01, 0x4d, 0x1b, 0x8c, 0x2c,
+  0xae, 0xfa, 0xe4, 0x5b, 0x61, 0x32, 0x0b, 0x91, 0xb5, 0x80, 0xa8, 0xa1,
+  0xa6, 0x0b, 0xcf, 0xb8, 0xaf, 0xa2, 0x71, 0x7f, 0x45, 0xe3, 0xd6, 0x8a,
+  0xb8, 0xed, 0x49, 0x5c, 0xa6, 0xd9, 0x03, 0xde, 0xca, 0x4d, 0x28, 0x95,
+  0x66, 0x95, 0x63, 0x8a, 0x86, 0x7c, 0x7f, 0xce, 0x17, 0x56, 0xcb, 0x64,
+  0x55, 0x9d, 0x73, 0x72, 0xa5, 0xfc, 0xd0, 0xbc, 0x18, 0x84, 0x95, 0x06,
+  0xee, 0xfd, 0x43, 0xbd, 0xa3, 0x17, 0x25, 0xc7, 0xd1, 0x06, 0x86, 0x47,
+  0x28, 0xbb, 0x3b, 0xa2, 0x6a, 0x6f, 0xf2, 0xaa, 0x8a, 0xf1, 0x5a, 0x29,
+  0x66, 0x8f, 0xa5, 0x20, 0xd3, 0x98, 0x5b, 0x13, 0x56, 0xe6, 0x5b, 0xbe,
+  0x38, 0x51, 0x5e, 0x36, 0x56, 0x43, 0x94, 0x0e, 0xee, 0xd2, 0x57, 0xe0,
+  0xdd, 0x15, 0xbc, 0x54, 0x76, 0xa4, 0x34, 0x13, 0x54, 0x8c, 0x07, 0x17,
+  0x5e, 0x8e, 0xf8, 0xe9, 0x63, 0x1c, 0xf5, 0xa4, 0xc8, 0xd2, 0x5d, 0x5a,
+  0x8d, 0xdc, 0xeb, 0xa5, 0x78, 0xfd, 0x1f, 0x53, 0xa3, 0x72, 0x3c, 0x4d,
+  0xbb, 0x62, 0xca, 0xa3, 0xc3, 0x7e, 0xf5, 0x6a, 0x9d, 0xab, 0x5c, 0xf5,
+  0x8d, 0xc4, 0x77, 0xd3, 0x73, 0x68, 0xf9, 0xf9, 0x27, 0x54, 0xb7, 0x99,
+  0xd0, 0x66, 0x7f, 0xb5, 0xdb, 0x3f, 0x79, 0xa9, 0x2b, 0xb1, 0xf9, 0x7a,
+  0xfe, 0x09, 0x34, 0x55, 0x96, 0xe1, 0x72, 0xa7, 0x3c, 0xde, 0xd4, 0xe2,
+  0xda, 0xfa, 0xd9, 0xa8, 0x1d, 0xde, 0xf6, 0x16, 0x59, 0xd4, 0x91, 0x2e,
+  0xde, 0x37, 0xe4, 0x2a, 0x69, 0x1b, 0x0e, 0x92, 0x92, 0xe3, 0x0e, 0x18,
+  0xf2, 0x8c, 0x0e, 0xd8, 0xec, 0xef, 0x36, 0x1e, 0x7c, 0x95, 0x52, 0x86,
+  0xc4, 0xea, 0x30, 0xe7, 0x83, 0x47, 0x84, 0x17, 0xb8, 0xfc, 0x90, 0x61,
+  0x58, 0x06, 0x43, 0x6d, 0xc1, 0x2a, 0x98, 0x13, 0x02, 0x63, 0xf0, 0x70,
+  0x46, 0xce, 0x78, 0x5a, 0x2d, 0x0a, 0xde, 0x70, 0x25, 0x56, 0x66, 0x8f,
+  0x1a, 0xe3, 0xda, 0x33, 0xb0, 0x2c, 0x04, 0x48, 0x4c, 0x15, 0xd6, 0x33,
+  0x3f, 0x0d, 0x2a, 0xca, 0xe3, 0x0e, 0xb0, 0x3a, 0x9f, 0xa4, 0x75, 0xad,
+  0x54, 0x32, 0x58, 0xf5, 0x0f, 0x9f, 0xe9, 0x88, 0xe7, 0xcf, 0xa5, 0x3e,
+  0xcc, 0x2b, 0x9c, 0x40, 0x33, 0xcb, 0xe8, 0x49, 0xf4, 0x93, 0x88, 0x07,
+  0xf4, 0x36, 0x0e, 0x68, 0x99, 0x41, 0x4e, 0x40, 0x2d, 0xcb, 0x24, 0xcf,
+  0xd5, 0xbe, 0x95, 0x55, 0xca, 0x86, 0x2e, 0xbc, 0xe7, 0x64, 0x79, 0x8d,
+  0x9e, 0x1f, 0xbd, 0x80, 0xd9, 0x09, 0x0d, 0x03, 0x66, 0xa4, 0xd5, 0x57,
+  0xb8, 0x91, 0xd6, 0x07, 0xec, 0x59, 0x09, 0xf6, 0x20, 0x33, 0xab, 0x7c,
+  0xb9, 0xa6, 0x73, 0x4b, 0xf9, 0x7c, 0xcb, 0x51, 0x80, 0x8c, 0x85, 0xc9,
+  0x55, 0x80, 0x90, 0x43, 0x90, 0x32, 0xbc, 0x9a, 0x7f, 0xdc, 0x51, 0xd8,
+  0x6f, 0x21, 0xe5, 0x67, 0x7e, 0xd2, 0x2f, 0x5c, 0x2e, 0xb4, 0xa5, 0x98,
+  0x77, 0xe0, 0x59, 0x67, 0xa7, 0xf1, 0xb8, 0x03, 0xde, 0x4b, 0x58, 0xee,
+  0xe8, 0x56, 0x2a, 0x2c, 0x27, 0x4f, 0x65, 0xed, 0xde, 0xa6, 0x1e, 0xa6,
+  0x9f, 0x76, 0x62, 0x72, 0xee, 0xa8, 0xd7, 0xfa, 0xc3, 0xf6, 0x00, 0x72,
+  0x17, 0xd0, 0x67, 0x42, 0x60, 0x58, 0xe6, 0xe3, 0x6f, 0xdb, 0xb4, 0xf5,
+  0x93, 0x74, 0x5d, 0xd4, 0xd2, 0x79, 0x11, 0x77, 0x5f, 0xa3, 0xeb, 0x66,
+  0x0d, 0xde, 0xa5, 0x39, 0xac, 0xcb, 0x80, 0x7d, 0xae, 0x1f, 0x18, 0xa3,
+  0x75, 0xba, 0xe7, 0xe0, 0x89, 0x60, 0x86, 0x9c, 0x3b, 0x11, 0x60, 0xc7,
+  0x59, 0x58, 0xed, 0x7b, 0x70, 0xf3, 0xc6, 0xa4, 0xda, 0x8d, 0x40, 0x44,
+  0xf7, 0xbf, 0xf0, 0x52, 0x9b, 0x09, 0xb1, 0x7e, 0x1e, 0x65, 0x31, 0x06,
+  0x66, 0xd0, 0xc8, 0xb5, 0x71, 0x71, 0x83, 0xcb, 0x22, 0x95, 0x6c, 0x99,
+  0x54, 0x92, 0x07, 0xa4, 0x43, 0x2a, 0x52, 0x69, 0x13, 0xc4, 0x86, 0x44,
+  0xea, 0x71, 0x89, 0x64, 0x89, 0x21, 0xaf, 0xda, 0x72, 0x76, 0xa4, 0x75,
+  0x52, 0xec, 0x13, 0x4c, 0xcc, 0x37, 0x0a, 0x0b, 0x49, 0x6a, 0xa3, 0xca,
+  0x48, 0x4e, 0x57, 0x62, 0x22, 0x6b, 0x9e, 0x6b, 0xba, 0x93, 0x61, 0x82,
+  0x4e, 0x82, 0x61, 0x51, 0x3a, 0x15, 0x8d, 0xa1, 0x33, 0x1d, 0x63, 0xb2,
+  0xc5, 0xe0, 0x84, 0xcc, 0x76, 0xbc, 0xe9, 0x00, 0xba, 0x64, 0xc7, 0xe1,
+  0x4c, 0x48, 0x6e, 0x0b, 0x1a, 0xcd, 0x3f, 0x42, 0x1b, 0xa2, 0xc7, 0x76,
+  0xae, 0x24, 0xcc, 0x76, 0xfe, 0x5c, 0x1c, 0x93, 0x21, 0xf1, 0xfd, 0xeb,
+  0x53, 0xdf, 0x85, 0xa1, 0xf5, 0x91, 0x26, 0x73, 0x97, 0x96, 0xc9, 0xfb,
+  0x57, 0xd9, 0x5b, 0x55, 0x63, 0xaa, 0x98, 0x9b, 0x8a, 0xb1, 0x23, 0xde,
+  0x51, 0xf7, 0xc2, 0x7b, 0xeb, 0x51, 0x5c, 0x4d, 0xd7, 0xe9, 0x66, 0x33,
+  0xdd, 0x4c, 0x61, 0xd8, 0xce, 0xef, 0x3f, 0x8e, 0x67, 0x75, 0x9e, 0xad,
+  0x5f, 0x39, 0xec, 0x95, 0xe9, 0x7e, 0x84, 0x0c, 0x0a, 0xd4, 0xdb, 0x27,
+  0xb3, 0x3b, 0xd6, 0x41, 0x34, 0x13, 0xc4, 0x15, 0x6b, 0x03, 0x11, 0xca,
+  0x0f, 0x06, 0xb0, 0x96, 0x63, 0x7c, 0x0d, 0x75, 0x18, 0x73, 0x42, 0x5c,
+  0xb9, 0xcb, 0xdd, 0xf3, 0xe7, 0xcb, 0x74, 0x9f, 0xef, 0x28, 0x48, 0x46,
+  0x9e, 0x6c, 0x36, 0xe9, 0x0a, 0x6d, 0x27, 0xa5, 0xdf, 0x45, 0x06, 0x84,
+  0x5b, 0xbc, 0xda, 0xe6, 0xa8, 0x0f, 0xaa, 0x44, 0xa9, 0x77, 0x88, 0x7c,
+  0x76, 0x3b, 0x05, 0x74, 0xaf, 0x4f, 0x34, 0x41, 0xea, 0xe8, 0xc5, 0x21,
+  0xc2, 0x0c, 0xa7, 0x68, 0x99, 0xdf, 0xe7, 0xb8, 0x74, 0x6c, 0x30, 0xad,
+  0x41, 0x62, 0x7e, 0xe2, 0xf0, 0xe9, 0x2a, 0x3d, 0x74, 0x5d, 0x34, 0xb8,
+  0x75, 0xfc, 0x03, 0x08, 0xde, 0x01, 0xc3, 0x93, 0x0d, 0x6d, 0xcf, 0x2d,
+  0x9a, 0xc6, 0xf5, 0xa7, 0xc2, 0xb0, 0x4d, 0x11, 0x87, 0xd4, 0x02, 0x7c,
+  0xdb, 0x61, 0x43, 0xe4, 0xcf, 0x97, 0x81, 0x93, 0x62, 0xd3, 0x8d, 0x00,
+  0xe2, 0xdf, 0x12, 0x77, 0x4c, 0x5b, 0xf7, 0x01, 0x7b, 0xcf, 0x8e, 0x12,
+  0xb1, 0x0a, 0xa4, 0x7d, 0x9e, 0x35, 0x61, 0x2e, 0x9f, 0xb6, 0x4b, 0xe9,
+  0x3a, 0x40, 0xd8, 0xc6, 0x46, 0x50, 0xa1, 0x93, 0x65, 0x3d, 0x25, 0x86,
+  0x5d, 0x34, 0x9e, 0xea, 0xac, 0x1a, 0xb1, 0x52, 0x9c, 0xf8, 0x0c, 0x85,
+  0x39, 0x18, 0x50, 0xb9, 0x54, 0xbd, 0xbc, 0xb8, 0x10, 0xa3, 0x78, 0x61,
+  0xa3, 0x97, 0xd6, 0x36, 0xcf, 0xae, 0x69, 0xc7, 0x0f, 0x60, 0xe4, 0xe5,
+  0xa3, 0x0e, 0xda, 0x9e, 0xbc, 0xf8, 0x4a, 0xee, 0x9d, 0x7e, 0x0a, 0x06,
+  0x81, 0x8d, 0x2a, 0x24, 0xf2, 0x11, 0x69, 0x22, 0xfd, 0x11, 0x09, 0xb8,
+  0x94, 0x88, 0xf8, 0xfb, 0x1a, 0x79, 0xd8, 0x6b, 0x1c, 0xaa, 0x22, 0xca,
+  0x66, 0xf8, 0x43, 0x2e, 0x64, 0x23, 0x74, 0xc3, 0x52, 0x75, 0x12, 0xd5,
+  0x4f, 0x99, 0xd4, 0xd0, 0x61, 0xa8, 0x80, 0xea, 0xb9, 0x3f, 0x19, 0x91,
+  0x3d, 0xec, 0x8a, 0xec, 0x56, 0xde, 0x1c, 0x13, 0xf9, 0x81, 0x9a, 0x6c,
+  0xd0, 0x0a, 0x2e, 0xeb, 0xc0, 0x7f, 0x64, 0xce, 0x51, 0x4f, 0x4e, 0x9c,
+  0xa1, 0xe1, 0x26, 0x67, 0x0a, 0xef, 0x77, 0x10, 0x83, 0x8a, 0x0c, 0xda,
+  0x67, 0x1a, 0x4e, 0xf8, 0x47, 0x34, 0xa0, 0x8d, 0xfe, 0x77, 0x23, 0xdf,
+  0xc6, 0xec, 0xb0, 0xb4, 0xd5, 0x5b, 0x22, 0x93, 0x3f, 0xa3, 0x93, 0x32,
+  0x1a, 0x3d, 0xc7, 0x30, 0x64, 0x02, 0x76, 0x34, 0x17, 0x0a, 0x39, 0x5d,
+  0x63, 0xbe, 0x6a, 0x77, 0x9b, 0x63, 0xa8, 0xa9, 0xd3, 0x92, 0x16, 0x7d,
+  0x89, 0x01, 0x2d, 0x5c, 0x9b, 0xc5, 0x9c, 0xe1, 0x2e, 0x9f, 0x86, 0x84,
+  0x45, 0x0b, 0x44, 0xc3, 0xff, 0x65, 0xfc, 0xb6, 0x47, 0xcd, 0x03, 0x00,
+  0xd2, 0xf1, 0xde, 0x76, 0xa9, 0x78, 0x00, 0x64, 0x61, 0x5a, 0xc8, 0x05,
+  0x18, 0xe7, 0x38, 0xad, 0x2e, 0x5e, 0xe8, 0x6b, 0xd0, 0x7e, 0xcf, 0x2d,
+  0x49, 0xf7, 0x3d, 0x74, 0x22, 0x84, 0x84, 0x69, 0x4c, 0xf7, 0x1a, 0xa5,
+  0xb1, 0xa5, 0x83, 0x53, 0xd4, 0x07, 0x3c, 0xc8, 0xb6, 0x2e, 0x06, 0xc8,
+  0x0e, 0xc5, 0xd5, 0xfb, 0xda, 0xa4, 0x99, 0x37, 0xc6, 0x3d, 0x64, 0x4b,
+  0x20, 0x22, 0x1c, 0xed, 0x8f, 0x3b, 0xb9, 0x82, 0x01, 0x2d, 0x5c, 0x1b,
+  0xc9, 0x0c, 0xd7, 0x41, 0x75, 0x1d, 0x20, 0x70, 0xb2, 0x99, 0x57, 0x83,
+  0x68, 0x37, 0x70, 0xc4, 0x21, 0x8f, 0x3b, 0x37, 0x01, 0x06, 0xb6, 0x83,
+  0xb2, 0x00, 0x4c, 0x93, 0xb8, 0x1b, 0x4a, 0x9f, 0x54, 0x1c, 0xfa, 0x88,
+  0x33, 0x70, 0x44, 0xdc, 0x4f, 0x6e, 0xaa, 0xe7, 0x9d, 0xf4, 0x19, 0x70,
+  0x0f, 0xba, 0xad, 0x93, 0x0d, 0x74, 0x47, 0x6b, 0x02, 0x30, 0x81, 0xd6,
+  0x24, 0xdf, 0xf7, 0xb7, 0x04, 0x61, 0x4c, 0x2b, 0xba, 0x3d, 0x15, 0x09,
+  0xd6, 0x07, 0x6d, 0x6d, 0x03, 0x82, 0x76, 0xd1, 0xef, 0x7f, 0x6f, 0xd2,
+  0x8e, 0xb9, 0x36, 0x7a, 0x89, 0x67, 0x20, 0xa6, 0x3e, 0xeb, 0x19, 0x03,
+  0x86, 0xf5, 0x40, 0xdb, 0x88, 0x67, 0xd0, 0x0e, 0xea, 0xeb, 0x00, 0x21,
+  0xf2, 0xfb, 0xbb, 0x3e, 0xb3, 0x5d, 0x9f, 0xf5, 0x75, 0x7d, 0x66, 0xba,
+  0x3e, 0xeb, 0xeb, 0xfa, 0xac, 0xa7, 0xeb, 0xb3, 0xbe, 0xae, 0x47, 0xcb,
+  0x78, 0xdf, 0x7a, 0x43, 0xa1, 0xfa, 0x48, 0xce, 0x39, 0xe9, 0x1f, 0xf0,
+  0x25, 0xa8, 0xd2, 0xf0, 0xa7, 0x47, 0x46, 0x22, 0x20, 0x0b, 0x49, 0x0b,
+  0xdb, 0xd6, 0x1c, 0x84, 0xfd, 0xe7, 0x2e, 0x3f, 0xd6, 0xbd, 0x46, 0xb4,
+  0x6b, 0xf3, 0x32, 0x40, 0x88, 0x91, 0x3d, 0xdb, 0xc0, 0xda, 0xe0, 0x95,
+  0x6c, 0xe6, 0xf4, 0x75, 0x9b, 0xef, 0x01, 0x17, 0xf6, 0xca, 0xb4, 0xbb,
+  0xb6, 0x02, 0xec, 0x3f, 0xb5, 0x77, 0xbc, 0xff, 0xb9, 0xd9, 0x92, 0xbc,
+  0xe8, 0x69, 0x48, 0x5e, 0xd4, 0xdb, 0x91, 0x17, 0x03, 0x9b, 0x41, 0x45,
+  0xdd, 0x12, 0xad, 0x8d, 0x00, 0xc8, 0x9f, 0xb5, 0xb7, 0xc1, 0xfb, 0xca,
+  0x4d, 0xf0, 0xbe, 0x93, 0xd6, 0x2c, 0xea, 0xba, 0x7d, 0x9e, 0x35, 0x61,
+  0xae, 0xda, 0xfd, 0x63, 0x6a, 0xdf, 0x9b, 0x5e, 0x0e, 0xeb, 0xa4, 0x48,
+  0x6f, 0xe3, 0x2a, 0xbd, 0x55, 0xe3, 0x67, 0xfd, 0xc5, 0xac, 0x0d, 0xbc,
+  0x63, 0x6f, 0xe4, 0x81, 0x5d, 0xb6, 0x3b, 0xb6, 0x8c, 0x71, 0x63, 0x3e,
+  0xa4, 0x5e, 0x06, 0xec, 0xa8, 0x51, 0x00, 0xc2, 0x75, 0x39, 0xc1, 0x94,
+  0x4d, 0x1d, 0x8d, 0xe3, 0x71, 0x0a, 0x96, 0xcd, 0x00, 0xcb, 0x65, 0x91,
+  0xdc, 0xaa, 0xfe, 0xaf, 0xc7, 0xe6, 0xc6, 0xfd, 0x6a, 0x9a, 0xaf, 0xd7,
+  0xa5, 0x0d, 0xc5, 0xf1, 0xd4, 0x6e, 0x15, 0x14, 0x94, 0x9d, 0x73, 0x7d,
+  0x30, 0x4e, 0x31, 0xd0, 0x70, 0x9d, 0x5c, 0xcf, 0xb9, 0x36, 0x0a, 0x16,
+  0xe6, 0x9f, 0xba, 0x1b, 0x90, 0xa6, 0xab, 0xc2, 0xda, 0xf8, 0x90, 0x44,
+  0xbe, 0xb3, 0xc1, 0xba, 0xcd, 0x8b, 0xc4, 0xcb, 0x26, 0xe5, 0xb4, 0x12,
+  0x8a, 0xdb, 0x3e, 0x88, 0x81, 0xc0, 0x03, 0x27, 0xa2, 0x6f, 0x1b, 0xcc,
+  0x67, 0xfe, 0x08, 0xb4, 0xc2, 0x5d, 0xf9, 0x03, 0x61, 0xb6, 0x25, 0x5e,
+  0xdd, 0x95, 0x35, 0x86, 0x48, 0xb5, 0x83, 0x18, 0xad, 0x05, 0xaa, 0x36,
+  0xf6, 0x27, 0x81, 0x0a, 0x4d, 0xf8, 0xbe, 0x3a, 0x5f, 0xc8, 0x28, 0xcc,
+  0x9d, 0xb4, 0x60, 0xd9, 0xe2, 0x36, 0x2e, 0xca, 0x28, 0x5b, 0xc0, 0xac,
+  0x2e, 0x39, 0x10, 0x19, 0xbc, 0x58, 0x08, 0x67, 0x5a, 0x2b, 0x11, 0x1a,
+  0x7f, 0x1c, 0xab, 0x4e, 0x96, 0xa3, 0x7f, 0xd1, 0x36, 0xcd, 0x92, 0x48,
+  0x30, 0xac, 0x35, 0xae, 0x2f, 0xd1, 0x23, 0x38, 0xdc, 0xe0, 0x6e, 0xfc,
+  0xcc, 0xd0, 0xfd, 0x86, 0x6b, 0xae, 0x01, 0xfd, 0xc9, 0xd3, 0x88, 0x72,
+  0x8c, 0x5c, 0xa2, 0xf1, 0x54, 0x50, 0x20, 0xad, 0x33, 0xaa, 0xd1, 0xf4,
+  0x38, 0x11, 0x48, 0xbb, 0x74, 0xad, 0xda, 0x4d, 0xc6, 0x24, 0x9b, 0x33,
+  0xa6, 0x94, 0x36, 0x4e, 0x42, 0x07, 0x61, 0x90, 0xc6, 0xcb, 0x7b, 0x42,
+  0x6e, 0x5b, 0xaa, 0xe9, 0x63, 0x04, 0x5d, 0x5b, 0x9f, 0xda, 0x58, 0x64,
+  0xe8, 0xf6, 0x0d, 0xc3, 0x42, 0xd6, 0x38, 0x2f, 0x9c, 0x0d, 0xd2, 0x32,
+  0xe5, 0x9a, 0x68, 0xd2, 0x44, 0x06, 0xe2, 0xa9, 0xfb, 0xcd, 0xb5, 0x22,
+  0x70, 0x43, 0x4f, 0xa7, 0x4e, 0x86, 0x11, 0xd8, 0xed, 0x2b, 0x85, 0x27,
+  0x74, 0x90, 0xa2, 0xe8, 0x0c, 0x36, 0x4e, 0xfe, 0x85, 0x41, 0x58, 0x87,
+  0x9f, 0xd6, 0xd4, 0xcd, 0x75, 0x94, 0xf7, 0x30, 0x5a, 0xc3, 0x0a, 0x7d,
+  0xa9, 0x27, 0x78, 0x18, 0xfc, 0x51, 0x8d, 0x73, 0xa3, 0x99, 0x6b, 0xbe,
+  0xa3, 0xaf, 0xd3, 0x56, 0x1e, 0x23, 0x1a, 0xb5, 0x25, 0x4e, 0x62, 0xc3,
+  0x60, 0x77, 0x9a, 0x7e, 0x7c, 0xfe, 0x3c, 0xd2, 0xbc, 0x98, 0x5b, 0x1b,
+  0x02, 0xd7, 0x99, 0x09, 0xf8, 0x15, 0xc3, 0xf2, 0xa7, 0x15, 0xfb, 0xdf,
+  0x68, 0x29, 0x4c, 0x6a, 0x8a, 0x67, 0xc1, 0xe4, 0x8e, 0x13, 0x47, 0xc6,
+  0x14, 0xc5, 0xbe, 0x70, 0x94, 0x86, 0x98, 0x90, 0xcc, 0xd7, 0x20, 0x0b,
+  0x2f, 0xfc, 0x31, 0x1b, 0xa3, 0x49, 0x3c, 0xaa, 0xa8, 0xff, 0xd0, 0x5e,
+  0x6f, 0x9c, 0xf2, 0xd5, 0xbe, 0x6e, 0xcc, 0x34, 0xcb, 0x84, 0x8d, 0xfd,
+  0x1b, 0x72, 0x5d, 0xa9, 0x52, 0x0c, 0x3f, 0x8a, 0xa5, 0x9a, 0xa3, 0x4e,
+  0x41, 0x98, 0x25, 0x44, 0x33, 0xd5, 0x5c, 0xb2, 0xc5, 0x16, 0x44, 0xf3,
+  0x65, 0xf4, 0x10, 0x5d, 0xd5, 0xd9, 0xc2, 0xe5, 0x0a, 0x63, 0xde, 0x9d,
+  0x5e, 0x7a, 0x80, 0x1f, 0x82, 0x47, 0x2c, 0xee, 0x7b, 0x0e, 0x0e, 0x3e,
+  0x5d, 0xa3, 0xd5, 0xe1, 0xb4, 0x91, 0x27, 0x72, 0xb4, 0x1e, 0x45, 0xa3,
+  0x92, 0x45, 0x31, 0x26, 0x4e, 0x49, 0x0a, 0x3e, 0x67, 0x45, 0xc7, 0xe7,
+  0xe8, 0x9c, 0x0a, 0xc1, 0x4f, 0x32, 0x50, 0x44, 0xe7, 0x9f, 0x48, 0xc5,
+  0xd1, 0xf3, 0x68, 0xfd, 0xed, 0x3e, 0x22, 0x70, 0x4a, 0x7a, 0x80, 0xf8,
+  0x93, 0x7d, 0xbe, 0x8b, 0x4c, 0x48, 0x66, 0x8e, 0xd1, 0x6e, 0x8f, 0x97,
+  0xeb, 0xbe, 0x29, 0xd3, 0x65, 0x94, 0xa8, 0x23, 0xc9, 0x77, 0x53, 0xae,
+  0xe8, 0x7c, 0x4a, 0xce, 0xd9, 0xe9, 0xe6, 0x21, 0x76, 0x89, 0x58, 0x46,
+  0xe7, 0xc9, 0x4c, 0x53, 0xd4, 0x19, 0x53, 0x8d, 0x65, 0x3c, 0xcb, 0xe0,
+  0x94, 0x06, 0x53, 0x6b, 0x06, 0x04, 0xca, 0x1e, 0x33, 0x0f, 0x35, 0xb7,
+  0x12, 0xf1, 0x41, 0x03, 0x91, 0x6a, 0x00, 0x3e, 0x07, 0x86, 0x08, 0xfa,
+  0x84, 0xf1, 0x60, 0x34, 0x2d, 0xeb, 0x05, 0x3a, 0x01, 0xd5, 0x5d, 0xc3,
+  0xe9, 0x65, 0x6d, 0x56, 0x6a, 0x3e, 0x87, 0x74, 0x53, 0x57, 0xcd, 0x1c,
+  0x83, 0x0f, 0x02, 0x79, 0x8a, 0x1c, 0x46, 0xb4, 0x6d, 0xc0, 0xf7, 0xe4,
+  0x3c, 0xa5, 0xda, 0x65, 0x8a, 0xd7, 0x28, 0x31, 0x02, 0x42, 0xdd, 0x75,
+  0xdc, 0x0a, 0x43, 0x88, 0xed, 0x5a, 0x40, 0xad, 0xc5, 0xc0, 0xaa, 0x8e,
+  0x97, 0x22, 0x85, 0x72, 0xb4, 0x8b, 0xc4, 0xf4, 0xa5, 0x3d, 0xac, 0x45,
+  0xc8, 0x19, 0xb0, 0xb3, 0x59, 0x32, 0x22, 0x75, 0x1f, 0x53, 0x13, 0x21,
+  0xfb, 0xb4, 0x05, 0x4a, 0x4c, 0x93, 0xef, 0x65, 0x1d, 0xe1, 0x57, 0x9c,
+  0x6b, 0xcb, 0xe4, 0x59, 0x64, 0x07, 0x06, 0xed, 0x59, 0x06, 0x39, 0xe5,
+  0x20, 0x86, 0x33, 0x63, 0x7f, 0x35, 0x9f, 0x7c, 0x43, 0x62, 0x7d, 0x5c,
+  0x08, 0x44, 0xfb, 0xc2, 0xed, 0x33, 0x1d, 0xad, 0x84, 0x02, 0x22, 0xd6,
+  0xfa, 0xdf, 0x94, 0x08, 0x4b, 0x59, 0xc7, 0xec, 0x8b, 0x6e, 0x51, 0xa1,
+  0xaa, 0xbd, 0x9a, 0xdb, 0xea, 0x0d, 0x70, 0x8a, 0x96, 0x08, 0xb7, 0xe1,
+  0x64, 0x18, 0xfb, 0x34, 0x61, 0x03, 0x23, 0xcf, 0x15, 0x75, 0x34, 0x8e,
+  0x9b, 0x65, 0x18, 0xc2, 0xe9, 0x6e, 0xc7, 0x09, 0x14, 0x5a, 0x54, 0x34,
+  0x4d, 0x97, 0x6b, 0xbd, 0x29, 0x69, 0x9e, 0x66, 0xf5, 0xef, 0xcf, 0xda,
+  0xb7, 0x1a, 0xde, 0xd7, 0x86, 0xf5, 0x71, 0x9d, 0x1b, 0xab, 0x9d, 0xf3,
+  0x1c, 0x80, 0x79, 0xd6, 0x73, 0xf6, 0xbb, 0x74, 0x52, 0x7c, 0x8a, 0x24,
+  0xe6, 0x2f, 0x6e, 0x08, 0x52, 0xa2, 0x4e, 0xec, 0xf3, 0x53, 0x2c, 0x12,
+  0x0c, 0x63, 0xca, 0x71, 0xe2, 0xfb, 0x91, 0x15, 0x6d, 0xc8, 0x78, 0x5d,
+  0x42, 0xa7, 0x27, 0x18, 0x84, 0xd3, 0x0a, 0x96, 0xbb, 0xb4, 0x4a, 0x38,
+  0x52, 0x7f, 0x53, 0x52, 0xa1, 0x91, 0xbf, 0xe1, 0xc2, 0x3d, 0x77, 0x62,
+  0xb4, 0x22, 0x84, 0x1c, 0x33, 0x8c, 0x3c, 0xde, 0x0a, 0xa0, 0x4a, 0x43,
+  0x01, 0xbe, 0x6b, 0xc8, 0x30, 0x63, 0xce, 0x00, 0x74, 0x4c, 0x98, 0xe0,
+  0x91, 0x8c, 0xc9, 0xd2, 0x17, 0xf6, 0x48, 0x5c, 0x9c, 0x3c, 0x4d, 0x12,
+  0xe2, 0x11, 0x28, 0x00, 0xe8, 0x55, 0xb9, 0xdf, 0x8d, 0x66, 0xce, 0xd1,
+  0xb9, 0x71, 0x75, 0x15, 0x04, 0x6c, 0xc1, 0xbb, 0x8c, 0xcc, 0x29, 0x37,
+  0xaf, 0x13, 0x7c, 0xb4, 0xa1, 0xef, 0xa2, 0x00, 0x76, 0x50, 0x3a, 0x2d,
+  0x7a, 0x53, 0xb8, 0x0d, 0xbb, 0x7f, 0x64, 0x2e, 0xe8, 0xcd, 0xcb, 0x47,
+  0xd6, 0x89, 0xd1, 0xa9, 0xa2, 0xac, 0x92, 0x83, 0xa9, 0xc2, 0x45, 0xa1,
+  0xc5, 0xcd, 0x99, 0x7a, 0xa8, 0xf4, 0x3e, 0xb9, 0xaf, 0x2c, 0x81, 0x0a,
+  0x5b, 0x27, 0xb0, 0x4c, 0xef, 0x3b, 0x70, 0x54, 0xdb, 0xe2, 0xe8, 0xf4,
+  0xa1, 0xc0, 0xd6, 0x71, 0xb0, 0xe0, 0x2c, 0x41, 0x11, 0xde, 0x37, 0x9a,
+  0x48, 0x37, 0x0d, 0xc9, 0xb4, 0x43, 0x9e, 0x61, 0x2e, 0x54, 0x4b, 0x9d,
+  0xb4, 0x20, 0xd8, 0x4a, 0x49, 0x50, 0x79, 0xc5, 0x18, 0x73, 0xd5, 0x2c,
+  0xc9, 0x62, 0xde, 0x1d, 0x73, 0xaf, 0x50, 0x14, 0xa8, 0x6c, 0x9d, 0x5b,
+  0xf0, 0x04, 0x27, 0xc5, 0x36, 0x3c, 0x0f, 0x95, 0x9f, 0x7d, 0x1e, 0x1c,
+  0xc6, 0x71, 0x44, 0xae, 0x05, 0x4a, 0xf7, 0x01, 0xb6, 0xf9, 0xc7, 0x98,
+  0x0c, 0x19, 0x93, 0x86, 0x94, 0xd1, 0x1c, 0x0c, 0xfb, 0xc3, 0x7f, 0xeb,
+  0x20, 0xe2, 0x9d, 0xf9, 0x91, 0x68, 0x61, 0xaa, 0x30, 0xdf, 0x8d, 0x84,
+  0xcd, 0x6e, 0xf6, 0x4d, 0x73, 0x21, 0x73, 0xe1, 0xa7, 0x64, 0x30, 0xa6,
+  0xf0, 0xbb, 0x35, 0x73, 0xb1, 0xb7, 0xf4, 0x61, 0x91, 0x41, 0xb8, 0x19,
+  0x12, 0xb0, 0x02, 0xca, 0x10, 0x3a, 0x74, 0xfc, 0x3a, 0x13, 0x44, 0xd0,
+  0xab, 0x87, 0x33, 0x66, 0xcd, 0xc6, 0xe0, 0x66, 0x94, 0x57, 0xba, 0xe5,
+  0x4e, 0xd1, 0xda, 0x24, 0xe4, 0xaa, 0x65, 0xc1, 0xe2, 0xec, 0xac, 0xb1,
+  0x26, 0x2b, 0x50, 0x75, 0x0a, 0xbb, 0x15, 0x15, 0x13, 0xff, 0x12, 0x40,
+  0xb6, 0xcc, 0x5e, 0x4e, 0xdf, 0x7e, 0x3a, 0x7b, 0xfb, 0x69, 0xf4, 0xe2,
+  0x09, 0xfe, 0x60, 0x4f, 0x7f, 0x2f, 0x2e, 0xf8, 0xc0, 0x44, 0xa3, 0x66,
+  0x2b, 0x28, 0x9a, 0x96, 0xd7, 0x42, 0xef, 0x66, 0xa6, 0xf0, 0x7d, 0x20,
+  0x6d, 0x43, 0x23, 0xc8, 0x70, 0x96, 0xf8, 0x9d, 0x11, 0x32, 0xf9, 0xc7,
+  0xcb, 0x24, 0x0b, 0x42, 0xd5, 0x3b, 0x94, 0xd6, 0x57, 0xbc, 0x93, 0x14,
+  0x0e, 0x2c, 0x2e, 0x27, 0xd1, 0xf0, 0x7f, 0x3c, 0x17, 0x6d, 0xda, 0x30,
+  0xe6, 0xc5, 0xeb, 0x74, 0x9f, 0xc2, 0x3e, 0x36, 0xd3, 0xd4, 0x83, 0xd1,
+  0xe3, 0x6f, 0x2e, 0x66, 0xc8, 0x9b, 0x0d, 0x07, 0x0e, 0x53, 0x51, 0xad,
+  0xde, 0x06, 0x5d, 0xbb, 0x07, 0xcc, 0x2a, 0x93, 0xc5, 0x46, 0xb0, 0x3e,
+  0xfe, 0x68, 0x85, 0x59, 0x47, 0xe9, 0xae, 0x44, 0x5a, 0x6e, 0xe7, 0x50,
+  0xea, 0x70, 0xac, 0xbc, 0x5d, 0xd3, 0x19, 0xb9, 0xdc, 0xcc, 0x57, 0x69,
+  0xb1, 0xc2, 0x34, 0xe4, 0x2c, 0xd5, 0xe0, 0xab, 0xcf, 0x51, 0xc1, 0x00,
+  0xf8, 0x3c, 0x41, 0x29, 0xdb, 0x43, 0xc1, 0xb1, 0xd7, 0x1b, 0xbb, 0x14,
+  0x62, 0xaf, 0x40, 0xd9, 0x47, 0x8e, 0xee, 0x7c, 0xcf, 0x5b, 0x9f, 0x6a,
+  0x4b, 0xca, 0xef, 0x94, 0x6e, 0x17, 0x6c, 0xc3, 0x5b, 0xa0, 0x19, 0x5d,
+  0x2b, 0x9a, 0x97, 0xd8, 0xc3, 0x8f, 0xbf, 0xd9, 0x71, 0x6a, 0xb1, 0xbb,
+  0xfb, 0x55, 0x0e, 0x10, 0xab, 0x0a, 0x90, 0x99, 0x6b, 0xa5, 0x81, 0x68,
+  0xfc, 0x80, 0x75, 0xf5, 0x92, 0x32, 0x24, 0xce, 0xa5, 0xc0, 0x9c, 0xaa,
+  0xc7, 0x1c, 0x39, 0x5c, 0xe9, 0x4a, 0x2f, 0xa6, 0xe2, 0x3b, 0x6d, 0x4b,
+  0x57, 0x1f, 0x72, 0xe7, 0x53, 0x5a, 0xf6, 0xb3, 0x38, 0xab, 0xe6, 0xdc,
+  0xfd, 0x0f, 0x57, 0xeb, 0x33, 0x20, 0x5a, 0x06, 0xc3, 0xb3, 0x91, 0x02,
+  0xe8, 0x42, 0x80, 0x40, 0xbc, 0x1f, 0x1c, 0x3d, 0xf4, 0x91, 0x6c, 0xc5,
+  0x60, 0x31, 0xa9, 0x30, 0x81, 0xe8, 0x3e, 0xdf, 0x27, 0xfe, 0x66, 0x72,
+  0x6c, 0xb0, 0x0b, 0xd7, 0xd7, 0x4a, 0xc4, 0xe5, 0x2a, 0x4d, 0x5b, 0x8b,
+  0x54, 0xee, 0x97, 0x26, 0xb9, 0x41, 0x8c, 0xc6, 0x2a, 0xf9, 0xee, 0xf8,
+  0x6c, 0xf3, 0x15, 0xab, 0xb9, 0x73, 0xaf, 0x66, 0xa6, 0x68, 0xf4, 0x87,
+  0xfd, 0xeb, 0x7d, 0x7e, 0xb7, 0x8f, 0xb4, 0x47, 0xd0, 0x8f, 0x7d, 0xe4,
+  0xd7, 0x48, 0x74, 0x1c, 0x19, 0x4e, 0x47, 0xa4, 0xd2, 0xd0, 0x18, 0x8f,
+  0x24, 0x3e, 0x86, 0x5c, 0x67, 0x5a, 0xa0, 0x73, 0x70, 0x56, 0xb1, 0xfd,
+  0x12, 0xd7, 0x84, 0xb2, 0x8a, 0x2b, 0xbc, 0x52, 0xbd, 0x7a, 0x1d, 0xdf,
+  0x70, 0x06, 0x9a, 0x50, 0x02, 0x13, 0xbd, 0x32, 0xd5, 0xb4, 0x28, 0xf8,
+  0x82, 0x48, 0x3c, 0xa9, 0xb3, 0x23, 0x5f, 0x36, 0x72, 0x1c, 0x7a, 0xd0,
+  0x81, 0xc7, 0xbf, 0x81, 0x80, 0xe6, 0x15, 0xdf, 0x80, 0x8b, 0x62, 0xa5,
+  0x7c, 0x64, 0x76, 0xdc, 0xcb, 0x63, 0x9a, 0xad, 0xe7, 0xe8, 0xe1, 0x9f,
+  0xb0, 0x2c, 0x0b, 0xba, 0xd2, 0x17, 0x51, 0x62, 0x9d, 0xea, 0x13, 0x67,
+  0x7a, 0xa1, 0x03, 0x11, 0xaf, 0x6c, 0x29, 0x4f, 0x43, 0xa0, 0x80, 0x0d,
+  0x46, 0xd4, 0x6b, 0x3b, 0x23, 0x87, 0x76, 0x88, 0xd8, 0x4b, 0xc7, 0x75,
+  0xee, 0xd4, 0x8d, 0x9a, 0x43, 0x1a, 0x71, 0x9b, 0x66, 0xb3, 0x99, 0x57,
+  0x81, 0x22, 0x22, 0xf3, 0xd1, 0x77, 0x35, 0x1c, 0x9c, 0x64, 0x79, 0xd7,
+  0x06, 0x7e, 0x3a, 0xd5, 0x4b, 0x86, 0x64, 0xe0, 0x33, 0x9d, 0xec, 0x17,
+  0xe1, 0xe9, 0xbf, 0x6b, 0x49, 0xb9, 0x53, 0x3b, 0xd3, 0x69, 0x8c, 0x72,
+  0x7d, 0xfc, 0x5a, 0xa4, 0x74, 0x2c, 0x84, 0x04, 0x43, 0x85, 0x80, 0xf8,
+  0x1a, 0x7f, 0xe2, 0xfa, 0x82, 0xc1, 0xbc, 0x53, 0xaf, 0x53, 0x8a, 0x3e,
+  0xd0, 0xf8, 0xba, 0xd2, 0xaf, 0x5f, 0x46, 0x8e, 0xfd, 0x6a, 0x3a, 0xbe,
+  0x49, 0xf6, 0x5c, 0xd1, 0x23, 0xb1, 0x9f, 0x89, 0x51, 0x6d, 0x16, 0x99,
+  0x7b, 0x89, 0x69, 0xf4, 0x57, 0xf8, 0xb5, 0xd3, 0x64, 0x5d, 0xa7, 0x50,
+  0xa6, 0x5a, 0xa8, 0xf0, 0x3f, 0xbf, 0xa7, 0xef, 0x62, 0x4d, 0x03, 0xc2,
+  0xa0, 0x26, 0x7a, 0x76, 0x83, 0x1d, 0x18, 0x6d, 0x01, 0x1b, 0xf4, 0x65,
+  0xe8, 0x0e, 0xfc, 0x38, 0xf6, 0x2e, 0x77, 0x7a, 0xbf, 0xbc, 0x49, 0x93,
+  0xc3, 0xd6, 0x27, 0x3f, 0xe4, 0xd9, 0x83, 0xcd, 0x31, 0x14, 0x9e, 0x20,
+  0x87, 0x7c, 0xb5, 0xdd, 0xc6, 0x3b, 0xb4, 0xcf, 0x85, 0x66, 0x48, 0x6d,
+  0x7a, 0xbc, 0x76, 0x43, 0x1e, 0xd4, 0x6c, 0xdc, 0x99, 0xb1, 0x57, 0x04,
+  0xae, 0x0f, 0xa6, 0xce, 0x21, 0x35, 0xaf, 0x11, 0x68, 0x07, 0xc7, 0x00,
+  0xf6, 0xd3, 0x9d, 0xcd, 0xb6, 0x6c, 0x4d, 0x1e, 0xcc, 0x3b, 0xfb, 0x76,
+  0xaf, 0xcd, 0x9a, 0xfb, 0x18, 0xde, 0xa9, 0x74, 0xed, 0xe8, 0x82, 0xe0,
+  0xf5, 0x70, 0x04, 0x6a, 0x46, 0xd7, 0x0f, 0xcd, 0xbe, 0x77, 0xba, 0xaa,
+  0xd1, 0x77, 0x2d, 0xdc, 0x69, 0x87, 0x21, 0xc4, 0x9f, 0x00, 0x67, 0x94,
+  0x21, 0x37, 0x1d, 0x27, 0xca, 0x4b, 0xf9, 0x80, 0x56, 0x0b, 0x03, 0x76,
+  0x5a, 0x43, 0x4a, 0x02, 0x59, 0x0b, 0xa9, 0x7d, 0xe8, 0xdd, 0xc7, 0x66,
+  0xb3, 0x0f, 0x0d, 0x4e, 0xdb, 0xc8, 0x90, 0xeb, 0x25, 0xc8, 0x95, 0xab,
+  0xc8, 0x90, 0xe9, 0xed, 0x82, 0xfc, 0x61, 0x4f, 0xd8, 0x3a, 0x86, 0xf9,
+  0x8b, 0xd5, 0x73, 0x9b, 0x37, 0x17, 0xb6, 0x30, 0xdb, 0x1c, 0x43, 0x85,
+  0x87, 0x94, 0xad, 0x8f, 0x38, 0xd1, 0x46, 0xff, 0x5c, 0x3a, 0x70, 0x62,
+  0xbc, 0xec, 0x65, 0x86, 0x3b, 0x4c, 0x6b, 0x16, 0x6a, 0x9e, 0x9f, 0xe8,
+  0xd5, 0x8f, 0x73, 0xe1, 0x94, 0x7a, 0xe6, 0xd6, 0xe9, 0xa4, 0x69, 0x98,
+  0x09, 0xa0, 0xb3, 0x65, 0xa1, 0x4b, 0xe9, 0x78, 0xc1, 0xc5, 0xaf, 0x08,
+  0xc1, 0x24, 0x61, 0xae, 0xb9, 0x53, 0x9a, 0xce, 0x54, 0x94, 0xb3, 0xe5,
+  0xaf, 0x49, 0xa1, 0x35, 0x94, 0x9a, 0x36, 0x8e, 0xce, 0x87, 0x51, 0xf7,
+  0xc4, 0x92, 0xe7, 0x46, 0x01, 0x19, 0x3e, 0xe2, 0x12, 0x74, 0xc6, 0x8e,
+  0xa2, 0x7b, 0x26, 0x55, 0x9f, 0x66, 0x87, 0xc6, 0x1c, 0x9d, 0xeb, 0x7e,
+  0x76, 0x48, 0x9b, 0x7f, 0xea, 0xb6, 0xb9, 0xd6, 0xd4, 0xa6, 0x40, 0xe0,
+  0x4b, 0xd6, 0xcd, 0x09, 0x9d, 0xeb, 0x08, 0xc0, 0x3c, 0x9a, 0x1f, 0xe2,
+  0xb4, 0x78, 0xc4, 0x06, 0xfa, 0xe9, 0x38, 0x8b, 0x6f, 0x8e, 0x49, 0x51,
+  0x24, 0xd1, 0xe8, 0x8b, 0x51, 0xf4, 0xd4, 0x54, 0xc0, 0x87, 0x41, 0x8c,
+  0x7f, 0x32, 0x00, 0x66, 0x9c, 0x25, 0xb0, 0x60, 0xac, 0x8b, 0x64, 0x71,
+  0x88, 0x46, 0xaf, 0xda, 0x31, 0x0d, 0x81, 0xb2, 0xb8, 0xbe, 0x8f, 0x46,
+  0xff, 0xab, 0x1f, 0x57, 0x17, 0xd4, 0x18, 0x94, 0xf9, 0xe5, 0x43, 0xb9,
+  0x4d, 0x6e, 0x17, 0xd0, 0x47, 0x5f, 0xb7, 0x22, 0x1b, 0x06, 0xe6, 0x60,
+  0x3b, 0x82, 0xb2, 0x37, 0x00, 0x5b, 0x17, 0xd8, 0x78, 0x8b, 0xb9, 0x4e,
+  0x31, 0xa0, 0xe4, 0xbf, 0xb5, 0x62, 0xea, 0x07, 0x19, 0x97, 0x07, 0x00,
+  0x4a, 0x61, 0x05, 0x5e, 0x2c, 0x93, 0xb2, 0x4c, 0xb2, 0xc5, 0x5f, 0xa3,
+  0xd1, 0xff, 0x6c, 0x45, 0xf8, 0x4e, 0xd0, 0x4d, 0xdc, 0x0f, 0xd1, 0xe8,
+  0xff, 0x0c, 0xc7, 0xdd, 0x05, 0x0d, 0xda, 0x7d, 0x99, 0xaf, 0x16, 0x0d,
+  0x8e, 0x00, 0x18, 0x86, 0xbd, 0x72, 0x30, 0xbf, 0x03, 0x6c, 0x1d, 0xaf,
+  0x72, 0xc7, 0x10, 0xbc, 0x5d, 0xb0, 0xe3, 0xbf, 0xc6, 0xab, 0x7c, 0x99,
+  0x3a, 0x75, 0xe3, 0x79, 0x12, 0x4c, 0xaa, 0x67, 0x0e, 0xbe, 0x01, 0x30,
+  0xa8, 0x58, 0x2d, 0x6a, 0x33, 0x0a, 0xeb, 0xab, 0x7c, 0xca, 0x06, 0x41,
+  0x39, 0xe3, 0xb3, 0x8d, 0x8b, 0x5d, 0xbe, 0x4f, 0x57, 0xd2, 0xe3, 0xb6,
+  0x05, 0xd1, 0xb3, 0xe0, 0x08, 0x0d, 0x82, 0x1f, 0x83, 0x5a, 0x5a, 0xc4,
+  0xa6, 0x50, 0x34, 0xfa, 0x65, 0x0b, 0xb5, 0x03, 0xe1, 0x3c, 0x7a, 0xf7,
+  0xaf, 0x93, 0xec, 0x52, 0x18, 0x1b, 0x37, 0x4f, 0x08, 0xde, 0xc2, 0x4e,
+  0xfd, 0xc0, 0x0d, 0xcc, 0x57, 0x75, 0xe0, 0xab, 0x0e, 0xcc, 0x21, 0x60,
+  0xb5, 0xa8, 0xd1, 0x66, 0x50, 0xf3, 0xd0, 0x16, 0x91, 0x15, 0xa1, 0x36,
+  0x1f, 0x6d, 0x5d, 0x4b, 0x19, 0x5a, 0xb2, 0xae, 0xd7, 0xb0, 0x32, 0xe3,
+  0xc0, 0xcd, 0x38, 0x83, 0x26, 0x65, 0xd1, 0xfc, 0x1a, 0xf3, 0x61, 0x8b,
+  0x69, 0x50, 0xb7, 0x97, 0xe5, 0xf1, 0x70, 0x20, 0x67, 0x85, 0x3d, 0xe8,
+  0x5b, 0xf3, 0x68, 0x05, 0x0a, 0xcd, 0x93, 0x43, 0x5c, 0xe2, 0x05, 0x5d,
+  0xcc, 0xa6, 0x4c, 0x4e, 0x95, 0x79, 0xf1, 0x9a, 0x70, 0x88, 0xa2, 0xb6,
+  0x43, 0xe3, 0xda, 0xf8, 0x80, 0xe7, 0xf8, 0x8b, 0x63, 0x99, 0x94, 0x8b,
+  0x43, 0x91, 0xee, 0x92, 0x05, 0xa8, 0x21, 0x0b, 0xeb, 0x1a, 0x51, 0xb2,
+  0xd5, 0xa4, 0x59, 0x82, 0x81, 0xf9, 0xee, 0xe2, 0xb3, 0x10, 0x00, 0xa1,
+  0xc4, 0xc5, 0x6a, 0xbd, 0x30, 0xfe, 0x1b, 0xe5, 0x50, 0xec, 0xf4, 0x0f,
+  0x7a, 0xdf, 0x48, 0xfc, 0x0b, 0x5a, 0xb4, 0x4e, 0x75, 0xb7, 0x71, 0xfa,
+  0x66, 0x7c, 0xff, 0x06, 0xff, 0x7d, 0xa0, 0x7f, 0x7f, 0x78, 0x33, 0x73,
+  0x8c, 0x15, 0xd4, 0xcd, 0xa7, 0x93, 0x03, 0xd5, 0x82, 0xb7, 0x55, 0xfc,
+  0xa1, 0xd1, 0xf7, 0xb3, 0x5a, 0x81, 0x71, 0x7f, 0x81, 0xc6, 0xf6, 0x41,
+  0x4b, 0x04, 0xc3, 0x4d, 0xa2, 0x73, 0x5c, 0x6f, 0xe7, 0xa2, 0x39, 0xe2,
+  0x99, 0x73, 0xf5, 0xd8, 0xd8, 0xb9, 0x65, 0x13, 0x27, 0xc6, 0x68, 0xba,
+  0xfd, 0x69, 0x4d, 0xee, 0x94, 0x21, 0x53, 0x38, 0x58, 0xaa, 0x7b, 0xf1,
+  0x31, 0x6c, 0x18, 0x9a, 0x43, 0xa3, 0xb6, 0x44, 0xc9, 0x02, 0x29, 0xe6,
+  0x3a, 0xea, 0xcd, 0x7d, 0xd3, 0x4a, 0x37, 0x3a, 0x75, 0xc2, 0x7b, 0x54,
+  0xf5, 0xa2, 0xac, 0x5c, 0x4c, 0x47, 0x50, 0x72, 0x34, 0x1b, 0x39, 0xea,
+  0xa7, 0xd1, 0x0f, 0x6b, 0x89, 0xc7, 0x9c, 0x70, 0x22, 0x6a, 0x90, 0x83,
+  0x21, 0x45, 0xc3, 0xfd, 0x99, 0x51, 0x55, 0xd8, 0x19, 0x74, 0xa4, 0x1e,
+  0xbb, 0x26, 0x41, 0x76, 0xe7, 0x0d, 0x42, 0xc6, 0x79, 0xb0, 0xc8, 0xdd,
+  0x30, 0x89, 0xa2, 0xeb, 0x60, 0x3f, 0x35, 0x06, 0xa1, 0x8f, 0x1d, 0x51,
+  0x8d, 0x7b, 0x41, 0xed, 0xc8, 0xd0, 0x2b, 0xf1, 0x23, 0xc7, 0xf3, 0x26,
+  0xd0, 0xb7, 0x76, 0xac, 0x64, 0xa8, 0x9c, 0x90, 0x00, 0xd3, 0x5b, 0xa3,
+  0xd6, 0x3d, 0x3e, 0xf5, 0x4c, 0xc4, 0x38, 0xb1, 0x83, 0x5c, 0xae, 0x27,
+  0x23, 0x36, 0x29, 0xb8, 0x0e, 0xee, 0x4b, 0xc3, 0x21, 0xfb, 0x99, 0x79,
+  0xbc, 0x35, 0x3d, 0x31, 0x85, 0x4d, 0x58, 0x81, 0x2e, 0xb6, 0xbf, 0x85,
+  0x59, 0x9e, 0xec, 0xf3, 0xe3, 0xcd, 0x36, 0x92, 0x21, 0x2d, 0x31, 0x0e,
+  0x5f, 0x70, 0x4a, 0x55, 0xb9, 0x35, 0x4d, 0x79, 0x99, 0xe1, 0x1d, 0xf5,
+  0x17, 0xb4, 0x45, 0xf6, 0x74, 0x42, 0x4b, 0x8c, 0xa1, 0xc0, 0x71, 0x3c,
+  0x50, 0xd6, 0x90, 0x81, 0xf7, 0xf8, 0x4b, 0x34, 0x58, 0x39, 0xe3, 0xa7,
+  0x22, 0x0d, 0x86, 0x53, 0x23, 0xcd, 0xac, 0x97, 0x9b, 0xd2, 0x97, 0x35,
+  0x86, 0xea, 0xe1, 0x92, 0x00, 0x6f, 0xb0, 0x6f, 0xd9, 0xa1, 0xb9, 0xeb,
+  0x65, 0x8e, 0x39, 0x89, 0xea, 0xa1, 0x88, 0xba, 0x28, 0x18, 0x56, 0xbf,
+  0x5f, 0xfb, 0x74, 0xe4, 0x15, 0x0e, 0x24, 0xa8, 0x73, 0xf6, 0x2e, 0xb6,
+  0xf4, 0xac, 0x46, 0xa9, 0x67, 0xeb, 0x78, 0x95, 0xe5, 0x55, 0x85, 0xfb,
+  0x54, 0x59, 0x00, 0x3c, 0x43, 0x87, 0x44, 0x6e, 0x13, 0x0f, 0x2c, 0xae,
+  0xd4, 0x3c, 0x35, 0xe5, 0x19, 0x7e, 0x1a, 0x66, 0x29, 0x24, 0x48, 0xdf,
+  0x4c, 0x48, 0x75, 0x39, 0x76, 0x42, 0xb3, 0x0b, 0x87, 0x1d, 0x14, 0x7e,
+  0x23, 0xa0, 0xda, 0x01, 0x82, 0xbf, 0xe5, 0x7d, 0x1b, 0x47, 0x6f, 0x63,
+  0xda, 0xf1, 0xc2, 0x9f, 0x51, 0x84, 0x75, 0x10, 0x52, 0xaa, 0x1f, 0x7e,
+  0xc9, 0xe1, 0x58, 0x1f, 0x12, 0x1f, 0x83, 0x57, 0xd8, 0x3d, 0x18, 0xa4,
+  0x93, 0xa5, 0x74, 0x17, 0xdf, 0x24, 0xf3, 0x55, 0x7e, 0xc4, 0xc0, 0x32,
+  0x67, 0xd1, 0x53, 0x75, 0x83, 0xf8, 0x14, 0xba, 0x33, 0xad, 0xe8, 0x80,
+  0x84, 0x10, 0xa0, 0xef, 0x68, 0x1c, 0x5d, 0xdc, 0xec, 0x8f, 0x07, 0xe8,
+  0xef, 0x68, 0x93, 0x52, 0xfc, 0x08, 0xd3, 0x79, 0xf8, 0x72, 0x2e, 0x1f,
+  0xf1, 0x1b, 0xf7, 0x98, 0x7a, 0x09, 0xef, 0x57, 0x1b, 0x3c, 0xc3, 0x9a,
+  0x13, 0xd4, 0xfe, 0xb8, 0x3b, 0x93, 0x0f, 0x2e, 0xdd, 0xbb, 0xf8, 0x3e,
+  0x3f, 0x56, 0x8b, 0xb7, 0x6b, 0xf8, 0x9f, 0x56, 0x33, 0xa2, 0x95, 0xe9,
+  0x90, 0xae, 0x67, 0xb5, 0xe2, 0x3d, 0x54, 0xae, 0xe3, 0x2a, 0x0e, 0x93,
+  0x88, 0x5f, 0x3e, 0x00, 0x7d, 0x88, 0xa6, 0x9b, 0x38, 0xbf, 0x5a, 0x5b,
+  0xe5, 0x4f, 0x4c, 0x04, 0x83, 0x69, 0x79, 0xdc, 0x6c, 0x8c, 0x3b, 0xb3,
+  0x10, 0xe1, 0x0f, 0x87, 0x7c, 0x22, 0x14, 0x98, 0x5b, 0x9e, 0xf0, 0x10,
+  0x3f, 0x61, 0xd9, 0xc6, 0x01, 0x9d, 0x47, 0xe2, 0x61, 0x7f, 0xe3, 0x52,
+  0x58, 0x47, 0x6c, 0xfc, 0x04, 0xdb, 0x10, 0x74, 0x14, 0xb6, 0xce, 0x32,
+  0x18, 0x79, 0x77, 0x54, 0xc2, 0x86, 0x1a, 0xc0, 0xb7, 0x31, 0x89, 0xd4,
+  0xa5, 0xc6, 0x3f, 0xa5, 0xb0, 0x45, 0xa3, 0x75, 0x0c, 0x5b, 0x3f, 0xf8,
+  0x0a, 0x1f, 0xcb, 0x3c, 0xdf, 0xe3, 0x5f, 0x6c, 0xce, 0x74, 0x86, 0xe6,
+  0xfb, 0xa2, 0x62, 0xb3, 0xa4, 0x4e, 0x5d, 0x3a, 0xe0, 0xc5, 0x60, 0x00,
+  0x74, 0x33, 0x1c, 0x20, 0x1e, 0x32, 0x72, 0x32, 0x8d, 0xf7, 0xa6, 0x16,
+  0x14, 0xf2, 0x20, 0x93, 0xcb, 0xd1, 0x85, 0x73, 0xee, 0xc2, 0xbd, 0x0c,
+  0x2b, 0x53, 0x12, 0xef, 0xe8, 0x14, 0xd4, 0x9b, 0xbd, 0x9b, 0x62, 0x57,
+  0xd9, 0xd3, 0x7e, 0x8d, 0x71, 0x20, 0x65, 0xf2, 0x6c, 0xbd, 0x50, 0xa6,
+  0x1e, 0x61, 0x00, 0xfd, 0x0a, 0x37, 0x99, 0x38, 0x3e, 0xd0, 0x81, 0xd1,
+  0x21, 0x5d, 0x95, 0xe9, 0x0f, 0x49, 0xf4, 0x76, 0x0d, 0xff, 0x03, 0x32,
+  0xe1, 0xfb, 0x0f, 0x49, 0x91, 0xc7, 0xf7, 0x69, 0xf9, 0x5c, 0x4d, 0x0b,
+  0x06, 0x15, 0x14, 0x58, 0x81, 0xa2, 0x9a, 0x37, 0xf1, 0xf0, 0x6b, 0x6a,
+  0x41, 0xb4, 0x8c, 0x57, 0xaf, 0x6f, 0x28, 0xfa, 0x58, 0xf4, 0x0d, 0x7a,
+  0x0a, 0x54, 0x18, 0x4a, 0x2d, 0xd9, 0x43, 0x1b, 0x57, 0xd0, 0x65, 0x9b,
+  0x7c, 0x8f, 0x57, 0x78, 0x30, 0x42, 0x4b, 0x76, 0x7e, 0xf9, 0x14, 0x3e,
+  0xe1, 0x9b, 0x12, 0xb4, 0xf3, 0x24, 0xba, 0xbc, 0x78, 0x1a, 0x09, 0x35,
+  0xe7, 0xed, 0xd4, 0x84, 0x9a, 0xd1, 0x51, 0xca, 0x11, 0x53, 0x0e, 0x27,
+  0x98, 0x2e, 0xa3, 0xf6, 0x6d, 0xd2, 0x02, 0xa4, 0x8c, 0x36, 0x13, 0x91,
+  0x59, 0x7b, 0xcb, 0x58, 0x1c, 0x37, 0xbc, 0xaf, 0xb5, 0xab, 0x03, 0xe9,
+  0xbe, 0x5a, 0x50, 0xd0, 0x2f, 0xf4, 0x43, 0x8f, 0xec, 0x0c, 0xc0, 0x10,
+  0x2c, 0xe2, 0x61, 0x4d, 0xb8, 0xd4, 0xf1, 0xd0, 0xdc, 0x9a, 0xc8, 0x72,
+  0x43, 0xdc, 0x58, 0x16, 0x78, 0x83, 0xeb, 0x3a, 0x62, 0xb2, 0xe2, 0xe2,
+  0xe6, 0x48, 0x2b, 0x29, 0x6c, 0x07, 0x50, 0xc7, 0x07, 0x5e, 0x91, 0xf2,
+  0x17, 0xa3, 0x3a, 0x62, 0x13, 0x09, 0x72, 0x8b, 0xf6, 0x25, 0x53, 0x0d,
+  0xfc, 0xea, 0xaa, 0x47, 0x5a, 0x38, 0xa4, 0x22, 0x31, 0xb6, 0x49, 0x15,
+  0xde, 0x51, 0x17, 0x34, 0xd6, 0x69, 0x0e, 0xbb, 0x5c, 0xe4, 0xb6, 0xed,
+  0xea, 0xc6, 0xeb, 0x1c, 0xc3, 0xb0, 0xc7, 0xe7, 0x35, 0x7b, 0xed, 0x5f,
+  0xd3, 0xb1, 0x17, 0x94, 0xb8, 0x86, 0x59, 0x05, 0xb8, 0xae, 0x97, 0xb0,
+  0xe3, 0xa9, 0xa2, 0xeb, 0x15, 0xe8, 0x54, 0xc9, 0x0a, 0x88, 0x72, 0xfa,
+  0x9c, 0x04, 0x3b, 0xfc, 0x8d, 0x61, 0x27, 0x3a, 0xdf, 0x14, 0x31, 0x39,
+  0x0d, 0x27, 0x67, 0xe8, 0xf3, 0x6c, 0x01, 0x60, 0xc0, 0xe2, 0x3d, 0x4c,
+  0xec, 0x0a, 0x54, 0x72, 0x05, 0x09, 0x95, 0x9a, 0xd9, 0x81, 0x2c, 0x81,
+  0x7f, 0xd9, 0xeb, 0x64, 0x4a, 0x12, 0xa1, 0x74, 0x6e, 0xc2, 0xa0, 0xa3,
+  0x68, 0xa8, 0xce, 0x50, 0x35, 0xb8, 0x84, 0x8d, 0x33, 0xd4, 0xbd, 0xf0,
+  0x48, 0x4b, 0x36, 0x36, 0xbe, 0x9b, 0x74, 0xe3, 0x42, 0x7f, 0x47, 0xb6,
+  0xf6, 0xe7, 0x78, 0x5a, 0x2d, 0x04, 0xd9, 0x82, 0x23, 0xa2, 0x76, 0x64,
+  0x11, 0x29, 0x95, 0x0e, 0x45, 0xf1, 0x11, 0x63, 0x46, 0x81, 0xfe, 0x77,
+  0xaa, 0xdb, 0x84, 0x51, 0x71, 0xdc, 0xef, 0x31, 0x84, 0xa0, 0x89, 0x72,
+  0xb8, 0x4e, 0x30, 0xe4, 0xe1, 0x43, 0x52, 0x7e, 0x33, 0xa2, 0x40, 0x52,
+  0x0e, 0x84, 0x04, 0x41, 0xf2, 0x40, 0xf8, 0x98, 0xce, 0x23, 0x71, 0x32,
+  0x72, 0xd8, 0x8b, 0x9b, 0xad, 0x34, 0x75, 0xb5, 0xbd, 0xd1, 0xf2, 0x47,
+  0x21, 0x91, 0xdd, 0xd6, 0x01, 0x7e, 0xf3, 0x87, 0x34, 0xde, 0x43, 0xbb,
+  0x29, 0xf0, 0x30, 0x20, 0xc6, 0x28, 0x8f, 0x5d, 0x1d, 0xd2, 0x36, 0xbc,
+  0x51, 0x80, 0xd2, 0x10, 0xca, 0x50, 0x0f, 0x86, 0x71, 0x3a, 0x07, 0x8b,
+  0x8d, 0xce, 0xad, 0xad, 0xb8, 0x52, 0x18, 0x26, 0xd9, 0x2a, 0xd1, 0x53,
+  0x76, 0xdd, 0x4e, 0xd2, 0x2b, 0xde, 0x81, 0xf0, 0x57, 0x3d, 0x3e, 0xe1,
+  0x6d, 0xa6, 0xff, 0x6e, 0x2e, 0x42, 0x6b, 0x97, 0xdc, 0xc6, 0xaa, 0xe8,
+  0x0a, 0x84, 0x80, 0xe0, 0x9e, 0x41, 0xd5, 0x40, 0xbf, 0xac, 0xe3, 0xbf,
+  0xed, 0x7d, 0xa0, 0x16, 0xed, 0x71, 0xe2, 0xf3, 0x6f, 0x1e, 0x36, 0xef,
+  0x30, 0x99, 0x85, 0x88, 0x91, 0x4e, 0x42, 0xc6, 0x4c, 0x2f, 0x27, 0x19,
+  0xb2, 0x5a, 0x45, 0x46, 0xfd, 0x9e, 0x8f, 0x96, 0x70, 0x65, 0x85, 0xa9,
+  0x4d, 0xcd, 0xe1, 0x31, 0xb5, 0x51, 0xef, 0xe7, 0x50, 0x0f, 0x69, 0xcd,
+  0xe4, 0x98, 0x01, 0xa3, 0x82, 0x07, 0xee, 0xc7, 0x72, 0x89, 0x5b, 0x38,
+  0x77, 0x0c, 0x5e, 0x15, 0xc9, 0x21, 0xa6, 0xa9, 0xf9, 0x6b, 0x6c, 0x5c,
+  0xf4, 0x18, 0x95, 0x07, 0x69, 0xe7, 0x4c, 0xc8, 0xde, 0xe8, 0x8b, 0x68,
+  0xfa, 0x11, 0x10, 0xe5, 0x7e, 0xe5, 0x45, 0xda, 0xae, 0xdd, 0xf5, 0xd5,
+  0xdc, 0x39, 0x45, 0x28, 0x1f, 0x4a, 0x50, 0x83, 0xe6, 0x16, 0x16, 0x34,
+  0x14, 0x56, 0xbc, 0x78, 0x4d, 0x51, 0x11, 0x71, 0x3a, 0x96, 0x25, 0xdd,
+  0xaa, 0x04, 0x57, 0x0e, 0x1a, 0xab, 0x8d, 0xd5, 0xd4, 0x33, 0x07, 0x86,
+  0x47, 0x16, 0x14, 0x22, 0x18, 0x20, 0xba, 0x7d, 0x53, 0xa5, 0xd5, 0x11,
+  0x98, 0x8a, 0xba, 0x29, 0xa6, 0xcd, 0xa2, 0x6e, 0x99, 0x78, 0xbc, 0x34,
+  0xf4, 0x68, 0x9d, 0x46, 0x1b, 0xde, 0xd4, 0x0a, 0xfe, 0x06, 0x8c, 0x89,
+  0xe8, 0x47, 0xbb, 0x49, 0xd3, 0x3c, 0x8f, 0xd3, 0xe3, 0xe7, 0xb0, 0x39,
+  0x18, 0xd9, 0xaf, 0x35, 0x24, 0xea, 0xab, 0xa0, 0xc3, 0x59, 0xdc, 0xa8,
+  0xc3, 0xba, 0x11, 0x00, 0xb1, 0x9e, 0x60, 0x1d, 0xf0, 0xd3, 0xac, 0xe6,
+  0xdd, 0x3f, 0x0b, 0x74, 0x1b, 0x1f, 0xce, 0xf5, 0x53, 0xe5, 0x04, 0x25,
+  0x75, 0x00, 0x65, 0xde, 0xb4, 0x76, 0xa2, 0x4c, 0x1c, 0xbe, 0x09, 0xa2,
+  0xfb, 0x5f, 0x63, 0x7a, 0x18, 0x23, 0x25, 0x57, 0x6b, 0xbc, 0xac, 0x22,
+  0x98, 0xa8, 0xd3, 0x31, 0xb8, 0x8f, 0x31, 0x2b, 0xf0, 0x7b, 0xe3, 0x98,
+  0xcf, 0x43, 0xe7, 0xcd, 0x08, 0xc2, 0xb2, 0x10, 0x92, 0xb5, 0x7d, 0xad,
+  0xc0, 0xda, 0x7e, 0xd4, 0x9e, 0xa2, 0x73, 0xf1, 0x3f, 0xf2, 0x95, 0x3b,
+  0xa0, 0xcb, 0x7b, 0x9c, 0xf5, 0x22, 0x33, 0x1d, 0x72, 0x6e, 0xba, 0xb5,
+  0xaf, 0x08, 0x6a, 0xe1, 0xa4, 0xeb, 0x9f, 0x5b, 0xd6, 0x74, 0x38, 0x44,
+  0x85, 0x06, 0x49, 0x00, 0xc3, 0xcd, 0xba, 0x02, 0xd4, 0x24, 0x09, 0xbf,
+  0xc6, 0x69, 0x68, 0x96, 0x6f, 0x03, 0x49, 0x80, 0xc0, 0x7d, 0xc6, 0x20,
+  0x8a, 0x41, 0x7e, 0xa1, 0xcd, 0x69, 0xb5, 0x5d, 0x10, 0x78, 0xe1, 0x4b,
+  0x51, 0x2b, 0x5c, 0x55, 0xa8, 0xd5, 0x0a, 0x86, 0x85, 0x6f, 0x6b, 0x31,
+  0x76, 0x6e, 0x4c, 0xf7, 0xeb, 0xfc, 0xae, 0x9c, 0xff, 0xee, 0xab, 0x33,
+  0x3b, 0x8d, 0xce, 0x70, 0x79, 0x82, 0xf6, 0x6d, 0xe6, 0xf0, 0xf9, 0xd9,
+  0xd5, 0x99, 0xc4, 0xfd, 0xf5, 0x44, 0x3d, 0xce, 0x7e, 0x6c, 0x3d, 0x1d,
+  0x08, 0xa2, 0x08, 0x68, 0x88, 0x7c, 0x50, 0xf9, 0x0e, 0x95, 0xed, 0x22,
+  0xff, 0xc2, 0x25, 0x8a, 0x49, 0x2c, 0x84, 0x21, 0x47, 0x69, 0x59, 0x30,
+  0x97, 0x2e, 0xcd, 0x64, 0x21, 0xb7, 0x5f, 0xba, 0x99, 0x9b, 0x73, 0x8a,
+  0x19, 0x19, 0x35, 0x13, 0xbb, 0x13, 0x5f, 0x47, 0xa7, 0xec, 0xda, 0x53,
+  0xff, 0xbc, 0xd6, 0xcf, 0x63, 0xac, 0x7f, 0xa1, 0x02, 0x46, 0xd3, 0xb7,
+  0x18, 0x21, 0xc4, 0xb3, 0x20, 0x37, 0x39, 0x6c, 0x8c, 0x98, 0x20, 0xda,
+  0x79, 0x90, 0x91, 0x4e, 0xfc, 0xe9, 0x8e, 0xae, 0x3a, 0x2b, 0xa9, 0xcc,
+  0xa6, 0xef, 0x91, 0xcb, 0x30, 0x7e, 0x57, 0xc1, 0x66, 0x66, 0x8e, 0xea,
+  0x39, 0xf7, 0x54, 0xd8, 0x39, 0x0d, 0x4f, 0x64, 0xd0, 0x14, 0xbc, 0x2e,
+  0xe2, 0x3b, 0xf8, 0x83, 0x88, 0x31, 0x9f, 0x0b, 0x2e, 0x57, 0x5c, 0x2b,
+  0xf9, 0x1b, 0xb9, 0x9e, 0x4c, 0x63, 0x40, 0xbb, 0xb8, 0x4b, 0xd7, 0xd5,
+  0x16, 0x26, 0x4c, 0x68, 0xab, 0x30, 0xa3, 0x9b, 0x61, 0x8d, 0x22, 0x5b,
+  0x72, 0x56, 0xc6, 0x32, 0x6d, 0x3b, 0x08, 0xa6, 0xaa, 0x6a, 0xad, 0x78,
+  0x9d, 0xc2, 0x1a, 0x82, 0xe4, 0x95, 0xd1, 0x79, 0xbd, 0x70, 0x50, 0x23,
+  0x98, 0x53, 0xab, 0x98, 0x47, 0x4a, 0x1e, 0xf3, 0xf9, 0x36, 0x89, 0xd7,
+  0xb5, 0x5d, 0x42, 0x4b, 0x17, 0x80, 0xee, 0x96, 0xc7, 0x6b, 0xd8, 0x7d,
+  0xc2, 0x7b, 0xa3, 0xf0, 0xef, 0x40, 0xdd, 0x4d, 0x0f, 0xc0, 0x82, 0x34,
+  0x18, 0xf3, 0x25, 0x06, 0xad, 0x16, 0x25, 0xc3, 0x70, 0xe6, 0x8c, 0xd7,
+  0xa9, 0x1a, 0xa7, 0x1a, 0x15, 0xa4, 0x14, 0x09, 0xa2, 0x2a, 0x4a, 0xec,
+  0x28, 0x1c, 0xae, 0xbe, 0x81, 0xbb, 0xfd, 0x1e, 0x95, 0x04, 0x41, 0xbc,
+  0xe9, 0x54, 0x69, 0x39, 0x7b, 0x7b, 0xc8, 0x68, 0x23, 0x64, 0x3d, 0x70,
+  0xb4, 0x11, 0xfc, 0xed, 0x6a, 0x23, 0x72, 0x57, 0xab, 0x55, 0x1b, 0x51,
+  0x66, 0xff, 0xa0, 0x4a, 0xc9, 0x89, 0xf1, 0x4a, 0x36, 0xdd, 0x65, 0x6f,
+  0x20, 0xa2, 0xa5, 0xe0, 0x73, 0xfe, 0xb2, 0x60, 0x89, 0x57, 0xe2, 0x76,
+  0xf6, 0x3c, 0xa2, 0xa1, 0x42, 0x1b, 0x2e, 0x0f, 0x34, 0xba, 0x73, 0x01,
+  0xc1, 0x79, 0x74, 0x03, 0x78, 0x8e, 0x25, 0x6a, 0x04, 0x22, 0x58, 0x1d,
+  0x5c, 0x2c, 0x1e, 0xd2, 0x9d, 0xbd, 0x1d, 0x36, 0x50, 0x13, 0x3a, 0x71,
+  0x02, 0x54, 0x61, 0x71, 0x6e, 0xb3, 0x1f, 0x95, 0x8b, 0x7a, 0xc1, 0x32,
+  0xd8, 0xa3, 0x13, 0xfb, 0xd5, 0x2e, 0x5e, 0xc6, 0xd9, 0x81, 0x17, 0xe3,
+  0xbe, 0xd5, 0x52, 0x2e, 0x4c, 0x9e, 0x38, 0xb8, 0xd8, 0x37, 0xc2, 0xab,
+  0x9a, 0x1a, 0xa4, 0x64, 0x4e, 0xc7, 0xbc, 0x98, 0x32, 0x33, 0x0b, 0x9c,
+  0x58, 0x0f, 0xb5, 0x94, 0xef, 0xfb, 0x67, 0x71, 0xd5, 0x67, 0x9b, 0x31,
+  0x28, 0x8c, 0x65, 0x36, 0xad, 0x17, 0xd0, 0xbd, 0x1d, 0x05, 0xec, 0x30,
+  0x9d, 0xdb, 0xa9, 0x60, 0xe0, 0xa7, 0x75, 0x89, 0x64, 0xbe, 0x70, 0x0b,
+  0xb8, 0x01, 0xa3, 0x91, 0x65, 0xb4, 0xc0, 0xe0, 0xa3, 0x78, 0x26, 0x06,
+  0x28, 0x31, 0x29, 0x5a, 0x9d, 0x01, 0x60, 0xe2, 0x7f, 0x49, 0x9d, 0x69,
+  0x79, 0x55, 0x22, 0x06, 0xd8, 0x81, 0x7a, 0x87, 0x31, 0xff, 0x11, 0x1a,
+  0xf0, 0x89, 0xc4, 0x28, 0x6b, 0xd7, 0x82, 0x5d, 0x01, 0xd0, 0xaa, 0x9e,
+  0xaa, 0x3b, 0xbc, 0x3b, 0xa5, 0x5b, 0x19, 0xed, 0x03, 0xf2, 0x99, 0x5c,
+  0x38, 0x6c, 0xf0, 0xbe, 0xa3, 0x84, 0xd4, 0x94, 0x42, 0xb6, 0x3e, 0x9a,
+  0xa5, 0xc8, 0xd9, 0x9c, 0x0a, 0x86, 0x10, 0x63, 0x46, 0x75, 0xd6, 0x6c,
+  0x67, 0xce, 0x0e, 0xf6, 0x7c, 0x17, 0xad, 0xad, 0x0d, 0x59, 0x8d, 0x75,
+  0x7d, 0xce, 0xed, 0xe2, 0x5d, 0xdd, 0xd2, 0x6b, 0x8f, 0xcd, 0x5c, 0x5e,
+  0xf3, 0xb4, 0x31, 0x66, 0x89, 0xa6, 0x46, 0xa6, 0x25, 0x46, 0x23, 0x67,
+  0x11, 0xab, 0x6b, 0x57, 0x0b, 0x67, 0x21, 0xab, 0xab, 0x58, 0xbc, 0xc8,
+  0xf1, 0x12, 0x74, 0x0a, 0x6b, 0x59, 0x71, 0xb5, 0x0e, 0x60, 0xb2, 0x0a,
+  0xde, 0x07, 0xc7, 0x75, 0xb5, 0xfe, 0x90, 0xd8, 0x9e, 0x0d, 0xc6, 0xf6,
+  0x2c, 0x84, 0xcd, 0xeb, 0xb1, 0xf7, 0xc4, 0x65, 0x2d, 0xcc, 0xd8, 0xb4,
+  0x9f, 0x14, 0x89, 0x0e, 0xb0, 0x6b, 0x64, 0xee, 0xdb, 0xbf, 0x7e, 0x80,
+  0xbd, 0x6b, 0xd7, 0xbe, 0xb5, 0x66, 0x3c, 0xe8, 0xdf, 0x8c, 0x76, 0x6c,
+  0x44, 0x5d, 0x15, 0xf4, 0xbd, 0xf7, 0xa2, 0x75, 0xf9, 0x6a, 0xb7, 0xa3,
+  0x3f, 0x62, 0x2b, 0xfa, 0xce, 0x74, 0xd5, 0x76, 0x98, 0x8e, 0x5b, 0x6c,
+  0x7d, 0x8b, 0xf9, 0x09, 0x52, 0xc7, 0x7a, 0xd8, 0xd0, 0xfd, 0xe3, 0x07,
+  0xdb, 0x3b, 0xbe, 0xe3, 0xbe, 0xf1, 0x9d, 0xf6, 0x8c, 0xd2, 0x62, 0xb6,
+  0x3b, 0x72, 0xbc, 0x06, 0x2f, 0x1c, 0xc5, 0x79, 0xd3, 0xc0, 0x6a, 0xc5,
+  0xf6, 0x08, 0xd6, 0x62, 0x93, 0x6a, 0xd1, 0xd9, 0x26, 0xda, 0x19, 0xf1,
+  0xec, 0x1f, 0x33, 0xe2, 0xff, 0x87, 0x19, 0xa1, 0xeb, 0xee, 0x3b, 0x4d,
+  0x8c, 0x67, 0xff, 0x98, 0x18, 0xc3, 0x27, 0x86, 0x37, 0x33, 0x74, 0x19,
+  0x6c, 0xcc, 0x0c, 0xd3, 0xbf, 0x0c, 0xe3, 0xde, 0xe8, 0xd5, 0x9b, 0x35,
+  0xb4, 0x2c, 0x5a, 0x95, 0xab, 0x81, 0x37, 0x38, 0xe3, 0x06, 0xe1, 0x7d,
+  0x16, 0xc0, 0x4b, 0x27, 0x41, 0xe2, 0x05, 0xb3, 0xb8, 0x29, 0xe2, 0xc3,
+  0x36, 0x5d, 0x95, 0xb8, 0x6d, 0xb4, 0xf5, 0xea, 0x64, 0x3c, 0x2e, 0x19,
+  0x61, 0x56, 0x56, 0xd6, 0x76, 0x50, 0xdb, 0xeb, 0xd1, 0xa4, 0x34, 0xdb,
+  0xbd, 0x0c, 0x95, 0xf0, 0x8c, 0x6e, 0x92, 0xf2, 0x24, 0x74, 0x78, 0x3c,
+  0x9b, 0x51, 0x48, 0x92, 0xb1, 0xf8, 0xd4, 0x64, 0x33, 0x9e, 0xd3, 0x27,
+  0xba, 0x1d, 0xcc, 0x82, 0x8d, 0x0f, 0x34, 0xfd, 0x7d, 0x76, 0xed, 0x8e,
+  0xa2, 0x4d, 0x6a, 0xde, 0x82, 0xb4, 0x05, 0xf1, 0x96, 0x75, 0xed, 0x35,
+  0x46, 0x5f, 0xad, 0x77, 0x82, 0xbd, 0xc4, 0xec, 0x85, 0x18, 0x11, 0xe8,
+  0x95, 0x8d, 0xd2, 0xa1, 0x76, 0xff, 0x86, 0x6f, 0x44, 0xd8, 0x67, 0x42,
+  0xc1, 0x7d, 0x3f, 0x85, 0x80, 0xf3, 0x82, 0x39, 0x4f, 0x30, 0x40, 0xd0,
+  0xe1, 0xf5, 0x06, 0x05, 0xf7, 0x0f, 0x52, 0xb0, 0x61, 0x27, 0x80, 0x97,
+  0x85, 0x1e, 0xe9, 0xa9, 0x50, 0xa1, 0x60, 0x2a, 0x0d, 0x5d, 0xdd, 0x51,
+  0xd3, 0xd1, 0x6d, 0xde, 0x19, 0x7f, 0x9e, 0x87, 0x46, 0x62, 0x34, 0x6d,
+  0x36, 0xef, 0xa5, 0xa6, 0x07, 0x34, 0x74, 0x9d, 0xdb, 0x8e, 0xa6, 0x5e,
+  0xef, 0xc9, 0x96, 0x92, 0xd8, 0x89, 0x6e, 0x31, 0xaf, 0x53, 0x5b, 0xca,
+  0xb4, 0xee, 0x07, 0xd4, 0xa5, 0x80, 0x76, 0xb4, 0x3d, 0xf6, 0x33, 0x46,
+  0xfd, 0x5e, 0xf6, 0x33, 0x6b, 0x2c, 0x7e, 0x0f, 0x33, 0x1a, 0x13, 0x57,
+  0xb5, 0xd6, 0xdf, 0x69, 0x46, 0xf3, 0x9c, 0x98, 0x1a, 0x82, 0x42, 0xdd,
+  0x9e, 0x38, 0xf8, 0xdf, 0x3b, 0x4a, 0xd3, 0xee, 0x2d, 0xa3, 0xc8, 0x58,
+  0xe3, 0xa7, 0x72, 0xae, 0x36, 0x21, 0xcb, 0xdf, 0x3a, 0x58, 0x2e, 0x1e,
+  0x3e, 0x48, 0xc4, 0x84, 0x02, 0x6a, 0xf2, 0x29, 0xf3, 0x63, 0x41, 0xb9,
+  0xf0, 0xde, 0xc6, 0x4f, 0xe8, 0xf4, 0x51, 0xde, 0xe3, 0xb8, 0xdb, 0xb7,
+  0x23, 0xcc, 0x9b, 0x88, 0x1b, 0xe2, 0x05, 0xfa, 0xd9, 0xac, 0xd3, 0x22,
+  0xaa, 0x4f, 0xd8, 0xfa, 0xf7, 0x26, 0xdf, 0x04, 0x08, 0xa1, 0x13, 0xcd,
+  0xbf, 0x3f, 0x25, 0xd6, 0xbd, 0xc7, 0xd7, 0x11, 0x70, 0x3a, 0xf3, 0x59,
+  0x13, 0x5b, 0x23, 0xf0, 0xf7, 0x87, 0x1b, 0x2b, 0xcb, 0x2c, 0x05, 0xed,
+  0xf5, 0xeb, 0x5b, 0x31, 0x9c, 0x13, 0x0b, 0xa3, 0xfc, 0xfc, 0x48, 0xf9,
+  0x0d, 0x93, 0xa1, 0xb9, 0x6e, 0x39, 0xd7, 0x9c, 0x0d, 0x2f, 0x06, 0x2d,
+  0x92, 0xb5, 0x03, 0xa4, 0x9a, 0xc0, 0xc6, 0xe2, 0x40, 0x09, 0x5d, 0xd1,
+  0xf6, 0x96, 0x20, 0xba, 0x11, 0xba, 0x4a, 0x41, 0x60, 0xa1, 0xbb, 0xd0,
+  0x3f, 0x14, 0xdf, 0xff, 0x3e, 0x8a, 0xaf, 0x59, 0xe3, 0xfc, 0x21, 0xae,
+  0x5f, 0x8c, 0x36, 0xca, 0xf0, 0xc9, 0x50, 0x65, 0xb8, 0x0e, 0xf8, 0xde,
+  0xca, 0x70, 0x1b, 0xa2, 0x16, 0x65, 0xb8, 0x0d, 0xfc, 0xef, 0xaf, 0x0c,
+  0xc3, 0xfc, 0xab, 0x40, 0xf2, 0xfd, 0xc8, 0x39, 0xc3, 0x3d, 0xcc, 0xf3,
+  0xa3, 0x8c, 0xbc, 0x5f, 0xff, 0x98, 0x54, 0xff, 0xcf, 0xda, 0x57, 0xbc,
+  0xb1, 0xf7, 0x36, 0x93, 0x91, 0x6a, 0x34, 0x1f, 0xee, 0xf8, 0xbd, 0x81,
+  0xae, 0xfb, 0xe8, 0xbf, 0xb5, 0xf6, 0xae, 0xf3, 0xfa, 0xd6, 0x42, 0xe1,
+  0x79, 0xf5, 0x5f, 0x67, 0x7e, 0xc1, 0x13, 0x8f, 0x05, 0x59, 0x8d, 0x99,
+  0x6f, 0x65, 0x36, 0xbd, 0x6b, 0x45, 0x52, 0x89, 0xab, 0x38, 0xa9, 0xe1,
+  0xd9, 0xf8, 0xd7, 0x4b, 0x04, 0xd8, 0x5f, 0xc4, 0x45, 0x95, 0xef, 0xa3,
+  0x3f, 0xa6, 0x19, 0xb4, 0xff, 0xb4, 0xc4, 0xa0, 0x48, 0x87, 0x63, 0x65,
+  0x02, 0x0c, 0x5c, 0x3c, 0xaa, 0x05, 0x18, 0x18, 0x53, 0x85, 0x08, 0x32,
+  0x05, 0x06, 0x76, 0xdc, 0x3e, 0xab, 0xfb, 0x08, 0x83, 0xee, 0x69, 0x34,
+  0xc0, 0xda, 0xa4, 0x3a, 0x44, 0x5e, 0x60, 0x94, 0x4d, 0x94, 0x10, 0xc2,
+  0x74, 0x9f, 0xcc, 0x39, 0x80, 0x50, 0x64, 0x7b, 0x56, 0x6f, 0x87, 0x48,
+  0x76, 0x6a, 0x71, 0x76, 0x91, 0xa9, 0x87, 0xab, 0x3c, 0x9e, 0x91, 0x94,
+  0xea, 0x3a, 0x61, 0x2a, 0xa8, 0xc3, 0xf1, 0x78, 0x1a, 0x30, 0x3a, 0xef,
+  0x0f, 0xc2, 0x48, 0x1f, 0x7a, 0x97, 0x59, 0xc6, 0x25, 0xc7, 0xa3, 0x89,
+  0x24, 0xc4, 0x86, 0xd7, 0x24, 0xe3, 0x70, 0x4a, 0xb9, 0xce, 0xd9, 0x9d,
+  0xc0, 0x7a, 0xb7, 0x2e, 0x0f, 0xb3, 0x9a, 0x38, 0xc0, 0x7e, 0xb9, 0xfc,
+  0x97, 0xa7, 0xaa, 0xe7, 0xd4, 0x90, 0x14, 0x01, 0x24, 0x45, 0x13, 0x49,
+  0xe1, 0x23, 0x71, 0x43, 0x9c, 0x55, 0x1a, 0x05, 0x0a, 0x65, 0x84, 0x76,
+  0x07, 0x5d, 0x41, 0x79, 0x1a, 0xb9, 0xce, 0x93, 0x53, 0x18, 0x36, 0xba,
+  0x79, 0x90, 0xd8, 0xaf, 0x72, 0x1b, 0x4c, 0x03, 0xd6, 0x3b, 0xff, 0xa9,
+  0x9f, 0xb5, 0x89, 0x67, 0x70, 0x03, 0x1b, 0x8a, 0x07, 0x27, 0x16, 0x88,
+  0x07, 0x8c, 0x60, 0xcb, 0x7c, 0xfd, 0x10, 0xfa, 0x08, 0x8c, 0x6b, 0x42,
+  0x16, 0x84, 0x3e, 0x3b, 0x55, 0x62, 0x84, 0xaa, 0x4e, 0x10, 0x43, 0xd6,
+  0xfc, 0xde, 0x8d, 0xcb, 0x71, 0x5e, 0xba, 0x77, 0x33, 0x3a, 0x4a, 0xbb,
+  0x5d, 0x04, 0x38, 0xfa, 0x4b, 0xe0, 0x7f, 0x00, 0x28, 0x2a, 0x87, 0xb9,
+  0x92, 0x44, 0xbd, 0x76, 0x6d, 0x63, 0x1d, 0xbf, 0xc5, 0xc0, 0xc1, 0x6b,
+  0x3a, 0xbb, 0x2c, 0x92, 0xea, 0x58, 0xec, 0xa3, 0x38, 0xe2, 0x7a, 0x2e,
+  0xde, 0x4e, 0x46, 0xe6, 0x7c, 0xd4, 0xf0, 0xd5, 0xe9, 0xb9, 0x1d, 0xa0,
+  0x59, 0x2f, 0xe5, 0x45, 0x00, 0x42, 0x2e, 0xf9, 0x49, 0xfc, 0x2d, 0x43,
+  0x88, 0x8e, 0x17, 0x5e, 0xb5, 0xcc, 0x13, 0xd8, 0x9a, 0x40, 0xef, 0xeb,
+  0x51, 0xa1, 0x64, 0x20, 0x3b, 0xd7, 0xc1, 0x82, 0xd1, 0xd7, 0x72, 0xad,
+  0xf8, 0x51, 0x81, 0x4f, 0xcc, 0xdd, 0x41, 0x83, 0xdd, 0xcc, 0x2b, 0x8c,
+  0x3b, 0x84, 0x51, 0x56, 0x34, 0x1e, 0x9a, 0xb0, 0xa2, 0x65, 0xb5, 0x53,
+  0x3f, 0x5e, 0x9a, 0xa2, 0xb2, 0xbe, 0xfb, 0x78, 0xcb, 0xcf, 0x5c, 0xc3,
+  0xa2, 0x18, 0xb6, 0x8f, 0x9c, 0xae, 0x16, 0x0f, 0xde, 0xcf, 0x77, 0x88,
+  0x2e, 0x29, 0xa2, 0x2b, 0xd7, 0x69, 0xbb, 0xca, 0xa3, 0xef, 0x54, 0x20,
+  0x9d, 0x92, 0x75, 0xaa, 0x11, 0xae, 0xee, 0x42, 0xae, 0x36, 0xf1, 0x46,
+  0xbe, 0x59, 0x8b, 0x33, 0x27, 0xc4, 0x12, 0x66, 0x2e, 0x79, 0xd1, 0xe0,
+  0x68, 0xdc, 0x09, 0x7c, 0x3c, 0x35, 0x71, 0xdc, 0x18, 0x65, 0xe5, 0xa1,
+  0x60, 0x4a, 0xfb, 0xf1, 0x68, 0xe0, 0x85, 0x1a, 0xc6, 0x7a, 0x87, 0x72,
+  0x96, 0x90, 0xb6, 0xee, 0x94, 0x1c, 0x22, 0x5e, 0x67, 0x5a, 0xa0, 0xd2,
+  0x41, 0x5c, 0xff, 0x86, 0xd2, 0xc8, 0x09, 0xbf, 0x5a, 0xff, 0x5c, 0xd8,
+  0xcf, 0x36, 0xa0, 0xaa, 0x21, 0x8a, 0xb2, 0xae, 0xb4, 0xd1, 0xc4, 0x29,
+  0x59, 0x5a, 0x48, 0xfa, 0xaf, 0xa3, 0xe9, 0x90, 0x97, 0x55, 0x57, 0x4f,
+  0xf1, 0xe7, 0x0f, 0x41, 0x17, 0x57, 0x5c, 0x59, 0x29, 0x60, 0xb8, 0x52,
+  0x39, 0xb2, 0xf4, 0x59, 0xf2, 0x42, 0xfc, 0x98, 0x9f, 0xbb, 0xff, 0xf1,
+  0x02, 0xfc, 0xe9, 0xb1, 0xca, 0xe7, 0xb8, 0x0b, 0xc6, 0xfb, 0x21, 0x26,
+  0x9c, 0xcf, 0x73, 0xbd, 0xc7, 0xec, 0xde, 0xe0, 0xcd, 0x96, 0x1b, 0x58,
+  0xf1, 0x4e, 0xd1, 0x77, 0x0e, 0x0b, 0xc0, 0xea, 0x4e, 0x6f, 0x46, 0x8d,
+  0xab, 0xbe, 0xd9, 0x6a, 0xe7, 0x81, 0x11, 0x5e, 0x84, 0x0b, 0x11, 0xf0,
+  0x55, 0x15, 0x57, 0xc0, 0xa2, 0xb8, 0xc3, 0x0e, 0xd4, 0x6f, 0xac, 0xc8,
+  0xb8, 0xbd, 0xc7, 0xd0, 0x6b, 0x74, 0xb7, 0xc5, 0x9a, 0x90, 0x77, 0xf1,
+  0x0a, 0x94, 0xb5, 0x15, 0xe5, 0x4b, 0x9a, 0x97, 0x06, 0xd5, 0xfc, 0xae,
+  0x40, 0x51, 0x5f, 0x70, 0x68, 0xfd, 0xbb, 0x7b, 0xf8, 0x97, 0x05, 0xcb,
+  0x77, 0xa2, 0x3f, 0x9c, 0xd3, 0xbb, 0xe6, 0x8e, 0x21, 0x72, 0x0c, 0x00,
+  0x5e, 0x95, 0x14, 0x60, 0x9c, 0x4c, 0x98, 0x14, 0x1d, 0x7d, 0x05, 0xcb,
+  0x33, 0xfa, 0x21, 0x1e, 0x92, 0x15, 0xe6, 0xb0, 0xf4, 0x81, 0x69, 0x80,
+  0x02, 0x36, 0xce, 0x73, 0xaa, 0x32, 0x60, 0x32, 0x30, 0x41, 0x97, 0x9d,
+  0xbd, 0xa2, 0x31, 0xf4, 0x17, 0x89, 0x35, 0xaa, 0xb7, 0x37, 0x74, 0xbc,
+  0x85, 0x17, 0xf9, 0x4d, 0x11, 0xef, 0x50, 0x37, 0x32, 0x3f, 0x66, 0x3d,
+  0xa5, 0x4a, 0x58, 0x04, 0x30, 0xd3, 0x14, 0xaa, 0xd0, 0xe8, 0x82, 0x62,
+  0x7f, 0xf6, 0x95, 0x5c, 0xc6, 0x45, 0xa9, 0xc5, 0xf4, 0xb9, 0xaf, 0xcc,
+  0x21, 0x4d, 0x56, 0x5b, 0xd0, 0xf4, 0x48, 0xf3, 0x96, 0xe7, 0xde, 0x7a,
+  0xf2, 0x7b, 0x53, 0x0d, 0x3f, 0xfa, 0x91, 0x56, 0x38, 0xd5, 0x81, 0x6d,
+  0x3e, 0x8a, 0x3f, 0xb7, 0x59, 0xf4, 0x5b, 0x09, 0xa4, 0x1f, 0x5a, 0x33,
+  0x7f, 0x11, 0x9c, 0x8d, 0x48, 0x02, 0x84, 0xd7, 0x61, 0xe2, 0x75, 0xc2,
+  0x97, 0x9a, 0xd3, 0x5b, 0xeb, 0x28, 0xea, 0x93, 0xb0, 0x4b, 0xe2, 0x3d,
+  0xe1, 0xdc, 0x25, 0xeb, 0x54, 0x1e, 0x39, 0x31, 0x35, 0x10, 0x54, 0xad,
+  0xe9, 0x2f, 0x26, 0xad, 0x5c, 0x18, 0x40, 0xf3, 0xab, 0x5c, 0x68, 0x7a,
+  0x82, 0x55, 0x62, 0xbf, 0xec, 0x71, 0x77, 0x91, 0xa5, 0xd5, 0x03, 0xa3,
+  0x40, 0xeb, 0x01, 0xde, 0x8d, 0xde, 0x27, 0x71, 0xb1, 0x28, 0x92, 0x1b,
+  0xb9, 0x50, 0xcc, 0x1f, 0x8f, 0xcb, 0x32, 0xc6, 0xef, 0xfd, 0x0d, 0xa1,
+  0xc8, 0x76, 0xda, 0x04, 0x6f, 0xda, 0x96, 0xdf, 0x1f, 0x81, 0xab, 0xcb,
+  0x05, 0xd4, 0x4d, 0x9e, 0x0b, 0xb5, 0xc9, 0x2e, 0x9f, 0x47, 0xcd, 0x92,
+  0x55, 0xbe, 0xc0, 0xd8, 0x0a, 0x8b, 0x32, 0xcf, 0x6e, 0x13, 0xaf, 0x90,
+  0xf7, 0xa5, 0x21, 0x01, 0x06, 0xfc, 0xe7, 0xec, 0x15, 0x7e, 0x9f, 0xb0,
+  0xaa, 0x1e, 0x91, 0xd1, 0xae, 0xcc, 0xf1, 0xee, 0x1e, 0xa6, 0xde, 0xe6,
+  0xcc, 0xaf, 0x12, 0x0d, 0x56, 0xb2, 0x37, 0xf8, 0x91, 0xc9, 0xa2, 0x63,
+  0x49, 0xd7, 0xdf, 0x40, 0x40, 0x92, 0xe3, 0x2f, 0x76, 0x94, 0xb3, 0xad,
+  0x78, 0x0f, 0x9a, 0xf4, 0xd2, 0x12, 0x6b, 0x3d, 0x20, 0x42, 0xe9, 0xb6,
+  0xb2, 0x9a, 0x1d, 0xfa, 0x4c, 0x9c, 0xa3, 0xc1, 0x91, 0x4c, 0xdd, 0xdd,
+  0x80, 0xb3, 0x07, 0x90, 0xea, 0xa9, 0xe1, 0x8b, 0xe3, 0x1e, 0xf3, 0x5b,
+  0xe3, 0xbf, 0x81, 0x9b, 0xa5, 0x2f, 0xf0, 0x3d, 0xdd, 0xd9, 0xa5, 0x87,
+  0x91, 0xc1, 0x2f, 0x34, 0x53, 0x31, 0xff, 0x34, 0x8c, 0xb1, 0x1a, 0x4d,
+  0x6e, 0x6a, 0x84, 0x67, 0x43, 0x15, 0xaf, 0x35, 0x9f, 0x9c, 0x96, 0x11,
+  0x5a, 0x56, 0xa8, 0xb6, 0xf8, 0xa0, 0xec, 0x5d, 0x56, 0x8f, 0xca, 0x74,
+  0xd4, 0xd3, 0x04, 0x8d, 0xf0, 0x80, 0x3b, 0xa5, 0xe3, 0xac, 0x41, 0xb0,
+  0xb1, 0x58, 0x19, 0x3f, 0xe9, 0x23, 0x7a, 0x49, 0x53, 0xe8, 0x0a, 0x75,
+  0xa6, 0x13, 0xed, 0x76, 0xf4, 0xe7, 0x7a, 0x7b, 0x7d, 0x4f, 0x4a, 0x32,
+  0x66, 0x50, 0x6a, 0x24, 0x32, 0x5e, 0x1c, 0x67, 0x33, 0xf3, 0x44, 0x0f,
+  0xf2, 0x12, 0xf8, 0xf8, 0x2f, 0x1a, 0xb5, 0x9f, 0x32, 0xb8, 0xd6, 0x9b,
+  0x2d, 0x60, 0x0c, 0x42, 0xf6, 0x5e, 0xee, 0x85, 0xd0, 0xed, 0xc7, 0xd1,
+  0x0b, 0xed, 0x59, 0x8e, 0x3e, 0xa6, 0x3f, 0x5e, 0xa0, 0xc5, 0x3d, 0x83,
+  0x59, 0x07, 0xaf, 0xa7, 0x6f, 0xff, 0x13, 0x33, 0xc1, 0xbd, 0x8d, 0x31,
+  0x15, 0xdf, 0xdb, 0x6f, 0xcf, 0xa3, 0xb7, 0x7f, 0x9b, 0xbd, 0x78, 0x62,
+  0x00, 0x46, 0x36, 0x6c, 0x9b, 0x79, 0xd0, 0x25, 0x44, 0x56, 0xf5, 0xf5,
+  0x9a, 0xa6, 0xc3, 0x2d, 0xde, 0xf5, 0x44, 0x6b, 0x03, 0x1a, 0xa2, 0xab,
+  0x9c, 0xde, 0xdd, 0xa1, 0x6a, 0x1a, 0xc9, 0x16, 0xc7, 0x78, 0x31, 0xcf,
+  0xe3, 0xf5, 0x7a, 0xae, 0xe0, 0x32, 0xbc, 0xb7, 0x71, 0xe6, 0x73, 0x14,
+  0x65, 0x47, 0x15, 0x18, 0xa2, 0xde, 0xfe, 0x98, 0x34, 0x38, 0x0b, 0x4b,
+  0x53, 0x0f, 0x08, 0x3d, 0xb8, 0x41, 0x5a, 0x1d, 0x0b, 0x4c, 0xc1, 0x02,
+  0x0b, 0x1c, 0x4f, 0xe5, 0xb5, 0xa1, 0xb0, 0x1c, 0x40, 0x1e, 0x60, 0x98,
+  0x5b, 0xf8, 0x69, 0x93, 0x36, 0x2a, 0xbb, 0x30, 0x20, 0x0b, 0x28, 0x84,
+  0x94, 0xa9, 0x3b, 0xb5, 0xda, 0xe5, 0xc3, 0xad, 0xa5, 0xc0, 0x11, 0x1a,
+  0xcf, 0xb2, 0x81, 0xfa, 0x49, 0x1b, 0xee, 0xe6, 0x7c, 0x24, 0x1c, 0x81,
+  0xde, 0xe3, 0xd1, 0xa7, 0xaf, 0xd2, 0x79, 0xf8, 0xd4, 0xd6, 0x6f, 0xce,
+  0x84, 0x84, 0xaa, 0xcc, 0x74, 0x5c, 0x28, 0x17, 0xa8, 0xee, 0xc2, 0xca,
+  0x95, 0x37, 0x41, 0x03, 0xf3, 0xae, 0xce, 0x89, 0xd4, 0x5b, 0x6c, 0x6f,
+  0xa0, 0xca, 0xcb, 0x97, 0x14, 0x9c, 0xef, 0xdb, 0xf1, 0xdb, 0xbf, 0x41,
+  0x53, 0xbd, 0x0f, 0x23, 0xa7, 0xe7, 0xea, 0xb2, 0x41, 0x2a, 0x37, 0xd8,
+  0x03, 0xba, 0x8d, 0x82, 0xb0, 0xe5, 0x96, 0xae, 0xd5, 0x9b, 0xe2, 0x24,
+  0xc0, 0xd7, 0x09, 0x9f, 0xdb, 0xc2, 0x90, 0x22, 0x8b, 0x48, 0xb5, 0x01,
+  0x69, 0xed, 0xf2, 0xc3, 0x2b, 0xa2, 0xc3, 0xf9, 0x9e, 0x68, 0x39, 0x61,
+  0x8b, 0xce, 0xf0, 0xc5, 0xad, 0x9d, 0x20, 0xac, 0x02, 0x54, 0xfe, 0x5a,
+  0x69, 0xe4, 0x70, 0x1e, 0x68, 0xf2, 0x2c, 0x8e, 0x30, 0xee, 0x75, 0x04,
+  0xa6, 0xdb, 0xe4, 0x36, 0xa4, 0x39, 0xbc, 0x6f, 0xed, 0x33, 0x0e, 0x7d,
+  0x3c, 0x16, 0xb8, 0xb1, 0x59, 0xa9, 0xf0, 0xe8, 0x0d, 0x94, 0x59, 0x93,
+  0xec, 0xc4, 0xe5, 0x58, 0x8f, 0xb1, 0xfc, 0xf2, 0x72, 0x51, 0x63, 0x4c,
+  0xd4, 0xd9, 0x3d, 0x3c, 0x3a, 0x34, 0xaf, 0x93, 0x98, 0x7d, 0xe2, 0x7f,
+  0x9f, 0x2f, 0x61, 0x99, 0x89, 0x7e, 0x95, 0xaf, 0xd3, 0xa4, 0xb8, 0xd6,
+  0xef, 0xff, 0xdb, 0x4c, 0x25, 0x9d, 0x8c, 0xe8, 0x1f, 0x19, 0xed, 0xe0,
+  0x57, 0xb4, 0xce, 0x31, 0x43, 0x05, 0xd6, 0x01, 0xf5, 0xa7, 0x7b, 0x53,
+  0x0d, 0xa8, 0x24, 0xf0, 0x0d, 0x27, 0xea, 0x03, 0xbd, 0xde, 0x3d, 0x88,
+  0x9d, 0x5c, 0x91, 0x2e, 0x8f, 0x15, 0x7f, 0xb5, 0x65, 0xcf, 0xcc, 0x44,
+  0xd3, 0xf8, 0x24, 0x8c, 0xec, 0xcc, 0x4c, 0xcb, 0x6d, 0x5c, 0x6e, 0xed,
+  0x42, 0xf0, 0x1a, 0x4a, 0xd3, 0xe4, 0xb1, 0x8e, 0xd4, 0xaa, 0x6f, 0xa7,
+  0x37, 0x40, 0x40, 0xc2, 0x53, 0xa4, 0x7e, 0xf9, 0x16, 0xc3, 0x49, 0xd7,
+  0x7d, 0xa7, 0x71, 0xa9, 0x05, 0x74, 0x98, 0x13, 0x2f, 0x7a, 0xfc, 0xcd,
+  0x58, 0xcf, 0x2e, 0xdd, 0xf1, 0xc3, 0xc5, 0xd8, 0xed, 0x5e, 0x04, 0x9f,
+  0x19, 0xec, 0xad, 0xb4, 0x8b, 0x29, 0x0e, 0x13, 0x33, 0xfd, 0x80, 0x6b,
+  0x68, 0x19, 0x1d, 0xc8, 0x7d, 0x63, 0x2b, 0x6c, 0xcc, 0xd1, 0x89, 0xf9,
+  0x4b, 0x8a, 0x56, 0x18, 0xd7, 0x94, 0x29, 0x34, 0x2f, 0x71, 0xb3, 0x80,
+  0x41, 0x8a, 0x09, 0x98, 0xd6, 0x71, 0x99, 0xc8, 0x27, 0xd3, 0x7d, 0x3e,
+  0xbf, 0x8b, 0x0b, 0xbc, 0xc9, 0xca, 0x2f, 0x5a, 0x78, 0x8e, 0xbe, 0x9d,
+  0x34, 0x38, 0x85, 0x55, 0x02, 0x66, 0x14, 0x17, 0xb9, 0xe5, 0x0f, 0x5f,
+  0xb6, 0x85, 0x26, 0x41, 0x4f, 0xf0, 0xea, 0x77, 0x55, 0x9a, 0xfa, 0x74,
+  0x2a, 0xf9, 0xff, 0xe8, 0x97, 0xf9, 0x6e, 0x07, 0xc4, 0xae, 0x62, 0xc9,
+  0xdd, 0x55, 0xdd, 0x25, 0x89, 0xf5, 0xb6, 0x8f, 0x38, 0x21, 0xa8, 0xfe,
+  0x58, 0x62, 0x2c, 0x73, 0xbb, 0x24, 0xe0, 0xc7, 0x75, 0x5a, 0x24, 0xab,
+  0x2a, 0x2f, 0xd2, 0xa4, 0xe4, 0x68, 0x5c, 0x3e, 0xd2, 0x84, 0x16, 0x19,
+  0x3c, 0x3a, 0xa0, 0x6d, 0x32, 0xa8, 0x8a, 0xde, 0x0a, 0x64, 0xbc, 0xfa,
+  0xdd, 0xb5, 0x87, 0xc5, 0xa9, 0x59, 0x4b, 0x31, 0x4b, 0x57, 0xd7, 0xba,
+  0x38, 0x79, 0x81, 0x32, 0x83, 0x44, 0x3c, 0x3d, 0x04, 0x24, 0x7c, 0xa1,
+  0xa3, 0xc0, 0x0c, 0x3d, 0xa7, 0x7d, 0xbc, 0x86, 0x78, 0xae, 0x9d, 0x40,
+  0x9b, 0x98, 0xdd, 0x22, 0x13, 0xaa, 0x24, 0x73, 0xd6, 0x91, 0x2f, 0x9d,
+  0x75, 0xa4, 0xae, 0x76, 0x4e, 0xe9, 0xfc, 0x99, 0x6a, 0x0b, 0x0e, 0xbb,
+  0x21, 0xb9, 0x9e, 0xe7, 0x65, 0xfe, 0xfd, 0x31, 0x29, 0x1e, 0xec, 0x02,
+  0x49, 0x6a, 0x4e, 0xa3, 0xd5, 0xba, 0x9e, 0xb5, 0xb5, 0xbb, 0xae, 0x20,
+  0x48, 0x03, 0x9a, 0xca, 0x71, 0xab, 0x2e, 0xcc, 0x1d, 0x25, 0xc5, 0x40,
+  0x36, 0x09, 0x0f, 0x62, 0x3f, 0x6a, 0xd9, 0x33, 0xd8, 0xce, 0xec, 0xd7,
+  0x71, 0xb1, 0x96, 0x6f, 0x67, 0x46, 0x2e, 0xd4, 0xfa, 0xf6, 0xe4, 0xa4,
+  0xb5, 0x5f, 0x4f, 0xde, 0xad, 0x5b, 0xcd, 0x2d, 0x07, 0xb4, 0x93, 0x17,
+  0x7b, 0xd3, 0xc1, 0x33, 0xab, 0x7f, 0x61, 0xe8, 0x92, 0x3f, 0x7d, 0xf9,
+  0x05, 0x2d, 0x62, 0x49, 0x0c, 0xfa, 0x0c, 0x69, 0x0f, 0x8e, 0xba, 0x63,
+  0x79, 0x18, 0x23, 0x9b, 0x2c, 0x91, 0xc5, 0x4b, 0xb4, 0x24, 0x62, 0x24,
+  0x32, 0xc7, 0xee, 0x81, 0xb1, 0x5f, 0xcc, 0x28, 0x88, 0xe4, 0x91, 0x20,
+  0x50, 0x28, 0x33, 0xe7, 0x1c, 0x9d, 0xe6, 0x1a, 0x77, 0x8b, 0x30, 0xf7,
+  0xf9, 0xa2, 0xa0, 0xd2, 0xf0, 0x15, 0x2e, 0x0f, 0xac, 0x04, 0x92, 0xe8,
+  0xc6, 0x34, 0x1a, 0x59, 0xe6, 0xb0, 0xbb, 0x21, 0x81, 0x89, 0x13, 0x39,
+  0x85, 0x37, 0x9a, 0x00, 0x27, 0x2c, 0x7a, 0x65, 0x7c, 0x93, 0xf0, 0x0e,
+  0x09, 0xef, 0xc6, 0x60, 0xe4, 0x3b, 0x8d, 0xbd, 0x82, 0xc1, 0xf1, 0x8a,
+  0x63, 0xe2, 0xe2, 0xda, 0xe6, 0xa5, 0xd4, 0x84, 0x2d, 0xc2, 0xc5, 0x43,
+  0x81, 0x01, 0xe1, 0x2a, 0xc1, 0x6d, 0x1a, 0xbc, 0x67, 0x6c, 0x7e, 0x73,
+  0x31, 0x1d, 0x52, 0x94, 0xef, 0x52, 0xd8, 0xb0, 0xaf, 0x2f, 0x3a, 0xb8,
+  0x10, 0x43, 0x6c, 0x38, 0x34, 0xb0, 0xf6, 0xc3, 0x99, 0x21, 0x7b, 0x17,
+  0x7c, 0x1b, 0xf8, 0xff, 0xb6, 0x95, 0x93, 0xf2, 0x63, 0x55, 0x5b, 0x1e,
+  0x50, 0xb8, 0x58, 0x06, 0x2f, 0x59, 0x95, 0x64, 0x08, 0xdd, 0xfa, 0xe3,
+  0x20, 0xd9, 0xec, 0x94, 0x76, 0xf2, 0xde, 0x73, 0xb6, 0xd4, 0xd0, 0x44,
+  0x62, 0x76, 0x79, 0x64, 0x77, 0x21, 0xea, 0xa4, 0x82, 0xd2, 0xcb, 0x69,
+  0xa1, 0xb9, 0xf6, 0x2c, 0x99, 0x8b, 0x08, 0x25, 0xec, 0xb7, 0x69, 0xb1,
+  0x6c, 0x63, 0x0e, 0xf5, 0xc9, 0xb2, 0xdb, 0xf3, 0x6e, 0xf0, 0x88, 0x6d,
+  0x91, 0x58, 0xe2, 0xae, 0x48, 0x2b, 0x93, 0x6a, 0x02, 0x2b, 0xc3, 0x0e,
+  0x31, 0x94, 0xfa, 0x7d, 0xf2, 0xc4, 0xef, 0x94, 0xd9, 0xa0, 0x15, 0xa3,
+  0x7d, 0x68, 0x5d, 0xe1, 0x12, 0x18, 0x77, 0x14, 0x34, 0x2c, 0x0a, 0x3a,
+  0xc4, 0xf2, 0x30, 0xcd, 0x6f, 0x08, 0x23, 0x84, 0x44, 0xca, 0x89, 0x14,
+  0xae, 0xd5, 0x39, 0xe7, 0x6c, 0x0f, 0xef, 0xda, 0xfa, 0x00, 0x96, 0xd0,
+  0x76, 0xc6, 0x76, 0xf2, 0xc8, 0x92, 0x5f, 0x5b, 0x8c, 0x4e, 0xd5, 0x61,
+  0xeb, 0x58, 0x26, 0x05, 0xac, 0x7d, 0xfd, 0x80, 0xe2, 0xd9, 0xd5, 0x0e,
+  0x78, 0x26, 0xb7, 0xb7, 0xd2, 0xfd, 0x06, 0x14, 0x46, 0x13, 0x28, 0xaa,
+  0x03, 0x72, 0x5b, 0xed, 0x32, 0x86, 0xa4, 0xed, 0xf5, 0xf3, 0x6e, 0xe8,
+  0x2a, 0x3f, 0x74, 0xa3, 0x35, 0xe7, 0xde, 0xa0, 0xdb, 0x63, 0x5e, 0xed,
+  0x7e, 0x02, 0xd6, 0xc9, 0x6e, 0x20, 0xa9, 0x25, 0xe8, 0x88, 0x49, 0x0f,
+  0xa8, 0xb9, 0x1d, 0x2e, 0x8e, 0x62, 0x83, 0x60, 0x41, 0x00, 0x56, 0x67,
+  0x1d, 0x6a, 0x01, 0x2f, 0x8e, 0x67, 0x99, 0xc6, 0x98, 0x3e, 0x93, 0x55,
+  0xb2, 0xb1, 0x21, 0x74, 0xd7, 0x65, 0x5e, 0xcb, 0x1e, 0x7f, 0x54, 0x2e,
+  0x57, 0xc0, 0x21, 0xc9, 0xbe, 0x3c, 0xc2, 0x82, 0x56, 0x24, 0xf1, 0x1a,
+  0x3e, 0x3f, 0x30, 0x31, 0x34, 0x9d, 0x95, 0x75, 0x09, 0x3b, 0xd9, 0x09,
+  0xf1, 0x14, 0x80, 0x54, 0xa8, 0x39, 0x66, 0xc6, 0xd0, 0x55, 0xf4, 0xf1,
+  0x9c, 0x31, 0x75, 0xc0, 0x0d, 0x6a, 0x80, 0x76, 0xcc, 0xdf, 0xab, 0x0d,
+  0xea, 0xb1, 0x37, 0xa0, 0x19, 0x16, 0xb4, 0x55, 0xdf, 0x29, 0x75, 0xe3,
+  0xfe, 0x41, 0x15, 0xd8, 0xe0, 0xe6, 0x16, 0x56, 0xdc, 0xfc, 0xce, 0x59,
+  0x6a, 0x41, 0xc5, 0xc4, 0x18, 0x59, 0xcc, 0x8c, 0xa7, 0xa5, 0x1a, 0x44,
+  0x8c, 0xd6, 0xfa, 0xc0, 0x66, 0x90, 0x98, 0x03, 0x0d, 0xe2, 0x9a, 0x4d,
+  0x36, 0x91, 0xbc, 0x78, 0x0d, 0x3b, 0x8b, 0xa4, 0xf2, 0xd7, 0xc7, 0xd5,
+  0x1a, 0xe3, 0xf9, 0xeb, 0x4c, 0x86, 0x55, 0x63, 0x9d, 0x25, 0x05, 0x69,
+  0x4e, 0xaa, 0x49, 0xb2, 0xfb, 0x6c, 0xa4, 0x2b, 0x0d, 0xaf, 0x4d, 0xe8,
+  0xd6, 0xa9, 0x46, 0xb6, 0x43, 0x5c, 0x6d, 0x71, 0x08, 0x0f, 0x48, 0xc1,
+  0x8c, 0xfe, 0xc1, 0x2e, 0xb6, 0xfe, 0x28, 0x7a, 0x48, 0x6d, 0xbe, 0x9c,
+  0xb0, 0xfa, 0xa1, 0x05, 0xa3, 0x6b, 0x4b, 0xba, 0xc1, 0x36, 0xb7, 0xef,
+  0xb4, 0x1c, 0x96, 0x54, 0xac, 0xd7, 0x38, 0x57, 0x1c, 0x68, 0xfa, 0x69,
+  0x2b, 0x30, 0x60, 0xeb, 0xe4, 0x36, 0xc5, 0xec, 0x2a, 0x16, 0x2d, 0xbf,
+  0x58, 0xa7, 0x1a, 0x1e, 0xc5, 0xd0, 0x89, 0x7e, 0x20, 0x7c, 0x16, 0xb6,
+  0x5a, 0x53, 0x9f, 0x5c, 0x23, 0x54, 0xb4, 0x3b, 0x02, 0xe6, 0x65, 0x62,
+  0x0e, 0xc1, 0x31, 0xc2, 0x9b, 0x62, 0xe3, 0x43, 0x31, 0x42, 0xf3, 0xf8,
+  0xa3, 0x08, 0x47, 0x2a, 0xb9, 0x29, 0x72, 0x0c, 0xce, 0xb2, 0xca, 0xae,
+  0x57, 0x5b, 0x72, 0x7e, 0x15, 0x9a, 0x8c, 0x68, 0x4f, 0xee, 0xab, 0xeb,
+  0xd5, 0xda, 0x7d, 0xbf, 0x3b, 0xea, 0x5a, 0x8b, 0xdf, 0x34, 0x46, 0x95,
+  0x69, 0xff, 0xcc, 0x85, 0x45, 0x56, 0xdc, 0x33, 0xa2, 0x15, 0xd4, 0x01,
+  0xc5, 0xe6, 0x32, 0xfe, 0x81, 0x0e, 0x7b, 0xfc, 0xd1, 0x0d, 0xb2, 0x78,
+  0x99, 0x5e, 0x37, 0x88, 0x41, 0x14, 0xc4, 0x12, 0x30, 0xe8, 0x44, 0x2b,
+  0xea, 0x0b, 0x41, 0x14, 0xd9, 0x71, 0x95, 0xa2, 0xaf, 0x16, 0x40, 0x61,
+  0x01, 0x54, 0xac, 0x43, 0x60, 0x3c, 0x9b, 0xca, 0x25, 0x1e, 0x52, 0xa6,
+  0xf7, 0x8d, 0xfa, 0xe4, 0x33, 0xe5, 0xea, 0xd1, 0x16, 0x3a, 0x63, 0x42,
+  0x2f, 0x50, 0x2f, 0x05, 0x04, 0xd8, 0x09, 0x7b, 0x0a, 0xf6, 0x6a, 0x39,
+  0xc4, 0xdf, 0x91, 0x7f, 0xfa, 0xf6, 0xd3, 0x91, 0x53, 0x17, 0x68, 0x28,
+  0xab, 0x3b, 0x3c, 0x29, 0x78, 0x32, 0x32, 0x83, 0xb1, 0xc2, 0xea, 0xb0,
+  0x87, 0xe0, 0x8b, 0x43, 0x46, 0x12, 0xe8, 0x0f, 0x65, 0xed, 0x08, 0x77,
+  0x79, 0xbf, 0xdb, 0x6c, 0x52, 0x3c, 0x8e, 0xcb, 0x1e, 0x22, 0xec, 0x3b,
+  0x89, 0xfb, 0x57, 0x52, 0x21, 0x5b, 0xe6, 0x1c, 0xa6, 0x58, 0x7e, 0x11,
+  0xfd, 0x82, 0x0d, 0x15, 0x91, 0xc8, 0x0b, 0x1f, 0x53, 0xb9, 0x4d, 0x0f,
+  0x07, 0x35, 0x88, 0xac, 0x93, 0x65, 0x1a, 0xef, 0x69, 0x73, 0x79, 0x5c,
+  0x1e, 0xf7, 0xd5, 0x11, 0x8d, 0xc6, 0x98, 0x77, 0xae, 0xa4, 0xf0, 0x1e,
+  0xbf, 0x4e, 0x96, 0xd1, 0xd5, 0xd3, 0xcb, 0x7f, 0xc6, 0x24, 0xb9, 0x09,
+  0x6a, 0xbe, 0x17, 0xce, 0xf0, 0xdd, 0xd7, 0xfb, 0xf2, 0x66, 0x50, 0x57,
+  0x12, 0x3c, 0xd9, 0xca, 0xbd, 0x4d, 0xcc, 0xc0, 0x92, 0x5c, 0xd5, 0x1c,
+  0x7d, 0x7b, 0x94, 0xab, 0x99, 0x7f, 0x91, 0x5b, 0x1d, 0x2e, 0x44, 0x5a,
+  0x2c, 0x2f, 0x31, 0xaf, 0xd0, 0x58, 0xe3, 0x00, 0x40, 0x6f, 0xcf, 0xac,
+  0xf8, 0x74, 0xbd, 0x32, 0x46, 0x9f, 0x83, 0x62, 0x70, 0x4d, 0x32, 0xad,
+  0xda, 0xee, 0xb2, 0x8b, 0xd5, 0xe1, 0x70, 0x1d, 0xfd, 0x12, 0x99, 0x10,
+  0x67, 0x98, 0xca, 0x2b, 0xce, 0xb9, 0x0d, 0x4d, 0x3f, 0xd2, 0xc4, 0x8b,
+  0x45, 0xe6, 0x81, 0xf8, 0xa3, 0x53, 0x2b, 0xd8, 0x43, 0xe0, 0x26, 0xc1,
+  0x08, 0x6f, 0x39, 0x9f, 0xa9, 0x30, 0xf6, 0x36, 0xd2, 0x74, 0x41, 0x2a,
+  0x0f, 0xf6, 0x00, 0x19, 0xe0, 0x78, 0xf6, 0x6a, 0x37, 0x06, 0x34, 0x31,
+  0xc7, 0xd8, 0xce, 0x82, 0x60, 0xba, 0x9a, 0x19, 0xb9, 0x67, 0x17, 0x81,
+  0x3f, 0xb2, 0x4d, 0x05, 0xe8, 0x8d, 0xf7, 0xbe, 0x24, 0x76, 0x68, 0x96,
+  0xf9, 0x81, 0xa6, 0xac, 0x55, 0xbc, 0x47, 0x5f, 0x1a, 0x9e, 0x62, 0xb8,
+  0x89, 0x91, 0xe6, 0x70, 0xa2, 0x73, 0xaf, 0x41, 0xd7, 0x6f, 0x27, 0x6f,
+  0x7f, 0x62, 0xac, 0xcd, 0x52, 0xb3, 0xec, 0xbd, 0x9e, 0x46, 0xab, 0xc0,
+  0x09, 0xbc, 0xbf, 0x74, 0xd0, 0x2a, 0x48, 0x1e, 0x85, 0x91, 0xbf, 0xa4,
+  0xb9, 0x59, 0xda, 0x50, 0xf4, 0x62, 0x80, 0x45, 0x60, 0x05, 0x3d, 0x94,
+  0x19, 0x1c, 0x14, 0x63, 0x6f, 0xc2, 0x61, 0x8c, 0x44, 0x65, 0x17, 0xac,
+  0x15, 0x62, 0xe5, 0xcb, 0x21, 0xd3, 0x2c, 0x52, 0xbc, 0x68, 0xa1, 0xc2,
+  0xa8, 0xd7, 0x4f, 0x25, 0x5e, 0xbd, 0x5c, 0xc5, 0x27, 0x30, 0x64, 0x0d,
+  0xb7, 0x14, 0xed, 0xc5, 0xf0, 0xe5, 0x1c, 0x0a, 0x5c, 0xd6, 0x8f, 0xa9,
+  0xc6, 0x4e, 0xd3, 0xa6, 0x38, 0x10, 0xbc, 0x77, 0xa3, 0x90, 0x32, 0xa2,
+  0x59, 0x91, 0x2f, 0xda, 0x2e, 0x3e, 0xd0, 0x69, 0x0c, 0x80, 0x58, 0xaf,
+  0x61, 0x11, 0xeb, 0x16, 0xc5, 0x35, 0xc7, 0x62, 0x50, 0xdf, 0x9b, 0x72,
+  0x9b, 0x1f, 0x33, 0xf6, 0x78, 0x42, 0x41, 0x0f, 0xf3, 0x14, 0x50, 0xd8,
+  0xa0, 0x89, 0x9c, 0x5b, 0x0a, 0xea, 0x9c, 0x8e, 0xe9, 0xd8, 0x09, 0x71,
+  0xd7, 0x2e, 0x07, 0x60, 0x5c, 0x06, 0x72, 0x28, 0x65, 0x47, 0x3f, 0x32,
+  0x9b, 0x59, 0x30, 0x0f, 0x47, 0xe8, 0x52, 0x9a, 0x9a, 0x1b, 0xea, 0xe7,
+  0x59, 0x26, 0x0f, 0x8a, 0x3f, 0x36, 0xee, 0x9d, 0x1b, 0xa7, 0xae, 0x99,
+  0x47, 0xb0, 0x13, 0x9c, 0xc7, 0x2f, 0xcd, 0x61, 0x7a, 0x5c, 0x63, 0x7f,
+  0x91, 0xdf, 0xcd, 0x25, 0x8a, 0xbb, 0xb9, 0x62, 0x06, 0xef, 0x24, 0x0c,
+  0xb5, 0xc0, 0xf3, 0xb1, 0x5a, 0xd6, 0x00, 0x84, 0x77, 0xc7, 0xdd, 0xbe,
+  0x09, 0xbb, 0xb3, 0x6e, 0xb6, 0xc0, 0xe5, 0xa6, 0x6d, 0xa7, 0x7a, 0xa3,
+  0xce, 0xa5, 0x9b, 0x0a, 0xec, 0x8d, 0x4f, 0x93, 0xf3, 0x89, 0x51, 0x55,
+  0x05, 0x66, 0xe9, 0x13, 0x4f, 0x89, 0x86, 0xb3, 0xb3, 0x21, 0xa5, 0x2a,
+  0xe2, 0x7d, 0x79, 0xc8, 0x35, 0xd4, 0xd0, 0xa3, 0x13, 0x68, 0x19, 0xf0,
+  0x7f, 0xb2, 0x89, 0x76, 0xd1, 0xbe, 0x5e, 0x2a, 0xf9, 0x3e, 0xb2, 0xed,
+  0x3e, 0x1d, 0xa3, 0x12, 0x6e, 0xdc, 0xa2, 0x9d, 0x0e, 0x79, 0x8f, 0xa9,
+  0x91, 0xce, 0x1a, 0x24, 0x42, 0x65, 0xb6, 0xef, 0x6a, 0x95, 0x39, 0x9d,
+  0x3a, 0xb8, 0xb2, 0x5d, 0x47, 0x65, 0x86, 0xf8, 0x40, 0x6b, 0xd4, 0xe4,
+  0xef, 0xbc, 0x72, 0xe5, 0x01, 0x4e, 0x3d, 0x73, 0xe5, 0xd1, 0xc0, 0x88,
+  0x8e, 0x33, 0xa8, 0x6b, 0xdc, 0x19, 0x8d, 0xa3, 0x68, 0x91, 0x44, 0xfb,
+  0x06, 0xa5, 0xa6, 0xe5, 0x81, 0xae, 0x50, 0x4a, 0x9d, 0x57, 0x3e, 0xa5,
+  0x3b, 0x4b, 0xa9, 0x81, 0xf1, 0x28, 0xed, 0xe9, 0xd7, 0x3a, 0xa5, 0x16,
+  0x49, 0xb4, 0x6b, 0x0e, 0x60, 0xec, 0x75, 0x9a, 0x85, 0x0d, 0x51, 0x4e,
+  0xb5, 0x8d, 0x46, 0x1e, 0x59, 0x43, 0xe4, 0x80, 0xce, 0x11, 0x63, 0xb5,
+  0xb1, 0x82, 0xa0, 0x98, 0x39, 0x63, 0xd7, 0xd1, 0x13, 0x85, 0x39, 0x42,
+  0x3e, 0x69, 0x08, 0x87, 0x26, 0x09, 0xc6, 0x51, 0x48, 0xf2, 0xb4, 0x79,
+  0x12, 0xab, 0x77, 0x6e, 0x39, 0x78, 0xec, 0x47, 0x99, 0xb5, 0x9d, 0xfc,
+  0xe8, 0x36, 0xdf, 0x4d, 0xd4, 0xc7, 0x47, 0xdf, 0xf6, 0xd0, 0xcb, 0x4b,
+  0xc4, 0xeb, 0xd4, 0xe1, 0x30, 0x66, 0x4d, 0x8a, 0x08, 0x7e, 0x14, 0x17,
+  0x52, 0x01, 0xc0, 0xf2, 0xb0, 0xe0, 0xcb, 0x5e, 0xfe, 0xf3, 0x06, 0xa6,
+  0x4e, 0x18, 0xbd, 0x77, 0x99, 0xaa, 0xbb, 0x66, 0x80, 0x0c, 0xd6, 0xec,
+  0x5d, 0xfb, 0xd2, 0xa3, 0xbe, 0x5a, 0x47, 0x70, 0x19, 0x4f, 0x0e, 0x72,
+  0x69, 0xb9, 0xf5, 0xc5, 0x2b, 0xa3, 0x3a, 0xf7, 0x9d, 0xba, 0x8b, 0x23,
+  0xac, 0x15, 0xc9, 0x2d, 0xb9, 0x5b, 0xb0, 0x4a, 0xf0, 0x05, 0x3a, 0xba,
+  0xe0, 0x6a, 0x27, 0x87, 0x4f, 0xd6, 0xad, 0x05, 0x63, 0x7d, 0xd2, 0x4a,
+  0xb9, 0xa2, 0x83, 0xa9, 0x0b, 0x78, 0xa0, 0x05, 0xbd, 0xe7, 0x00, 0xf8,
+  0x3d, 0x8e, 0x7f, 0xad, 0xe1, 0xfe, 0xc7, 0x9c, 0x68, 0x4a, 0xab, 0xfd,
+  0x53, 0x2d, 0x55, 0x6a, 0x0a, 0x74, 0xec, 0x99, 0x53, 0x32, 0x58, 0xa0,
+  0x70, 0xef, 0x04, 0xd3, 0x6b, 0x9c, 0xfc, 0xc9, 0x57, 0xf9, 0x5c, 0x89,
+  0x4a, 0xd5, 0xd8, 0x76, 0xa3, 0x87, 0x50, 0x19, 0x2d, 0xd3, 0x0a, 0x68,
+  0x2e, 0x59, 0xf4, 0xe2, 0x85, 0x84, 0x12, 0x23, 0x84, 0xc7, 0x1c, 0x6a,
+  0x18, 0xef, 0x38, 0x5c, 0x70, 0xbe, 0x97, 0x7c, 0x0d, 0xea, 0xec, 0xef,
+  0x93, 0x43, 0x16, 0xaf, 0x12, 0xd6, 0x40, 0x0d, 0xb6, 0xe5, 0x43, 0x64,
+  0x74, 0xfd, 0x6d, 0x9c, 0x6d, 0x80, 0xfc, 0x07, 0xba, 0xf3, 0xb3, 0x4b,
+  0x7f, 0x00, 0x95, 0xf5, 0x8b, 0xcf, 0xbf, 0x7a, 0x05, 0x6c, 0xb5, 0x26,
+  0x3b, 0xb9, 0xb3, 0xdb, 0xb6, 0x89, 0xfd, 0xdc, 0x70, 0xb3, 0xf9, 0x6e,
+  0x91, 0xee, 0x6e, 0x98, 0x90, 0x2a, 0xa2, 0x39, 0x81, 0x27, 0xf9, 0x6a,
+  0xdf, 0x8a, 0xd7, 0xeb, 0xab, 0x6c, 0xbf, 0x22, 0xdf, 0xbf, 0x70, 0xa1,
+  0x31, 0xe2, 0x54, 0x9d, 0x09, 0xbd, 0x1f, 0xab, 0x82, 0x5c, 0x0a, 0xdb,
+  0x0b, 0xc4, 0xfb, 0x07, 0x3a, 0xd0, 0x45, 0xb7, 0xa9, 0x4a, 0xb3, 0xc1,
+  0x30, 0x2b, 0x1b, 0xa7, 0xf3, 0x80, 0x3b, 0xe3, 0xbd, 0x65, 0x79, 0xb9,
+  0x81, 0xdb, 0x66, 0xdd, 0x3c, 0x31, 0xa9, 0x2c, 0xc5, 0x0f, 0x9e, 0x8c,
+  0x30, 0xe4, 0x0d, 0xcf, 0x6c, 0xb2, 0x41, 0xae, 0xe6, 0x1c, 0xbd, 0x2f,
+  0x38, 0x6c, 0x30, 0x4d, 0x39, 0x89, 0x96, 0x3e, 0x9d, 0xa6, 0xe5, 0x7c,
+  0x99, 0xe7, 0x59, 0xa2, 0xe3, 0x5f, 0x15, 0xeb, 0xf9, 0x0e, 0x98, 0x8f,
+  0x8e, 0x58, 0x82, 0x11, 0x85, 0x03, 0x2f, 0x45, 0xd7, 0x18, 0x44, 0x4a,
+  0x33, 0x42, 0xb0, 0x24, 0x5b, 0xb1, 0x34, 0x65, 0xe9, 0xeb, 0x44, 0x6e,
+  0x68, 0x08, 0x46, 0x9e, 0x02, 0x78, 0x63, 0x6f, 0x13, 0xd3, 0xe9, 0xa2,
+  0x73, 0x3e, 0x7d, 0xde, 0x4a, 0xb3, 0x8d, 0x7d, 0x7d, 0x1a, 0x7a, 0xab,
+  0xc7, 0xcc, 0xe1, 0x8f, 0x5e, 0x8b, 0x98, 0x9a, 0xae, 0x56, 0x71, 0x04,
+  0xe4, 0x35, 0x07, 0x92, 0x26, 0xe8, 0x5e, 0xaa, 0xc4, 0x19, 0xaa, 0x8d,
+  0xb6, 0xd9, 0xe0, 0xd1, 0xe5, 0xbc, 0x1d, 0xd3, 0x75, 0x8e, 0xc7, 0x6b,
+  0xa9, 0x76, 0xcc, 0x74, 0x87, 0x2f, 0xc8, 0xad, 0xc6, 0xc8, 0xc3, 0x75,
+  0x6e, 0xce, 0xd6, 0xe5, 0xd6, 0x08, 0xbe, 0x32, 0x17, 0x62, 0x4f, 0x5a,
+  0xf8, 0x31, 0xf5, 0x2f, 0x90, 0x8d, 0x53, 0x8e, 0x5f, 0x48, 0xe8, 0xf4,
+  0xc3, 0x10, 0x42, 0xdf, 0xc6, 0xcf, 0x47, 0x84, 0x6d, 0x38, 0xe3, 0x3e,
+  0x21, 0xa6, 0x7d, 0xa9, 0x99, 0xa5, 0x67, 0x1d, 0x53, 0x41, 0xe7, 0x8c,
+  0xf8, 0xba, 0xe8, 0x2a, 0x4c, 0x17, 0xcb, 0xcb, 0x24, 0x2e, 0x56, 0x5b,
+  0xbc, 0xb0, 0x61, 0xac, 0xeb, 0x69, 0xa5, 0x66, 0x7d, 0xb9, 0x86, 0x5c,
+  0xfb, 0x26, 0xab, 0xc0, 0xf3, 0xe8, 0xd7, 0x28, 0xbf, 0x3e, 0xcb, 0xd2,
+  0xb8, 0x84, 0x7d, 0x2b, 0x08, 0x1b, 0x96, 0x71, 0xc9, 0x3d, 0x48, 0x90,
+  0x95, 0xf8, 0x3d, 0x92, 0xa1, 0x25, 0xdf, 0x44, 0xf9, 0xb1, 0x30, 0xc2,
+  0xeb, 0x14, 0xf3, 0x17, 0xe3, 0x78, 0x56, 0x09, 0x9d, 0x2d, 0x8b, 0xb8,
+  0x85, 0x6d, 0x10, 0xaa, 0x2d, 0x73, 0x94, 0x14, 0xf6, 0xbe, 0xc6, 0xd4,
+  0x4a, 0xdd, 0xba, 0xcd, 0x81, 0xfc, 0xdb, 0xa6, 0xa6, 0x8b, 0x58, 0xad,
+  0x99, 0xdb, 0x8c, 0x36, 0x91, 0x23, 0x92, 0xbd, 0x7d, 0x9f, 0x57, 0x93,
+  0x34, 0x2d, 0x58, 0x21, 0x67, 0x38, 0x46, 0xd7, 0x42, 0x5a, 0x9e, 0x28,
+  0x73, 0xcb, 0x1c, 0x36, 0x77, 0x68, 0x53, 0xbc, 0x15, 0xbf, 0xbb, 0x04,
+  0xed, 0xd3, 0x7c, 0x2a, 0x6c, 0x43, 0xba, 0xc9, 0xa5, 0x2d, 0x2d, 0x07,
+  0x3f, 0xd9, 0x99, 0xeb, 0x36, 0xba, 0x06, 0xc9, 0x87, 0xbf, 0xa3, 0x4a,
+  0x54, 0x2a, 0x82, 0xe7, 0x43, 0x3b, 0x13, 0xa8, 0x4f, 0x03, 0xc3, 0x95,
+  0x25, 0xba, 0xc7, 0x58, 0x87, 0xc2, 0x5b, 0x74, 0x28, 0x24, 0x7a, 0xaf,
+  0xaf, 0xd9, 0xb1, 0x70, 0xe6, 0x80, 0xbb, 0xe6, 0xac, 0x3f, 0xf3, 0xba,
+  0x89, 0x1e, 0x7a, 0x7f, 0x71, 0x1d, 0xa5, 0x02, 0x0d, 0x41, 0xfe, 0xbf,
+  0x35, 0xe7, 0xc4, 0x27, 0xce, 0x16, 0x6e, 0xc7, 0xf1, 0xa0, 0x73, 0x13,
+  0x13, 0x1a, 0x6a, 0x45, 0xc7, 0x5a, 0x6a, 0x8a, 0x25, 0x84, 0x22, 0x14,
+  0xdb, 0x78, 0x0d, 0x5d, 0xa0, 0xb4, 0xee, 0x3a, 0x6e, 0x2c, 0x6a, 0xef,
+  0x25, 0x1c, 0xba, 0x65, 0xc5, 0x73, 0xdd, 0xd3, 0x1d, 0xed, 0x9c, 0x81,
+  0xc4, 0xb4, 0x48, 0x40, 0x9d, 0x5c, 0x41, 0x47, 0xc4, 0x78, 0x0e, 0x4c,
+  0x9e, 0x15, 0x1a, 0xf8, 0x50, 0xdc, 0x25, 0xc4, 0x1c, 0xed, 0x94, 0x37,
+  0xa3, 0x49, 0x4b, 0x4c, 0x4a, 0x8f, 0xab, 0x98, 0x8e, 0xc4, 0x1f, 0xce,
+  0xd1, 0x45, 0x17, 0x1a, 0x08, 0x6c, 0x08, 0x2b, 0x1b, 0xfc, 0x40, 0x2f,
+  0x45, 0xea, 0xe9, 0x94, 0x43, 0x5a, 0x2a, 0x12, 0xe6, 0xe6, 0x3d, 0x2e,
+  0xa3, 0xcc, 0xcc, 0x6a, 0x14, 0x3f, 0xee, 0xd7, 0xc0, 0xb9, 0x78, 0x18,
+  0x47, 0xa6, 0x5b, 0xb6, 0x85, 0x97, 0x69, 0x75, 0x8c, 0xd9, 0x91, 0x46,
+  0x7b, 0xa2, 0x31, 0x7e, 0xdc, 0x55, 0xd1, 0xa9, 0xe4, 0x51, 0xae, 0x1f,
+  0xce, 0x0a, 0x5f, 0xa2, 0x30, 0xa1, 0x6e, 0xd9, 0x99, 0x80, 0xdb, 0xc6,
+  0x9e, 0xdc, 0x40, 0x29, 0x65, 0x82, 0x8c, 0xa1, 0x85, 0x5c, 0xc6, 0x98,
+  0x5a, 0xc6, 0x98, 0x0d, 0x60, 0x0c, 0x45, 0x6f, 0x0f, 0x5c, 0x6d, 0x86,
+  0xb0, 0x68, 0xa4, 0x56, 0xae, 0x51, 0xdd, 0xb2, 0x62, 0x26, 0x65, 0x09,
+  0x73, 0x36, 0xae, 0x8e, 0x28, 0x34, 0x9d, 0x79, 0x45, 0x4b, 0x2a, 0x1d,
+  0xec, 0x30, 0x83, 0xf0, 0x74, 0x71, 0xec, 0x3b, 0x1b, 0x71, 0x41, 0x92,
+  0xe8, 0x0e, 0xd3, 0xb0, 0x6c, 0x70, 0xa3, 0x1b, 0xc3, 0x78, 0x7d, 0xf6,
+  0xc5, 0x57, 0x9f, 0x5d, 0x47, 0xaf, 0x72, 0x98, 0xfc, 0x4b, 0x60, 0x99,
+  0x38, 0x92, 0xb3, 0x0d, 0x85, 0xff, 0x57, 0x55, 0x1d, 0x3a, 0xe7, 0xbf,
+  0xbd, 0xfa, 0x6c, 0x5c, 0x7f, 0x7e, 0x4b, 0xec, 0x06, 0x3d, 0x78, 0x87,
+  0x4e, 0x04, 0xb7, 0xec, 0xe8, 0x9d, 0x58, 0x0d, 0x98, 0x74, 0x38, 0xfc,
+  0x88, 0x2c, 0x56, 0x24, 0x74, 0x60, 0xad, 0x6c, 0x61, 0xf0, 0x62, 0x19,
+  0xc2, 0x26, 0x13, 0xe4, 0x49, 0x59, 0xac, 0x9e, 0xec, 0xf0, 0xed, 0x45,
+  0x46, 0xa9, 0xff, 0x6c, 0x66, 0x2e, 0xe7, 0xc6, 0x09, 0x59, 0x77, 0xcd,
+  0xb1, 0x9e, 0xf8, 0xfc, 0x6d, 0x40, 0x70, 0x12, 0x2a, 0x2c, 0xcd, 0x46,
+  0x4c, 0x69, 0xaa, 0xe4, 0x85, 0x67, 0x27, 0xf4, 0xc4, 0xf5, 0x53, 0xb4,
+  0x94, 0x90, 0xe7, 0x3e, 0xf9, 0x81, 0xa1, 0x7b, 0x44, 0xba, 0xda, 0x12,
+  0x2a, 0x43, 0x67, 0xa0, 0xc2, 0xe4, 0x1e, 0x7a, 0xab, 0xbc, 0x30, 0xfd,
+  0xf1, 0x47, 0xc0, 0x9c, 0x41, 0x15, 0x78, 0x10, 0x0b, 0xbb, 0x83, 0x9a,
+  0xdb, 0x93, 0x2b, 0xf6, 0xf1, 0x59, 0x69, 0x42, 0xc4, 0x16, 0x02, 0xd5,
+  0x15, 0x42, 0x06, 0xc3, 0x0d, 0x3d, 0x78, 0x07, 0x0a, 0xb0, 0xf4, 0x2a,
+  0xaa, 0xb6, 0x7b, 0x4e, 0x88, 0x23, 0x45, 0x2f, 0xdc, 0xf4, 0x85, 0xe2,
+  0x32, 0x20, 0xc3, 0xb6, 0x4f, 0x4a, 0x50, 0x54, 0xe9, 0xa2, 0x50, 0x79,
+  0x16, 0x3d, 0x8d, 0x46, 0xff, 0x06, 0x63, 0xb5, 0x43, 0xed, 0x92, 0x96,
+  0x2e, 0x39, 0xa8, 0x2d, 0xc9, 0x97, 0x83, 0x61, 0xcf, 0xad, 0xb3, 0xef,
+  0xbf, 0xba, 0x57, 0x84, 0xea, 0x17, 0x05, 0x4f, 0x11, 0xc1, 0x02, 0x34,
+  0xaa, 0x1b, 0x0c, 0xdd, 0xb3, 0xd0, 0x1a, 0x67, 0x01, 0x48, 0x5a, 0x26,
+  0x99, 0x65, 0xda, 0xf6, 0x12, 0xbc, 0x92, 0x4e, 0x6d, 0xc4, 0x92, 0x47,
+  0x46, 0xd4, 0xd5, 0x3a, 0x51, 0x19, 0x8d, 0x0a, 0x70, 0x42, 0xa7, 0x0b,
+  0xd9, 0x74, 0xb0, 0xe5, 0xb3, 0xb5, 0xf1, 0x74, 0x4f, 0xc7, 0x06, 0xa6,
+  0x69, 0x3d, 0xb1, 0x6f, 0xfb, 0xa8, 0x27, 0xa9, 0x77, 0xf7, 0x84, 0xd2,
+  0xc6, 0x6e, 0x1e, 0x78, 0x9c, 0x2a, 0xbe, 0x08, 0x6d, 0x37, 0xbb, 0x9b,
+  0x15, 0x87, 0xbd, 0x35, 0x44, 0x97, 0x6a, 0x6b, 0xe6, 0xf4, 0xa3, 0xd6,
+  0x4f, 0x9a, 0x57, 0xc6, 0xdb, 0xa2, 0x4a, 0x46, 0xac, 0x88, 0x0c, 0xab,
+  0x18, 0xfe, 0x69, 0x0e, 0x5d, 0x54, 0x25, 0x2b, 0x4c, 0xf5, 0x33, 0x0d,
+  0x8f, 0x71, 0x23, 0x74, 0xba, 0xed, 0x56, 0xdc, 0xd3, 0xe1, 0xf4, 0x33,
+  0x53, 0x4f, 0xab, 0xb8, 0x8e, 0xbe, 0x46, 0x47, 0x2d, 0xeb, 0xbb, 0x24,
+  0xa2, 0x82, 0x75, 0x31, 0x60, 0xeb, 0x7a, 0x01, 0x46, 0x46, 0x6e, 0x83,
+  0x74, 0x20, 0x6b, 0xa7, 0x6a, 0xcc, 0xc1, 0x0f, 0xd8, 0x6d, 0x18, 0xf0,
+  0xe0, 0x54, 0xe5, 0x99, 0x73, 0x61, 0xee, 0x6f, 0xb5, 0xf6, 0xce, 0xbc,
+  0xb3, 0x77, 0x4e, 0x06, 0x31, 0x51, 0xc4, 0x03, 0xd9, 0xea, 0xcb, 0x4c,
+  0x88, 0xc4, 0xfa, 0xe3, 0x8d, 0x27, 0x9e, 0x6c, 0xa1, 0xf2, 0xf5, 0x3b,
+  0xd2, 0x3c, 0xd5, 0xc5, 0x1d, 0xaf, 0xd3, 0xb3, 0x0f, 0x2a, 0x39, 0x7a,
+  0xed, 0x93, 0xbb, 0xe8, 0x26, 0xcb, 0x97, 0xb1, 0xeb, 0xf3, 0x25, 0x1d,
+  0xbf, 0xa3, 0xb8, 0x4e, 0xb8, 0xac, 0xe3, 0x62, 0xef, 0xf8, 0x3d, 0x9e,
+  0x8a, 0x8b, 0x96, 0xef, 0x79, 0x1d, 0x6d, 0x12, 0x5a, 0x5c, 0x68, 0x97,
+  0xdb, 0x45, 0xf0, 0xa3, 0xf0, 0xd9, 0x0c, 0xd1, 0xef, 0x2b, 0xcb, 0xb3,
+  0x47, 0xff, 0x17, 0x13, 0x1d, 0x65, 0x06, 0xf8, 0x2c, 0x01, 0x00
 };
-unsigned int wxMathML_lisp_gz_len = 18414;
+unsigned int wxMathML_lisp_gz_len = 19643;
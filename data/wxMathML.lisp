@@ -69,12 +69,78 @@
 	  tmp-x)
       x))
 
+  ;; In the framed protocol the XML messages we send are preceded by a
+  ;; header: ASCII STX, a character that tells the type of the message, the
+  ;; length of the message in bytes and a colon. This way wxMaxima knows
+  ;; when a message is complete without searching it for its closing tag.
+  (defvar $wxframedprotocol nil "Precede XML messages by their type and length?")
+
+  (defun wx-utf8-length (str)
+    #+gcl (length str)
+    #-gcl (let ((len 0))
+	    (loop for ch across str do
+		 (let ((code (char-code ch)))
+		   (incf len (cond ((< code #x80) 1)
+				   ((< code #x800) 2)
+				   ((< code #x10000) 3)
+				   (t 4)))))
+	    len))
+
+  (defun wx-send (type str)
+    (when $wxframedprotocol
+      (format t "~a~a~d:" (code-char 2) type (wx-utf8-length str)))
+    (princ str))
+
+  ;; In the compact encoding the XML of math output is tokenized: Each tag
+  ;; from *wx-compact-tags* is replaced by a single control character (code
+  ;; #x10 plus its position in the list), all other opening tags are sent as
+  ;; ASCII ENQ, the contents of the tag and ASCII ACK and all closing tags
+  ;; are replaced by ASCII BEL. Text keeps its XML escapes. The result is
+  ;; enclosed in <mthc> and </mthc>. wxMaxima's MathParser knows the same
+  ;; list of tags.
+  (defvar $wxcompactxml nil "Send math output in the compact encoding?")
+
+  (defvar *wx-compact-tags*
+    '("r" "v" "n" "p" "f" "e" "t" "i" "fn" "fnm" "g" "s" "q" "h" "mtr" "mtd"))
+
+  (defun wx-compact-xml (str)
+    (with-output-to-string (out)
+      (let ((pos 0)
+	    (len (length str)))
+	(loop while (< pos len) do
+	     (let ((start (position #\< str :start pos)))
+	       (when (null start)
+		 (write-string str out :start pos)
+		 (return))
+	       (write-string str out :start pos :end start)
+	       (let ((end (position #\> str :start start)))
+		 (when (null end)
+		   (write-string str out :start start)
+		   (return))
+		 (let* ((inner (subseq str (1+ start) end))
+			(selfclosing (and (> (length inner) 0)
+					  (char= (char inner (1- (length inner))) #\/))))
+		   (when selfclosing
+		     (setq inner (subseq inner 0 (1- (length inner)))))
+		   (if (and (> (length inner) 0) (char= (char inner 0) #\/))
+		       (write-char (code-char 7) out)
+		       (let ((code (position inner *wx-compact-tags* :test #'string=)))
+			 (if code
+			     (write-char (code-char (+ #x10 code)) out)
+			     (progn
+			       (write-char (code-char 5) out)
+			       (write-string inner out)
+			       (write-char (code-char 6) out)))
+			 (when selfclosing
+			   (write-char (code-char 7) out)))))
+		 (setq pos (1+ end))))))))
+
   ;; Allow the user to communicate what to display in the statusbar whilst
   ;; the current program is running
   (defun $wxstatusbar (&rest status)
     #+clisp (finish-output)
-    (format t "<statusbar>~a</statusbar>~%" (wxxml-fix-string
-					     (apply '$sconcat status)))
+    (wx-send #\s (format nil "<statusbar>~a</statusbar>~%" (wxxml-fix-string
+							     (apply '$sconcat status))))
     #+clisp (finish-output)
     )
 
@@ -1172,8 +1238,11 @@
     #+clisp (finish-output)
     (let ((*print-circle* nil)
 	  (*wxxml-mratp* (format nil "~{~a~}" (cdr (checkrat x)))))
-      (mapc #'princ
-	    (wxxml x '("<mth>") '("</mth>") 'mparen 'mparen)))
+      (let ((xml (format nil "~{~a~}"
+			 (wxxml x '("<mth>") '("</mth>") 'mparen 'mparen))))
+	(wx-send #\m (if $wxcompactxml
+			 (concatenate 'string "<mthc>" (wx-compact-xml xml) "</mthc>")
+			 xml))))
     #+clisp (finish-output)
     )
 
@@ -1880,15 +1949,45 @@
 	    (mtell "<value>~M</value>" (wxxml-fix-string(eval var)))))
     (format t "</variable>"))
 
+  (defun wx-query-variable-xml (var)
+    (format nil "<variable>~%<name>~a</name>~a</variable>~%"
+	    (wxxml-fix-string (maybe-invert-string-case var))
+	    (with-output-to-string (*standard-output*)
+	      (ignore-errors
+		(let (($display2d nil))
+		  (mtell "<value>~M</value>" (wxxml-fix-string (meval (intern var)))))))))
+
+  ;; The XML for each watched variable wxMaxima has been sent last
+  (defvar *wx-variable-values* (make-hash-table :test #'equal))
+
+  ;; Send the values of all variables wxMaxima watches in a single message.
+  ;; If onlychanged is true variables whose value hasn't changed since it has
+  ;; been sent last are omitted.
+  (defun wx-query-variables (onlychanged &rest vars)
+    #+clisp (finish-output)
+    (wx-send #\v (with-output-to-string (out)
+		   (format out "<variables>~%")
+		   (dolist (var vars)
+		     (let ((xml (wx-query-variable-xml var)))
+		       (unless (and onlychanged
+				    (equal xml (gethash var *wx-variable-values*)))
+			 (setf (gethash var *wx-variable-values*) xml)
+			 (write-string xml out))))
+		   (format out "</variables>~%")))
+    #+clisp (finish-output)
+    )
+
   (defun wx-query-variable (var)
-    (format t "<variables>~%<variable>~%<name>~a</name>" (wxxml-fix-string (maybe-invert-string-case var)))
-    (ignore-errors
-      (let (($display2d nil))
-	(mtell "<value>~M</value>" (wxxml-fix-string(meval (intern var))))))
-      (format t "</variable>~%</variables>~%"))
+    (wx-query-variables nil var))
 
   (defun wx-print-variables ()
     #+clisp (finish-output)
+    (wx-send #\v (with-output-to-string (*standard-output*)
+		   (wx-print-variables-xml)))
+    #+clisp (finish-output)
+    )
+
+  (defun wx-print-variables-xml ()
     (format t "<variables>")
     (wx-print-variable '$maxima_userdir)
     (wx-print-variable '$maxima_tempdir)
@@ -1906,9 +2005,7 @@
     (format t "<variable><name>*lisp-version*</name><value>~a</value></variable>"
 	    #+sbcl (ensure-readably-printable-string (lisp-implementation-version))
 	    #-sbcl (lisp-implementation-version))
-    (format t "</variables>~%")
-    #+clisp (finish-output)
-    )
+    (format t "</variables>~%"))
 
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
   ;; A function that allows wxMaxima to set maxima's current directory to that
@@ -63,12 +63,12 @@ AbsCell::~AbsCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> AbsCell::GetInnerCells()
+Cell *AbsCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_innerCell)
-    innerCells.push_back(m_innerCell);
-  return innerCells;
+  Cell *innerCells[] = {m_innerCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void AbsCell::SetInner(Cell *inner)
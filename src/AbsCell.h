@@ -59,12 +59,16 @@ public:
 
   ~AbsCell();
   
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 1;}
+  Cell *GetInnerCell(int index);
 
   void SetInner(Cell *inner);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   bool BreakUp();
 
   void Unbreak();
@@ -53,14 +53,12 @@ AtCell::~AtCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> AtCell::GetInnerCells()
+Cell *AtCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_baseCell)
-    innerCells.push_back(m_baseCell);
-  if(m_indexCell)
-    innerCells.push_back(m_indexCell);
-  return innerCells;
+  Cell *innerCells[] = {m_baseCell, m_indexCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void AtCell::SetIndex(Cell *index)
@@ -32,8 +32,12 @@ public:
 
   ~AtCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 2;}
+  Cell *GetInnerCell(int index);
   Cell *Copy();
+
+  size_t SizeInBytes()
+  { return sizeof(*this); }
   
   void SetBase(Cell *base);
   void SetIndex(Cell *index);
@@ -36,28 +36,53 @@ wxString Cell::GetToolTip(const wxPoint &point)
     return wxEmptyString;
 
   wxString toolTip;
-  std::list<Cell *> innerCells = GetInnerCells();
-  for(std::list<Cell *>::iterator it = innerCells.begin(); it != innerCells.end(); ++it)
+  for(int i = 0; i < GetInnerCellCount(); i++)
   {
-    if(*it != NULL)
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
     {
-      if((toolTip = (*it)->GetToolTip(point)) != wxEmptyString)
+      if((toolTip = inner->GetToolTip(point)) != wxEmptyString)
         return toolTip;
     }
   }
-  return m_toolTip;
+  return GetLocalToolTip();
+}
+
+Cell::Extras *Cell::GetExtras()
+{
+  if(m_extras == NULL)
+    m_extras = new Extras;
+  return m_extras;
+}
+
+void Cell::SetToolTip(const wxString &tooltip)
+{
+  if((m_extras == NULL) && tooltip.IsEmpty())
+    return;
+  GetExtras()->m_toolTip = tooltip;
+}
+
+void Cell::ResetToolTip()
+{
+  if(m_extras != NULL)
+    m_extras->m_toolTip = m_extras->m_initialToolTip;
+}
+
+void Cell::SetAltCopyText(wxString text)
+{
+  if((m_extras == NULL) && text.IsEmpty())
+    return;
+  GetExtras()->m_altCopyText = text;
 }
 
 Cell::Cell(Cell *group, Configuration **config)
-#if wxUSE_ACCESSIBILITY
-  :wxAccessible()
-#endif
 {
   m_lastZoomFactor = -1;
   m_clientWidth_old = -1;
   m_group = group;
   m_textStyle = TS_DEFAULT;
   m_cellPointers = NULL;
+  m_extras = NULL;
   m_group = group;
   m_parent = group;
   m_configuration = config;
@@ -84,7 +109,9 @@ Cell::Cell(Cell *group, Configuration **config)
   m_SuppressMultiplicationDot = false;
   m_imageBorderWidth = 0;
   SetCurrentPoint(wxPoint(-1, -1));
-  m_toolTip = (*m_configuration)->GetDefaultCellToolTip();
+  wxString toolTip = (*m_configuration)->GetDefaultCellToolTip();
+  if(!toolTip.IsEmpty())
+    GetExtras()->m_toolTip = GetExtras()->m_initialToolTip = toolTip;
   m_fontSize = (*m_configuration)->GetMathFontSize();
 }
 
@@ -103,6 +130,7 @@ Cell::~Cell()
     wxDELETE(tmp);
     last->m_next = NULL;
   }
+  wxDELETE(m_extras);
 }
 
 void Cell::SetType(CellType type)
@@ -209,11 +237,11 @@ int Cell::CellsInListRecursive()
   while(tmp != NULL)
   {
     cells ++;
-    std::list<Cell*> cellList = tmp->GetInnerCells();
-    for (std::list<Cell *>::iterator it = cellList.begin(); it != cellList.end(); ++it)
+    for (int i = 0; i < tmp->GetInnerCellCount(); i++)
     {
-      if(*it != NULL)
-        cells += (*it)->CellsInListRecursive();
+      Cell *inner = tmp->GetInnerCell(i);
+      if(inner != NULL)
+        cells += inner->CellsInListRecursive();
     }
     tmp = tmp->m_next;
   }
@@ -228,11 +256,11 @@ void Cell::SetGroup(Cell *group)
     wxASSERT (group->GetType() == MC_TYPE_GROUP);
   }
   
-  std::list<Cell*> cellList = GetInnerCells();
-  for (std::list<Cell *>::iterator it = cellList.begin(); it != cellList.end(); ++it)
+  for (int i = 0; i < GetInnerCellCount(); i++)
   {
-    if(*it != NULL)
-      (*it)->SetGroupList(group);
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
+      inner->SetGroupList(group);
   }
 }
 
@@ -394,7 +422,7 @@ void Cell::Draw(wxPoint point)
 
 #if wxUSE_ACCESSIBILITY
   if((*m_configuration)->GetWorkSheet() != NULL)
-    NotifyEvent(0, (*m_configuration)->GetWorkSheet(), wxOBJID_CLIENT, wxOBJID_CLIENT);
+    wxAccessible::NotifyEvent(0, (*m_configuration)->GetWorkSheet(), wxOBJID_CLIENT, wxOBJID_CLIENT);
 #endif
 }
 
@@ -1058,13 +1086,15 @@ void Cell::SelectInner(wxRect &rect, Cell **first, Cell **last)
   *first = NULL;
   *last = NULL;
 
-  std::list<Cell*> cellList = GetInnerCells();
-  for (std::list<Cell *>::iterator it = cellList.begin(); it != cellList.end(); ++it)
-    if(*it != NULL)
+  for (int i = 0; i < GetInnerCellCount(); i++)
+  {
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
     {
-      if ((*it)->ContainsRect(rect))
-        (*it)->SelectRect(rect, first, last);
+      if (inner->ContainsRect(rect))
+        inner->SelectRect(rect, first, last);
     }
+  }
 
   if (*first == NULL || *last == NULL)
   {
@@ -1103,10 +1133,12 @@ void Cell::ResetData()
   m_lineWidth = -1;
   m_maxCenter = -1;
   m_maxDrop   = -1;
-  std::list<Cell*> cellList = GetInnerCells();
-  for (std::list<Cell *>::iterator it = cellList.begin(); it != cellList.end(); ++it)
-    if(*it != NULL)
-      (*it)->ResetData();
+  for (int i = 0; i < GetInnerCellCount(); i++)
+  {
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
+      inner->ResetData();
+  }
 }
 
 Cell *Cell::first()
@@ -1138,10 +1170,12 @@ void Cell::Unbreak()
     m_nextToDraw->m_previousToDraw = this;
 
   // Unbreak the inner cells, too
-  std::list<Cell *> innerCells = GetInnerCells();
-  for(std::list<Cell *>::iterator it = innerCells.begin(); it != innerCells.end(); ++it)
-    if(*it != NULL)
-      (*it)->Unbreak();
+  for (int i = 0; i < GetInnerCellCount(); i++)
+  {
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
+      inner->Unbreak();
+  }
 }
 
 void Cell::UnbreakList()
@@ -1199,8 +1233,8 @@ void Cell::UnsetPen()
  */
 void Cell::CopyData(Cell *s, Cell *t)
 {
-  t->m_altCopyText = s->m_altCopyText;
-  t->m_toolTip = s->m_toolTip;
+  if(s->m_extras != NULL)
+    *t->GetExtras() = *s->m_extras;
   t->m_forceBreakLine = s->m_forceBreakLine;
   t->m_type = s->m_type;
   t->m_textStyle = s->m_textStyle;
@@ -1280,8 +1314,8 @@ wxAccStatus Cell::GetParent (wxAccessible **parent)
   if(parent == NULL)
     return wxACC_FAIL;
 
-  if(*parent != this)
-    *parent = m_parent;
+  if((m_parent != NULL) && (m_parent != this))
+    *parent = m_parent->GetAccessible();
   else
   {
     if((*m_configuration)->GetWorkSheet() != NULL)
@@ -1310,7 +1344,11 @@ wxAccStatus Cell::GetValue (int childId, wxString *strValue)
 
 wxAccStatus Cell::GetChildCount (int *childCount)
 {
-  *childCount = GetInnerCells().size();
+  // Accessibility only knows about the slots that actually contain a cell.
+  *childCount = 0;
+  for (int i = 0; i < GetInnerCellCount(); i++)
+    if(GetInnerCell(i) != NULL)
+      (*childCount)++;
   return wxACC_OK;
 }
 
@@ -1368,14 +1406,16 @@ wxAccStatus Cell::GetChild(int childId, Cell  **child)
   {
     if (childId > 0)
     {
-      std::list<Cell*> cellList = m_parent->GetInnerCells();
       int cnt = 1;
-      for (std::list<Cell *>::iterator it = cellList.begin(); it != cellList.end(); ++it)
-        if (cnt++ == childId)
+      for (int i = 0; i < m_parent->GetInnerCellCount(); i++)
+      {
+        Cell *inner = m_parent->GetInnerCell(i);
+        if ((inner != NULL) && (cnt++ == childId))
         {
-          *child = *it;
+          *child = inner;
           return wxACC_OK;
         }
+      }
     }
     return wxACC_FAIL;
   }
@@ -1445,6 +1485,87 @@ wxAccStatus Cell::GetRole (int WXUNUSED(childId), wxAccRole *role)
   else return wxACC_FAIL;
 }
 
+wxAccessible *Cell::GetAccessible()
+{
+  return m_cellPointers->GetAccessible(this);
+}
+
+wxAccStatus CellAccessible::GetChild(int childId, wxAccessible **child)
+{
+  if(child == NULL)
+    return wxACC_FAIL;
+
+  Cell *cell = NULL;
+  wxAccStatus status = m_cell->GetChild(childId, &cell);
+  if(cell != NULL)
+    *child = cell->GetAccessible();
+  else
+    *child = NULL;
+  return status;
+}
+
+wxAccStatus CellAccessible::GetFocus(int *childId, wxAccessible **child)
+{
+  Cell *cell = NULL;
+  wxAccStatus status = m_cell->GetFocus(childId, &cell);
+  if(child != NULL)
+  {
+    if(cell != NULL)
+      *child = cell->GetAccessible();
+    else
+      *child = NULL;
+  }
+  return status;
+}
+
+wxAccStatus CellAccessible::HitTest(const wxPoint &pt,
+                                   int *childId, wxAccessible **childObject)
+{
+  Cell *cell = NULL;
+  wxAccStatus status = m_cell->HitTest(pt, childId, &cell);
+  if(childObject != NULL)
+  {
+    if(cell != NULL)
+      *childObject = cell->GetAccessible();
+    else
+      *childObject = NULL;
+  }
+  return status;
+}
+
+Cell::CellPointers::~CellPointers()
+{
+  for(AccessibleList::iterator it = m_accessibles.begin(); it != m_accessibles.end(); ++it)
+    delete it->second;
+}
+
+wxAccessible *Cell::CellPointers::GetAccessible(Cell *cell)
+{
+  AccessibleList::iterator it = m_accessibles.find(cell);
+  if(it != m_accessibles.end())
+    return it->second;
+
+  // The screen reader may still hold the objects it has asked for and
+  // navigate from them to their parents => they live as long as their cell
+  // does and are deleted by DropAccessible().
+  CellAccessible *accessible = new CellAccessible(cell);
+  m_accessibles[cell] = accessible;
+  return accessible;
+}
+
+void Cell::CellPointers::DropAccessible(Cell *cell)
+{
+  if(m_accessibles.empty())
+    return;
+
+  AccessibleList::iterator it = m_accessibles.find(cell);
+  if(it != m_accessibles.end())
+  {
+    delete it->second;
+    m_accessibles.erase(it);
+  }
+}
+
 #endif
 
 Cell::CellPointers::CellPointers(wxScrolledCanvas *mathCtrl)
@@ -1501,17 +1622,24 @@ void Cell::MarkAsDeleted()
     m_cellPointers->m_activeCell = NULL;
   if(this == m_cellPointers->m_currentTextCell)
     m_cellPointers->m_currentTextCell = NULL;
+  if(!m_cellPointers->m_groupsInWorkers.empty())
+    m_cellPointers->m_groupsInWorkers.remove(this);
+  if(!m_cellPointers->m_groupsToHarvest.empty())
+    m_cellPointers->m_groupsToHarvest.remove(this);
 
   if((this == m_cellPointers->m_selectionStart) || (this == m_cellPointers->m_selectionEnd))
     m_cellPointers->m_selectionStart = m_cellPointers->m_selectionEnd = NULL;
   if(this == m_cellPointers->m_cellUnderPointer)
     m_cellPointers->m_cellUnderPointer = NULL;
+#if wxUSE_ACCESSIBILITY
+  m_cellPointers->DropAccessible(this);
+#endif
 
   // Delete all pointers to the cells this cell contains
-  std::list<Cell *> innerCells = GetInnerCells();
-  for(std::list<Cell *>::iterator it = innerCells.begin(); it != innerCells.end(); ++it)
+  for (int i = 0; i < GetInnerCellCount(); i++)
   {
-    if(*it != NULL)
-      (*it)->MarkAsDeleted();
+    Cell *inner = GetInnerCell(i);
+    if(inner != NULL)
+      inner->MarkAsDeleted();
   }
 }
@@ -36,6 +36,7 @@
 #include <wx/hashmap.h>
 #include <wx/scrolwin.h>
 #endif // wxUSE_ACCESSIBILITY
+#include "CellPool.h"
 #include "Configuration.h"
 #include "TextStyle.h"
 
@@ -93,20 +94,29 @@ enum CellType
   they have to delete() it.
 
   On systems where wxWidget supports (and is compiled with)
-  accessibility features Cell is derived from wxAccessible which
-  allows every element in the worksheet to identify itself to an
-  eventual screen reader.
+  accessibility features every cell can identify itself to an
+  eventual screen reader. The wxAccessible objects the screen reader
+  talks to are only created for the cells it actually asks for, see
+  CellAccessible.
 
  */
 #if wxUSE_ACCESSIBILITY
-class Cell: public wxAccessible
-#else
-class Cell
+class CellAccessible;
 #endif
+
+class Cell
 {
   public:
   Cell(Cell *group, Configuration **config);
 
+  //! Cells are allocated from the CellPool which is much faster than the heap
+  static void *operator new(size_t size)
+  { return CellPool::Allocate(size); }
+
+  //! Returns the memory of a cell to the CellPool
+  static void operator delete(void *ptr, size_t size)
+  { CellPool::Free(ptr, size); }
+
   /*! Scale font sizes and line widths according to the zoom factor.
 
     Is used for displaying/printing/exporting of text/maths
@@ -131,9 +141,12 @@ class Cell
   //! Accessibility: What is the contents of this cell?
   virtual wxAccStatus GetValue (int childId, wxString *strValue);
   virtual wxAccStatus GetRole (int childId, wxAccRole *role);
+  //! Accessibility: What happens if the user activates this cell?
+  virtual wxAccStatus GetDefaultAction (int WXUNUSED(childId), wxString *WXUNUSED(actionName))
+  { return wxACC_NOT_IMPLEMENTED; }
+  //! The object that represents this cell for the screen reader. Created on demand.
+  wxAccessible *GetAccessible();
 #endif
-  
-  wxString m_toolTip;
 
   /*! Returns the ToolTip this cell provides.
 
@@ -640,14 +653,14 @@ class Cell
     separately (and on separate lines).
    */
   Cell *m_previousToDraw;
-  bool m_bigSkip;
+  bool m_bigSkip:1;
   /*! true means:  This cell is broken into two or more lines.
     
     Long abs(), conjugate(), fraction and similar cells can be displayed as 2D objects,
     but will be displayed in their linear form (and therefore broken into lines) if they
     end up to be wider than the screen. In this case m_isBrokenIntoLines is true.
    */
-  bool m_isBrokenIntoLines;
+  bool m_isBrokenIntoLines:1;
   /*! True means: This cell is not to be drawn.
 
     Currently the following items fall into this category:
@@ -655,7 +668,18 @@ class Cell
      - plus signs within numbers
      - most multiplication dots.
    */
-  bool m_isHidden;
+  bool m_isHidden:1;
+
+  /*! Do we want to begin this cell with a center dot if it is part of a product?
+
+    Maxima will represent a product like (a*b*c) by a list like the following:
+    [*,a,b,c]. This would result us in converting (a*b*c) to the following LaTeX
+    code: \\left(\\cdot a ß\\cdot b \\cdot c\\right) which obviously is one \\cdot too
+    many => we need parenthesis cells to set this flag for the first cell in 
+    their "inner cell" list.
+   */
+  bool m_SuppressMultiplicationDot:1;
+
 
   /*! Determine if this cell contains text that isn't code
 
@@ -751,8 +775,14 @@ class Cell
 
   bool IsMath();
 
-  void SetAltCopyText(wxString text)
-  { m_altCopyText = text; }
+  void SetAltCopyText(wxString text);
+
+  /* Text that should end up on the clipboard if this cell is copied as text.
+
+     \attention  The alternative copy text is not checked in all cell types!
+  */
+  wxString GetAltCopyText()
+  { if(m_extras == NULL) return wxEmptyString; else return m_extras->m_altCopyText; }
 
   /*! Attach a copy of the list of cells that follows this one to a cell
     
@@ -769,22 +799,35 @@ class Cell
   */
   virtual Cell *Copy() = 0;
 
-  /*! Do we want to begin this cell with a center dot if it is part of a product?
+  /*! The number of bytes this cell occupies
 
-    Maxima will represent a product like (a*b*c) by a list like the following:
-    [*,a,b,c]. This would result us in converting (a*b*c) to the following LaTeX
-    code: \\left(\\cdot a ß\\cdot b \\cdot c\\right) which obviously is one \\cdot too
-    many => we need parenthesis cells to set this flag for the first cell in 
-    their "inner cell" list.
+    Doesn't include the memory its strings, bitmaps or the cells it contains
+    allocate. Used by Worksheet::MemoryReport().
    */
-  bool m_SuppressMultiplicationDot;
+  virtual size_t SizeInBytes() = 0;
 
   //! Set the tooltip of this math cell. wxEmptyString means: no tooltip.
-  void SetToolTip(const wxString &tooltip){m_toolTip = tooltip;}
+  void SetToolTip(const wxString &tooltip);
+  //! Revert the tooltip to the one that was active when this cell was created
+  void ResetToolTip();
+  //! The tooltip of this cell without looking at the cells it contains
+  wxString GetLocalToolTip()
+  { if(m_extras == NULL) return wxEmptyString; else return m_extras->m_toolTip; }
   void SetCurrentPoint(wxPoint point){m_currentPoint = point;}
   void SetCurrentPoint(int x, int y){m_currentPoint = wxPoint(x,y);}
   wxPoint GetCurrentPoint(){return m_currentPoint;}
-  
+
+  /*! The number of slots for cells this cell contains
+
+    Together with GetInnerCell() this allows to iterate over the cells this
+    cell contains without having to allocate a list of them which would mean
+    a memory allocation per cell on traversing the cell tree.
+   */
+  virtual int GetInnerCellCount() = 0;
+
+  //! The cell in slot index of this cell. NULL if this slot currently is empty.
+  virtual Cell *GetInnerCell(int index) = 0;
+
 protected:
   /*! The point in the work sheet at which this cell begins.
 
@@ -812,20 +855,31 @@ protected:
   Cell *m_parent;
 
   //! Does this cell begin with a forced page break?
-  bool m_breakPage;
+  bool m_breakPage:1;
   //! Are we allowed to add a line break before this cell?
-  bool m_breakLine;
+  bool m_breakLine:1;
   //! true means we force this cell to begin with a line break.  
-  bool m_forceBreakLine;
-  bool m_highlight;
-  /* Text that should end up on the clipboard if this cell is copied as text.
+  bool m_forceBreakLine:1;
+  bool m_highlight:1;
 
-     \attention  m_altCopyText is not check in all cell types!
-  */
-  wxString m_altCopyText;
-  Configuration **m_configuration;
+  /*! The strings only few cells need
 
-virtual std::list<Cell *> GetInnerCells() = 0;
+    Every wxString costs a few dozen bytes even if it is empty. Since most cells
+    have neither a tooltip nor an alternative copy text these strings are only
+    allocated if one of them is set to a non-empty value.
+   */
+  struct Extras
+  {
+    wxString m_toolTip;
+    //! The tooltip that was active when the cell was created
+    wxString m_initialToolTip;
+    wxString m_altCopyText;
+  };
+  //! The strings only few cells need. NULL if all of them are empty.
+  Extras *m_extras;
+  //! Returns m_extras, allocating it if necessary
+  Extras *GetExtras();
+  Configuration **m_configuration;
 
 protected:
   //! The height of this cell.
@@ -946,6 +1000,17 @@ public:
       NULL means that maxima isn't currently evaluating a cell.
     */
     Cell *m_workingGroup;
+    /*! The group cells additional maxima processes evaluate.
+
+      Used for finding out if the output of a maxima worker belongs to a cell
+      that still exists.
+    */
+    std::list<Cell *> m_groupsInWorkers;
+    /*! The group cells whose definitions haven't been added to the autocompletion, yet.
+
+      Maxima has already been sent their commands.
+    */
+    std::list<Cell *> m_groupsToHarvest;
     /*! The currently selected string. 
 
       Since this string is defined here it is available in every editor cell
@@ -967,6 +1032,14 @@ public:
     //! Forget where the keyboard selection was started
     void ResetKeyboardSelectionStart()
       { m_cellKeyboardSelectionStartedIn = NULL; }
+
+#if wxUSE_ACCESSIBILITY
+    ~CellPointers();
+    //! Returns the accessibility object for a cell, creating it if necessary
+    wxAccessible *GetAccessible(Cell *cell);
+    //! Deletes the accessibility object of a cell, if there is one
+    void DropAccessible(Cell *cell);
+#endif
   
     /*! The first cell of the currently selected range of Cells.
     
@@ -1012,6 +1085,14 @@ public:
     wxScrolledCanvas *m_mathCtrl;
     //! The image counter for saving .wxmx files
     int m_wxmxImgCounter;
+#if wxUSE_ACCESSIBILITY
+    WX_DECLARE_VOIDPTR_HASH_MAP(CellAccessible *, AccessibleList);
+    /*! The accessibility objects that currently exist for any cell
+
+      Only the cells a screen reader has asked about have one.
+     */
+    AccessibleList m_accessibles;
+#endif
   };
 
 protected:
@@ -1024,6 +1105,45 @@ private:
   double m_lastZoomFactor;
 };
 
+#if wxUSE_ACCESSIBILITY
+/*! The object that represents a cell for a screen reader
+
+  Only a tiny fraction of all cells are ever looked at by a screen reader.
+  Therefore cells aren't wxAccessible objects themselves: Cell::GetAccessible()
+  creates a CellAccessible that forwards all questions to the cell, if they are
+  needed. Cell::CellPointers owns these objects and deletes them when their cell
+  is deleted or when too many of them have accumulated.
+ */
+class CellAccessible: public wxAccessible
+{
+public:
+  explicit CellAccessible(Cell *cell) : wxAccessible()
+  { m_cell = cell; }
+
+  virtual wxAccStatus GetDescription(int childId, wxString *description)
+  { return m_cell->GetDescription(childId, description); }
+  virtual wxAccStatus GetParent (wxAccessible **parent)
+  { return m_cell->GetParent(parent); }
+  virtual wxAccStatus GetChildCount (int *childCount)
+  { return m_cell->GetChildCount(childCount); }
+  virtual wxAccStatus GetChild (int childId, wxAccessible **child);
+  virtual wxAccStatus GetFocus (int *childId, wxAccessible **child);
+  virtual wxAccStatus GetLocation (wxRect &rect, int elementId)
+  { return m_cell->GetLocation(rect, elementId); }
+  virtual wxAccStatus HitTest (const wxPoint &pt,
+                               int *childId, wxAccessible **childObject);
+  virtual wxAccStatus GetValue (int childId, wxString *strValue)
+  { return m_cell->GetValue(childId, strValue); }
+  virtual wxAccStatus GetRole (int childId, wxAccRole *role)
+  { return m_cell->GetRole(childId, role); }
+  virtual wxAccStatus GetDefaultAction (int childId, wxString *actionName)
+  { return m_cell->GetDefaultAction(childId, actionName); }
+
+private:
+  Cell *m_cell;
+};
+#endif
+
 #endif // MATHCELL_H
 
 
@@ -0,0 +1,86 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class CellPool
+
+  CellPool provides the memory all cells are allocated from.
+ */
+
+#include "CellPool.h"
+#include <new>
+
+CellPool::FreeBlock *CellPool::m_freeLists[CellPool::m_sizeClasses] = {NULL};
+size_t CellPool::m_bytesReserved = 0;
+wxCriticalSection CellPool::m_lock;
+
+void *CellPool::Allocate(size_t size)
+{
+  if ((size == 0) || (size > m_maxBlockSize))
+    return ::operator new(size);
+
+  size_t sizeClass = (size - 1) / m_granularity;
+
+  wxCriticalSectionLocker lock(m_lock);
+  if (m_freeLists[sizeClass] == NULL)
+    Refill(sizeClass);
+
+  FreeBlock *block = m_freeLists[sizeClass];
+  m_freeLists[sizeClass] = block->m_next;
+  return block;
+}
+
+void CellPool::Free(void *ptr, size_t size)
+{
+  if (ptr == NULL)
+    return;
+
+  if ((size == 0) || (size > m_maxBlockSize))
+  {
+    ::operator delete(ptr);
+    return;
+  }
+
+  size_t sizeClass = (size - 1) / m_granularity;
+
+  wxCriticalSectionLocker lock(m_lock);
+  FreeBlock *block = static_cast<FreeBlock *>(ptr);
+  block->m_next = m_freeLists[sizeClass];
+  m_freeLists[sizeClass] = block;
+}
+
+void CellPool::Refill(size_t sizeClass)
+{
+  size_t blockSize = (sizeClass + 1) * m_granularity;
+  size_t blocks = m_chunkSize / blockSize;
+  // Throws std::bad_alloc just like the plain operator new would do.
+  char *chunk = static_cast<char *>(::operator new(blocks * blockSize));
+  m_bytesReserved += blocks * blockSize;
+
+  // Link the blocks in ascending order so consecutive cells end up next to
+  // each other in memory.
+  for (size_t i = blocks; i > 0; i--)
+  {
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + (i - 1) * blockSize);
+    block->m_next = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = block;
+  }
+}
@@ -0,0 +1,86 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class CellPool
+
+  CellPool provides the memory all cells are allocated from.
+ */
+
+#ifndef CELLPOOL_H
+#define CELLPOOL_H
+
+#include <cstddef>
+#include <wx/thread.h>
+
+/*! A pool allocator for cells
+
+  Maxima's output is converted into thousands of small cells that are freed
+  again as soon as the next output replaces them. Getting each of them from the
+  general-purpose heap is slow and fragments the heap. The pool instead carves
+  chunks of memory into blocks of fixed size classes and keeps a free list per
+  size class: Allocating or freeing a cell is a matter of popping or pushing
+  a list element.
+
+  Memory that has been handed to the pool is never returned to the operating
+  system, but is reused for the next cells of the same size. Objects that are
+  bigger than the biggest size class are forwarded to the heap.
+ */
+class CellPool
+{
+public:
+  //! Returns a block of memory that can hold an object of the given size
+  static void *Allocate(size_t size);
+
+  //! Hands a block obtained from Allocate() back to the pool
+  static void Free(void *ptr, size_t size);
+
+  //! The number of bytes the pool has obtained from the heap so far
+  static size_t BytesReserved()
+  { return m_bytesReserved; }
+
+private:
+  //! All block sizes are multiples of this number of bytes
+  static const size_t m_granularity = 16;
+  //! Objects bigger than this are allocated directly on the heap
+  static const size_t m_maxBlockSize = 2048;
+  //! The number of size classes
+  static const size_t m_sizeClasses = m_maxBlockSize / m_granularity;
+  //! How many bytes we request from the heap at once
+  static const size_t m_chunkSize = 64 * 1024;
+
+  //! An unused block. Its memory is re-used as the link to the next unused block.
+  struct FreeBlock
+  {
+    FreeBlock *m_next;
+  };
+
+  //! Carves a new chunk into blocks for the given size class
+  static void Refill(size_t sizeClass);
+
+  //! The unused blocks of each size class
+  static FreeBlock *m_freeLists[m_sizeClasses];
+  static size_t m_bytesReserved;
+  //! Cells are created by the GUI thread, but also by the background threads
+  static wxCriticalSection m_lock;
+};
+
+#endif // CELLPOOL_H
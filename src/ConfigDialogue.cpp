@@ -319,6 +319,18 @@ void ConfigDialogue::SetProperties()
   m_openHCaret->SetToolTip("If this checkbox is set a new code cell is opened as soon as maxima requests data. If it isn't set a new code cell is opened in this case as soon as the user starts typing in code.");
   m_restartOnReEvaluation->SetToolTip(
           _("Maxima provides no \"forget all\" command that flushes all settings a maxima session could make. wxMaxima therefore normally defaults to starting a fresh maxima process every time the worksheet is to be re-evaluated. As this needs a little bit of time this switch allows to disable this behavior."));
+  m_pipelineCommands->SetToolTip(
+          _("Send the next commands of the evaluation queue while maxima still works on the current one. Commands that might ask a question are never sent ahead, and if the evaluation is aborted maxima still executes the commands it already has been sent."));
+  m_reuseOutput->SetToolTip(
+          _("Don't send cells to maxima whose input and whose dependencies haven't changed since maxima has evaluated them, but show the output maxima has answered the last time. Only cells that don't define anything and call no function that might have side effects are skipped."));
+  m_compactXml->SetToolTip(
+          _("Takes effect when maxima is started the next time."));
+  m_framedProtocol->SetToolTip(
+          _("Lets wxMaxima find the end of long outputs faster. Takes effect when maxima is started the next time."));
+  m_maximaWorkers->SetToolTip(
+          _("How many additional maxima processes evaluate the sections that are marked as independent of the rest of the worksheet in parallel."));
+  m_keepStandbyMaxima->SetToolTip(
+          _("Makes restarting maxima faster, but the second maxima process needs as much memory as a freshly started maxima does all the time."));
   m_maximaUserLocation->SetToolTip(_("Enter the path to the Maxima executable."));
   m_additionalParameters->SetToolTip(_("Additional parameters for Maxima"
                                                " (e.g. -l clisp)."));
@@ -524,6 +536,12 @@ void ConfigDialogue::SetProperties()
   m_keepPercentWithSpecials->SetValue(keepPercent);
   m_abortOnError->SetValue(configuration->GetAbortOnError());
   m_restartOnReEvaluation->SetValue(configuration->RestartOnReEvaluation());
+  m_pipelineCommands->SetValue(configuration->PipelineCommands());
+  m_reuseOutput->SetValue(configuration->ReuseOutput());
+  m_compactXml->SetValue(configuration->CompactXml());
+  m_framedProtocol->SetValue(configuration->FramedProtocol());
+  m_maximaWorkers->SetValue(configuration->MaximaWorkers());
+  m_keepStandbyMaxima->SetValue(configuration->KeepStandbyMaxima());
   m_defaultFramerate->SetValue(defaultFramerate);
   m_defaultPlotWidth->SetValue(defaultPlotWidth);
   m_defaultPlotHeight->SetValue(defaultPlotHeight);
@@ -1007,6 +1025,28 @@ wxPanel *ConfigDialogue::CreateMaximaPanel()
 
   m_restartOnReEvaluation = new wxCheckBox(panel, -1, _("Start a new maxima for each re-evaluation"));
   vsizer->Add(m_restartOnReEvaluation, 0, wxALL, 5);
+
+  m_pipelineCommands = new wxCheckBox(panel, -1, _("Send commands before maxima has finished the previous ones"));
+  vsizer->Add(m_pipelineCommands, 0, wxALL, 5);
+
+  m_reuseOutput = new wxCheckBox(panel, -1, _("Reuse the output of cells that would produce the same output"));
+  vsizer->Add(m_reuseOutput, 0, wxALL, 5);
+
+  m_compactXml = new wxCheckBox(panel, -1, _("Ask maxima to send math in a compact encoding"));
+  vsizer->Add(m_compactXml, 0, wxALL, 5);
+
+  m_framedProtocol = new wxCheckBox(panel, -1, _("Ask maxima to announce the length of its messages"));
+  vsizer->Add(m_framedProtocol, 0, wxALL, 5);
+
+  wxBoxSizer *workersSizer = new wxBoxSizer(wxHORIZONTAL);
+  wxStaticText *mw = new wxStaticText(panel, -1, _("Additional maxima processes for independent sections:"));
+  m_maximaWorkers = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(100*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 1, 16);
+  workersSizer->Add(mw, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  workersSizer->Add(m_maximaWorkers, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  vsizer->Add(workersSizer);
+
+  m_keepStandbyMaxima = new wxCheckBox(panel, -1, _("Keep a second maxima running that takes over on restart"));
+  vsizer->Add(m_keepStandbyMaxima, 0, wxALL, 5);
   panel->SetSizerAndFit(vsizer);
 
   return panel;
@@ -1172,6 +1212,12 @@ void ConfigDialogue::WriteSettings()
   Configuration *configuration = m_configuration;
   configuration->SetAbortOnError(m_abortOnError->GetValue());
   configuration->RestartOnReEvaluation(m_restartOnReEvaluation->GetValue());
+  configuration->PipelineCommands(m_pipelineCommands->GetValue());
+  configuration->ReuseOutput(m_reuseOutput->GetValue());
+  configuration->CompactXml(m_compactXml->GetValue());
+  configuration->FramedProtocol(m_framedProtocol->GetValue());
+  configuration->MaximaWorkers(m_maximaWorkers->GetValue());
+  configuration->KeepStandbyMaxima(m_keepStandbyMaxima->GetValue());
   configuration->MaximaUserLocation(m_maximaUserLocation->GetValue());
   configuration->AutodetectMaxima(m_autodetectMaxima->GetValue());
   config->Write(wxT("parameters"), m_additionalParameters->GetValue());
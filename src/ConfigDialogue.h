@@ -261,6 +261,12 @@ protected:
   wxCheckBox *m_saveSize;
   wxCheckBox *m_abortOnError;
   wxCheckBox *m_restartOnReEvaluation;
+  wxCheckBox *m_pipelineCommands;
+  wxCheckBox *m_reuseOutput;
+  wxCheckBox *m_compactXml;
+  wxCheckBox *m_framedProtocol;
+  wxSpinCtrl *m_maximaWorkers;
+  wxCheckBox *m_keepStandbyMaxima;
   wxCheckBox *m_wrapLatexMath;
   wxCheckBox *m_savePanes;
   wxCheckBox *m_usepngCairo;
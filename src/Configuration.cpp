@@ -41,13 +41,22 @@ Configuration::Configuration(wxDC *dc) : m_dc(dc)
   m_documentclassOptions = wxT("fleqn");
   
   m_inLispMode = false;
+  m_headless = false;
   m_htmlEquationFormat = mathJaX_TeX;
   m_autodetectMaxima = true;
   m_BackgroundBrush = *wxWHITE_BRUSH;
   m_clipToDrawRegion = true;
+  m_cacheOutput = false;
+  m_styleGeneration = 0;
   m_fontChanged = true;
   m_mathJaxURL_UseUser = false;
   m_TOCshowsSectionNumbers = false;
+  m_framedProtocol = false;
+  m_compactXml = false;
+  m_pipelineCommands = false;
+  m_maximaWorkers = 2;
+  m_keepStandbyMaxima = false;
+  m_reuseOutput = false;
   m_antialiassingDC = NULL;
   m_parenthesisDrawMode = unknown;
   m_mathJaxURL = wxT("https://cdnjs.cloudflare.com/ajax/libs/mathjax/2.7.5/MathJax.js?config=TeX-AMS_HTML");
@@ -360,6 +369,12 @@ void Configuration::ReadConfig()
   }
   
   config->Read(wxT("TOCshowsSectionNumbers"), &m_TOCshowsSectionNumbers);
+  config->Read(wxT("framedProtocol"), &m_framedProtocol);
+  config->Read(wxT("compactXml"), &m_compactXml);
+  config->Read(wxT("pipelineCommands"), &m_pipelineCommands);
+  config->Read(wxT("maximaWorkers"), &m_maximaWorkers);
+  config->Read(wxT("keepStandbyMaxima"), &m_keepStandbyMaxima);
+  config->Read(wxT("reuseOutput"), &m_reuseOutput);
   config->Read(wxT("autoWrapMode"), &m_autoWrap);
   config->Read(wxT("mathJaxURL_UseUser"), &m_mathJaxURL_UseUser);
   config->Read(wxT("useUnicodeMaths"), &m_useUnicodeMaths);
@@ -703,6 +718,7 @@ wxString Configuration::MaximaDefaultLocation()
 
 void Configuration::ReadStyles(wxString file)
 {
+  m_styleGeneration++;
   wxConfigBase *config = NULL;
   if (file == wxEmptyString)
     config = wxConfig::Get();
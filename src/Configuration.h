@@ -712,6 +712,70 @@ public:
 
   bool TocShowsSectionNumbers(){return m_TOCshowsSectionNumbers;}
 
+  /*! Do we ask maxima to precede its XML messages by their type and length?
+
+    Takes effect when maxima is started the next time.
+   */
+  bool FramedProtocol(){return m_framedProtocol;}
+  void FramedProtocol(bool framed)
+    {
+      wxConfig::Get()->Write(wxT("framedProtocol"), (m_framedProtocol = framed));
+    }
+
+  /*! Do we ask maxima to send math in the compact encoding instead of as XML?
+
+    Takes effect when maxima is started the next time.
+   */
+  bool CompactXml(){return m_compactXml;}
+  void CompactXml(bool compact)
+    {
+      wxConfig::Get()->Write(wxT("compactXml"), (m_compactXml = compact));
+    }
+
+  /*! Do we send commands to maxima before it has finished the previous ones?
+
+    Maxima reads commands that already have been sent as the answer to a
+    question. Therefore cells that are known to ask questions aren't sent
+    ahead. If the evaluation is aborted maxima still executes the commands that
+    already have been sent.
+   */
+  bool PipelineCommands(){return m_pipelineCommands;}
+  void PipelineCommands(bool pipeline)
+    {
+      wxConfig::Get()->Write(wxT("pipelineCommands"), (m_pipelineCommands = pipeline));
+    }
+
+  /*! Do we restore the output of cells whose input and dependencies haven't changed?
+
+    Only cells that don't define anything can be skipped: maxima doesn't learn
+    what a skipped cell would have told it.
+   */
+  bool ReuseOutput(){return m_reuseOutput;}
+  void ReuseOutput(bool reuse)
+    {
+      wxConfig::Get()->Write(wxT("reuseOutput"), (m_reuseOutput = reuse));
+    }
+
+  //! How many additional maxima processes may evaluate independent sections?
+  int MaximaWorkers(){return m_maximaWorkers;}
+  void MaximaWorkers(int workers)
+    {
+      wxConfig::Get()->Write(wxT("maximaWorkers"), (m_maximaWorkers = workers));
+    }
+
+  /*! Do we keep a second maxima running that takes over on restarting maxima?
+
+    The standby maxima has already been started and sent everything wxMaxima
+    tells a new maxima => restarting maxima doesn't need to wait for it.
+    Off by default as the standby process permanently occupies the memory of
+    a second maxima.
+   */
+  bool KeepStandbyMaxima(){return m_keepStandbyMaxima;}
+  void KeepStandbyMaxima(bool keep)
+    {
+      wxConfig::Get()->Write(wxT("keepStandbyMaxima"), (m_keepStandbyMaxima = keep));
+    }
+
   void UseUnicodeMaths(bool useunicodemaths)
     {
       wxConfig::Get()->Write(wxT("useUnicodeMaths"), (m_useUnicodeMaths = useunicodemaths));
@@ -768,6 +832,12 @@ public:
   bool ClipToDrawRegion(){return m_clipToDrawRegion;}
   //! Do we want to save time by only redrawing the area currently shown on the screen?
   void ClipToDrawRegion(bool clipToDrawRegion){m_clipToDrawRegion = clipToDrawRegion; m_forceUpdate = true;}
+  //! May GroupCells draw their output from a bitmap cache? Only true while drawing the worksheet.
+  bool CacheOutput(){return m_cacheOutput;}
+  //! May GroupCells draw their output from a bitmap cache?
+  void CacheOutput(bool cacheOutput){m_cacheOutput = cacheOutput;}
+  //! Is increased every time the styles are read => tells if a rendered cell is outdated
+  long StyleGeneration(){return m_styleGeneration;}
   //! Request adjusting the worksheet size?
   void AdjustWorksheetSize(bool adjust)
     { m_adjustWorksheetSizeNeeded = adjust; }
@@ -781,6 +851,12 @@ public:
   void MaximaShareDir(wxString dir){m_maximaShareDir = dir;}
   void InLispMode(bool lisp){m_inLispMode = lisp;}
   bool InLispMode(){return m_inLispMode;}
+  /*! Is the worksheet evaluated without ever being displayed?
+
+    In this case cells are never laid out or drawn.
+   */
+  bool Headless(){return m_headless;}
+  void Headless(bool headless){m_headless = headless;}
   Style m_styles[NUMBEROFSTYLES];
 private:
   //! Autodetect maxima's location?
@@ -861,6 +937,8 @@ private:
   wxString m_maximaShareDir;
   bool m_forceUpdate;
   bool m_clipToDrawRegion;
+  bool m_cacheOutput;
+  long m_styleGeneration;
   bool m_outdated;
   wxString m_defaultToolTip;
   bool m_TeXFonts;
@@ -883,10 +961,23 @@ private:
   int m_showLength;
   //!< don't add ; in lisp mode
   bool m_inLispMode;
+  bool m_headless;
   bool m_copyRTF;
   bool m_copySVG;
   bool m_copyEMF;
   bool m_TOCshowsSectionNumbers;
+  //! Do we ask maxima to precede its XML messages by their type and length?
+  bool m_framedProtocol;
+  //! Do we ask maxima to send math in the compact encoding?
+  bool m_compactXml;
+  //! Do we send commands to maxima before it has finished the previous ones?
+  bool m_pipelineCommands;
+  //! How many additional maxima processes may evaluate independent sections?
+  int m_maximaWorkers;
+  //! Do we keep a second maxima running that takes over on restarting maxima?
+  bool m_keepStandbyMaxima;
+  //! Do we restore the output of cells whose input and dependencies haven't changed?
+  bool m_reuseOutput;
   bool m_useUnicodeMaths;
   bool m_indentMaths;
   bool m_abortOnError;
@@ -63,16 +63,12 @@ ConjugateCell::~ConjugateCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> ConjugateCell::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  if(m_innerCell)
-    innerCells.push_back(m_innerCell);
-  if(m_open)
-    innerCells.push_back(m_open);
-  if(m_close)
-    innerCells.push_back(m_close);
-  return innerCells;
+Cell *ConjugateCell::GetInnerCell(int index)
+{
+  Cell *innerCells[] = {m_innerCell, m_open, m_close};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void ConjugateCell::SetInner(Cell *inner)
@@ -52,12 +52,16 @@ public:
 
   ~ConjugateCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 3;}
+  Cell *GetInnerCell(int index);
 
   void SetInner(Cell *inner);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   bool BreakUp();
 
   void Unbreak();
@@ -55,14 +55,12 @@ DiffCell::~DiffCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> DiffCell::GetInnerCells()
+Cell *DiffCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_baseCell)
-    innerCells.push_back(m_baseCell);
-  if(m_diffCell)
-    innerCells.push_back(m_diffCell);
-  return innerCells;
+  Cell *innerCells[] = {m_baseCell, m_diffCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 
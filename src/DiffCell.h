@@ -32,10 +32,14 @@ public:
 
   ~DiffCell();
   
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 2;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetBase(Cell *base);
 
   void SetDiff(Cell *diff);
@@ -406,12 +406,6 @@ void EditorCell::MarkAsDeleted()
   Cell::MarkAsDeleted();
 }
 
-std::list<Cell *> EditorCell::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  return innerCells;
-}
-
 wxString EditorCell::ToTeX()
 {
   wxString text = m_text;
@@ -947,38 +941,46 @@ void EditorCell::Draw(wxPoint point1)
         TextCurrentPoint.x += width;
       }
     }
-    //
-    // Draw the caret
-    //
+    UnsetPen();
 
-    if (m_displayCaret && m_hasFocus && IsActive())
-    {
-      unsigned int caretInLine = 0;
-      unsigned int caretInColumn = 0;
+  }
+}
+
+void EditorCell::DrawCaret()
+{
+  if (m_isHidden || !(m_displayCaret && m_hasFocus && IsActive()))
+    return;
+
+  if ((m_currentPoint.x < 0) || (m_currentPoint.y < 0))
+    return;
+
+  Configuration *configuration = (*m_configuration);
+  wxDC *dc = configuration->GetDC();
+  wxPoint point = m_currentPoint;
+  SetFont();
 
-      PositionToXY(m_positionOfCaret, &caretInColumn, &caretInLine);
+  unsigned int caretInLine = 0;
+  unsigned int caretInColumn = 0;
 
-      int lineWidth = GetLineWidth(caretInLine, caretInColumn);
+  PositionToXY(m_positionOfCaret, &caretInColumn, &caretInLine);
 
-      dc->SetPen(*(wxThePenList->FindOrCreatePen(configuration->GetColor(TS_CURSOR), 1, wxPENSTYLE_SOLID)));
-      dc->SetBrush(*(wxTheBrushList->FindOrCreateBrush(configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
+  int lineWidth = GetLineWidth(caretInLine, caretInColumn);
+
+  dc->SetPen(*(wxThePenList->FindOrCreatePen(configuration->GetColor(TS_CURSOR), 1, wxPENSTYLE_SOLID)));
+  dc->SetBrush(*(wxTheBrushList->FindOrCreateBrush(configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
 #if defined(__WXOSX__)
-      // draw 1 pixel shorter caret than on windows
-      dc->DrawRectangle(point.x  + lineWidth - (*m_configuration)->GetCursorWidth(),
-                       point.y + Scale_Px(1) - m_center + caretInLine * m_charHeight,
-                       (*m_configuration)->GetCursorWidth(),
-                       m_charHeight - Scale_Px(5));
+  // draw 1 pixel shorter caret than on windows
+  dc->DrawRectangle(point.x  + lineWidth - (*m_configuration)->GetCursorWidth(),
+                    point.y + Scale_Px(1) - m_center + caretInLine * m_charHeight,
+                    (*m_configuration)->GetCursorWidth(),
+                    m_charHeight - Scale_Px(5));
 #else
-      dc->DrawRectangle(point.x + + lineWidth-(*m_configuration)->GetCursorWidth()/2,
-                       point.y + Scale_Px(2) - m_center + caretInLine * m_charHeight,
-                       (*m_configuration)->GetCursorWidth(),
-                       m_charHeight- Scale_Px(3));
+  dc->DrawRectangle(point.x + + lineWidth-(*m_configuration)->GetCursorWidth()/2,
+                    point.y + Scale_Px(2) - m_center + caretInLine * m_charHeight,
+                    (*m_configuration)->GetCursorWidth(),
+                    m_charHeight- Scale_Px(3));
 #endif
-    }
-
-    UnsetPen();
-
-  }
+  UnsetPen();
 }
 
 void EditorCell::SetFont()
@@ -3950,55 +3952,17 @@ bool EditorCell::CheckChanges()
   return false;
 }
 
-int EditorCell::ReplaceAll(wxString oldString, wxString newString, bool IgnoreCase)
+void EditorCell::SetValueFromReplaceAll(const wxString &text)
 {
-  if (oldString == wxEmptyString)
-    return 0;
-
   SaveValue();
-  wxString newText;
-  int count = 0;
-  if(!IgnoreCase)
-  {
-    newText = m_text;
-    newText.Replace(wxT("\r"), wxT(" "));
-    count = newText.Replace(oldString, newString);
-  }
-  else
-  {
-    int pos;
-    wxString src = m_text;
-    src.Replace(wxT("\r"), wxT(" "));
-    wxString src_LowerCase = src;
-    src_LowerCase.MakeLower();
-    oldString.MakeLower();
-    do{
-      pos = src_LowerCase.Find(oldString);
-      if(pos == wxNOT_FOUND)
-        newText += src;
-      else
-      {
-        newText += src.Left(pos);
-        newText += newString;
-        src_LowerCase = src_LowerCase.Right(src_LowerCase.Length()-pos-newString.Length());
-        src = src.Right(src.Length()-pos-oldString.Length());
-        count ++;
-      }
-    } while((pos != wxNOT_FOUND) && (src != wxEmptyString));
-  }
-  if (count > 0)
-  {
-    m_text = newText;
-    m_containsChanges = true;
-    ClearSelection();
-    StyleText();
-  }
+  m_text = text;
+  m_containsChanges = true;
+  ClearSelection();
+  StyleText();
 
   // If text is selected setting the selection again updates m_selectionString
   if (m_selectionStart > 0)
     SetSelection(m_selectionStart, m_selectionEnd);
-
-  return count;
 }
 
 bool EditorCell::FindNext(wxString str, bool down, bool ignoreCase)
@@ -4041,6 +4005,58 @@ bool EditorCell::FindNext(wxString str, bool down, bool ignoreCase)
   return false;
 }
 
+bool EditorCell::FindNext(wxRegEx &regex, bool down)
+{
+  int start = down ? 0 : m_text.Length();
+  wxString text(m_text);
+
+  text.Replace(wxT('\r'), wxT(' '));
+
+  if (m_selectionStart >= 0)
+  {
+    if (down)
+      start = m_selectionStart + 1;
+    else
+      start = m_selectionStart ;
+  }
+  else if (IsActive())
+    start = m_positionOfCaret;
+
+  if (!down && m_selectionStart == 0)
+    return false;
+
+  // wxRegEx only tells us where the first match is => step from match to match.
+  // Empty matches would result in an invisible selection and are skipped.
+  size_t offset = down ? start : 0;
+  int matchStart = wxNOT_FOUND;
+  size_t matchLength = 0;
+  while (offset <= text.Length())
+  {
+    if (!regex.Matches(text.Mid(offset), (offset > 0) ? wxRE_NOTBOL : 0))
+      break;
+    size_t thisStart, thisLength;
+    regex.GetMatch(&thisStart, &thisLength);
+    thisStart += offset;
+    if (!down && ((int) thisStart >= start))
+      break;
+    if (thisLength > 0)
+    {
+      matchStart = thisStart;
+      matchLength = thisLength;
+      if (down)
+        break;
+    }
+    offset = thisStart + wxMax(thisLength, (size_t) 1);
+  }
+
+  if (matchStart != wxNOT_FOUND)
+  {
+    SetSelection(matchStart, matchStart + matchLength);
+    return true;
+  }
+  return false;
+}
+
 bool EditorCell::ReplaceSelection(wxString oldStr, wxString newStr, bool keepSelected, bool IgnoreCase, bool replaceMaximaString)
 {
   wxString text(m_text);
@@ -29,6 +29,7 @@
 #include <vector>
 #include <list>
 #include <vector>
+#include <wx/regex.h>
 #include "MaximaTokenizer.h"
 
 /*! \file
@@ -198,7 +199,9 @@ public:
     no more displayed currently.
    */
   void MarkAsDeleted();
-  std::list<Cell *> GetInnerCells();
+  //! This cell doesn't contain other cells
+  int GetInnerCellCount(){return 0;}
+  Cell *GetInnerCell(int WXUNUSED(index)){return NULL;}
 
   /*! Expand all tabulators.
 
@@ -216,6 +219,9 @@ public:
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   //! Recalculate the widths of the current cell.
   void RecalculateWidths(int fontsize);
 
@@ -388,6 +394,14 @@ public:
     return m_isDirty;
   }
 
+  /*! Draw the caret
+
+    The caret isn't drawn by Draw() since the worksheet keeps the cells in a
+    backbuffer and draws the caret on top of it. This way a blinking caret
+    doesn't cause any cell to be redrawn.
+   */
+  void DrawCaret();
+
   //! Toggles the visibility of the cursor which is used to make it blink.
   void SwitchCaretDisplay()
   {
@@ -467,9 +481,12 @@ public:
 
   bool CheckChanges();
 
-  /*! Replaces all occurrences of a given string
+  /*! Replaces the contents of this cell by the result of a "replace all" operation
+
+    Unlike SetValue() this keeps the old contents in the undo buffer of this cell
+    and marks the cell as changed.
    */
-  int ReplaceAll(wxString oldString, wxString newString, bool IgnoreCase);
+  void SetValueFromReplaceAll(const wxString &text);
 
   /*! Finds the next occurrences of a string
 
@@ -483,6 +500,15 @@ public:
    */
   bool FindNext(wxString str, bool down, bool ignoreCase);
 
+  /*! Finds the next match of a regular expression
+
+    \param regex The compiled regular expression to search for
+    \param down
+     - true: search downwards
+     - false: search upwards
+   */
+  bool FindNext(wxRegEx &regex, bool down);
+
   void SetSelection(int start, int end);
 
   void GetSelection(int *start, int *end)
@@ -0,0 +1,368 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class EvaluationProfiler
+
+  EvaluationProfiler is the sidebar that shows how long each command maxima
+  was sent took and which part of wxMaxima the time was spent in.
+ */
+
+#include "EvaluationProfiler.h"
+#include "EditorCell.h"
+
+#include <algorithm>
+#include <wx/sizer.h>
+#include <wx/datetime.h>
+#include <wx/wfstream.h>
+#include <wx/txtstrm.h>
+
+EvaluationProfiler::EvaluationProfiler(wxWindow *parent, int id) : wxPanel(parent, id)
+{
+  m_dropped = 0;
+  m_lastLayoutTime = 0;
+  m_lastDrawTime = 0;
+  m_sortColumn = col_index;
+  m_sortAscending = true;
+  m_updateNeeded = false;
+  m_sortNeeded = false;
+
+  m_list = new RecordList(this, profiler_list_id);
+  m_list->AppendColumn(wxT("#"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Cell"));
+  m_list->AppendColumn(_("Command"));
+  m_list->AppendColumn(_("Sent"));
+  m_list->AppendColumn(_("First output [ms]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Prompt [ms]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Bytes"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Parse [ms]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Layout [ms]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Draw [ms]"), wxLIST_FORMAT_RIGHT);
+
+  wxBoxSizer *buttons = new wxBoxSizer(wxHORIZONTAL);
+  buttons->Add(new wxButton(this, profiler_export_id, _("Export as CSV...")),
+               wxSizerFlags().Border(wxALL, 2));
+  buttons->Add(new wxButton(this, profiler_clear_id, _("Clear")),
+               wxSizerFlags().Border(wxALL, 2));
+
+  wxFlexGridSizer *box = new wxFlexGridSizer(1);
+  box->AddGrowableCol(0);
+  box->AddGrowableRow(0);
+  box->Add(m_list, wxSizerFlags().Expand());
+  box->Add(buttons);
+
+  SetSizer(box);
+  box->Fit(this);
+  box->SetSizeHints(this);
+}
+
+EvaluationProfiler::~EvaluationProfiler()
+{
+}
+
+EvaluationProfiler::RecordList::RecordList(EvaluationProfiler *profiler, int id) :
+  wxListCtrl(profiler, id, wxDefaultPosition, wxDefaultSize,
+             wxLC_REPORT | wxLC_ALIGN_LEFT | wxLC_VIRTUAL)
+{
+  m_profiler = profiler;
+}
+
+wxString EvaluationProfiler::RecordList::OnGetItemText(long item, long column) const
+{
+  if ((item < 0) || ((size_t) item >= m_profiler->m_order.size()))
+    return wxEmptyString;
+  return m_profiler->ColumnText(m_profiler->m_order[item], column);
+}
+
+void EvaluationProfiler::CommandSent(wxString command, GroupCell *cell)
+{
+  // Keep the memory the profiler needs bounded even in very long sessions.
+  if (m_records.size() >= m_maxRecords)
+  {
+    size_t drop = m_maxRecords / 10;
+    m_records.erase(m_records.begin(), m_records.begin() + drop);
+    m_dropped += drop;
+    std::list<size_t>::iterator it = m_open.begin();
+    while (it != m_open.end())
+    {
+      if (*it < drop)
+        it = m_open.erase(it);
+      else
+      {
+        *it -= drop;
+        ++it;
+      }
+    }
+  }
+
+  Record record;
+  record.m_command = command;
+  record.m_command.Replace(wxT("\n"), wxT(" "));
+  if ((cell != NULL) && (cell->GetEditable() != NULL))
+    record.m_cell = cell->GetEditable()->ToString().BeforeFirst(wxT('\n'));
+  record.m_sent = wxGetUTCTimeMillis();
+  record.m_firstOutput = -1;
+  record.m_prompt = -1;
+  record.m_bytes = 0;
+  record.m_parseTime = 0;
+  record.m_layoutTime = 0;
+  record.m_drawTime = 0;
+  m_records.push_back(record);
+  m_open.push_back(m_records.size() - 1);
+  m_updateNeeded = true;
+  m_sortNeeded = true;
+}
+
+EvaluationProfiler::Record *EvaluationProfiler::CurrentRecord()
+{
+  if (!m_open.empty())
+    return &m_records[m_open.front()];
+  if (!m_records.empty())
+    return &m_records.back();
+  return NULL;
+}
+
+void EvaluationProfiler::DataReceived(long bytes)
+{
+  if (m_open.empty())
+    return;
+  Record &record = m_records[m_open.front()];
+  if (record.m_firstOutput < 0)
+    record.m_firstOutput = (wxGetUTCTimeMillis() - record.m_sent).ToLong();
+  record.m_bytes += bytes;
+  m_updateNeeded = true;
+}
+
+void EvaluationProfiler::ParseTime(long microseconds)
+{
+  Record *record = CurrentRecord();
+  if (record == NULL)
+    return;
+  record->m_parseTime += microseconds;
+  m_updateNeeded = true;
+}
+
+void EvaluationProfiler::PromptReceived()
+{
+  if (m_open.empty())
+    return;
+  Record &record = m_records[m_open.front()];
+  record.m_prompt = (wxGetUTCTimeMillis() - record.m_sent).ToLong();
+  m_open.pop_front();
+  m_updateNeeded = true;
+}
+
+void EvaluationProfiler::Abort()
+{
+  m_open.clear();
+  m_updateNeeded = true;
+}
+
+void EvaluationProfiler::UpdateFrontendTimes(long totalLayoutTime, long totalDrawTime)
+{
+  long layoutTime = totalLayoutTime - m_lastLayoutTime;
+  long drawTime = totalDrawTime - m_lastDrawTime;
+  m_lastLayoutTime = totalLayoutTime;
+  m_lastDrawTime = totalDrawTime;
+  if ((layoutTime <= 0) && (drawTime <= 0))
+    return;
+
+  Record *record = CurrentRecord();
+  if (record == NULL)
+    return;
+  record->m_layoutTime += layoutTime;
+  record->m_drawTime += drawTime;
+  m_updateNeeded = true;
+}
+
+void EvaluationProfiler::Clear()
+{
+  m_records.clear();
+  m_open.clear();
+  m_dropped = 0;
+  m_updateNeeded = true;
+  m_sortNeeded = true;
+}
+
+wxString EvaluationProfiler::ColumnText(size_t index, int column) const
+{
+  const Record &record = m_records[index];
+  switch (column)
+  {
+  case col_index:
+    return wxString::Format(wxT("%li"), (long) (index + m_dropped + 1));
+  case col_cell:
+    return record.m_cell;
+  case col_command:
+    return record.m_command;
+  case col_sent:
+    return wxDateTime(record.m_sent).Format(wxT("%H:%M:%S.%l"));
+  case col_firstOutput:
+    if (record.m_firstOutput < 0)
+      return wxEmptyString;
+    return wxString::Format(wxT("%li"), record.m_firstOutput);
+  case col_prompt:
+    if (record.m_prompt < 0)
+      return wxEmptyString;
+    return wxString::Format(wxT("%li"), record.m_prompt);
+  case col_bytes:
+    return wxString::Format(wxT("%li"), record.m_bytes);
+  case col_parse:
+    // %f would use the decimal separator of the locale, which breaks the CSV
+    // export in locales that use a comma.
+    return wxString::Format(wxT("%li.%li"), record.m_parseTime / 1000,
+                            (record.m_parseTime % 1000) / 100);
+  case col_layout:
+    return wxString::Format(wxT("%li"), record.m_layoutTime);
+  case col_draw:
+    return wxString::Format(wxT("%li"), record.m_drawTime);
+  }
+  return wxEmptyString;
+}
+
+bool EvaluationProfiler::RecordCompare::operator()(size_t a, size_t b) const
+{
+  if (!m_ascending)
+    std::swap(a, b);
+  const Record &ra = m_records[a];
+  const Record &rb = m_records[b];
+  switch (m_column)
+  {
+  case col_cell:
+    return ra.m_cell < rb.m_cell;
+  case col_command:
+    return ra.m_command < rb.m_command;
+  case col_firstOutput:
+    return ra.m_firstOutput < rb.m_firstOutput;
+  case col_prompt:
+    return ra.m_prompt < rb.m_prompt;
+  case col_bytes:
+    return ra.m_bytes < rb.m_bytes;
+  case col_parse:
+    return ra.m_parseTime < rb.m_parseTime;
+  case col_layout:
+    return ra.m_layoutTime < rb.m_layoutTime;
+  case col_draw:
+    return ra.m_drawTime < rb.m_drawTime;
+  default:
+    // The records are stored in the order they were sent in.
+    return a < b;
+  }
+}
+
+void EvaluationProfiler::Update()
+{
+  if (!m_updateNeeded)
+    return;
+  m_updateNeeded = false;
+
+  // The numbers of a command change while it is running. Re-sorting the list
+  // each time would make the lines jump around => we only sort if lines have
+  // been added or the user has asked for a different order.
+  if (m_sortNeeded)
+  {
+    m_sortNeeded = false;
+    m_order.resize(m_records.size());
+    for (size_t i = 0; i < m_order.size(); i++)
+      m_order[i] = i;
+    std::stable_sort(m_order.begin(), m_order.end(),
+                     RecordCompare(m_records, m_sortColumn, m_sortAscending));
+  }
+
+  // The list only asks for the text of the lines it actually displays.
+  if ((size_t) m_list->GetItemCount() != m_order.size())
+    m_list->SetItemCount(m_order.size());
+  if (!m_order.empty())
+    m_list->RefreshItems(0, m_order.size() - 1);
+}
+
+bool EvaluationProfiler::ExportCSV(wxString file)
+{
+  wxFileOutputStream output(file);
+  if (!output.IsOk())
+    return false;
+
+  wxTextOutputStream text(output);
+  text << wxT("index,cell,command,sent,first_output_ms,prompt_ms,bytes,parse_ms,layout_ms,draw_ms\n");
+  for (size_t i = 0; i < m_records.size(); i++)
+  {
+    for (int column = col_index; column <= col_draw; column++)
+    {
+      wxString field = ColumnText(i, column);
+      if (column > col_index)
+        text << wxT(",");
+      if ((column == col_cell) || (column == col_command))
+      {
+        field.Replace(wxT("\""), wxT("\"\""));
+        field = wxT("\"") + field + wxT("\"");
+      }
+      text << field;
+    }
+    text << wxT("\n");
+  }
+  text.Flush();
+  return output.IsOk();
+}
+
+void EvaluationProfiler::OnColumnClick(wxListEvent &event)
+{
+  // Clicking a column twice reverses the sort order.
+  if (event.GetColumn() == m_sortColumn)
+    m_sortAscending = !m_sortAscending;
+  else
+  {
+    m_sortColumn = event.GetColumn();
+    // Most columns are sorted in order to find the slowest commands.
+    m_sortAscending = (m_sortColumn == col_index) ||
+      (m_sortColumn == col_sent) ||
+      (m_sortColumn == col_cell) ||
+      (m_sortColumn == col_command);
+  }
+  m_updateNeeded = true;
+  m_sortNeeded = true;
+  Update();
+}
+
+void EvaluationProfiler::OnExport(wxCommandEvent &WXUNUSED(event))
+{
+  wxFileDialog fileDialog(this,
+                          _("Export the evaluation profile"), wxEmptyString,
+                          wxT("profile.csv"),
+                          _("Comma separated values (*.csv)|*.csv"),
+                          wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+  if (fileDialog.ShowModal() != wxID_OK)
+    return;
+
+  if (!ExportCSV(fileDialog.GetPath()))
+    wxLogError(wxString::Format(_("Cannot write the evaluation profile to %s"), fileDialog.GetPath()));
+}
+
+void EvaluationProfiler::OnClear(wxCommandEvent &WXUNUSED(event))
+{
+  Clear();
+  Update();
+}
+
+BEGIN_EVENT_TABLE(EvaluationProfiler, wxPanel)
+  EVT_LIST_COL_CLICK(EvaluationProfiler::profiler_list_id, EvaluationProfiler::OnColumnClick)
+  EVT_BUTTON(EvaluationProfiler::profiler_export_id, EvaluationProfiler::OnExport)
+  EVT_BUTTON(EvaluationProfiler::profiler_clear_id, EvaluationProfiler::OnClear)
+END_EVENT_TABLE()
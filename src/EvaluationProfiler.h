@@ -0,0 +1,213 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class EvaluationProfiler
+
+  EvaluationProfiler is the sidebar that shows how long each command maxima
+  was sent took and which part of wxMaxima the time was spent in.
+ */
+
+#ifndef EVALUATIONPROFILER_H
+#define EVALUATIONPROFILER_H
+
+#include <vector>
+#include <list>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "GroupCell.h"
+
+/*! A pane that lists the time each command maxima was sent took
+
+  For each command the profiler records when it was sent, how long it took
+  until maxima sent the first output and until maxima displayed the next input
+  prompt, how many bytes maxima answered with and how long wxMaxima took to
+  parse, lay out and draw the answer. This tells if it is maxima or wxMaxima
+  that makes a slow worksheet slow.
+
+  Maxima answers the commands in the order it has received them => the
+  commands that haven't been answered yet are kept in a FIFO and all output
+  is attributed to the oldest of them. Layout and drawing often happen after
+  maxima has already displayed the prompt: If no command is waiting for an
+  answer the time wxMaxima spends on them is attributed to the command that
+  has been answered last.
+
+  Like the XmlInspector the display of the data is only updated on calling
+  EvaluationProfiler::Update(). The list is a virtual one => only the lines
+  that are visible are asked for their text.
+ */
+class EvaluationProfiler : public wxPanel
+{
+public:
+  EvaluationProfiler(wxWindow *parent, int id);
+
+  ~EvaluationProfiler();
+
+  /*! Records that a command has been sent to maxima
+
+    \param command The command maxima was sent
+    \param cell The cell the command belongs to
+   */
+  void CommandSent(wxString command, GroupCell *cell);
+
+  //! Records that maxima has sent us bytes bytes of data
+  void DataReceived(long bytes);
+
+  //! Records that parsing maxima's output took microseconds µs
+  void ParseTime(long microseconds);
+
+  //! Records that maxima has displayed an input prompt
+  void PromptReceived();
+
+  //! Records that the commands that haven't been answered yet never will be
+  void Abort();
+
+  /*! Attributes the time the worksheet took for layout and drawing to the commands
+
+    \param totalLayoutTime The layout time the worksheet has accumulated in total [ms]
+    \param totalDrawTime The draw time the worksheet has accumulated in total [ms]
+   */
+  void UpdateFrontendTimes(long totalLayoutTime, long totalDrawTime);
+
+  //! Forgets all recorded commands
+  void Clear();
+
+  //! Writes all recorded commands to a CSV file
+  bool ExportCSV(wxString file);
+
+  //! Actually draw the updates
+  void Update();
+
+  //! Do we need to update the profiler's display?
+  bool UpdateNeeded()
+  { return m_updateNeeded && IsShown(); }
+
+private:
+  //! The data we collect for each command
+  struct Record
+  {
+    //! The command maxima was sent
+    wxString m_command;
+    //! The first line of the cell the command belongs to
+    wxString m_cell;
+    //! When was the command sent?
+    wxLongLong m_sent;
+    //! How long did it take until maxima sent output? -1 = no output, yet [ms]
+    long m_firstOutput;
+    //! How long did it take until maxima displayed the prompt? -1 = not yet [ms]
+    long m_prompt;
+    //! The number of bytes maxima answered with
+    long m_bytes;
+    //! The time spent parsing maxima's answer [µs]
+    long m_parseTime;
+    //! The time spent laying out the worksheet [ms]
+    long m_layoutTime;
+    //! The time spent drawing the worksheet [ms]
+    long m_drawTime;
+  };
+
+  //! Compares two records by the contents of a column
+  class RecordCompare
+  {
+  public:
+    RecordCompare(const std::vector<Record> &records, int column, bool ascending) :
+      m_records(records), m_column(column), m_ascending(ascending)
+    {}
+    bool operator()(size_t a, size_t b) const;
+  private:
+    const std::vector<Record> &m_records;
+    int m_column;
+    bool m_ascending;
+  };
+
+  //! The columns of the list
+  enum column
+  {
+    col_index,
+    col_cell,
+    col_command,
+    col_sent,
+    col_firstOutput,
+    col_prompt,
+    col_bytes,
+    col_parse,
+    col_layout,
+    col_draw
+  };
+
+  enum profilerIds
+  {
+    profiler_list_id = wxID_HIGHEST + 1,
+    profiler_export_id,
+    profiler_clear_id
+  };
+
+  //! A list that asks the profiler for the text of the lines it displays
+  class RecordList : public wxListCtrl
+  {
+  public:
+    RecordList(EvaluationProfiler *profiler, int id);
+  protected:
+    wxString OnGetItemText(long item, long column) const;
+  private:
+    EvaluationProfiler *m_profiler;
+  };
+  friend class RecordList;
+
+  //! The text a column shows for a record
+  wxString ColumnText(size_t record, int column) const;
+
+  //! Returns the record the next output belongs to. NULL = none.
+  Record *CurrentRecord();
+
+  void OnColumnClick(wxListEvent &event);
+
+  void OnExport(wxCommandEvent &event);
+
+  void OnClear(wxCommandEvent &event);
+
+  //! The maximum number of commands we keep the data of
+  static const size_t m_maxRecords = 10000;
+
+  RecordList *m_list;
+  //! All recorded commands, in the order they were sent
+  std::vector<Record> m_records;
+  //! The index in m_records for each line of the list
+  std::vector<size_t> m_order;
+  //! The indices of the commands that haven't been answered yet, oldest first
+  std::list<size_t> m_open;
+  //! The number of commands that have been dropped from m_records
+  long m_dropped;
+  //! The layout time the worksheet had accumulated at the last UpdateFrontendTimes() [ms]
+  long m_lastLayoutTime;
+  //! The draw time the worksheet had accumulated at the last UpdateFrontendTimes() [ms]
+  long m_lastDrawTime;
+  //! The column the list is sorted by
+  int m_sortColumn;
+  bool m_sortAscending;
+  bool m_updateNeeded;
+  //! Does m_order need to be sorted again on the next Update()?
+  bool m_sortNeeded;
+
+  DECLARE_EVENT_TABLE()
+};
+
+#endif // EVALUATIONPROFILER_H
@@ -29,6 +29,8 @@
 
 #include "EvaluationQueue.h"
 #include "MaximaTokenizer.h"
+#include <iterator>
+#include <algorithm>
 
 bool EvaluationQueue::Empty()
 {
@@ -39,6 +41,9 @@ EvaluationQueue::EvaluationQueue()
 {
   m_size = 0;
   m_workingGroupChanged = false;
+  m_commandsSent = 0;
+  m_orphanedCommands = 0;
+  m_inputKeysValid = false;
 }
 
 void EvaluationQueue::Clear()
@@ -47,6 +52,32 @@ void EvaluationQueue::Clear()
   m_size = 0;
   m_commands.clear();
   m_workingGroupChanged = false;
+  m_orphanedCommands += m_commandsSent;
+  m_commandsSent = 0;
+  m_cellsSentAhead.clear();
+}
+
+bool EvaluationQueue::OrphanedCommandFinished()
+{
+  if (m_orphanedCommands == 0)
+    return false;
+  m_orphanedCommands--;
+  return true;
+}
+
+void EvaluationQueue::MarkCommandAheadSent(GroupCell *cell)
+{
+  m_commandsSent++;
+  // The commands of the current cell have been split up already => it doesn't
+  // matter if its contents change.
+  if ((cell != GetCell()) && !IsSentAhead(cell))
+    m_cellsSentAhead.push_back(cell);
+}
+
+bool EvaluationQueue::IsSentAhead(GroupCell *cell)
+{
+  return std::find(m_cellsSentAhead.begin(), m_cellsSentAhead.end(), cell) !=
+    m_cellsSentAhead.end();
 }
 
 bool EvaluationQueue::IsInQueue(GroupCell *gr)
@@ -60,6 +91,14 @@ bool EvaluationQueue::IsInQueue(GroupCell *gr)
 
 void EvaluationQueue::Remove(GroupCell *gr)
 {
+  // Commands that were sent ahead can no more be matched to the cells that
+  // stay in the queue => abort the evaluation.
+  if ((m_commandsSent > 1) && IsInQueue(gr))
+  {
+    Clear();
+    return;
+  }
+
   bool removeFirst = !(m_queue.empty()) && gr == m_queue.front();
   m_queue.remove(gr);
   m_size = m_queue.size();
@@ -83,6 +122,8 @@ void EvaluationQueue::AddToQueue(GroupCell *gr)
   {
     AddTokens(gr);
     m_workingGroupChanged = true;
+    // The cells might have changed since the queue has run the last time.
+    m_inputKeysValid = false;
   }
   m_size++;
   m_queue.push_back(gr);
@@ -112,6 +153,8 @@ void EvaluationQueue::RemoveFirst()
   {
     m_workingGroupChanged = false;
     m_commands.pop_front();
+    if (m_commandsSent > 0)
+      m_commandsSent--;
   }
   else
   {
@@ -123,6 +166,7 @@ void EvaluationQueue::RemoveFirst()
       m_queue.pop_front();
       m_size--;
       AddTokens(GetCell());
+      m_cellsSentAhead.remove(GetCell());
     } while (m_commands.empty() && (!m_queue.empty()));
     m_workingGroupChanged = true;
   }
@@ -132,6 +176,12 @@ void EvaluationQueue::AddTokens(GroupCell *cell)
 {
   if(cell == NULL)
     return;
+  Tokenize(cell, m_commands);
+  m_knownAnswers = cell->m_knownAnswers;
+}
+
+void EvaluationQueue::Tokenize(GroupCell *cell, std::list<EvaluationQueue::command> &commands)
+{
   MaximaTokenizer::TokenList tokens = cell->GetEditable()->GetTokens();
   MaximaTokenizer::TokenList::iterator it;
   wxString token;
@@ -149,7 +199,7 @@ void EvaluationQueue::AddTokens(GroupCell *cell)
       token.Trim(true);
       token.Trim(false);
       if(!token.IsEmpty())
-        m_commands.push_back(command(token, index));      
+        commands.push_back(command(token, index));      
       token = wxEmptyString;
       continue;
     }
@@ -159,7 +209,7 @@ void EvaluationQueue::AddTokens(GroupCell *cell)
       token.Trim(true);
       token.Trim(false);
       if(!token.IsEmpty())
-        m_commands.push_back(command(token, index));
+        commands.push_back(command(token, index));
       token = wxEmptyString;
       continue;
     }
@@ -167,9 +217,55 @@ void EvaluationQueue::AddTokens(GroupCell *cell)
   token.Trim(true);
   token.Trim(false);
   if(!token.IsEmpty())
-    m_commands.push_back(command(token, index));
-  
-  m_knownAnswers = cell->m_knownAnswers;
+    commands.push_back(command(token, index));
+}
+
+wxArrayString EvaluationQueue::GetCommands(GroupCell *cell)
+{
+  wxArrayString result;
+  if (cell == NULL)
+    return result;
+  std::list<EvaluationQueue::command> commands;
+  Tokenize(cell, commands);
+  for (std::list<EvaluationQueue::command>::iterator it = commands.begin();
+       it != commands.end(); ++it)
+    result.Add(it->GetString());
+  return result;
+}
+
+bool EvaluationQueue::GetCommandAhead(wxString &text, GroupCell *&cell)
+{
+  std::list<GroupCell *>::iterator it = m_queue.begin();
+  if (it == m_queue.end())
+    return false;
+
+  size_t position = m_commandsSent;
+  if (position < m_commands.size())
+  {
+    std::list<EvaluationQueue::command>::iterator cmd = m_commands.begin();
+    std::advance(cmd, position);
+    text = cmd->GetString();
+    cell = *it;
+    return true;
+  }
+  position -= m_commands.size();
+
+  // The commands of the cells behind the current one haven't been split up yet.
+  for (++it; it != m_queue.end(); ++it)
+  {
+    std::list<EvaluationQueue::command> commands;
+    Tokenize(*it, commands);
+    if (position < commands.size())
+    {
+      std::list<EvaluationQueue::command>::iterator cmd = commands.begin();
+      std::advance(cmd, position);
+      text = cmd->GetString();
+      cell = *it;
+      return true;
+    }
+    position -= commands.size();
+  }
+  return false;
 }
 
 GroupCell *EvaluationQueue::GetCell()
@@ -69,6 +69,26 @@ private:
   //! Adds all commands in commandString as separate tokens to the queue.
   void AddTokens(GroupCell *cell);
 
+  //! Splits the contents of cell into single commands
+  static void Tokenize(GroupCell *cell, std::list<EvaluationQueue::command> &commands);
+
+  /*! The number of commands at the head of the queue maxima already has been sent
+
+    Normally this is 0 or 1. In the pipelined mode wxMaxima sends a few commands
+    ahead so maxima doesn't need to wait for the GUI between two commands.
+   */
+  size_t m_commandsSent;
+  //! The number of commands maxima still works on that were removed from the queue
+  size_t m_orphanedCommands;
+  /*! The cells behind the current one maxima already has been sent commands from
+
+    Their contents mustn't change until they are evaluated as maxima won't see
+    the change.
+   */
+  std::list<GroupCell *> m_cellsSentAhead;
+  //! Have the input keys of the cells been calculated since this queue has started?
+  bool m_inputKeysValid;
+
   //! A list of answers provided by the user
   std::list<wxString> m_knownAnswers;
 
@@ -170,6 +190,79 @@ public:
   {
     return m_commands.size();
   }
+
+  //! Has the first command in the queue already been sent to maxima?
+  bool CommandSent()
+  { return m_commandsSent > 0; }
+
+  //! Mark the first command in the queue as sent to maxima
+  void MarkCommandSent()
+  {
+    if (m_commandsSent == 0)
+      m_commandsSent = 1;
+  }
+
+  //! How many commands from the head of the queue have been sent to maxima?
+  size_t CommandsSent()
+  { return m_commandsSent; }
+
+  /*! Returns the first command maxima hasn't been sent yet
+
+    \param text Returns the command
+    \param cell Returns the cell the command belongs to
+    \return false, if there is no such command
+   */
+  bool GetCommandAhead(wxString &text, GroupCell *&cell);
+
+  /*! Mark the command GetCommandAhead() has returned as sent to maxima
+
+    \param cell The cell GetCommandAhead() has returned
+   */
+  void MarkCommandAheadSent(GroupCell *cell);
+
+  /*! Has maxima been sent commands from this cell before it became the current one?
+
+    If it has the cell mustn't be edited until it has been evaluated.
+   */
+  bool IsSentAhead(GroupCell *cell);
+
+  /*! Handles maxima having finished a command that was removed from the queue
+
+    If the queue is cleared while maxima still works on commands from it the
+    prompts of these commands must not be mistaken for the end of the commands
+    that will be added to the queue next. Maxima still executes all of them,
+    though.
+    \return true, if the prompt belonged to such a command.
+   */
+  bool OrphanedCommandFinished();
+
+  //! How many commands that were removed from the queue does maxima still work on?
+  size_t OrphanedCommands()
+  { return m_orphanedCommands; }
+
+  //! Forget about all commands maxima has been sent, for example after it has been restarted
+  void ResetCommandsSent()
+  {
+    m_commandsSent = 0;
+    m_orphanedCommands = 0;
+    m_cellsSentAhead.clear();
+  }
+
+  //! Splits the contents of a cell into the commands maxima has to be sent
+  static wxArrayString GetCommands(GroupCell *cell);
+
+  //! Removes the first cell from the queue without evaluating it
+  void SkipCell()
+  {
+    m_commands.clear();
+    RemoveFirst();
+  }
+
+  //! Have the input keys of the cells been calculated since this queue has started?
+  bool InputKeysValid()
+  { return m_inputKeysValid; }
+  void InputKeysValid(bool valid)
+  { m_inputKeysValid = valid; }
 };
 
 
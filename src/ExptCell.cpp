@@ -85,20 +85,12 @@ ExptCell::~ExptCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> ExptCell::GetInnerCells()
+Cell *ExptCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_baseCell)
-    innerCells.push_back(m_baseCell);
-  if(m_exptCell)
-    innerCells.push_back(m_exptCell);
-  if(m_exp)
-    innerCells.push_back(m_exp);
-  if(m_open)
-    innerCells.push_back(m_open);
-  if(m_close)
-    innerCells.push_back(m_close );
-  return innerCells;
+  Cell *innerCells[] = {m_baseCell, m_exptCell, m_exp, m_open, m_close};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 
@@ -178,8 +170,8 @@ void ExptCell::RecalculateHeight(int fontsize)
 
 wxString ExptCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText;
+  if (GetAltCopyText() != wxEmptyString)
+    return GetAltCopyText();
   if (m_isBrokenIntoLines)
     return wxEmptyString;
   wxString s = m_baseCell->ListToString() + wxT("^");
@@ -194,8 +186,8 @@ wxString ExptCell::ToString()
 
 wxString ExptCell::ToMatlab()
 {
-  if (m_altCopyText != wxEmptyString)
-	return m_altCopyText;
+  if (GetAltCopyText() != wxEmptyString)
+	return GetAltCopyText();
   if (m_isBrokenIntoLines)
 	return wxEmptyString;
   wxString s = m_baseCell->ListToMatlab() + wxT("^");
@@ -52,10 +52,14 @@ public:
 
   ~ExptCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 5;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   //! Set the mantissa
   void SetBase(Cell *base);
 
@@ -0,0 +1,164 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class FindReplaceEngine
+
+  FindReplaceEngine does the actual string matching for "Replace All".
+ */
+
+#include "FindReplaceEngine.h"
+#include <wx/log.h>
+
+FindReplaceEngine::FindReplaceEngine(const wxString &oldString, const wxString &newString,
+                                     bool ignoreCase, bool regex)
+{
+  m_oldString = oldString;
+  m_oldString_lowerCase = oldString.Lower();
+  m_newString = newString;
+  m_ignoreCase = ignoreCase;
+  m_regex = regex;
+  m_ok = (oldString != wxEmptyString);
+
+  // Compiling the expression once here lets wxRegEx tell the user what is
+  // wrong with it. The worker threads compile their own copy afterwards.
+  if (m_ok && m_regex)
+  {
+    wxRegEx test;
+    m_ok = test.Compile(m_oldString, RegexFlags(m_ignoreCase));
+  }
+}
+
+int FindReplaceEngine::Replace(wxString &text, wxRegEx *regex)
+{
+  if (m_regex)
+  {
+    int count = regex->Replace(&text, m_newString);
+    if (count < 0)
+      count = 0;
+    return count;
+  }
+
+  if (!m_ignoreCase)
+    return text.Replace(m_oldString, m_newString);
+
+  wxString text_lowerCase = text.Lower();
+  wxString result;
+  size_t pos = 0;
+  size_t found;
+  int count = 0;
+  while ((found = text_lowerCase.find(m_oldString_lowerCase, pos)) != wxString::npos)
+  {
+    result += text.Mid(pos, found - pos);
+    result += m_newString;
+    pos = found + m_oldString.Length();
+    count++;
+  }
+  if (count > 0)
+  {
+    result += text.Mid(pos);
+    text = result;
+  }
+  return count;
+}
+
+std::vector<int> FindReplaceEngine::ReplaceAll(const std::vector<wxString> &texts,
+                                               std::vector<wxString> &results)
+{
+  std::vector<int> counts(texts.size(), 0);
+  results.clear();
+  results.resize(texts.size());
+
+  if (!m_ok || texts.empty())
+    return counts;
+
+  size_t threads = 1;
+  int cpus = wxThread::GetCPUCount();
+  if (cpus > 1)
+    threads = wxMin((size_t) cpus, texts.size() / m_minTextsPerThread);
+  if (threads < 1)
+    threads = 1;
+
+  size_t chunkSize = (texts.size() + threads - 1) / threads;
+  std::vector<Worker *> workers;
+  for (size_t begin = 0; begin < texts.size(); begin += chunkSize)
+  {
+    size_t end = wxMin(begin + chunkSize, texts.size());
+    Worker *worker = new Worker(this, &texts, &results, &counts, begin, end);
+    // The last chunk is processed by the calling thread which would be
+    // waiting for the others, anyway.
+    if ((end < texts.size()) && (worker->Run() == wxTHREAD_NO_ERROR))
+      workers.push_back(worker);
+    else
+    {
+      worker->Process();
+      delete worker;
+    }
+  }
+
+  for (std::vector<Worker *>::iterator it = workers.begin(); it != workers.end(); ++it)
+  {
+    (*it)->Wait();
+    delete *it;
+  }
+  return counts;
+}
+
+FindReplaceEngine::Worker::Worker(FindReplaceEngine *engine, const std::vector<wxString> *texts,
+                                  std::vector<wxString> *results, std::vector<int> *counts,
+                                  size_t begin, size_t end) : wxThread(wxTHREAD_JOINABLE)
+{
+  m_engine = engine;
+  m_texts = texts;
+  m_results = results;
+  m_counts = counts;
+  m_begin = begin;
+  m_end = end;
+}
+
+wxThread::ExitCode FindReplaceEngine::Worker::Entry()
+{
+  Process();
+  return 0;
+}
+
+void FindReplaceEngine::Worker::Process()
+{
+  // wxRegEx keeps the state of the last match => every thread needs its own one.
+  wxRegEx regex;
+  if (m_engine->m_regex)
+  {
+    wxLogNull suppressor;
+    if (!regex.Compile(m_engine->m_oldString, RegexFlags(m_engine->m_ignoreCase)))
+      return;
+  }
+
+  for (size_t i = m_begin; i < m_end; i++)
+  {
+    wxString text = (*m_texts)[i];
+    int count = m_engine->Replace(text, &regex);
+    if (count > 0)
+    {
+      (*m_results)[i] = text;
+      (*m_counts)[i] = count;
+    }
+  }
+}
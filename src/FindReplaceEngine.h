@@ -0,0 +1,119 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class FindReplaceEngine
+
+  FindReplaceEngine does the actual string matching for "Replace All".
+ */
+
+#ifndef FINDREPLACEENGINE_H
+#define FINDREPLACEENGINE_H
+
+#include <vector>
+#include <wx/string.h>
+#include <wx/regex.h>
+#include <wx/thread.h>
+
+/*! Searches and replaces a string or a regular expression in a list of texts
+
+  The texts are split into chunks that are processed by a pool of worker threads.
+  The engine never touches any cell: It only works on copies of the cell contents
+  and returns the new texts which allows the caller to apply all changes from the
+  GUI thread as one single undoable action.
+ */
+class FindReplaceEngine
+{
+public:
+  /*! The constructor
+
+    \param oldString The string or regular expression to search for
+    \param newString The replacement. If regex is true "\1" and "&" refer to parts
+           of the match.
+    \param ignoreCase true = search case-insensitively
+    \param regex true = oldString is a regular expression
+   */
+  FindReplaceEngine(const wxString &oldString, const wxString &newString,
+                    bool ignoreCase, bool regex);
+
+  //! False if there is nothing to search for or the regular expression is invalid.
+  bool IsOk()
+  { return m_ok; }
+
+  /*! Replace all matches in all texts
+
+    \param texts   The texts to search in. The caller must hand us copies that
+                   aren't shared with any other thread.
+    \param results Is filled with the new texts. Texts that don't contain any
+                   match are left empty.
+    \return How many matches each text contained.
+   */
+  std::vector<int> ReplaceAll(const std::vector<wxString> &texts, std::vector<wxString> &results);
+
+  /*! Replace all matches in one text
+
+    \param text The text to work on
+    \param regex The compiled regular expression. Ignored for plain-text searches.
+    \return The number of matches that were replaced.
+   */
+  int Replace(wxString &text, wxRegEx *regex);
+
+  //! The flags wxRegEx needs for a search with the given case sensitivity
+  static int RegexFlags(bool ignoreCase)
+  { return wxRE_DEFAULT | (ignoreCase ? wxRE_ICASE : 0); }
+
+private:
+  //! Below this number of texts starting threads is more expensive than the search
+  static const size_t m_minTextsPerThread = 32;
+
+  //! Processes one chunk of the list of texts
+  class Worker : public wxThread
+  {
+  public:
+    Worker(FindReplaceEngine *engine, const std::vector<wxString> *texts,
+           std::vector<wxString> *results, std::vector<int> *counts,
+           size_t begin, size_t end);
+
+    //! Does the actual work. Can be called directly if no thread could be created.
+    void Process();
+
+  protected:
+    virtual ExitCode Entry();
+
+  private:
+    FindReplaceEngine *m_engine;
+    const std::vector<wxString> *m_texts;
+    std::vector<wxString> *m_results;
+    std::vector<int> *m_counts;
+    size_t m_begin;
+    size_t m_end;
+  };
+
+  wxString m_oldString;
+  //! The lowercase version of m_oldString for case-insensitive plain-text searches
+  wxString m_oldString_lowerCase;
+  wxString m_newString;
+  bool m_ignoreCase;
+  bool m_regex;
+  bool m_ok;
+};
+
+#endif // FINDREPLACEENGINE_H
@@ -120,6 +120,15 @@ FindReplacePane::FindReplacePane(wxWindow *parent, wxFindReplaceData *data) :
           NULL, this
   );
 
+  m_regex = new wxCheckBox(this, -1, _("Regular expression"));
+  m_regex->SetValue(!!(data->GetFlags() & FR_REGEX));
+  grid_sizer->Add(m_regex, wxSizerFlags().Expand().Border(wxALL, 5));
+  m_regex->Connect(
+          wxEVT_CHECKBOX,
+          wxCommandEventHandler(FindReplacePane::OnRegex),
+          NULL, this
+  );
+
   // If I press <tab> in the search text box I want to arrive in the
   // replacement text box immediately.
   m_replaceText->MoveAfterInTabOrder(m_searchText);
@@ -173,6 +182,13 @@ void FindReplacePane::OnMatchCase(wxCommandEvent &event)
   wxConfig::Get()->Write(wxT("findFlags"), m_findReplaceData->GetFlags());  
 }
 
+void FindReplacePane::OnRegex(wxCommandEvent &event)
+{
+  m_findReplaceData->SetFlags(
+          (m_findReplaceData->GetFlags() & (~FR_REGEX)) | (event.IsChecked() * FR_REGEX));
+  wxConfig::Get()->Write(wxT("findFlags"), m_findReplaceData->GetFlags());
+}
+
 void FindReplacePane::OnActivate(wxActivateEvent &event)
 {
   if (event.GetActive())
@@ -37,6 +37,12 @@
 #include <wx/checkbox.h>
 #include <wx/textctrl.h>
 
+/*! A flag we add to the wxFindReplaceFlags: The search string is a regular expression
+
+  wxFindReplaceFlags only uses the 3 lowest bits so the next one is free for our use.
+ */
+#define FR_REGEX 8
+
 /*! The find+replace pane
  */
 class FindReplacePane : public wxPanel
@@ -54,6 +60,7 @@ private:
   wxRadioButton *m_forward;
   wxRadioButton *m_backwards;
   wxCheckBox *m_matchCase;
+  wxCheckBox *m_regex;
 
 public:
   FindReplacePane(wxWindow *parent, wxFindReplaceData *data);
@@ -83,6 +90,8 @@ protected:
 
   void OnMatchCase(wxCommandEvent &event);
 
+  void OnRegex(wxCommandEvent &event);
+
   void OnKeyDown(wxKeyEvent &event);
 
 DECLARE_EVENT_TABLE()
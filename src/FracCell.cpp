@@ -79,24 +79,12 @@ FracCell::~FracCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> FracCell::GetInnerCells()
+Cell *FracCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_divide)
-    innerCells.push_back(m_divide);
-  if(m_denom)
-    innerCells.push_back(m_denom);
-  if(m_num)
-    innerCells.push_back(m_num);
-  if(m_open1)
-    innerCells.push_back(m_open1);
-  if(m_close1)
-    innerCells.push_back(m_close1);
-  if(m_open2)
-    innerCells.push_back(m_open2);
-  if(m_close2)
-    innerCells.push_back(m_close2);
-  return innerCells;
+  Cell *innerCells[] = {m_divide, m_denom, m_num, m_open1, m_close1, m_open2, m_close2};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void FracCell::SetNum(Cell *num)
@@ -46,7 +46,8 @@ public:
 
   ~FracCell();
   
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 7;}
+  Cell *GetInnerCell(int index);
 
   //! All types of fractions we supportx
   enum FracType
@@ -58,6 +59,9 @@ public:
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void RecalculateHeight(int fontsize);
 
   void RecalculateWidths(int fontsize);
@@ -54,14 +54,12 @@ FunCell::~FunCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> FunCell::GetInnerCells()
+Cell *FunCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_nameCell)
-    innerCells.push_back(m_nameCell);
-  if(m_argCell)
-    innerCells.push_back(m_argCell);
-  return innerCells;
+  Cell *innerCells[] = {m_nameCell, m_argCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void FunCell::SetName(Cell *name)
@@ -123,8 +121,8 @@ wxString FunCell::ToString()
 {
   if (m_isBrokenIntoLines)
     return wxEmptyString;
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText + Cell::ListToString();
+  if (GetAltCopyText() != wxEmptyString)
+    return GetAltCopyText() + Cell::ListToString();
   wxString s = m_nameCell->ListToString() + m_argCell->ListToString();
   return s;
 }
@@ -133,8 +131,8 @@ wxString FunCell::ToMatlab()
 {
   if (m_isBrokenIntoLines)
 	return wxEmptyString;
-  if (m_altCopyText != wxEmptyString)
-	return m_altCopyText + Cell::ListToMatlab();
+  if (GetAltCopyText() != wxEmptyString)
+	return GetAltCopyText() + Cell::ListToMatlab();
   wxString s = m_nameCell->ListToMatlab() + m_argCell->ListToMatlab();
   return s;
 }
@@ -56,10 +56,14 @@ public:
 
   ~FunCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 2;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetName(Cell *base);
 
   void SetArg(Cell *index);
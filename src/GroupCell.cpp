@@ -31,6 +31,7 @@
 
 #include <wx/config.h>
 #include <wx/clipbrd.h>
+#include <wx/dcgraph.h>
 #include "MarkDown.h"
 #include "GroupCell.h"
 #include "SlideShowCell.h"
@@ -45,6 +46,10 @@ GroupCell::GroupCell(Configuration **config, GroupType groupType, CellPointers *
 {
   m_next = m_previous = m_nextToDraw = m_previousToDraw = NULL;
   m_autoAnswer = false;
+  m_independent = false;
+  m_inputEvaluated = false;
+  m_evaluationGeneration = 0;
+  m_outputFromCache = false;
   m_cellsInGroup = 1;
   m_cellPointers = cellPointers;
   m_inEvaluationQueue = false;
@@ -68,6 +73,10 @@ GroupCell::GroupCell(Configuration **config, GroupType groupType, CellPointers *
   m_groupType = groupType;
   m_lastInOutput = NULL;
   m_appendedCells = NULL;
+  m_bufferedOutput = m_lastInBufferedOutput = NULL;
+  m_outputChanged = false;
+  m_outputCacheZoom = -1;
+  m_outputCacheStyle = -1;
 
   // set up cell depending on groupType, so we have a working cell
   if (groupType != GC_TYPE_PAGEBREAK)
@@ -289,12 +298,177 @@ void GroupCell::ResetInputLabelList()
 
 }
 
+void GroupCell::InputEvaluated()
+{
+  if (GetEditable() == NULL)
+    return;
+  m_evaluatedInput = GetEditable()->GetValue();
+  m_inputEvaluated = true;
+  m_evaluationGeneration = ++m_evaluationCounter;
+
+  // The keys are only kept up to date while the output is cached.
+  if ((*m_configuration)->ReuseOutput() && (m_keyedInput == m_evaluatedInput))
+    m_pendingOutputKey = m_inputKey;
+  else
+    m_pendingOutputKey = wxEmptyString;
+  m_outputKey = wxEmptyString;
+  m_outputFromCache = false;
+}
+
+void GroupCell::InputKey(wxString key)
+{
+  m_inputKey = key;
+  if (GetEditable() != NULL)
+    m_keyedInput = GetEditable()->GetValue();
+}
+
+void GroupCell::OutputComplete()
+{
+  // Output that contains an error might not be what maxima answers next time.
+  if (m_cellPointers->m_errorList.Contains(this))
+    m_outputKey = wxEmptyString;
+  else
+    m_outputKey = m_pendingOutputKey;
+  m_pendingOutputKey = wxEmptyString;
+}
+
+bool GroupCell::OutputCached()
+{
+  if ((m_output == NULL) || m_outputKey.IsEmpty() || (GetEditable() == NULL))
+    return false;
+  return (m_outputKey == m_inputKey) && (m_keyedInput == GetEditable()->GetValue());
+}
+
+bool GroupCell::InputChanged()
+{
+  if (GetEditable() == NULL)
+    return false;
+  return (!m_inputEvaluated) || (GetEditable()->GetValue() != m_evaluatedInput);
+}
+
+void GroupCell::ForgetEvaluatedInputList()
+{
+  GroupCell *tmp = this;
+  while (tmp)
+  {
+    tmp->ForgetEvaluatedInput();
+    if (tmp->IsFoldable() && (tmp->m_hiddenTree))
+      tmp->m_hiddenTree->ForgetEvaluatedInputList();
+
+    tmp = dynamic_cast<GroupCell *>(tmp->m_next);
+  }
+}
+
+bool GroupCell::GetDependencies(wxArrayString &defines, wxArrayString &uses,
+                                size_t *unattributedAssignments)
+{
+  if ((m_groupType != GC_TYPE_CODE) || (GetEditable() == NULL))
+    return true;
+
+  // Functions whose effects on the symbols we cannot see from their arguments
+  static const wxString opaqueFunctions[] = {
+    wxT("kill"), wxT("load"), wxT("batch"), wxT("batchload"), wxT("loadfile"),
+    wxT("reset"), wxT("remvalue"), wxT("remfunction"), wxT("remove"),
+    wxT("define"), wxT("declare"), wxT("assume"), wxT("forget"),
+    wxT("to_lisp")
+  };
+  static const size_t opaqueFunctionCount =
+    sizeof(opaqueFunctions) / sizeof(opaqueFunctions[0]);
+
+  std::vector<MaximaTokenizer::Token *> tokens = GetCodeTokens();
+
+  bool predictable = true;
+  // The colons we have found the symbol for that they assign a value to
+  std::vector<bool> attributed(tokens.size(), false);
+  for (size_t i = 0; i < tokens.size(); i++)
+  {
+    TextStyle style = tokens[i]->GetStyle();
+    wxString text = tokens[i]->GetText();
+    if (style == TS_CODE_LISP)
+      predictable = false;
+    if ((style != TS_CODE_VARIABLE) && (style != TS_CODE_FUNCTION))
+      continue;
+
+    // Assignments can be found anywhere in a command, for example in
+    // a:b:1, if x>0 then y:1 or block(c:2): Skip the arguments or the index
+    // that might follow the name and look if the next token is a colon.
+    size_t next = i + 1;
+    if ((next < tokens.size()) &&
+        ((tokens[next]->GetText() == wxT("(")) || (tokens[next]->GetText() == wxT("["))))
+    {
+      int depth = 0;
+      for (; next < tokens.size(); next++)
+      {
+        wxString bracket = tokens[next]->GetText();
+        if ((bracket == wxT("(")) || (bracket == wxT("[")))
+          depth++;
+        if ((bracket == wxT(")")) || (bracket == wxT("]")))
+          depth--;
+        if ((depth == 0) || (tokens[next]->GetStyle() == TS_CODE_ENDOFLINE))
+          break;
+      }
+      next++;
+    }
+    bool isDefinition = (next < tokens.size()) && (tokens[next]->GetText() == wxT(":"));
+
+    if (isDefinition)
+    {
+      attributed[next] = true;
+      if (defines.Index(text) == wxNOT_FOUND)
+        defines.Add(text);
+      continue;
+    }
+
+    if (style == TS_CODE_FUNCTION)
+    {
+      for (size_t j = 0; j < opaqueFunctionCount; j++)
+        if (text == opaqueFunctions[j])
+          predictable = false;
+    }
+    if (uses.Index(text) == wxNOT_FOUND)
+      uses.Add(text);
+  }
+
+  // :, ::, := and ::= all start with a colon. A colon that follows another one
+  // belongs to the same operator.
+  if (unattributedAssignments != NULL)
+  {
+    *unattributedAssignments = 0;
+    for (size_t i = 0; i < tokens.size(); i++)
+      if ((tokens[i]->GetStyle() == TS_CODE_OPERATOR) && (tokens[i]->GetText() == wxT(":")) &&
+          (!attributed[i]) && ((i == 0) || (tokens[i - 1]->GetText() != wxT(":"))))
+        (*unattributedAssignments)++;
+  }
+  return predictable;
+}
+
+std::vector<MaximaTokenizer::Token *> GroupCell::GetCodeTokens()
+{
+  std::vector<MaximaTokenizer::Token *> tokens;
+  if (GetEditable() == NULL)
+    return tokens;
+
+  MaximaTokenizer::TokenList allTokens = GetEditable()->GetTokens();
+  for (MaximaTokenizer::TokenList::iterator it = allTokens.begin(); it != allTokens.end(); ++it)
+  {
+    if ((*it)->GetStyle() == TS_CODE_COMMENT)
+      continue;
+    wxString text = (*it)->GetText();
+    text.Trim(true);
+    text.Trim(false);
+    if (!text.IsEmpty())
+      tokens.push_back(*it);
+  }
+  return tokens;
+}
+
 Cell *GroupCell::Copy()
 {
   GroupCell *tmp = new GroupCell(m_configuration, m_groupType, m_cellPointers);
   tmp->Hide(m_hide);
   CopyData(this, tmp);
   tmp->AutoAnswer(m_autoAnswer);
+  tmp->Independent(m_independent);
   if (m_inputLabel)
     tmp->SetInput(m_inputLabel->CopyList());
   if (m_output != NULL)
@@ -418,11 +592,13 @@ wxString GroupCell::ToWXM(bool wxm)
 
 GroupCell::~GroupCell()
 {
+  ReleaseOutputCache();
   MarkAsDeleted();
   wxDELETE(m_inputLabel);
   wxDELETE(m_output);
+  wxDELETE(m_bufferedOutput);
   wxDELETE(m_hiddenTree);
-  m_inputLabel = m_output = m_hiddenTree = NULL;
+  m_inputLabel = m_output = m_bufferedOutput = m_lastInBufferedOutput = m_hiddenTree = NULL;
 }
 
 void GroupCell::MarkAsDeleted()
@@ -444,17 +620,24 @@ void GroupCell::MarkAsDeleted()
   Cell::MarkAsDeleted();
 }
 
-std::list<Cell *> GroupCell::GetInnerCells()
+int GroupCell::GetInnerCellCount()
+{
+  if (m_groupType == GC_TYPE_PAGEBREAK)
+    return 0;
+  return 2;
+}
+
+Cell *GroupCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if (m_groupType != GC_TYPE_PAGEBREAK)
+  switch (index)
   {
-    if(GetInput())
-      innerCells.push_back(GetInput());
-    if(GetOutput())
-      innerCells.push_back(GetOutput());
+    case 0:
+      return GetInput();
+    case 1:
+      return GetOutput();
+    default:
+      return NULL;
   }
-  return innerCells;
 }
 
 wxString GroupCell::TexEscapeOutputCell(wxString Input)
@@ -504,6 +687,7 @@ void GroupCell::SetOutput(Cell *output)
     m_cellPointers->m_answerCell = NULL;
   
   wxDELETE(m_output);
+  ReleaseOutputCache();
 
   m_output = output;
 
@@ -523,6 +707,9 @@ void GroupCell::SetOutput(Cell *output)
 
 void GroupCell::RemoveOutput()
 {
+  m_outputKey = wxEmptyString;
+  m_outputFromCache = false;
+
   // If there is nothing to do we can skip the rest of this action.
   if (m_output == NULL)
     return;
@@ -535,6 +722,10 @@ void GroupCell::RemoveOutput()
     wxDELETE(m_output);
     m_output = NULL;
   }
+  wxDELETE(m_bufferedOutput);
+  m_lastInBufferedOutput = NULL;
+  m_outputChanged = false;
+  ReleaseOutputCache();
 
   m_cellPointers->m_errorList.Remove(this);
   // Calculate the new cell height.
@@ -555,9 +746,13 @@ void GroupCell::AppendOutput(Cell *cell)
 {
   wxASSERT_MSG(cell != NULL, _("Bug: Trying to append NULL to a group cell."));
   if (cell == NULL) return;
+  ReleaseOutputCache();
   cell->SetGroupList(this);
+  // Counting only the new cells keeps appending output line by line linear in time.
+  int newCells = cell->CellsInListRecursive();
   if (m_output == NULL)
   {
+    m_cellsInGroup = 2 + newCells;
     m_output = cell;
 
     if (m_groupType == GC_TYPE_CODE && m_inputLabel->m_next != NULL)
@@ -583,12 +778,59 @@ void GroupCell::AppendOutput(Cell *cell)
     if(m_lastInOutput != NULL)
       while (m_lastInOutput->m_next != NULL)
         m_lastInOutput = m_lastInOutput->m_next;
+    m_cellsInGroup += newCells;
   }
 
   if (m_appendedCells == NULL)
     m_appendedCells = cell;
+}
 
-  UpdateCellsInGroup();
+void GroupCell::BufferOutput(Cell *cell)
+{
+  wxASSERT_MSG(cell != NULL, _("Bug: Trying to append NULL to a group cell."));
+  if (cell == NULL) return;
+  cell->SetGroupList(this);
+
+  if (m_bufferedOutput == NULL)
+    m_bufferedOutput = cell;
+  else
+    m_lastInBufferedOutput->AppendCell(cell);
+
+  m_lastInBufferedOutput = cell;
+  while (m_lastInBufferedOutput->m_next != NULL)
+    m_lastInBufferedOutput = m_lastInBufferedOutput->m_next;
+}
+
+void GroupCell::BufferOutputChange(Cell *cell)
+{
+  // Output that still waits in the buffer will be laid out anyway.
+  for (Cell *tmp = m_bufferedOutput; tmp != NULL; tmp = tmp->m_next)
+    if (tmp == cell)
+      return;
+  cell->ResetSize();
+  m_outputChanged = true;
+}
+
+bool GroupCell::FlushBufferedOutput()
+{
+  if ((m_bufferedOutput == NULL) && (!m_outputChanged))
+    return false;
+
+  if (m_bufferedOutput != NULL)
+  {
+    Cell *output = m_bufferedOutput;
+    m_bufferedOutput = m_lastInBufferedOutput = NULL;
+    AppendOutput(output);
+  }
+  if (m_outputChanged)
+  {
+    m_outputChanged = false;
+    ResetSize();
+    Recalculate();
+  }
+  else
+    RecalculateAppended();
+  return true;
 }
 
 void GroupCell::Recalculate()
@@ -604,11 +846,16 @@ void GroupCell::Recalculate()
 
 void GroupCell::RecalculateWidths(int fontsize)
 {
+  // A worksheet that is never displayed doesn't need to know its size.
+  if ((*m_configuration)->Headless())
+    return;
+
   Cell::RecalculateWidths(fontsize);
   Configuration *configuration = (*m_configuration);
   
   if (NeedsRecalculation())
   {
+    ReleaseOutputCache();
     // special case of 'line cell'
     if (m_groupType == GC_TYPE_PAGEBREAK)
     {
@@ -679,6 +926,7 @@ void GroupCell::InputHeightChanged()
 // breakup cells and compute new line breaks
 void GroupCell::OnSize()
 {
+  ReleaseOutputCache();
   // Unbreakup cells
   Cell *tmp = m_output;
   while (tmp != NULL)
@@ -800,10 +1048,14 @@ bool GroupCell::NeedsRecalculation()
 
 void GroupCell::RecalculateHeight(int fontsize)
 {
+  if ((*m_configuration)->Headless())
+    return;
+
   Cell::RecalculateHeight(fontsize);
 
   if(NeedsRecalculation())
   {
+    ReleaseOutputCache();
     m_outputRect.SetHeight(0);
     RecalculateHeightInput();   
     RecalculateHeightOutput();
@@ -821,8 +1073,9 @@ void GroupCell::RecalculateHeight(int fontsize)
 // We assume that appended cells will be in a new line!
 void GroupCell::RecalculateAppended()
 {  
-  if(m_hide)
+  if(m_hide || (*m_configuration)->Headless())
     return;
+  ReleaseOutputCache();
   if(NeedsRecalculation())
     m_appendedCells = m_output;
   Configuration *configuration = (*m_configuration);
@@ -995,8 +1248,6 @@ void GroupCell::Draw(wxPoint point)
 
       if ((m_output != NULL) && !m_hide)
       {
-        Cell *tmp = m_output;
-        int drop = tmp->GetMaxDrop();
         if ((configuration->ShowCodeCells()) ||
             (m_groupType != GC_TYPE_CODE))
           in.y += m_inputLabel->GetMaxDrop();
@@ -1005,25 +1256,8 @@ void GroupCell::Draw(wxPoint point)
         m_outputRect.y = in.y - m_output->GetMaxCenter();
         m_outputRect.x = in.x;
 
-        in.x += GetLineIndent(tmp);
-        while (tmp != NULL)
-        {         
-          tmp->Draw(in);
-          if ((tmp->m_nextToDraw != NULL) && (tmp->m_nextToDraw->BreakLineHere()))
-            {
-              if (tmp->m_nextToDraw->m_bigSkip)
-                in.y += MC_LINE_SKIP;
- 
-              in.x = point.x + GetLineIndent(tmp->m_nextToDraw);              
-
-              in.y += drop + tmp->m_nextToDraw->GetMaxCenter();
-              drop = tmp->m_nextToDraw->GetMaxDrop();
-            }
-          else
-            in.x += tmp->GetWidth();
-
-          tmp = tmp->m_nextToDraw;
-        }
+        if (!DrawOutputFromCache(in, point.x))
+          DrawOutput(in, point.x);
       }
       if ((configuration->ShowCodeCells()) ||
           (m_groupType != GC_TYPE_CODE))
@@ -1056,6 +1290,228 @@ void GroupCell::Draw(wxPoint point)
   }
 }
 
+void GroupCell::DrawOutput(wxPoint in, int lineStart)
+{
+  Cell *tmp = m_output;
+  int drop = tmp->GetMaxDrop();
+  in.x += GetLineIndent(tmp);
+  while (tmp != NULL)
+  {
+    tmp->Draw(in);
+    if ((tmp->m_nextToDraw != NULL) && (tmp->m_nextToDraw->BreakLineHere()))
+    {
+      if (tmp->m_nextToDraw->m_bigSkip)
+        in.y += MC_LINE_SKIP;
+
+      in.x = lineStart + GetLineIndent(tmp->m_nextToDraw);
+
+      in.y += drop + tmp->m_nextToDraw->GetMaxCenter();
+      drop = tmp->m_nextToDraw->GetMaxDrop();
+    }
+    else
+      in.x += tmp->GetWidth();
+
+    tmp = tmp->m_nextToDraw;
+  }
+}
+
+bool GroupCell::OutputIsCacheable()
+{
+  Configuration *configuration = (*m_configuration);
+  if ((m_output == NULL) || m_hide)
+    return false;
+
+  // Images already are bitmaps and animations change their contents. Answers
+  // to questions are editable.
+  for (Cell *tmp = m_output; tmp != NULL; tmp = tmp->m_next)
+    if ((tmp->GetType() == MC_TYPE_IMAGE) || (tmp->GetType() == MC_TYPE_SLIDE) ||
+        (tmp->GetType() == MC_TYPE_INPUT))
+      return false;
+  return true;
+}
+
+bool GroupCell::DrawOutputFromCache(wxPoint in, int lineStart)
+{
+  // Printing and exporting always draw the output cells themselves.
+  if (!(*m_configuration)->CacheOutput())
+    return false;
+
+  if (!OutputIsCacheable())
+  {
+    ReleaseOutputCache();
+    return false;
+  }
+
+  Configuration *configuration = (*m_configuration);
+  wxDC *dc = configuration->GetDC();
+  double scaleX, scaleY;
+  dc->GetUserScale(&scaleX, &scaleY);
+
+  // Lines of maths are indented by GetLineIndent() which isn't part of m_outputRect.
+  wxRect rect = m_outputRect;
+  rect.width += Scale_Px(configuration->GetLabelWidth()) + 2 * MC_TEXT_PADDING;
+  wxSize bitmapSize((int) ceil(rect.width * scaleX), (int) ceil(rect.height * scaleY));
+  if ((rect.width < 1) || (rect.height < 1))
+    return false;
+
+  if ((!m_outputCache.IsOk()) ||
+      (m_outputCacheRect != rect) ||
+      (m_outputCache.GetSize() != bitmapSize) ||
+      (m_outputCacheZoom != configuration->GetZoomFactor()) ||
+      (m_outputCacheStyle != configuration->StyleGeneration()))
+  {
+    ReleaseOutputCache();
+
+    // A single huge output would push the output of all other cells out of the
+    // cache, anyway.
+    size_t bytes = (size_t) bitmapSize.x * bitmapSize.y * 4;
+    if (bytes > m_outputCacheBudget / 8)
+      return false;
+    while ((m_outputCacheBytes + bytes > m_outputCacheBudget) && (!m_outputCacheOwners.empty()))
+      m_outputCacheOwners.front()->ReleaseOutputCache();
+
+    m_outputCache = wxBitmap(bitmapSize.x, bitmapSize.y, wxBITMAP_SCREEN_DEPTH);
+    if (!m_outputCache.IsOk())
+      return false;
+    {
+      wxMemoryDC cacheDC;
+      cacheDC.SelectObject(m_outputCache);
+      if (!cacheDC.IsOk())
+      {
+        m_outputCache = wxNullBitmap;
+        return false;
+      }
+      cacheDC.SetUserScale(scaleX, scaleY);
+      cacheDC.SetLogicalOrigin(rect.x, rect.y);
+      cacheDC.SetBrush(configuration->GetBackgroundBrush());
+      cacheDC.SetPen(*wxTRANSPARENT_PEN);
+      cacheDC.DrawRectangle(rect);
+      cacheDC.SetMapMode(wxMM_TEXT);
+      wxGCDC antiAliassingDC(cacheDC);
+      if (antiAliassingDC.IsOk())
+      {
+        antiAliassingDC.SetUserScale(scaleX, scaleY);
+        antiAliassingDC.SetLogicalOrigin(rect.x, rect.y);
+      }
+
+      // Render the whole output, not only the part that is currently visible.
+      wxDC *oldAntialiassingDC = configuration->GetAntialiassingDC();
+      wxRect oldUpdateRegion = configuration->GetUpdateRegion();
+      configuration->SetContext(cacheDC);
+      if (antiAliassingDC.IsOk())
+        configuration->SetAntialiassingDC(antiAliassingDC);
+      configuration->SetUpdateRegion(rect);
+      SetPen();
+      DrawOutput(in, lineStart);
+      configuration->SetContext(*dc);
+      configuration->SetAntialiassingDC(*oldAntialiassingDC);
+      configuration->SetUpdateRegion(oldUpdateRegion);
+      SetPen();
+    }
+    m_outputCacheRect = rect;
+    m_outputCacheZoom = configuration->GetZoomFactor();
+    m_outputCacheStyle = configuration->StyleGeneration();
+    m_outputCacheBytes += bytes;
+    m_outputCacheOwners.push_back(this);
+  }
+  else
+  {
+    m_outputCacheOwners.remove(this);
+    m_outputCacheOwners.push_back(this);
+    PlaceOutput(in, lineStart);
+  }
+
+  if (configuration->ClipToDrawRegion())
+    rect.Intersect(configuration->GetUpdateRegion());
+  if ((rect.width < 1) || (rect.height < 1))
+    return true;
+
+  {
+    wxMemoryDC cacheDC;
+    cacheDC.SelectObject(m_outputCache);
+    cacheDC.SetUserScale(scaleX, scaleY);
+    cacheDC.SetLogicalOrigin(m_outputCacheRect.x, m_outputCacheRect.y);
+    dc->Blit(rect.x, rect.y, rect.width, rect.height, &cacheDC, rect.x, rect.y);
+  }
+  DrawSelectionOverlay();
+  return true;
+}
+
+void GroupCell::PlaceOutput(wxPoint in, int lineStart)
+{
+  Cell *tmp = m_output;
+  int drop = tmp->GetMaxDrop();
+  in.x += GetLineIndent(tmp);
+  while (tmp != NULL)
+  {
+    if ((tmp->GetHeight() > 0) && (in.y > 0))
+      tmp->SetCurrentPoint(in);
+    if ((tmp->m_nextToDraw != NULL) && (tmp->m_nextToDraw->BreakLineHere()))
+    {
+      if (tmp->m_nextToDraw->m_bigSkip)
+        in.y += MC_LINE_SKIP;
+
+      in.x = lineStart + GetLineIndent(tmp->m_nextToDraw);
+
+      in.y += drop + tmp->m_nextToDraw->GetMaxCenter();
+      drop = tmp->m_nextToDraw->GetMaxDrop();
+    }
+    else
+      in.x += tmp->GetWidth();
+
+    tmp = tmp->m_nextToDraw;
+  }
+}
+
+void GroupCell::DrawSelectionOverlay()
+{
+  Cell *tmp = m_cellPointers->m_selectionStart;
+  if ((tmp == NULL) || (tmp->GetType() == MC_TYPE_GROUP) || (tmp->GetGroup() != this))
+    return;
+
+  Configuration *configuration = (*m_configuration);
+  wxDC *dc = configuration->GetAntialiassingDC();
+  if ((dc == NULL) || (!dc->IsOk()))
+    return;
+
+  wxColour color = configuration->GetColor(TS_SELECTION);
+  if (dc != configuration->GetDC())
+  {
+    // The antialiassing DC knows about transparency => the contents shine through.
+    dc->SetPen(*wxTRANSPARENT_PEN);
+    dc->SetBrush(wxBrush(wxColour(color.Red(), color.Green(), color.Blue(), 128)));
+  }
+  else
+  {
+    // A filled rectangle would hide the contents => only draw its outline.
+    dc->SetPen(*(wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID)));
+    dc->SetBrush(*wxTRANSPARENT_BRUSH);
+  }
+  while (tmp != NULL)
+  {
+    if (!tmp->m_isBrokenIntoLines && !tmp->m_isHidden)
+      tmp->DrawBoundingBox(*dc, false);
+    if (tmp == m_cellPointers->m_selectionEnd)
+      break;
+    tmp = tmp->m_nextToDraw;
+  }
+  SetPen();
+}
+
+void GroupCell::ReleaseOutputCache()
+{
+  if (!m_outputCache.IsOk())
+    return;
+
+  m_outputCacheBytes -= (size_t) m_outputCache.GetWidth() * m_outputCache.GetHeight() * 4;
+  m_outputCache = wxNullBitmap;
+  m_outputCacheOwners.remove(this);
+}
+
+size_t GroupCell::m_outputCacheBytes = 0;
+unsigned long GroupCell::m_evaluationCounter = 0;
+std::list<GroupCell *> GroupCell::m_outputCacheOwners;
+
 wxRect GroupCell::GetRect(bool WXUNUSED(all))
 {
   return wxRect(m_currentPoint.x, m_currentPoint.y - m_center,
@@ -1188,6 +1644,25 @@ void GroupCell::DrawBracket()
     if (Cell::InUpdateRegion(rect))
       dc->DrawRectangle(rect);
   }
+  //
+  // Mark groupcells whose output has been restored instead of recalculated.
+  //
+  else if (m_outputFromCache)
+  {
+    drawBracket = true;
+    dc->SetBrush(*wxTRANSPARENT_BRUSH);
+    dc->SetPen(*(wxThePenList->FindOrCreatePen(configuration->GetColor(TS_CELL_BRACKET),
+                                              configuration->GetDefaultLineWidth(),
+                                              wxPENSTYLE_SHORT_DASH)));
+    wxRect rect = GetRect();
+    rect = wxRect(
+            configuration->GetIndent() - configuration->GetCellBracketWidth(),
+            rect.GetTop() - 2,
+            configuration->GetCellBracketWidth(),
+            rect.GetHeight() + 5);
+    if (Cell::InUpdateRegion(rect))
+      dc->DrawRectangle(rect);
+  }
 
   Cell *editable = GetEditable();
   if (editable != NULL && editable->IsActive())
@@ -1679,6 +2154,8 @@ wxString GroupCell::ToXML()
       }
       if(m_autoAnswer)
         str += wxT(" auto_answer=\"yes\"");
+      if((m_output != NULL) && (!m_outputKey.IsEmpty()))
+        str += wxT(" output_key=\"") + m_outputKey + wxT("\"");
       break;
     }
     case GC_TYPE_IMAGE:
@@ -1722,6 +2199,8 @@ wxString GroupCell::ToXML()
   // write hidden status
   if (m_hide)
     str += wxT(" hide=\"true\"");
+  if (m_independent)
+    str += wxT(" independent=\"yes\"");
   str += wxT(">\n");
 
   Cell *input = GetInput();
@@ -2151,6 +2630,7 @@ void GroupCell::Hide(bool hide)
     return;
 
   m_hide = hide;
+  ReleaseOutputCache();
   if ((m_groupType == GC_TYPE_TEXT) || (m_groupType == GC_TYPE_CODE))
     GetEditable()->SetFirstLineOnly(m_hide);
 
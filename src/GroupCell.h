@@ -30,6 +30,7 @@
 #ifndef GROUPCELL_H
 #define GROUPCELL_H
 
+#include <vector>
 #include "Cell.h"
 #include "EditorCell.h"
 
@@ -77,6 +78,14 @@ public:
     m_autoAnswer = autoAnswer;
     if(GetEditable() != NULL) GetEditable()->AutoAnswer(autoAnswer);
   }
+  /*! Can this section be evaluated without knowing the rest of the worksheet?
+
+    Independent sections can be handed to additional maxima processes that
+    evaluate them in parallel to each other.
+   */
+  bool Independent(){return m_independent;}
+  //! Mark this section as being independent of the rest of the worksheet
+  void Independent(bool independent){m_independent = independent;}
   // Add a new answer to the cell
   void AddAnswer(wxString answer)
     {
@@ -93,7 +102,8 @@ public:
     no more displayed currently.
    */
   void MarkAsDeleted();
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount();
+  Cell *GetInnerCell(int index);
 
   /*! Which GroupCell was the last maxima was working on?
 
@@ -120,6 +130,9 @@ public:
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   // general methods
   GroupType GetGroupType()
   { return m_groupType; }
@@ -148,6 +161,26 @@ public:
   EditorCell *GetEditable(); // returns pointer to editor (if there is one)
   void AppendOutput(Cell *cell);
 
+  /*! Queue output cells to be appended to the output by FlushBufferedOutput()
+
+    Appending and laying out maxima's output line by line would mean recalculating
+    and redrawing the growing cell once per line.
+   */
+  void BufferOutput(Cell *cell);
+
+  /*! A cell of the output has changed its contents
+
+    Its layout is updated by the next FlushBufferedOutput(), together with the
+    output that has been buffered until then.
+   */
+  void BufferOutputChange(Cell *cell);
+
+  /*! Append all output BufferOutput() has collected and calculate its layout
+
+    \return false, if there was no output to append.
+   */
+  bool FlushBufferedOutput();
+
   /*! Remove all output cells attached to this one
 
     If called on an image cell it will not remove the image attached to it (even if the image
@@ -278,6 +311,79 @@ public:
 
   //! Call ResetInputLabel() on all cells in the list of cells this GroupCell starts with.
   void ResetInputLabelList();
+
+  //! Remember the input maxima has been sent for this cell
+  void InputEvaluated();
+
+  /*! Sets the key the output of this cell would be cached under
+
+    The key is a hash of the input and of the keys of the cells that define
+    the symbols the input uses. An empty key means that the output of this
+    cell cannot be cached.
+   */
+  void InputKey(wxString key);
+
+  //! The key the current output of this cell has been produced with
+  wxString OutputKey(){return m_outputKey;}
+  //! Sets the key the current output of this cell has been produced with
+  void OutputKey(wxString key){m_outputKey = key;}
+
+  //! Maxima has finished evaluating this cell
+  void OutputComplete();
+
+  //! Is the output of this cell still what maxima would answer to the current input?
+  bool OutputCached();
+
+  //! Makes sure the next evaluation of this cell isn't answered from the cache
+  void DiscardOutputKey(){m_outputKey = wxEmptyString;}
+
+  //! Has the output of this cell been restored instead of being recalculated?
+  bool OutputFromCache(){return m_outputFromCache;}
+  //! Mark the output of this cell as having been restored instead of being recalculated
+  void OutputFromCache(bool fromCache){m_outputFromCache = fromCache;}
+
+  /*! Has the input changed since maxima has evaluated it the last time?
+
+    Cells maxima never has evaluated are always stale.
+   */
+  bool InputChanged();
+
+  /*! When has maxima evaluated this cell the last time?
+
+    Cells that are evaluated later get higher numbers. 0 means: Never.
+   */
+  unsigned long GetEvaluationGeneration(){return m_evaluationGeneration;}
+
+  //! Call ForgetEvaluatedInput() on all cells in the list of cells this GroupCell starts with.
+  void ForgetEvaluatedInputList();
+
+  //! Forget which input maxima has evaluated, for example after maxima has been restarted
+  void ForgetEvaluatedInput()
+  {
+    m_inputEvaluated = false;
+    m_evaluationGeneration = 0;
+    m_evaluatedInput = wxEmptyString;
+  }
+
+  /*! Finds out which symbols the commands in this cell define and which ones they use
+
+    Uses the tokens the MaximaTokenizer has found in the input. A symbol counts
+    as defined if anywhere in the input it is followed by <code>:</code>,
+    <code>(args):=</code> or <code>[index]:</code>. All other variable and
+    function names count as being used.
+    \param defines Returns the symbols this cell defines
+    \param uses Returns the symbols this cell uses
+    \param unattributedAssignments If not NULL: Returns how many of the :, ::, :=
+    and ::= operators in the input assign to something that isn't a plain
+    symbol name, for example <code>(a):1</code>.
+    \return false, if the cell has effects that cannot be found out this way,
+    for example if it contains lisp code or calls kill() or load().
+   */
+  bool GetDependencies(wxArrayString &defines, wxArrayString &uses,
+                       size_t *unattributedAssignments = NULL);
+
+  //! The tokens of the input that carry meaning: No comments and no whitespace
+  std::vector<MaximaTokenizer::Token *> GetCodeTokens();
   //! @{ folding and unfolding
 
   //! Is this cell foldable?
@@ -385,6 +491,9 @@ public:
   //! Draw the bracket of this cell
   void DrawBracket();
 
+  //! Forget the rendered copy of the output, see DrawOutputFromCache()
+  void ReleaseOutputCache();
+
   //! Is this list of cells empty?
   bool Empty();
 
@@ -437,7 +546,7 @@ public:
       {
         if (parent != NULL)
         {
-          *parent = m_group;
+          *parent = m_group->GetAccessible();
           return wxACC_OK;
         }
         return wxACC_FAIL;
@@ -506,15 +615,80 @@ protected:
   int m_mathFontSize;
   Cell *m_lastInOutput;
   Cell *m_appendedCells;
+  //! Output that is waiting to be appended to m_output, see BufferOutput()
+  Cell *m_bufferedOutput;
+  //! The last cell in m_bufferedOutput
+  Cell *m_lastInBufferedOutput;
+  //! Has a cell of the output changed since the last FlushBufferedOutput()?
+  bool m_outputChanged;
+  //! Draw the output cells. Lines start at the x coordinate lineStart.
+  void DrawOutput(wxPoint in, int lineStart);
+  /*! Draw the output using a bitmap that holds a rendered copy of it
+
+    Output cells only change when the cell is re-evaluated. Re-using the rendered
+    output instead of drawing every single text and line of it again makes scrolling
+    through worksheets with big formulas much faster.
+
+    \return false, if the output cannot be cached and needs to be drawn directly.
+   */
+  bool DrawOutputFromCache(wxPoint in, int lineStart);
+  //! Can our output be drawn from a bitmap right now?
+  bool OutputIsCacheable();
+  /*! Tell the output cells where they are without drawing them
+
+    Hit-testing and the selection need the positions of the cells the cached
+    bitmap has been drawn instead of.
+   */
+  void PlaceOutput(wxPoint in, int lineStart);
+  /*! Highlight the selected output cells on top of the cached bitmap
+
+    The worksheet draws the selection below the cell contents which the cached
+    bitmap hides => draw it again, but translucent.
+   */
+  void DrawSelectionOverlay();
 private:
   //! Does this GroupCell automatically fill in the answer to questions?
   bool m_autoAnswer;
+  //! Can this section be evaluated independently of the rest of the worksheet?
+  bool m_independent;
+  //! Has maxima evaluated this cell since it has been started?
+  bool m_inputEvaluated;
+  //! The value of m_evaluationCounter when this cell was evaluated the last time
+  unsigned long m_evaluationGeneration;
+  //! Counts the evaluations of all cells
+  static unsigned long m_evaluationCounter;
+  //! The input maxima has evaluated the last time
+  wxString m_evaluatedInput;
+  //! The key the output of the current input would be cached under
+  wxString m_inputKey;
+  //! The input m_inputKey has been calculated for
+  wxString m_keyedInput;
+  //! The key of the output maxima currently calculates for this cell
+  wxString m_pendingOutputKey;
+  //! The key the current output has been produced with
+  wxString m_outputKey;
+  //! Has the output been restored instead of being recalculated?
+  bool m_outputFromCache;
   wxRect m_outputRect;
   bool m_inEvaluationQueue;
   bool m_lastInEvaluationQueue;
   int m_inputWidth, m_inputHeight, m_outputWidth, m_outputHeight;
   //! The number of cells the current group contains (-1, if no GroupCell)
   int m_cellsInGroup;
+  //! A rendered copy of our output, if DrawOutputFromCache() has created one.
+  wxBitmap m_outputCache;
+  //! The area of the worksheet m_outputCache shows
+  wxRect m_outputCacheRect;
+  //! The zoom factor m_outputCache was rendered at
+  double m_outputCacheZoom;
+  //! The style generation m_outputCache was rendered with
+  long m_outputCacheStyle;
+  //! The memory all output caches together may use [bytes]
+  static const size_t m_outputCacheBudget = 64 * 1024 * 1024;
+  //! The memory all output caches currently use [bytes]
+  static size_t m_outputCacheBytes;
+  //! All GroupCells that own an output cache, least recently used first
+  static std::list<GroupCell *> m_outputCacheOwners;
   void UpdateCellsInGroup(){
     if(m_output != NULL)
       m_cellsInGroup = 2 + m_output->CellsInListRecursive();
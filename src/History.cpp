@@ -30,7 +30,7 @@
 
 #include <wx/sizer.h>
 #include <wx/tokenzr.h>
-#include <wx/regex.h>
+#include "StringMatchers.h"
 
 History::History(wxWindow *parent, int id) : wxPanel(parent, id)
 {
@@ -78,18 +78,29 @@ void History::UpdateDisplay()
 {
   wxString regex = m_regex->GetValue();
   wxArrayString display;
-  wxRegEx matcher;
 
-  if (regex != wxEmptyString)
-    matcher.Compile(regex);
+  // A pattern without special characters is a plain substring search that
+  // doesn't need the regex engine. Real regular expressions are only compiled
+  // again if the user has changed them.
+  bool plainText = !StringMatchers::ContainsRegexChars(regex);
+  if ((!plainText) && (regex != m_matcherPattern))
+  {
+    m_matcherPattern = regex;
+    m_matcher.Compile(regex);
+  }
 
   for (unsigned int i = 0; i < commands.Count(); i++)
   {
     wxString curr = commands.Item(i);
 
-    if (regex.Length() > 0 && matcher.IsValid())
+    if (regex.Length() > 0 && plainText)
+    {
+      if (curr.Contains(regex))
+        display.Add(curr);
+    }
+    else if (regex.Length() > 0 && m_matcher.IsValid())
     {
-      if (matcher.Matches(curr))
+      if (m_matcher.Matches(curr))
         display.Add(curr);
     }
     else
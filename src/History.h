@@ -26,6 +26,7 @@
   issued commands for the history pane.
  */
 #include <wx/wx.h>
+#include <wx/regex.h>
 
 #ifndef HISTORY_H
 #define HISTORY_H
@@ -62,6 +63,10 @@ public:
 private:
   wxListBox *m_history;
   wxTextCtrl *m_regex;
+  //! The compiled version of the regular expression the user has entered
+  wxRegEx m_matcher;
+  //! The regular expression m_matcher was compiled from
+  wxString m_matcherPattern;
   wxArrayString commands;
   //! The currently selected item. -1=none.
   long m_current;
@@ -25,11 +25,12 @@
 */
 
 #include "Image.h"
+#include <algorithm>
 #include <wx/mstream.h>
 #include <wx/wfstream.h>
 #include <wx/zstream.h>
 #include <wx/txtstrm.h>
-#include <wx/regex.h>
+#include "StringMatchers.h"
 #include <wx/stdpaths.h>
 
 wxMemoryBuffer Image::ReadCompressedImage(wxInputStream *data)
@@ -120,6 +121,10 @@ Image::Image(Configuration **config, wxString image, bool remove, wxFileSystem *
 
 Image::~Image()
 {
+  // The capture might still be reading the files we are about to delete.
+  if(m_gnuplotCapture)
+    m_gnuplotCapture->Wait();
+
   if(m_gnuplotSource != wxEmptyString)
   {
     if(wxFileExists(m_gnuplotSource))
@@ -151,123 +156,22 @@ void Image::GnuplotSource(wxString gnuplotFilename, wxString dataFilename, wxFil
     if (strucStat.st_size > 25*1000*1000)
       return;
 
-    // The gnuplot source of the image is cached in a compressed form:
-    //
-    // as it is text-only and contains many redundancies it will get way
-    // smaller this way.
-    {
-      wxFileInputStream input(m_gnuplotSource);
-      if(!input.IsOk())
-        return;
-      wxTextInputStream textIn(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      
-      wxMemoryOutputStream mstream;
-      int zlib_flags;
-      if(wxZlibOutputStream::CanHandleGZip())
-        zlib_flags = wxZLIB_GZIP;
-      else
-        zlib_flags = wxZLIB_ZLIB;
-      wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-      wxTextOutputStream textOut(zstream);
-      wxString line;
-      
-      // A RegEx that matches the name of the data file (needed if we ever want to
-      // move a data file into the temp directory of a new computer that locates its
-      // temp data somewhere strange).
-      wxRegEx replaceDataFileName("'[^']*maxout_[^']*_[0-9]*\\.data'");
-      while(!input.Eof())
-      {
-        line = textIn.ReadLine();
-        if(replaceDataFileName.Matches(line))
-        {
-          wxString dataFileName;
-          dataFileName = replaceDataFileName.GetMatch(line);
-          replaceDataFileName.Replace(&line,wxT("'<DATAFILENAME>'"));
-        }
-        textOut << line + wxT("\n");
-      }
-      textOut.Flush();
-      zstream.Close();
-      
-      m_gnuplotSource_Compressed.Clear();
-      m_gnuplotSource_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                            mstream.GetOutputStreamBuffer()->GetBufferSize());
-    }
-    
-    {
-      wxFileInputStream input(m_gnuplotData);
-      if(!input.IsOk())
-        return;
-      wxTextInputStream textIn(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      
-      wxMemoryOutputStream mstream;
-      int zlib_flags;
-      if(wxZlibOutputStream::CanHandleGZip())
-        zlib_flags = wxZLIB_GZIP;
-      else
-        zlib_flags = wxZLIB_ZLIB;
-      wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-      wxTextOutputStream textOut(zstream);
-      wxString line;
-      
-      while(!input.Eof())
-      {
-      line = textIn.ReadLine();
-      textOut << line + wxT("\n");
-      }
-      textOut.Flush();
-      zstream.Close();
-      
-      m_gnuplotData_Compressed.Clear();
-      m_gnuplotData_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                          mstream.GetOutputStreamBuffer()->GetBufferSize());
-    }
+    // Reading and compressing the files can take a while => do it in the
+    // background and only wait for it if someone actually needs the data.
+    m_gnuplotCapture = wxSharedPtr<GnuplotCapture>(new GnuplotCapture(m_gnuplotSource, m_gnuplotData));
   }
   else
   {
+    // wxFileSystem isn't thread-safe => files from a .wxmx archive are read
+    // immediately.
     {
       wxFSFile *fsfile = filesystem->OpenFile(m_gnuplotSource);
       if (fsfile)
       { // open successful
         wxInputStream *input = fsfile->GetStream();
-          if(input->IsOk())
-          {
-            wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-
-            wxMemoryOutputStream mstream;
-            int zlib_flags;
-            if(wxZlibOutputStream::CanHandleGZip())
-              zlib_flags = wxZLIB_GZIP;
-            else
-              zlib_flags = wxZLIB_ZLIB;
-            wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-            wxTextOutputStream textOut(zstream);
-            wxString line;
-            
-            // A RegEx that matches the name of the data file (needed if we ever want to
-            // move a data file into the temp directory of a new computer that locates its
-            // temp data somewhere strange).
-            wxRegEx replaceDataFileName("'[^']*maxout_[^']*_[0-9*]\\.data'");
-            while(!input->Eof())
-            {
-              line = textIn.ReadLine();
-              if(replaceDataFileName.Matches(line))
-              {
-                wxString dataFileName;
-                dataFileName = replaceDataFileName.GetMatch(line);
-                if(dataFileName != wxEmptyString)
-                  wxLogMessage(_("Gnuplot Data File Name: ") + dataFileName);
-                replaceDataFileName.Replace(&line,wxT("'<DATAFILENAME>'"));
-              }
-              textOut << line + wxT("\n");
-            }
-            textOut.Flush();
-            zstream.Close();
-            m_gnuplotSource_Compressed.Clear();
-            m_gnuplotSource_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                                  mstream.GetOutputStreamBuffer()->GetBufferSize());
-            wxDELETE(input);
-          }
+        if(input->IsOk())
+          m_gnuplotSource_Compressed = CompressGnuplotFile(*input, true);
+        wxDELETE(fsfile);
       }
     }
     {
@@ -276,38 +180,160 @@ void Image::GnuplotSource(wxString gnuplotFilename, wxString dataFilename, wxFil
       { // open successful
         wxInputStream *input = fsfile->GetStream();
         if(input->IsOk())
-        {
-          wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-            
-          wxMemoryOutputStream mstream;
-          int zlib_flags;
-          if(wxZlibOutputStream::CanHandleGZip())
-            zlib_flags = wxZLIB_GZIP;
-          else
-            zlib_flags = wxZLIB_ZLIB;
-          wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-          wxTextOutputStream textOut(zstream);
-          wxString line;
-            
-          while(!input->Eof())
-          {
-            line = textIn.ReadLine();
-            textOut << line + wxT("\n");
-          }
-          textOut.Flush();
-          zstream.Close();
-            
-          m_gnuplotData_Compressed.Clear();
-          m_gnuplotData_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                              mstream.GetOutputStreamBuffer()->GetBufferSize());
-        }
+          m_gnuplotData_Compressed = CompressGnuplotFile(*input, false);
+        wxDELETE(fsfile);
       }
     }
   }
 }
 
+wxMemoryBuffer Image::CompressGnuplotFile(wxInputStream &input, bool source)
+{
+  // As gnuplot files are text-only and contain many redundancies they get way
+  // smaller if compressed.
+  wxTextInputStream textIn(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
+
+  wxMemoryOutputStream mstream;
+  int zlib_flags;
+  if(wxZlibOutputStream::CanHandleGZip())
+    zlib_flags = wxZLIB_GZIP;
+  else
+    zlib_flags = wxZLIB_ZLIB;
+  // This is only the copy we keep in memory: .wxmx files are compressed
+  // separately on saving => speed is more important than size here.
+  wxZlibOutputStream zstream(mstream, wxZ_BEST_SPEED, zlib_flags);
+  wxTextOutputStream textOut(zstream);
+  wxString line;
+
+  while(!input.Eof())
+  {
+    line = textIn.ReadLine();
+    // Replace the name of the data file (needed if we ever want to move a
+    // data file into the temp directory of a new computer that locates its
+    // temp data somewhere strange).
+    if(source)
+      StringMatchers::ReplaceDataFileNames(line, wxT("'<DATAFILENAME>'"));
+    textOut << line + wxT("\n");
+  }
+  textOut.Flush();
+  zstream.Close();
+
+  wxMemoryBuffer retval;
+  retval.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
+                    mstream.GetOutputStreamBuffer()->GetBufferSize());
+  return retval;
+}
+
+wxMutex Image::GnuplotCapture::m_queueMutex;
+wxCondition Image::GnuplotCapture::m_captureDone(Image::GnuplotCapture::m_queueMutex);
+std::list<Image::GnuplotCapture *> Image::GnuplotCapture::m_queue;
+bool Image::GnuplotCapture::m_workerRunning = false;
+
+Image::GnuplotCapture::GnuplotCapture(wxString gnuplotFilename, wxString dataFilename)
+{
+  m_done = false;
+  // wxStrings mustn't share their data with strings another thread uses.
+  m_gnuplotFilename = gnuplotFilename.Clone();
+  m_dataFilename = dataFilename.Clone();
+  {
+    wxMutexLocker lock(m_queueMutex);
+    m_queue.push_back(this);
+    if(m_workerRunning)
+      return;
+    // The worker cannot start working before we have released the lock.
+    Worker *worker = new Worker();
+    if(worker->Run() == wxTHREAD_NO_ERROR)
+    {
+      m_workerRunning = true;
+      return;
+    }
+    delete worker;
+    m_queue.remove(this);
+  }
+  Capture();
+  m_done = true;
+}
+
+Image::GnuplotCapture::~GnuplotCapture()
+{
+  Wait();
+}
+
+void Image::GnuplotCapture::Wait()
+{
+  {
+    wxMutexLocker lock(m_queueMutex);
+    if(m_done)
+      return;
+    std::list<GnuplotCapture *>::iterator it = std::find(m_queue.begin(), m_queue.end(), this);
+    if(it == m_queue.end())
+    {
+      // The worker is working on this capture right now.
+      while(!m_done)
+        m_captureDone.Wait();
+      return;
+    }
+    // The worker hasn't started on this capture, yet => we don't need to wait
+    // for the ones that have been queued before it.
+    m_queue.erase(it);
+  }
+  Capture();
+  wxMutexLocker lock(m_queueMutex);
+  m_done = true;
+}
+
+wxThread::ExitCode Image::GnuplotCapture::Worker::Entry()
+{
+  while(true)
+  {
+    GnuplotCapture *capture;
+    {
+      wxMutexLocker lock(m_queueMutex);
+      if(m_queue.empty())
+      {
+        m_workerRunning = false;
+        return 0;
+      }
+      capture = m_queue.front();
+      m_queue.pop_front();
+    }
+    capture->Capture();
+    // The owner of the capture may delete it as soon as m_done is set.
+    wxMutexLocker lock(m_queueMutex);
+    capture->m_done = true;
+    m_captureDone.Broadcast();
+  }
+}
+
+void Image::GnuplotCapture::Capture()
+{
+  {
+    wxFileInputStream input(m_gnuplotFilename);
+    if(!input.IsOk())
+      return;
+    m_source = CompressGnuplotFile(input, true);
+  }
+  {
+    wxFileInputStream input(m_dataFilename);
+    if(!input.IsOk())
+      return;
+    m_data = CompressGnuplotFile(input, false);
+  }
+}
+
+void Image::WaitForGnuplotCapture()
+{
+  if(!m_gnuplotCapture)
+    return;
+  m_gnuplotCapture->Wait();
+  m_gnuplotSource_Compressed = m_gnuplotCapture->GetSource();
+  m_gnuplotData_Compressed = m_gnuplotCapture->GetData();
+  m_gnuplotCapture.reset();
+}
+
 wxMemoryBuffer Image::GetGnuplotSource()
 {
+  WaitForGnuplotCapture();
   wxMemoryBuffer retval;
   
   wxMemoryOutputStream output;
@@ -337,6 +363,7 @@ wxMemoryBuffer Image::GetGnuplotSource()
 
 wxMemoryBuffer Image::GetGnuplotData()
 {
+  WaitForGnuplotCapture();
   wxMemoryBuffer retval;
   
   wxMemoryOutputStream output;
@@ -369,6 +396,8 @@ wxString Image::GnuplotData()
   if((m_gnuplotData == wxEmptyString) || (wxFileExists(m_gnuplotData)))
     return m_gnuplotData;
 
+  WaitForGnuplotCapture();
+
   // Move the gnuplot data and data file into our temp directory
   wxFileName gnuplotSourceFile(m_gnuplotSource);
   m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
@@ -403,6 +432,8 @@ wxString Image::GnuplotSource()
   if((m_gnuplotSource == wxEmptyString) || (wxFileExists(m_gnuplotSource)))
     return m_gnuplotSource;
 
+  WaitForGnuplotCapture();
+
   // Move the gnuplot source and data file into our temp directory
   wxFileName gnuplotSourceFile(m_gnuplotSource);
   m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
@@ -30,11 +30,14 @@
 #define IMAGE_H
 
 #include "Cell.h"
+#include <list>
 #include <wx/image.h>
 
 #include <wx/filesys.h>
 #include <wx/fs_arc.h>
 #include <wx/buffer.h>
+#include <wx/thread.h>
+#include <wx/sharedptr.h>
 
 /*! Manages an auto-scaling image
 
@@ -91,6 +94,9 @@ public:
     Causes the files to be cached if they are not way too long; As the files
     are text-only they profit from being compressed and are stored in the 
     memory in their compressed form.
+
+    Files from the local filesystem are read and compressed in a background
+    thread so the image can be displayed without waiting for that.
    */
   void GnuplotSource(wxString gnuplotFilename, wxString dataFilename, wxFileSystem *filesystem = NULL);
   /*! Returns the gnuplot source file name of this image
@@ -183,7 +189,68 @@ public:
   //! The image in its original compressed form
   wxMemoryBuffer m_compressedImage;
 
+  /*! Reads a gnuplot source or data file and compresses it
+
+    \param input The file to read
+    \param source true = This is a gnuplot source file => replace the name of the
+                  data file by a placeholder.
+   */
+  static wxMemoryBuffer CompressGnuplotFile(wxInputStream &input, bool source);
+
+  /*! Reads and compresses the gnuplot files of an image in the background
+
+    Works like a future: Wait() returns as soon as the compressed files are
+    available. All captures are done by one background thread that works
+    through them in the order they were requested => a worksheet with many
+    plots doesn't start a thread for each of them.
+   */
+  class GnuplotCapture
+  {
+  public:
+    GnuplotCapture(wxString gnuplotFilename, wxString dataFilename);
+    //! Waits for the capture to finish
+    ~GnuplotCapture();
+    //! Wait until the files have been compressed
+    void Wait();
+    //! The compressed gnuplot source. Call Wait() first.
+    wxMemoryBuffer GetSource(){return m_source;}
+    //! The compressed gnuplot data. Call Wait() first.
+    wxMemoryBuffer GetData(){return m_data;}
+  private:
+    //! Does the actual work
+    void Capture();
+
+    //! The thread that works through m_queue. Ends as soon as the queue is empty.
+    class Worker : public wxThread
+    {
+    public:
+      Worker() : wxThread(wxTHREAD_DETACHED){}
+    protected:
+      virtual ExitCode Entry();
+    };
+
+    //! Guards m_queue, m_workerRunning and m_done
+    static wxMutex m_queueMutex;
+    //! Is signalled each time the worker has finished a capture
+    static wxCondition m_captureDone;
+    //! The captures the worker hasn't started on, yet
+    static std::list<GnuplotCapture *> m_queue;
+    //! Is there a worker that works through m_queue?
+    static bool m_workerRunning;
+
+    //! Has Capture() finished?
+    bool m_done;
+    wxString m_gnuplotFilename;
+    wxString m_dataFilename;
+    wxMemoryBuffer m_source;
+    wxMemoryBuffer m_data;
+  };
+
 protected:
+  //! Wait for the background capture of the gnuplot files to finish, if there is one
+  void WaitForGnuplotCapture();
+  //! The background capture of the gnuplot files. Is shared by all copies of this image.
+  wxSharedPtr<GnuplotCapture> m_gnuplotCapture;
   //! A zipped version of the gnuplot commands that produced this image.
   wxMemoryBuffer m_gnuplotSource_Compressed;
   //! A zipped version of the gnuplot data needed in order to create this image.
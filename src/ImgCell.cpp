@@ -126,12 +126,6 @@ void ImgCell::MarkAsDeleted()
   Cell::MarkAsDeleted();
 }
 
-std::list<Cell *> ImgCell::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  return innerCells;
-}
-
 wxString ImgCell::GetToolTip(const wxPoint &point)
 {
   if(ContainsPoint(point))
@@ -144,7 +138,7 @@ wxString ImgCell::GetToolTip(const wxPoint &point)
                "One example of the latter would be: Gnuplot refuses to plot entirely "
                "empty images"));
     else
-      return m_toolTip;
+      return GetLocalToolTip();
   }
   else
     return wxEmptyString;
@@ -65,13 +65,18 @@ public:
       return m_image->GnuplotData();
   }
 
-  std::list<Cell *> GetInnerCells();
+  //! This cell doesn't contain other cells
+  int GetInnerCellCount(){return 0;}
+  Cell *GetInnerCell(int WXUNUSED(index)){return NULL;}
   void MarkAsDeleted();
 
   void LoadImage(wxString image, bool remove = true);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   friend class SlideShow;
 
   /*! Writes the image to a file
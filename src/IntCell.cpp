@@ -74,18 +74,12 @@ IntCell::~IntCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> IntCell::GetInnerCells()
+Cell *IntCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_base)
-    innerCells.push_back(m_base);
-  if(m_under)
-    innerCells.push_back(m_under);
-  if(m_over)
-    innerCells.push_back(m_over);
-  if(m_var)
-    innerCells.push_back(m_var);
-  return innerCells;
+  Cell *innerCells[] = {m_base, m_under, m_over, m_var};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void IntCell::SetOver(Cell *over)
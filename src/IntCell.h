@@ -43,10 +43,14 @@ public:
 
   ~IntCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 4;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void RecalculateHeight(int fontsize);
 
   void RecalculateWidths(int fontsize);
@@ -66,22 +66,12 @@ LimitCell::~LimitCell()
   m_base = m_under = m_name = m_open = m_comma = m_close = NULL;
 }
 
-std::list<Cell *> LimitCell::GetInnerCells()
+Cell *LimitCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_base)
-    innerCells.push_back(m_base);
-  if(m_under)
-    innerCells.push_back(m_under);
-  if(m_name)
-    innerCells.push_back(m_name);
-  if(m_open)
-    innerCells.push_back(m_open);
-  if(m_comma)
-    innerCells.push_back(m_comma);
-  if(m_close)
-    innerCells.push_back(m_close);
-  return innerCells;
+  Cell *innerCells[] = {m_base, m_under, m_name, m_open, m_comma, m_close};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void LimitCell::SetName(Cell *name)
@@ -39,10 +39,14 @@ public:
 
   ~LimitCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 6;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void RecalculateHeight(int fontsize);
 
   void RecalculateWidths(int fontsize);
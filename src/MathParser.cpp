@@ -31,6 +31,7 @@
 #include <wx/intl.h>
 
 #include "MathParser.h"
+#include "StringMatchers.h"
 
 #include "FracCell.h"
 #include "ExptCell.h"
@@ -79,7 +80,6 @@ wxXmlNode *MathParser::GetNextTag(wxXmlNode *node)
 
 MathParser::MathParser(Configuration **cfg, Cell::CellPointers *cellPointers, wxString zipfile)
 {
-  wxASSERT(m_graphRegex.Compile(wxT("[[:cntrl:]]")));
   m_configuration = cfg;
   m_cellPointers = cellPointers;
   m_ParserStyle = MC_TYPE_DEFAULT;
@@ -122,6 +122,7 @@ Cell *MathParser::ParseCellTag(wxXmlNode *node)
     wxString isAutoAnswer = node->GetAttribute(wxT("auto_answer"), wxT("no"));
     if(isAutoAnswer == wxT("yes"))
       group->AutoAnswer(true);
+    group->OutputKey(node->GetAttribute(wxT("output_key"), wxEmptyString));
     int i = 1; wxString answer;
     while (node->GetAttribute(wxString::Format(wxT("answer%i"),i),&answer))
     {
@@ -261,6 +262,9 @@ Cell *MathParser::ParseCellTag(wxXmlNode *node)
 
   group->SetGroup(group);
   group->Hide(hide);
+  if (group->IsFoldable() &&
+      (node->GetAttribute(wxT("independent"), wxT("no")) == wxT("yes")))
+    group->Independent(true);
   return group;
 }
 
@@ -1025,6 +1029,169 @@ Cell *MathParser::ParseTag(wxXmlNode *node, bool all)
   return retval;
 }
 
+const wxChar *MathParser::m_compactTags[] = {
+  wxT("r"), wxT("v"), wxT("n"), wxT("p"), wxT("f"), wxT("e"), wxT("t"), wxT("i"),
+  wxT("fn"), wxT("fnm"), wxT("g"), wxT("s"), wxT("q"), wxT("h"), wxT("mtr"), wxT("mtd")
+};
+const int MathParser::m_compactTagCount =
+  sizeof(MathParser::m_compactTags) / sizeof(MathParser::m_compactTags[0]);
+
+wxString MathParser::DecodeCompactXmlText(const wxString &data, size_t start, size_t end)
+{
+  wxString text;
+  text.reserve(end - start);
+  size_t pos = start;
+  while (pos < end)
+  {
+    wxChar ch = data[pos];
+    if (ch != wxT('&'))
+    {
+      // The same characters ParseLine() replaces before handing XML to the parser
+      if ((ch < wxT(' ')) && (ch != wxT('\t')) && (ch != wxT('\n')) && (ch != wxT('\r')))
+        ch = wxT('\xFFFD');
+      text += ch;
+      pos++;
+      continue;
+    }
+
+    size_t semicolon = data.find(wxT(';'), pos);
+    if ((semicolon == wxString::npos) || (semicolon >= end))
+    {
+      text += ch;
+      pos++;
+      continue;
+    }
+    wxString entity = data.SubString(pos + 1, semicolon - 1);
+    if (entity == wxT("amp"))
+      text += wxT('&');
+    else if (entity == wxT("lt"))
+      text += wxT('<');
+    else if (entity == wxT("gt"))
+      text += wxT('>');
+    else if (entity == wxT("quot"))
+      text += wxT('"');
+    else if (entity == wxT("apos"))
+      text += wxT('\'');
+    else if (entity.StartsWith(wxT("#")))
+    {
+      unsigned long code;
+      bool ok;
+      if (entity.StartsWith(wxT("#x")))
+        ok = entity.Mid(2).ToULong(&code, 16);
+      else
+        ok = entity.Mid(1).ToULong(&code, 10);
+      if (ok)
+        text += wxUniChar(code);
+      else
+        text += wxT("&") + entity + wxT(";");
+    }
+    else
+      text += wxT("&") + entity + wxT(";");
+    pos = semicolon + 1;
+  }
+  return text;
+}
+
+wxXmlNode *MathParser::DecodeCompactXml(const wxString &data)
+{
+  // The message consists of exactly one tag, normally <mth>.
+  wxXmlNode *retval = NULL;
+  // The node we append children to and its last child: wxXmlNode::AddChild()
+  // would have to walk the list of children for every new node.
+  wxXmlNode *parent = NULL;
+  wxXmlNode *lastChild = NULL;
+
+  size_t len = data.Length();
+  size_t pos = 0;
+  while (pos < len)
+  {
+    wxChar ch = data[pos];
+    if (ch == wxT('\x07'))
+    {
+      // A closing tag
+      if (parent == NULL)
+        break;
+      lastChild = parent;
+      parent = parent->GetParent();
+      pos++;
+      if (parent == NULL)
+        break;
+      continue;
+    }
+
+    wxXmlNode *node = NULL;
+    if ((ch >= m_compactTagBase) && (ch < m_compactTagBase + m_compactTagCount))
+    {
+      node = new wxXmlNode(wxXML_ELEMENT_NODE, m_compactTags[ch - m_compactTagBase]);
+      pos++;
+    }
+    else if (ch == wxT('\x05'))
+    {
+      // A tag that is sent with its name and its attributes
+      size_t end = data.find(wxT('\x06'), pos);
+      if (end == wxString::npos)
+        break;
+      size_t nameEnd = pos + 1;
+      while ((nameEnd < end) && (data[nameEnd] != wxT(' ')))
+        nameEnd++;
+      node = new wxXmlNode(wxXML_ELEMENT_NODE, data.SubString(pos + 1, nameEnd - 1));
+
+      size_t attrPos = nameEnd;
+      while (attrPos < end)
+      {
+        if (data[attrPos] == wxT(' '))
+        {
+          attrPos++;
+          continue;
+        }
+        size_t equals = data.find(wxT('='), attrPos);
+        if ((equals == wxString::npos) || (equals + 1 >= end))
+          break;
+        wxChar quote = data[equals + 1];
+        size_t valueEnd = data.find(quote, equals + 2);
+        if ((valueEnd == wxString::npos) || (valueEnd >= end))
+          break;
+        node->AddAttribute(data.SubString(attrPos, equals - 1),
+                           DecodeCompactXmlText(data, equals + 2, valueEnd));
+        attrPos = valueEnd + 1;
+      }
+      pos = end + 1;
+    }
+    else
+    {
+      // Text
+      size_t end = pos;
+      while ((end < len) && (data[end] != wxT('\x05')) && (data[end] != wxT('\x07')) &&
+             ((data[end] < m_compactTagBase) || (data[end] >= m_compactTagBase + m_compactTagCount)))
+        end++;
+      node = new wxXmlNode(wxXML_TEXT_NODE, wxEmptyString, DecodeCompactXmlText(data, pos, end));
+      pos = end;
+    }
+
+    if (parent == NULL)
+    {
+      // Whitespace around the outermost tag
+      if ((retval != NULL) || (node->GetType() != wxXML_ELEMENT_NODE))
+      {
+        delete node;
+        continue;
+      }
+      retval = node;
+    }
+    else
+      parent->InsertChildAfter(node, lastChild);
+
+    if (node->GetType() == wxXML_ELEMENT_NODE)
+    {
+      parent = node;
+      lastChild = NULL;
+    }
+    else
+      lastChild = node;
+  }
+  return retval;
+}
+
 /***
  * Parse the string s, which is (correct) xml fragment.
  * Put the result in line.
@@ -1056,10 +1223,34 @@ Cell *MathParser::ParseLine(wxString s, CellType style)
       showLength = 50000;    
   }
 
-  m_graphRegex.Replace(&s, wxT("\xFFFD"));
+  // Math in the compact encoding is about a third as long as the same math
+  // as XML.
+  int compactStart = s.Find(wxT("<mthc>"));
+  int compactEnd = s.Find(wxT("</mthc>"));
+  bool compact = (compactStart != wxNOT_FOUND) && (compactEnd > compactStart);
+  long length = s.Length();
+  if (compact)
+    length *= 3;
 
-  if (((long) s.Length() < showLength) || (showLength == 0))
+  if ((length < showLength) || (showLength == 0))
   {
+    if (compact)
+    {
+      wxXmlNode *doc = DecodeCompactXml(s.SubString(compactStart + 6, compactEnd - 1));
+      if (doc != NULL)
+      {
+        // ConsoleAppend() encloses math in a <span>: Then the <mth> tag itself
+        // is part of the output.
+        if (compactStart > 0)
+          cell = ParseTag(doc);
+        else
+          cell = ParseTag(doc->GetChildren());
+        delete doc;
+      }
+      return cell;
+    }
+
+    StringMatchers::ReplaceControlChars(s);
 
     wxXmlDocument xml;
 
@@ -53,7 +53,32 @@ public:
 
   Cell *ParseTag(wxXmlNode *node, bool all = true);
 
+  /*! Converts math maxima has sent in the compact encoding into a xml tree
+
+    The compact encoding is described in wxMathML.lisp: The tags from
+    m_compactTags are sent as a single control character, all other opening
+    tags as ENQ, the contents of the tag and ACK, and all closing tags as BEL.
+    The text between the tags still contains XML entities.
+
+    Building the xml tree directly saves us the text-to-XML-parser round-trip
+    and allows ParseTag() to handle both encodings.
+    \param data The message without the enclosing <mthc> and </mthc>
+    \return The root node of the xml tree or NULL, if data contained no tag.
+    The caller has to delete it.
+   */
+  static wxXmlNode *DecodeCompactXml(const wxString &data);
+
 private:
+  //! The tag names the compact encoding transmits as single characters
+  static const wxChar *m_compactTags[];
+  //! The number of entries in m_compactTags
+  static const int m_compactTagCount;
+  //! The character that encodes the first entry of m_compactTags
+  static const wxChar m_compactTagBase = wxT('\x10');
+
+  //! Replaces the XML entities in a text from the compact encoding
+  static wxString DecodeCompactXmlText(const wxString &data, size_t start, size_t end);
+
   void ParseCommonAttrs(wxXmlNode *node, Cell *cell);
 
   Cell *HandleNullPointer(Cell *cell);
@@ -128,7 +153,6 @@ private:
   Cell *ParseSubSupTag(wxXmlNode *node);
 
   wxString m_userDefinedLabel;
-  wxRegEx m_graphRegex;
 
   CellType m_ParserStyle;
   int m_FracStyle;
@@ -68,13 +68,11 @@ MatrCell::~MatrCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> MatrCell::GetInnerCells()
+Cell *MatrCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  for (unsigned int i = 0; i < m_cells.size(); i++)
-    if(m_cells[i])
-      innerCells.push_back(m_cells[i]);
-  return innerCells;
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return m_cells[index];
 }
 
 
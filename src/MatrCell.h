@@ -36,10 +36,14 @@ public:
 
   ~MatrCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return (int) m_cells.size();}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void RecalculateHeight(int fontsize);
 
   void RecalculateWidths(int fontsize);
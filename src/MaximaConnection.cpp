@@ -0,0 +1,302 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaConnection
+
+  MaximaConnection starts a maxima process in the background and talks to it
+  over a socket.
+ */
+
+#include "MaximaConnection.h"
+#include "ErrorRedirector.h"
+
+const wxString MaximaConnection::m_readyMarker(wxT("<wxmaxima-ready/>"));
+
+MaximaConnection::MaximaConnection(wxEvtHandler *processOwner, int processId)
+{
+  if (processOwner == NULL)
+  {
+    m_processOwner = this;
+    m_processId = connection_process_id;
+  }
+  else
+  {
+    m_processOwner = processOwner;
+    m_processId = processId;
+  }
+  m_server = NULL;
+  m_client = NULL;
+  m_clientStream = NULL;
+  m_clientTextStream = NULL;
+  m_process = NULL;
+  m_pipeTimer.SetOwner(this, connection_pipe_timer_id);
+  m_pid = -1;
+  m_port = -1;
+  m_isConnected = false;
+  m_ready = false;
+}
+
+MaximaConnection::~MaximaConnection()
+{
+  Kill();
+}
+
+bool MaximaConnection::Start(wxString command, int port, wxArrayString setup)
+{
+  Kill();
+  m_command = command;
+  m_setup = setup;
+
+  // Find a port no other program uses
+  for (int i = 0; (i < 1000) && (m_server == NULL) && (port <= 65535); i++, port++)
+  {
+    wxIPV4address addr;
+#ifndef __WXOSX__
+    addr.LocalHost();
+#else
+    addr.AnyAddress();
+#endif
+    addr.Service(port);
+    m_server = new wxSocketServer(addr);
+    if (!m_server->Ok())
+    {
+      m_server->Destroy();
+      m_server = NULL;
+    }
+  }
+  if (m_server == NULL)
+  {
+    wxLogMessage(_("Cannot start the server for an additional maxima process"));
+    return false;
+  }
+  m_port = port - 1;
+  m_server->SetEventHandler(*this, connection_server_id);
+  m_server->SetNotify(wxSOCKET_CONNECTION_FLAG);
+  m_server->Notify(true);
+
+  command.Append(wxString::Format(wxT(" -s %d "), m_port));
+  m_process = new wxProcess(m_processOwner, m_processId);
+  m_process->Redirect();
+  wxLogMessage(wxString::Format(_("Running an additional maxima as: %s"), command));
+  m_pid = wxExecute(command, wxEXEC_ASYNC, m_process);
+  if (m_pid <= 0)
+  {
+    wxDELETE(m_process);
+    m_pid = -1;
+    m_server->Destroy();
+    m_server = NULL;
+    return false;
+  }
+  m_pipeTimer.Start(m_pipeDrainInterval);
+  return true;
+}
+
+void MaximaConnection::Kill()
+{
+  m_ready = false;
+  m_isConnected = false;
+  m_banner = wxEmptyString;
+  m_data = wxEmptyString;
+  m_sendBuffer.Clear();
+  m_pipeTimer.Stop();
+
+  wxDELETE(m_clientTextStream);
+  wxDELETE(m_clientStream);
+  if (m_client)
+  {
+    m_client->SetFlags(wxSOCKET_WAITALL);
+    Send(wxT("quit();"));
+    m_client->Destroy();
+    m_client = NULL;
+  }
+  if (m_server)
+  {
+    m_server->Destroy();
+    m_server = NULL;
+  }
+
+  // We don't want to be informed about the end of a process we have ended
+  // on purpose.
+  if (m_process)
+    m_process->Detach();
+  m_process = NULL;
+  if (m_pid > 0)
+  {
+    SuppressErrorDialogs logNull;
+    wxProcess::Kill(m_pid, wxSIGKILL, wxKILL_CHILDREN);
+  }
+  m_pid = -1;
+}
+
+void MaximaConnection::ProcessEnded()
+{
+  // The process has ended => there is nothing left to detach or to kill.
+  m_process = NULL;
+  m_pid = -1;
+  Kill();
+}
+
+void MaximaConnection::Release(wxProcess *&process, wxSocketBase *&client)
+{
+  process = m_process;
+  client = m_client;
+
+  // Until the new owner has set itself as the socket's event handler nobody
+  // must be informed about new data.
+  if (m_client != NULL)
+    m_client->Notify(false);
+  // The streams only read from the socket => deleting them doesn't affect it.
+  wxDELETE(m_clientTextStream);
+  wxDELETE(m_clientStream);
+  m_client = NULL;
+  m_process = NULL;
+  m_pid = -1;
+  Kill();
+}
+
+void MaximaConnection::ServerEvent(wxSocketEvent &event)
+{
+  if (event.GetSocketEvent() != wxSOCKET_CONNECTION)
+    return;
+
+  // Only one maxima may talk to us.
+  if (m_isConnected)
+  {
+    wxSocketBase *tmp = m_server->Accept(false);
+    if (tmp != NULL)
+      tmp->Destroy();
+    return;
+  }
+
+  m_client = m_server->Accept(false);
+  if (m_client == NULL)
+    return;
+  m_isConnected = true;
+  m_clientStream = new wxSocketInputStream(*m_client);
+  m_clientTextStream = new wxTextInputStream(*m_clientStream, wxT('\t'), wxConvUTF8);
+  m_client->SetEventHandler(*this, connection_client_id);
+  m_client->SetNotify(wxSOCKET_INPUT_FLAG | wxSOCKET_OUTPUT_FLAG);
+  m_client->Notify(true);
+  m_client->SetFlags(wxSOCKET_NOWAIT);
+  m_client->SetTimeout(15);
+
+  // Nobody else will connect to us => the server isn't needed any more.
+  m_server->Destroy();
+  m_server = NULL;
+
+  // Maxima reads the setup commands only after it has output its banner and
+  // its first prompt. As they don't cause maxima to output a prompt we let
+  // maxima tell us when it has processed them.
+  for (size_t i = 0; i < m_setup.GetCount(); i++)
+    Send(m_setup[i]);
+  Send(wxT(":lisp-quiet (format t \"") + m_readyMarker + wxT("~%\")"));
+}
+
+void MaximaConnection::ClientEvent(wxSocketEvent &event)
+{
+  if (event.GetSocketEvent() == wxSOCKET_OUTPUT)
+  {
+    if (!m_sendBuffer.Flush(m_client))
+      wxLogMessage(_("Error writing to an additional maxima process"));
+    return;
+  }
+  if (event.GetSocketEvent() != wxSOCKET_INPUT)
+    return;
+  if ((m_client == NULL) || (!m_client->IsData()))
+    return;
+
+  DrainPipes();
+
+  while ((m_client->IsData()) && (!m_clientStream->Eof()))
+  {
+    wxChar chr = m_clientTextStream->GetChar();
+    if (chr == wxEOT)
+      break;
+    if (chr != wxT('\0'))
+      m_data += chr;
+  }
+
+  if (!m_ready)
+  {
+    // Everything maxima outputs before it has processed the setup commands
+    // is its banner and the first prompt.
+    int marker = m_data.Find(m_readyMarker);
+    if (marker == wxNOT_FOUND)
+      return;
+    m_banner = m_data.Left(marker);
+    // The marker is followed by a newline nobody expects.
+    m_data = m_data.Mid(marker + m_readyMarker.Length());
+    m_data.Trim(false);
+    m_ready = true;
+    OnReady();
+    // OnReady() might have killed maxima.
+    if (!m_ready)
+      return;
+  }
+  OnData();
+}
+
+void MaximaConnection::Send(wxString command)
+{
+  if (m_client == NULL)
+    return;
+
+  if (command.StartsWith(wxT(":lisp ")) || command.StartsWith(wxT(":lisp\n")))
+    command.Replace(wxT("\n"), wxT(" "));
+  command.Trim(true);
+  command.Append(wxT("\n"));
+
+  wxScopedCharBuffer const data = command.utf8_str();
+  if (!m_sendBuffer.Write(m_client, data.data(), data.length()))
+    wxLogMessage(_("Error writing to an additional maxima process"));
+}
+
+void MaximaConnection::OnProcessEvent(wxProcessEvent &WXUNUSED(event))
+{
+  ProcessEnded();
+}
+
+void MaximaConnection::OnPipeTimer(wxTimerEvent &WXUNUSED(event))
+{
+  DrainPipes();
+}
+
+void MaximaConnection::DrainPipes()
+{
+  if (m_process == NULL)
+    return;
+
+  char buf[4096];
+  wxInputStream *stdOut = m_process->GetInputStream();
+  while ((stdOut != NULL) && stdOut->CanRead())
+    stdOut->Read(buf, sizeof(buf));
+  wxInputStream *stdErr = m_process->GetErrorStream();
+  while ((stdErr != NULL) && stdErr->CanRead())
+    stdErr->Read(buf, sizeof(buf));
+}
+
+BEGIN_EVENT_TABLE(MaximaConnection, wxEvtHandler)
+  EVT_SOCKET(MaximaConnection::connection_server_id, MaximaConnection::ServerEvent)
+  EVT_SOCKET(MaximaConnection::connection_client_id, MaximaConnection::ClientEvent)
+  EVT_END_PROCESS(MaximaConnection::connection_process_id, MaximaConnection::OnProcessEvent)
+  EVT_TIMER(MaximaConnection::connection_pipe_timer_id, MaximaConnection::OnPipeTimer)
+END_EVENT_TABLE()
@@ -0,0 +1,184 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaConnection
+
+  MaximaConnection starts a maxima process in the background and talks to it
+  over a socket.
+ */
+
+#ifndef MAXIMACONNECTION_H
+#define MAXIMACONNECTION_H
+
+#include <wx/wx.h>
+#include <wx/process.h>
+#include <wx/socket.h>
+#include <wx/txtstrm.h>
+#include <wx/timer.h>
+#include "SocketWriter.h"
+
+/*! A maxima process wxMaxima talks to in the background
+
+  This is what MaximaWorker and MaximaStandby have in common: The connection
+  is established in the same way wxMaxima connects to the main maxima process:
+  A socket server is opened and maxima is told which port to connect to. As
+  soon as maxima has connected it is sent the setup commands. As these don't
+  cause maxima to output a prompt maxima is asked to output a marker after it
+  has processed them.
+
+  Everything is sent without waiting for maxima to read it: What doesn't fit
+  into the socket's buffer is kept and sent on the next wxSOCKET_OUTPUT event.
+ */
+class MaximaConnection : public wxEvtHandler
+{
+public:
+  /*! The constructor
+
+    \param processOwner The event handler that gets informed about the end of
+    maxima. NULL means: This object itself, which then calls ProcessEnded().
+    \param processId The id of the wxEVT_END_PROCESS event sent to processOwner
+   */
+  explicit MaximaConnection(wxEvtHandler *processOwner = NULL, int processId = wxID_ANY);
+
+  virtual ~MaximaConnection();
+
+  /*! Starts the maxima process
+
+    \param command The command line that starts maxima, without the port
+    \param port The first port to try to open the socket server on
+    \param setup The commands that prepare maxima for talking to wxMaxima
+    \return false, if the socket server or maxima could not be started.
+   */
+  bool Start(wxString command, int port, wxArrayString setup);
+
+  //! Starts maxima again, with the same command line and setup commands
+  bool Restart()
+  { return Start(m_command, m_port, m_setup); }
+
+  //! Stops the maxima process
+  void Kill();
+
+  //! Has maxima connected to us and processed the setup commands?
+  bool IsReady()
+  { return m_isConnected && m_ready; }
+
+  //! The command line maxima has been started with, without the port
+  wxString GetCommand()
+  { return m_command; }
+
+  //! The commands maxima has been prepared with
+  wxArrayString GetSetup()
+  { return m_setup; }
+
+  //! The pid wxExecute() has returned for the maxima process
+  long GetProcessPid()
+  { return m_pid; }
+
+  /*! The maxima process has ended
+
+    Called by the event handler that has been informed about the end of the
+    process.
+   */
+  virtual void ProcessEnded();
+
+  //! Sends a string to maxima
+  void Send(wxString command);
+
+protected:
+  //! Maxima has processed the setup commands
+  virtual void OnReady()
+  {}
+
+  //! Maxima has sent us something that has been appended to m_data
+  virtual void OnData()
+  {}
+
+  /*! Hands the maxima process and the connection to it over to the caller
+
+    Afterwards the caller is responsible for the process and the socket.
+   */
+  void Release(wxProcess *&process, wxSocketBase *&client);
+
+  //! Everything maxima has output before it has processed the setup commands
+  wxString m_banner;
+  //! Everything maxima has output since then that hasn't been interpreted yet
+  wxString m_data;
+
+private:
+  //! Maxima has connected to our socket server
+  void ServerEvent(wxSocketEvent &event);
+
+  //! Maxima has sent us something or is ready for more data
+  void ClientEvent(wxSocketEvent &event);
+
+  //! The maxima process has terminated
+  void OnProcessEvent(wxProcessEvent &event);
+
+  //! Time to empty maxima's stdout and stderr
+  void OnPipeTimer(wxTimerEvent &event);
+
+  /*! Reads and discards everything maxima has written to stdout and stderr
+
+    Nobody is interested in it. But if we don't read it the pipes might fill
+    up and stop maxima, even if maxima doesn't write to the socket.
+   */
+  void DrainPipes();
+
+  enum
+  {
+    connection_server_id = wxID_HIGHEST + 1,
+    connection_client_id,
+    connection_process_id,
+    connection_pipe_timer_id
+  };
+
+  //! How often we empty maxima's stdout and stderr [milliseconds]
+  static const int m_pipeDrainInterval = 250;
+
+  //! The marker maxima sends after it has processed our setup commands
+  static const wxString m_readyMarker;
+
+  wxEvtHandler *m_processOwner;
+  int m_processId;
+  wxSocketServer *m_server;
+  wxSocketBase *m_client;
+  wxSocketInputStream *m_clientStream;
+  wxTextInputStream *m_clientTextStream;
+  wxProcess *m_process;
+  //! Periodically calls DrainPipes()
+  wxTimer m_pipeTimer;
+  long m_pid;
+  //! The command line maxima has been started with, without the port
+  wxString m_command;
+  //! The port our socket server listens on
+  int m_port;
+  wxArrayString m_setup;
+  bool m_isConnected;
+  //! Has maxima processed the setup commands?
+  bool m_ready;
+  //! The data maxima hasn't accepted yet
+  SocketWriter m_sendBuffer;
+
+  DECLARE_EVENT_TABLE()
+};
+
+#endif // MAXIMACONNECTION_H
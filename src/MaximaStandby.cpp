@@ -0,0 +1,58 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaStandby
+
+  MaximaStandby keeps a maxima process running in the background that can take
+  over as soon as maxima is restarted.
+ */
+
+#include "MaximaStandby.h"
+
+MaximaStandby::MaximaStandby(wxEvtHandler *owner, int processId) :
+  MaximaConnection(owner, processId)
+{
+}
+
+bool MaximaStandby::Start(wxString command, int port, wxArrayString setup)
+{
+  m_initialFolder = wxEmptyString;
+  wxGetEnv(wxT("MAXIMA_INITIAL_FOLDER"), &m_initialFolder);
+  return MaximaConnection::Start(command, port, setup);
+}
+
+void MaximaStandby::ProcessEnded()
+{
+  wxLogMessage(_("The standby maxima has terminated."));
+  MaximaConnection::ProcessEnded();
+}
+
+void MaximaStandby::OnReady()
+{
+  wxLogMessage(_("The standby maxima is ready."));
+}
+
+void MaximaStandby::HandOver(wxProcess *&process, wxSocketBase *&client, wxString &data)
+{
+  data = m_banner + m_data;
+  Release(process, client);
+}
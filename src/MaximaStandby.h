@@ -0,0 +1,96 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaStandby
+
+  MaximaStandby keeps a maxima process running in the background that can take
+  over as soon as maxima is restarted.
+ */
+
+#ifndef MAXIMASTANDBY_H
+#define MAXIMASTANDBY_H
+
+#include <wx/wx.h>
+#include "MaximaConnection.h"
+
+/*! A maxima process that waits in the background until it is needed
+
+  Starting maxima and sending it the definitions wxMaxima needs takes several
+  seconds. The standby does both in advance so that on restarting maxima
+  wxMaxima only needs to take over the process and the connection to it.
+
+  The connection to the standby maxima is handled by MaximaConnection. The
+  standby keeps everything maxima outputs until it is taken over: The banner
+  contains maxima's pid that wxMaxima needs for interrupting maxima. The
+  maxima process is created with the owner as the event handler that is
+  informed about its end => after the takeover the owner gets informed about
+  the end of the process even if the standby no more exists. Before the
+  takeover the owner has to ask the standby if the process that has ended is
+  the standby's one, using GetProcessPid().
+ */
+class MaximaStandby : public MaximaConnection
+{
+public:
+  /*! The constructor
+
+    \param owner The event handler that gets informed about the end of maxima
+    \param processId The id of the wxEVT_END_PROCESS event sent to owner
+   */
+  MaximaStandby(wxEvtHandler *owner, int processId);
+
+  /*! Starts the maxima process
+
+    \param command The command line that starts maxima, without the port
+    \param port The first port to try to open the socket server on
+    \param setup The commands that prepare maxima for talking to wxMaxima
+    \return false, if the socket server or maxima could not be started.
+   */
+  bool Start(wxString command, int port, wxArrayString setup);
+
+  //! The folder maxima has been told to start in
+  wxString GetInitialFolder()
+  { return m_initialFolder; }
+
+  //! The maxima process has ended before it has been taken over
+  void ProcessEnded();
+
+  /*! Hands the maxima process and the connection to it over to the caller
+
+    Afterwards the caller is responsible for the process and the socket and the
+    standby can be deleted without affecting them.
+
+    \param process The maxima process
+    \param client The socket maxima is connected to
+    \param data Everything maxima has output until now: Its banner and its
+    first prompt
+   */
+  void HandOver(wxProcess *&process, wxSocketBase *&client, wxString &data);
+
+protected:
+  //! Maxima has processed the setup commands
+  void OnReady();
+
+private:
+  wxString m_initialFolder;
+};
+
+#endif // MAXIMASTANDBY_H
@@ -0,0 +1,183 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaWorker
+
+  MaximaWorker drives an additional maxima process that evaluates a section of
+  the worksheet independently of the main maxima process.
+ */
+
+#include "MaximaWorker.h"
+#include "EvaluationQueue.h"
+
+MaximaWorker::MaximaWorker(wxEvtHandler *owner, int eventId,
+                           wxString promptPrefix, wxString promptSuffix)
+{
+  m_owner = owner;
+  m_eventId = eventId;
+  m_promptPrefix = promptPrefix;
+  m_promptSuffix = promptSuffix;
+  m_group = NULL;
+}
+
+MaximaWorker::~MaximaWorker()
+{
+  // Whoever deletes us knows that we won't evaluate anything any more.
+  m_groups.clear();
+  m_groupCommands.clear();
+  m_group = NULL;
+}
+
+void MaximaWorker::OnReady()
+{
+  m_lastPrompt = wxT("(%i1) ");
+  Notify(worker_idle);
+}
+
+void MaximaWorker::OnData()
+{
+  int start;
+  while ((start = m_data.Find(m_promptPrefix)) != wxNOT_FOUND)
+  {
+    int end = m_data.find(m_promptSuffix, start);
+    if (end == wxNOT_FOUND)
+      return;
+
+    m_output = m_data.Left(start);
+    wxString prompt = m_data.SubString(start + m_promptPrefix.Length(), end - 1);
+    m_data = m_data.Mid(end + m_promptSuffix.Length());
+    prompt.Trim(true);
+    prompt.Trim(false);
+
+    if (m_group == NULL)
+    {
+      // A prompt we didn't ask for.
+      m_lastPrompt = prompt;
+      continue;
+    }
+
+    // Input prompts look like "(%i5)". Everything else is a question we
+    // cannot answer from here.
+    if (!(prompt.StartsWith(wxT("(%")) && prompt.EndsWith(wxT(")"))))
+    {
+      m_output += prompt + wxT("\n") +
+        _("Maxima has asked a question: Sections that ask questions cannot be evaluated in parallel.");
+      m_inputPrompt = m_lastPrompt;
+      Notify(worker_failed);
+      m_group = NULL;
+      DropGroups();
+      Restart();
+      return;
+    }
+
+    m_inputPrompt = m_lastPrompt;
+    m_lastPrompt = prompt + wxT(" ");
+    Notify(worker_command_done);
+    if (m_commands.IsEmpty())
+    {
+      Notify(worker_group_done);
+      m_group = NULL;
+    }
+    NextCommand();
+  }
+}
+
+void MaximaWorker::Evaluate(const std::list<GroupCell *> &groups)
+{
+  // The cells might be deleted while we evaluate them => we split them into
+  // commands now and use the pointers only for telling our owner which cell
+  // the output belongs to.
+  for (std::list<GroupCell *>::const_iterator it = groups.begin(); it != groups.end(); ++it)
+  {
+    if ((*it)->AddEnding())
+      (*it)->ResetSize();
+    m_groups.push_back(*it);
+    m_groupCommands.push_back(EvaluationQueue::GetCommands(*it));
+  }
+  NextCommand();
+}
+
+void MaximaWorker::NextCommand()
+{
+  while (m_commands.IsEmpty())
+  {
+    if (m_groups.empty())
+    {
+      if (m_group == NULL)
+        Notify(worker_idle);
+      return;
+    }
+    m_group = m_groups.front();
+    m_groups.pop_front();
+    m_commands = m_groupCommands.front();
+    m_groupCommands.pop_front();
+    if (m_commands.IsEmpty())
+    {
+      Notify(worker_group_done);
+      m_group = NULL;
+    }
+  }
+
+  wxString command = m_commands[0];
+  m_commands.RemoveAt(0);
+  Send(command);
+}
+
+void MaximaWorker::DropGroups()
+{
+  if (m_group != NULL)
+    Notify(worker_group_dropped);
+  while (!m_groups.empty())
+  {
+    m_group = m_groups.front();
+    m_groups.pop_front();
+    Notify(worker_group_dropped);
+  }
+  m_groups.clear();
+  m_groupCommands.clear();
+  m_commands.Clear();
+  m_group = NULL;
+}
+
+void MaximaWorker::Notify(workerEvent what)
+{
+  wxCommandEvent event(wxEVT_MENU, m_eventId);
+  event.SetInt(what);
+  event.SetEventObject(this);
+  // The owner has to read the output before we continue => process the event
+  // immediately instead of queueing it.
+  m_owner->ProcessEvent(event);
+}
+
+void MaximaWorker::ProcessEnded()
+{
+  wxLogMessage(_("An additional maxima process has terminated."));
+  if (m_group != NULL)
+  {
+    m_output = _("Maxima has terminated while evaluating this cell.");
+    m_inputPrompt = m_lastPrompt;
+    Notify(worker_failed);
+    m_group = NULL;
+  }
+  DropGroups();
+  MaximaConnection::ProcessEnded();
+}
@@ -0,0 +1,151 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaWorker
+
+  MaximaWorker drives an additional maxima process that evaluates a section of
+  the worksheet independently of the main maxima process.
+ */
+
+#ifndef MAXIMAWORKER_H
+#define MAXIMAWORKER_H
+
+#include <list>
+#include <wx/wx.h>
+#include "MaximaConnection.h"
+#include "GroupCell.h"
+
+/*! An additional maxima process for evaluating independent sections
+
+  Sections the user has marked as independent of the rest of the worksheet
+  don't need to be evaluated by the maxima process that evaluates everything
+  else. wxMaxima instead can hand each of them to one of a pool of workers,
+  each of which runs its own maxima process. This way several sections can be
+  evaluated on several cores at the same time.
+
+  The connection to the worker's maxima is handled by MaximaConnection. After
+  each command maxima has finished the worker sends its owner a wxEVT_MENU
+  event with the id it has been constructed with. The event's int tells which
+  of the events listed in workerEvent has happened. The owner then can read
+  the output and the prompt using GetOutput() and GetPrompt().
+ */
+class MaximaWorker : public MaximaConnection
+{
+public:
+  //! The things a worker informs its owner about
+  enum workerEvent
+  {
+    //! Maxima has finished a command. The output belongs to GetGroup().
+    worker_command_done,
+    //! Maxima has finished the last command of GetGroup().
+    worker_group_done,
+    //! The worker has finished its section and waits for the next one.
+    worker_idle,
+    //! Maxima asked a question or terminated. The rest of the section is dropped.
+    worker_failed,
+    //! The worker won't evaluate GetGroup() as it has failed on a cell before it.
+    worker_group_dropped
+  };
+
+  /*! The constructor
+
+    \param owner The event handler that gets informed about the worker's progress
+    \param eventId The id of the wxEVT_MENU events sent to owner
+    \param promptPrefix The string maxima is told to precede its prompts with
+    \param promptSuffix The string maxima is told to follow its prompts with
+   */
+  MaximaWorker(wxEvtHandler *owner, int eventId,
+               wxString promptPrefix, wxString promptSuffix);
+
+  ~MaximaWorker();
+
+  //! Is this worker ready to evaluate a new section?
+  bool IsIdle()
+  { return IsReady() && (m_group == NULL) && m_groups.empty(); }
+
+  /*! Evaluates the code cells of a section, one after another
+
+    The cells are split into commands right away. Later the worker uses the
+    pointers only for telling its owner which cell an output belongs to: The
+    owner has to check if this cell still exists.
+   */
+  void Evaluate(const std::list<GroupCell *> &groups);
+
+  /*! Forgets all cells this worker still had to evaluate
+
+    The owner gets a worker_group_dropped event for each of them so it knows
+    that it won't get any output for them.
+   */
+  void DropGroups();
+
+  //! The cell the output from GetOutput() belongs to
+  GroupCell *GetGroup()
+  { return m_group; }
+
+  //! The output of the command maxima has finished last
+  wxString GetOutput()
+  { return m_output; }
+
+  //! The input prompt maxima has displayed before the command it has finished last
+  wxString GetPrompt()
+  { return m_inputPrompt; }
+
+  //! The maxima process has terminated
+  void ProcessEnded();
+
+protected:
+  //! Maxima has processed the setup commands
+  void OnReady();
+
+  //! Extracts all complete prompts from m_data
+  void OnData();
+
+private:
+  //! Sends maxima the next command
+  void NextCommand();
+
+  //! Informs the owner of this worker about an event
+  void Notify(workerEvent what);
+
+  wxEvtHandler *m_owner;
+  int m_eventId;
+  wxString m_promptPrefix;
+  wxString m_promptSuffix;
+
+  //! The output of the command maxima has finished last
+  wxString m_output;
+  //! The last input prompt maxima has displayed
+  wxString m_lastPrompt;
+  //! The input prompt for the command maxima has finished last
+  wxString m_inputPrompt;
+
+  //! The cells of the section that haven't been evaluated yet
+  std::list<GroupCell *> m_groups;
+  //! The commands of each of the cells in m_groups
+  std::list<wxArrayString> m_groupCommands;
+  //! The cell maxima is working on
+  GroupCell *m_group;
+  //! The commands of m_group that haven't been sent yet
+  wxArrayString m_commands;
+};
+
+#endif // MAXIMAWORKER_H
@@ -53,10 +53,14 @@ public:
 
   ~ParenCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 3;}
+  Cell *GetInnerCell(int index);
 
   virtual Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetInner(Cell *inner, CellType  style);
 
   void SetPrint(bool print)
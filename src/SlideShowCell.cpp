@@ -182,12 +182,6 @@ void SlideShow::MarkAsDeleted()
   Cell::MarkAsDeleted();
 }
 
-std::list<Cell *> SlideShow::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  return innerCells;
-}
-
 void SlideShow::SetDisplayedIndex(int ind)
 {
   if (ind >= 0 && ind < m_size)
@@ -409,7 +403,7 @@ wxString SlideShow::GetToolTip(const wxPoint &point)
                "One example of the latter would be: Gnuplot refuses to plot entirely "
                "empty images"));
     else
-      return m_toolTip;
+      return GetLocalToolTip();
   }
   else
     return wxEmptyString;
@@ -82,7 +82,9 @@ public:
   
   virtual wxString GetToolTip(const wxPoint &point);
 
-  std::list<Cell *> GetInnerCells();
+  //! This cell doesn't contain other cells
+  int GetInnerCellCount(){return 0;}
+  Cell *GetInnerCell(int WXUNUSED(index)){return NULL;}
   void MarkAsDeleted();
 
   /*! Remove all cached scaled images from memory
@@ -96,6 +98,9 @@ public:
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   int GetDisplayedIndex()
   { return m_displayed; }
 
@@ -0,0 +1,79 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+  This file defines the contents of the class SocketWriter
+
+  SocketWriter sends data over a socket without waiting for the other side to
+  read it.
+ */
+
+#include "SocketWriter.h"
+
+SocketWriter::SocketWriter()
+{
+  m_start = 0;
+  m_lastWriteCount = 0;
+}
+
+bool SocketWriter::Write(wxSocketBase *socket, const void *data, size_t length)
+{
+  m_buffer.AppendData(data, length);
+  return Flush(socket);
+}
+
+bool SocketWriter::Flush(wxSocketBase *socket)
+{
+  m_lastWriteCount = 0;
+  if ((socket == NULL) || (Pending() == 0))
+    return true;
+
+  char *data = (char *) m_buffer.GetData();
+  socket->Write(data + m_start, Pending());
+  // With wxSOCKET_NOWAIT a full socket buffer isn't an error: We just have to
+  // try again on the next wxSOCKET_OUTPUT event.
+  if (socket->Error() && (socket->LastError() != wxSOCKET_WOULDBLOCK))
+  {
+    Clear();
+    return false;
+  }
+
+  m_lastWriteCount = socket->LastWriteCount();
+  m_start += m_lastWriteCount;
+  if (m_start >= m_buffer.GetDataLen())
+    Clear();
+  else if (m_start > m_buffer.GetDataLen() / 2)
+  {
+    // Don't let the part that has already been sent grow without bounds.
+    size_t left = Pending();
+    memmove(data, data + m_start, left);
+    m_buffer.SetDataLen(left);
+    m_start = 0;
+  }
+  return true;
+}
+
+void SocketWriter::Clear()
+{
+  m_buffer.SetDataLen(0);
+  m_start = 0;
+}
@@ -0,0 +1,82 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+  This file defines the class SocketWriter
+
+  SocketWriter sends data over a socket without waiting for the other side to
+  read it.
+ */
+
+#ifndef SOCKETWRITER_H
+#define SOCKETWRITER_H
+
+#include <wx/wx.h>
+#include <wx/buffer.h>
+#include <wx/socket.h>
+
+/*! Sends data over a non-blocking socket without losing what doesn't fit
+
+  With wxSOCKET_NOWAIT a socket accepts only as much data as fits into its
+  buffer. SocketWriter keeps the rest and sends it on the next call to
+  Flush(), which its owner makes on the next wxSOCKET_OUTPUT event.
+ */
+class SocketWriter
+{
+public:
+  SocketWriter();
+
+  /*! Queues data and sends as much of it as the socket currently accepts
+
+    \return false, if writing to the socket has failed. Everything that
+    still waited for being sent is discarded in this case.
+   */
+  bool Write(wxSocketBase *socket, const void *data, size_t length);
+
+  /*! Sends as much of the queued data as the socket currently accepts
+
+    \return false, if writing to the socket has failed. Everything that
+    still waited for being sent is discarded in this case.
+   */
+  bool Flush(wxSocketBase *socket);
+
+  //! Discards everything that still waits for being sent
+  void Clear();
+
+  //! The number of bytes that still wait for being sent
+  size_t Pending()
+  { return m_buffer.GetDataLen() - m_start; }
+
+  //! The number of bytes the last Flush() has sent
+  size_t LastWriteCount()
+  { return m_lastWriteCount; }
+
+private:
+  //! The data the socket hasn't accepted yet
+  wxMemoryBuffer m_buffer;
+  //! How much of m_buffer has already been sent
+  size_t m_start;
+  //! The number of bytes the last Flush() has sent
+  size_t m_lastWriteCount;
+};
+
+#endif // SOCKETWRITER_H
@@ -67,16 +67,12 @@ SqrtCell::~SqrtCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> SqrtCell::GetInnerCells()
+Cell *SqrtCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_innerCell)
-    innerCells.push_back(m_innerCell);
-  if(m_open)
-    innerCells.push_back(m_open);
-  if(m_close)
-    innerCells.push_back(m_close);
-  return innerCells;
+  Cell *innerCells[] = {m_innerCell, m_open, m_close};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void SqrtCell::SetInner(Cell *inner)
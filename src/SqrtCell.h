@@ -52,10 +52,14 @@ public:
 
   ~SqrtCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 3;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetInner(Cell *inner);
 
   void RecalculateHeight(int fontsize);
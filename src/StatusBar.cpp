@@ -38,6 +38,7 @@ StatusBar::StatusBar(wxWindow *parent, int id) : wxStatusBar(parent, id)
   int widths[] = {-1, 300, GetSize().GetHeight()};
   m_maximaPercentage = -1;
   m_oldmaximaPercentage = -1;
+  m_sendBacklog = 0;
   SetFieldsCount(3, widths);
   m_stdToolTip = _(
           "Maxima, the program that does the actual mathematics is started as a separate process. This has the advantage that an eventual crash of maxima cannot harm wxMaxima, which displays the worksheet.\nThis icon indicates if data is transferred between maxima and wxMaxima.");
@@ -107,9 +108,12 @@ void StatusBar::UpdateBitmaps()
 
 void StatusBar::OnTimerEvent(wxTimerEvent &WXUNUSED(event))
 {
+  // As long as data waits for maxima to accept it we are still transmitting.
+  bool transmit = SendTimer.IsRunning() || (m_sendBacklog > 0);
+
   // don't do anything if the network status didn't change.
   if ((m_icon_shows_receive == (ReceiveTimer.IsRunning())) &&
-      (m_icon_shows_transmit == (SendTimer.IsRunning())))
+      (m_icon_shows_transmit == transmit))
     return;
 
   // don't do anything if the timer expired, but we aren't connected
@@ -118,7 +122,7 @@ void StatusBar::OnTimerEvent(wxTimerEvent &WXUNUSED(event))
     return;
 
   m_icon_shows_receive = ReceiveTimer.IsRunning();
-  m_icon_shows_transmit = SendTimer.IsRunning();
+  m_icon_shows_transmit = transmit;
 
   if (m_icon_shows_receive && m_icon_shows_transmit)
   {
@@ -151,6 +155,26 @@ void StatusBar::OnTimerEvent(wxTimerEvent &WXUNUSED(event))
   }
 }
 
+void StatusBar::SendBacklog(long bytes)
+{
+  if (bytes == m_sendBacklog)
+    return;
+  m_sendBacklog = bytes;
+
+  if ((m_networkState != error) && (m_networkState != offline))
+  {
+    wxString toolTip = m_stdToolTip;
+    if (m_sendBacklog > 0)
+      toolTip += wxString::Format(
+        _("\n\n%li bytes are waiting for maxima to accept them."),
+        m_sendBacklog
+        );
+    m_networkStatus->SetToolTip(toolTip);
+  }
+  wxTimerEvent dummy;
+  OnTimerEvent(dummy);
+}
+
 void StatusBar::NetworkStatus(networkState status)
 {
   UpdateBitmaps();
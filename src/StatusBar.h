@@ -70,6 +70,12 @@ public:
       m_maximaPercentage = percentage;
       NetworkStatus(m_oldNetworkState);
     }
+
+  /*! Inform the status bar how many bytes wait for maxima to accept them
+
+    As long as there are any the icon shows that data is transmitted.
+   */
+  void SendBacklog(long bytes);
 protected:
   void OnSize(wxSizeEvent &event);
 
@@ -89,6 +95,8 @@ private:
    */
   float m_oldmaximaPercentage;
   networkState m_oldNetworkState;
+  //! The number of bytes that wait for maxima to accept them
+  long m_sendBacklog;
   wxString m_stdToolTip;
   wxString m_networkErrToolTip;
   wxString m_noConnectionToolTip;
@@ -0,0 +1,147 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class StringMatchers
+
+  StringMatchers contains hand-written scanners for the fixed patterns wxMaxima
+  searches for while parsing maxima's output.
+ */
+
+#include "StringMatchers.h"
+
+//! Is ch one of the characters [0-9] matches?
+static bool IsAsciiDigit(wxChar ch)
+{
+  return (ch >= wxT('0')) && (ch <= wxT('9'));
+}
+
+bool StringMatchers::LooksLikeRoundingError(const wxString &number)
+{
+  size_t len = number.Length();
+  size_t pos = 0;
+  while ((pos = number.find(wxT('.'), pos)) != wxString::npos)
+  {
+    pos++;
+    if (pos >= len)
+      return false;
+
+    // 12 zeros or 12 nines...
+    wxChar repeated = number[pos];
+    if ((repeated != wxT('0')) && (repeated != wxT('9')))
+      continue;
+    size_t i = pos;
+    while ((i < len) && (i - pos < 12) && (number[i] == repeated))
+      i++;
+    if (i - pos < 12)
+      continue;
+
+    // ...followed by at least one more digit and the end of the number or
+    // its exponent.
+    size_t digitsStart = i;
+    while ((i < len) && IsAsciiDigit(number[i]))
+      i++;
+    if ((i > digitsStart) && ((i == len) || (number[i] == wxT('e'))))
+      return true;
+  }
+  return false;
+}
+
+void StringMatchers::Unescape(wxString &text)
+{
+  if (text.Find(wxT('\\')) == wxNOT_FOUND)
+    return;
+
+  wxString result;
+  result.reserve(text.Length());
+  for (wxString::const_iterator it = text.begin(); it != text.end(); ++it)
+  {
+    if ((*it == wxT('\\')) && (it + 1 != text.end()))
+      ++it;
+    result += *it;
+  }
+  text = result;
+}
+
+int StringMatchers::ReplaceControlChars(wxString &text, wxChar replacement)
+{
+  int count = 0;
+  for (wxString::iterator it = text.begin(); it != text.end(); ++it)
+  {
+    wxChar ch = *it;
+    if ((ch < wxT(' ')) && (ch != wxT('\t')) && (ch != wxT('\n')) && (ch != wxT('\r')))
+    {
+      *it = replacement;
+      count++;
+    }
+  }
+  return count;
+}
+
+int StringMatchers::ReplaceDataFileNames(wxString &line, const wxString &replacement)
+{
+  static const wxString marker(wxT("maxout_"));
+  static const wxString extension(wxT(".data"));
+
+  if (line.Find(marker) == wxNOT_FOUND)
+    return 0;
+
+  int count = 0;
+  size_t start = 0;
+  while ((start = line.find(wxT('\''), start)) != wxString::npos)
+  {
+    size_t end = line.find(wxT('\''), start + 1);
+    if (end == wxString::npos)
+      break;
+
+    // The name must look like <anything>maxout_<anything>_<digits>.data
+    wxString name = line.SubString(start + 1, end - 1);
+    bool matches = false;
+    size_t markerPos = name.find(marker);
+    if ((markerPos != wxString::npos) && name.EndsWith(extension))
+    {
+      size_t i = name.Length() - extension.Length();
+      while ((i > 0) && IsAsciiDigit(name[i - 1]))
+        i--;
+      matches = (i > markerPos + marker.Length()) && (name[i - 1] == wxT('_'));
+    }
+
+    if (matches)
+    {
+      line.replace(start, end - start + 1, replacement);
+      start += replacement.Length();
+      count++;
+    }
+    else
+      // The closing quote might be the opening quote of a file name.
+      start = end;
+  }
+  return count;
+}
+
+bool StringMatchers::ContainsRegexChars(const wxString &text)
+{
+  static const wxString regexChars(wxT("\\^$.|?*+()[]{}"));
+  for (wxString::const_iterator it = text.begin(); it != text.end(); ++it)
+    if (regexChars.Find(*it) != wxNOT_FOUND)
+      return true;
+  return false;
+}
@@ -0,0 +1,78 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class StringMatchers
+
+  StringMatchers contains hand-written scanners for the fixed patterns wxMaxima
+  searches for while parsing maxima's output.
+ */
+
+#ifndef STRINGMATCHERS_H
+#define STRINGMATCHERS_H
+
+#include <wx/string.h>
+
+/*! Hand-written replacements for the regular expressions used in hot paths
+
+  wxRegEx has to be compiled before use, isn't thread-safe and is slow compared
+  to a simple loop over the characters of a string. The patterns below are
+  searched for in every cell or every line of maxima's output, which is why
+  they are implemented as scanners. The comment of each function names the
+  regular expression it replaces.
+ */
+class StringMatchers
+{
+public:
+  /*! Does a number look like it contains a floating-point rounding error?
+
+    Replaces the regular expressions <code>\\.000000000000[0-9]+$</code>,
+    <code>\\.999999999999[0-9]+$</code>, <code>\\.000000000000[0-9]+e</code> and
+    <code>\\.999999999999[0-9]+e</code>.
+   */
+  static bool LooksLikeRoundingError(const wxString &number);
+
+  /*! Removes the backslashes that escape characters
+
+    Replaces the regular expression <code>\\\\(.)</code> with the
+    replacement <code>\\1</code>.
+   */
+  static void Unescape(wxString &text);
+
+  /*! Replaces all characters XML doesn't allow by a replacement character
+
+    Tabs, newlines and carriage returns are allowed in XML and are kept.
+    \return The number of characters that were replaced.
+   */
+  static int ReplaceControlChars(wxString &text, wxChar replacement = wxT('\xFFFD'));
+
+  /*! Replaces quoted names of maxima's plot data files by a placeholder
+
+    Replaces the regular expression <code>'[^']*maxout_[^']*_[0-9]*\\.data'</code>.
+    \return The number of file names that were replaced.
+   */
+  static int ReplaceDataFileNames(wxString &line, const wxString &replacement);
+
+  //! Does this string contain any character a regular expression treats specially?
+  static bool ContainsRegexChars(const wxString &text);
+};
+
+#endif // STRINGMATCHERS_H
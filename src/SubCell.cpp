@@ -56,14 +56,12 @@ SubCell::~SubCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> SubCell::GetInnerCells()
+Cell *SubCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_baseCell)
-    innerCells.push_back(m_baseCell);
-  if(m_indexCell)
-    innerCells.push_back(m_indexCell);
-  return innerCells;
+  Cell *innerCells[] = {m_baseCell, m_indexCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 
@@ -123,9 +121,9 @@ void SubCell::Draw(wxPoint point)
 
 wxString SubCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
+  if (GetAltCopyText() != wxEmptyString)
   {
-    return m_altCopyText;
+    return GetAltCopyText();
   }
 
   wxString s;
@@ -139,9 +137,9 @@ wxString SubCell::ToString()
 
 wxString SubCell::ToMatlab()
 {
-  if (m_altCopyText != wxEmptyString)
+  if (GetAltCopyText() != wxEmptyString)
   {
-	return m_altCopyText;
+	return GetAltCopyText();
   }
 
   wxString s;
@@ -189,8 +187,8 @@ wxString SubCell::ToXML()
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  if (m_altCopyText != wxEmptyString)
-    flags += wxT(" altCopy=\"") + XMLescape(m_altCopyText) + wxT("\"");
+  if (GetAltCopyText() != wxEmptyString)
+    flags += wxT(" altCopy=\"") + XMLescape(GetAltCopyText()) + wxT("\"");
   
   return wxT("<i") + flags + wxT("><r>") + m_baseCell->ListToXML() + wxT("</r><r>") +
            m_indexCell->ListToXML() + wxT("</r></i>");
@@ -32,10 +32,14 @@ public:
 
   ~SubCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 2;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetBase(Cell *base);
 
   void SetIndex(Cell *index);
@@ -63,16 +63,12 @@ SubSupCell::~SubSupCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> SubSupCell::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  if(m_baseCell)
-    innerCells.push_back(m_baseCell);
-  if(m_indexCell)
-    innerCells.push_back(m_indexCell);
-  if(m_exptCell)
-    innerCells.push_back(m_exptCell);
-  return innerCells;
+Cell *SubSupCell::GetInnerCell(int index)
+{
+  Cell *innerCells[] = {m_baseCell, m_indexCell, m_exptCell};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void SubSupCell::SetIndex(Cell *index)
@@ -32,10 +32,14 @@ public:
 
   ~SubSupCell();
 
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 3;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   void SetBase(Cell *base);
 
   void SetIndex(Cell *index);
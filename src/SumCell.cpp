@@ -71,16 +71,12 @@ SumCell::~SumCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> SumCell::GetInnerCells()
+Cell *SumCell::GetInnerCell(int index)
 {
-  std::list<Cell *> innerCells;
-  if(m_base)
-    innerCells.push_back(m_base);
-  if(m_under)
-    innerCells.push_back(m_under);
-  if(m_over)
-    innerCells.push_back(m_over);
-  return innerCells;
+  Cell *innerCells[] = {m_base, m_under, m_over};
+  if((index < 0) || (index >= GetInnerCellCount()))
+    return NULL;
+  return innerCells[index];
 }
 
 void SumCell::SetOver(Cell *over)
@@ -46,9 +46,13 @@ public:
 
   ~SumCell();
   
-  std::list<Cell *> GetInnerCells();
+  int GetInnerCellCount(){return 3;}
+  Cell *GetInnerCell(int index);
 
   Cell *Copy();
+
+  size_t SizeInBytes()
+  { return sizeof(*this); }
   
   void RecalculateHeight(int fontsize);
 
@@ -28,6 +28,7 @@
  */
 
 #include "TextCell.h"
+#include "StringMatchers.h"
 #include "wx/config.h"
 
 TextCell::TextCell(Cell *parent, Configuration **config, CellPointers *cellPointers,
@@ -72,7 +73,6 @@ TextCell::TextCell(Cell *parent, Configuration **config, CellPointers *cellPoint
   SetValue(text);
   m_highlight = false;
   m_dontEscapeOpeningParenthesis = false;
-  m_initialToolTip = (*m_configuration)->GetDefaultCellToolTip();
   m_fontsize_old = -1;
 }
 
@@ -81,12 +81,6 @@ TextCell::~TextCell()
   MarkAsDeleted();
 }
 
-std::list<Cell *> TextCell::GetInnerCells()
-{
-  std::list<Cell *> innerCells;
-  return innerCells;
-}
-
 void TextCell::SetStyle(TextStyle style)
 {
   Cell::SetStyle(style);
@@ -106,24 +100,47 @@ void TextCell::SetType(CellType type)
   SetFont((*m_configuration)->GetDefaultFontSize());
 }
 
+TextCell::TextInfo TextCell::GetTextInfo(const wxString &text)
+{
+  wxCriticalSectionLocker lock(m_textInfoCacheLock);
+
+  TextInfoCache::iterator it = m_textInfoCache.find(text);
+  if(it != m_textInfoCache.end())
+    return it->second;
+
+  TextInfo info;
+  info.m_text = text;
+  info.m_text.Replace(wxT("\n"), wxEmptyString);
+  info.m_text.Replace(wxT("-->"), wxT("\x2794"));
+  info.m_text.Replace(wxT(" -->"), wxT("\x2794"));
+  info.m_text.Replace(wxT(" \x2212\x2192 "), wxT("\x2794"));
+  info.m_text.Replace(wxT("->"), wxT("\x2192"));
+  info.m_text.Replace(wxT("\x2212>"), wxT("\x2192"));
+  info.m_roundingError = StringMatchers::LooksLikeRoundingError(info.m_text);
+
+  // Very long strings are seldom repeated and would bloat the cache.
+  if(text.Length() <= 256)
+  {
+    if(m_textInfoCache.size() >= m_maxTextInfoCacheSize)
+      m_textInfoCache.clear();
+    m_textInfoCache[text] = info;
+  }
+  return info;
+}
+
 void TextCell::SetValue(const wxString &text)
 {
-  m_toolTip = m_initialToolTip;
+  ResetToolTip();
   m_displayedDigits_old = (*m_configuration)->GetDisplayedDigits();
-  m_text = text;
+  TextInfo info = GetTextInfo(text);
+  m_text = info.m_text;
   ResetSize();
-  m_text.Replace(wxT("\n"), wxEmptyString);
-  m_text.Replace(wxT("-->"), wxT("\x2794"));
-  m_text.Replace(wxT(" -->"), wxT("\x2794"));
-  m_text.Replace(wxT(" \x2212\x2192 "), wxT("\x2794"));
-  m_text.Replace(wxT("->"), wxT("\x2192"));
-  m_text.Replace(wxT("\x2212>"), wxT("\x2192"));
 
   m_displayedText = m_text;
   if (m_textStyle == TS_FUNCTION)
   {
     if (m_text == wxT("ilt"))
-      m_toolTip = _("The inverse laplace transform.");
+      SetToolTip(_("The inverse laplace transform."));
     
     if (m_text == wxT("gamma"))
       m_displayedText = wxT("\x0393");
@@ -134,40 +151,40 @@ void TextCell::SetValue(const wxString &text)
   if (m_textStyle == TS_VARIABLE)
   {
     if (m_text == wxT("pnz"))
-      m_toolTip = _("Either positive, negative or zero.\n"
-                    "Normally the result of sign() if the sign cannot be determined."
-        );
+      SetToolTip(_("Either positive, negative or zero.\n"
+                   "Normally the result of sign() if the sign cannot be determined."
+       ));
 
     if (m_text == wxT("pz"))
-      m_toolTip = _("Either positive or zero.\n"
-                    "A possible result of sign()."
-        );
+      SetToolTip(_("Either positive or zero.\n"
+                   "A possible result of sign()."
+       ));
   
     if (m_text == wxT("nz"))
-      m_toolTip = _("Either negative or zero.\n"
-                    "A possible result of sign()."
-        );
+      SetToolTip(_("Either negative or zero.\n"
+                   "A possible result of sign()."
+       ));
 
     if (m_text == wxT("und"))
-      m_toolTip = _("The result was undefined.");
+      SetToolTip(_("The result was undefined."));
 
         if (m_text == wxT("ind"))
-      m_toolTip = _("The result was indefinite.");
+      SetToolTip(_("The result was indefinite."));
 
     if (m_text == wxT("zeroa"))
-      m_toolTip = _("Infinitesimal above zero.");
+      SetToolTip(_("Infinitesimal above zero."));
 
     if (m_text == wxT("zerob"))
-      m_toolTip = _("Infinitesimal below zero.");
+      SetToolTip(_("Infinitesimal below zero."));
 
     if (m_text == wxT("inf"))
-      m_toolTip = wxT("+∞.");
+      SetToolTip(wxT("+∞."));
 
     if (m_text == wxT("infinity"))
-      m_toolTip = _("Complex infinity.");
+      SetToolTip(_("Complex infinity."));
         
     if (m_text == wxT("inf"))
-      m_toolTip = wxT("-∞.");
+      SetToolTip(wxT("-∞."));
 
     if(m_text.StartsWith("%r"))
     {
@@ -185,8 +202,8 @@ void TextCell::SetValue(const wxString &text)
         }
 
       if(isrnum)
-        m_toolTip = _("A variable that can be assigned a number to.\n"
-          "Often used by solve() and algsys(), if there is an infinite number of results.");
+        SetToolTip(_("A variable that can be assigned a number to.\n"
+         "Often used by solve() and algsys(), if there is an infinite number of results."));
     }
 
   
@@ -206,7 +223,7 @@ void TextCell::SetValue(const wxString &text)
         }
       
       if(isinum)
-        m_toolTip = _("An integration constant.");
+        SetToolTip(_("An integration constant."));
     }
   }
   
@@ -221,23 +238,18 @@ void TextCell::SetValue(const wxString &text)
       m_displayedText = m_displayedText.Left(left) +
                         wxString::Format(_("[%i digits]"), (int) m_displayedText.Length() - 2 * left) +
                         m_displayedText.Right(left);
-      m_toolTip = _("The maximum number of displayed digits can be changed in the configuration dialogue");
+      SetToolTip(_("The maximum number of displayed digits can be changed in the configuration dialogue"));
     }
     else
     {
-      if(
-        (m_roundingErrorRegEx1.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx2.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx3.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx4.Matches(m_displayedText))
-        )
-        m_toolTip = _("As calculating 0.1^12 demonstrates maxima by default doesn't tend to "
-                      "hide what looks like being the small error using floating-point "
-                      "numbers introduces.\n"
-                      "If this seems to be the case here the error can be avoided by using "
-                      "exact numbers like 1/10, 1*10^-1 or rat(.1).\n"
-                      "It also can be hidden by setting fpprintprec to an appropriate value. "
-                      "But be aware in this case that even small errors can add up.");
+      if(info.m_roundingError)
+        SetToolTip(_("As calculating 0.1^12 demonstrates maxima by default doesn't tend to "
+                     "hide what looks like being the small error using floating-point "
+                     "numbers introduces.\n"
+                     "If this seems to be the case here the error can be avoided by using "
+                     "exact numbers like 1/10, 1*10^-1 or rat(.1).\n"
+                     "It also can be hidden by setting fpprintprec to an appropriate value. "
+                     "But be aware in this case that even small errors can add up."));
     }
   }
   else
@@ -246,84 +258,84 @@ void TextCell::SetValue(const wxString &text)
        (text.Contains(wxT("DOCUMENTATION OF ROUTINE MCSRCH"))) ||
        (text.Contains(wxT("ERROR RETURN OF LINE SEARCH:"))) ||
        text.Contains(wxT("POSSIBLE CAUSES: FUNCTION OR GRADIENT ARE INCORRECT")))
-      m_toolTip = _("This message can appear when trying to numerically find an optimum. "
-                    "In this case it might indicate that a starting point lies in a local "
-                    "optimum that fits the data best if one parameter is increased to "
-                    "infinity or decreased to -infinity. It also can indicate that an "
-                    "attempt was made to fit data to an equation that actually matches "
-                    "the data best if one parameter is set to +/- infinity.");
+      SetToolTip(_("This message can appear when trying to numerically find an optimum. "
+                   "In this case it might indicate that a starting point lies in a local "
+                   "optimum that fits the data best if one parameter is increased to "
+                   "infinity or decreased to -infinity. It also can indicate that an "
+                   "attempt was made to fit data to an equation that actually matches "
+                   "the data best if one parameter is set to +/- infinity."));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("is not an infix operator"))))
-      m_toolTip = _("A command or number wasn't preceded by a \":\", a \"$\", a \";\" or a \",\".\n"
-                    "Most probable cause: A missing comma between two list items.");
+      SetToolTip(_("A command or number wasn't preceded by a \":\", a \"$\", a \";\" or a \",\".\n"
+                   "Most probable cause: A missing comma between two list items."));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("Found LOGICAL expression where ALGEBRAIC expression expected"))))
-      m_toolTip = _("Most probable cause: A dot instead a comma between two list items containing assignments.");
+      SetToolTip(_("Most probable cause: A dot instead a comma between two list items containing assignments."));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("is not a prefix operator"))))
-      m_toolTip = _("Most probable cause: Two commas or similar separators in a row.");
+      SetToolTip(_("Most probable cause: Two commas or similar separators in a row."));
     if(text.Contains(wxT("Illegal use of delimiter")))
-      m_toolTip = _("Most probable cause: an operator was directly followed by a closing parenthesis.");
+      SetToolTip(_("Most probable cause: an operator was directly followed by a closing parenthesis."));
     
     if(text.StartsWith(wxT("part: fell off the end.")))
-      m_toolTip = _("part() or the [] operator was used in order to extract the nth element "
-                    "of something that was less than n elements long.");
+      SetToolTip(_("part() or the [] operator was used in order to extract the nth element "
+                   "of something that was less than n elements long."));
     if(text.StartsWith(wxT("rest: fell off the end.")))
-      m_toolTip = _("rest() tried to drop more entries from a list than the list was long.");
+      SetToolTip(_("rest() tried to drop more entries from a list than the list was long."));
     if(text.StartsWith(wxT("assignment: cannot assign to")))
-      m_toolTip = _("The value of few special variables is assigned by Maxima and cannot be changed by the user. Also a few constructs aren't variable names and therefore cannot be written to.");
+      SetToolTip(_("The value of few special variables is assigned by Maxima and cannot be changed by the user. Also a few constructs aren't variable names and therefore cannot be written to."));
     if(text.StartsWith(wxT("rat: replaced ")))
-      m_toolTip = _("Normally computers use floating-point numbers that can be handled "
-                    "incredibly fast while being accurate to dozens of digits. "
-                    "They will, though, introduce a small error into some common numbers. "
-                    "For example 0.1 is represented as 3602879701896397/36028797018963968.\n"
-                    "As mathematics is based on the fact that numbers that are exactly "
-                    "equal cancel each other out small errors can quickly add up to big errors "
-                    "(see Wilkinson's Polynomials or Rump's Polynomials). Some maxima "
-                    "commands therefore use rat() in order to automatically convert floats to "
-                    "exact numbers (like 1/10 or sqrt(2)/2) where floating-point errors might "
-                    "add up.\n\n"
-                    "This error message doesn't occur if exact numbers (1/10 instead of 0.1) "
-                    "are used.\n"
-                    "The info that numbers have automatically been converted can be suppressed "
-                    "by setting ratprint to false.");
+      SetToolTip(_("Normally computers use floating-point numbers that can be handled "
+                   "incredibly fast while being accurate to dozens of digits. "
+                   "They will, though, introduce a small error into some common numbers. "
+                   "For example 0.1 is represented as 3602879701896397/36028797018963968.\n"
+                   "As mathematics is based on the fact that numbers that are exactly "
+                   "equal cancel each other out small errors can quickly add up to big errors "
+                   "(see Wilkinson's Polynomials or Rump's Polynomials). Some maxima "
+                   "commands therefore use rat() in order to automatically convert floats to "
+                   "exact numbers (like 1/10 or sqrt(2)/2) where floating-point errors might "
+                   "add up.\n\n"
+                   "This error message doesn't occur if exact numbers (1/10 instead of 0.1) "
+                   "are used.\n"
+                   "The info that numbers have automatically been converted can be suppressed "
+                   "by setting ratprint to false."));
     if(text.StartsWith(wxT("expt: undefined: 0 to a negative exponent.")))
-      m_toolTip = _("Division by 0.");
+      SetToolTip(_("Division by 0."));
     if(text.Contains(wxT("arithmetic error DIVISION-BY-ZERO signalled")))
-      m_toolTip = _("Besides a division by 0 the reason for this error message can be a "
-                    "calculation that returns +/-infinity.");
+      SetToolTip(_("Besides a division by 0 the reason for this error message can be a "
+                   "calculation that returns +/-infinity."));
     if(text.Contains(wxT("isn't in the domain of")))
-      m_toolTip = _("Most probable cause: A function was called with a parameter that causes "
-                    "it to return infinity and/or -infinity.");
+      SetToolTip(_("Most probable cause: A function was called with a parameter that causes "
+                   "it to return infinity and/or -infinity."));
     if(text.StartsWith(wxT("Only symbols can be bound")))
-      m_toolTip = _("This error message is most probably caused by a try to assign "
-                    "a value to a number instead of a variable name.\n"
-                    "One probable cause is using a variable that already has a numeric "
-                    "value as a loop counter.");
+      SetToolTip(_("This error message is most probably caused by a try to assign "
+                   "a value to a number instead of a variable name.\n"
+                   "One probable cause is using a variable that already has a numeric "
+                   "value as a loop counter."));
     if(text.StartsWith(wxT("append: operators of arguments must all be the same.")))
-      m_toolTip = _("Most probably it was attempted to append something to a list "
-                    "that isn't a list.\n"
-                    "Enclosing the new element for the list in brackets ([]) "
-                    "converts it to a list and makes it appendable.");
+      SetToolTip(_("Most probably it was attempted to append something to a list "
+                   "that isn't a list.\n"
+                   "Enclosing the new element for the list in brackets ([]) "
+                   "converts it to a list and makes it appendable."));
     if(text.Contains(wxT(": invalid index")))
-      m_toolTip = _("The [] or the part() command tried to access a list or matrix "
-                    "element that doesn't exist.");
+      SetToolTip(_("The [] or the part() command tried to access a list or matrix "
+                   "element that doesn't exist."));
     if(text.StartsWith(wxT("apply: subscript must be an integer; found:")))
-      m_toolTip = _("the [] operator tried to extract an element of a list, a matrix, "
-                    "an equation or an array. But instead of an integer number "
-                    "something was used whose numerical value is unknown or not an "
-                    "integer.\n"
-                    "Floating-point numbers are bound to contain small rounding errors "
-                    "and therefore in most cases don't work as an array index that"
-                    "needs to be an exact integer number.");
+      SetToolTip(_("the [] operator tried to extract an element of a list, a matrix, "
+                   "an equation or an array. But instead of an integer number "
+                   "something was used whose numerical value is unknown or not an "
+                   "integer.\n"
+                   "Floating-point numbers are bound to contain small rounding errors "
+                   "and therefore in most cases don't work as an array index that"
+                   "needs to be an exact integer number."));
     if(text.StartsWith(wxT(": improper argument: ")))
     {
       if((m_previous) && (m_previous->ToString() == wxT("at")))
-        m_toolTip = _("The second argument of at() isn't an equation or a list of "
-                      "equations. Most probably it was lacking an \"=\".");
+        SetToolTip(_("The second argument of at() isn't an equation or a list of "
+                     "equations. Most probably it was lacking an \"=\"."));
       else if((m_previous) && (m_previous->ToString() == wxT("subst")))
-        m_toolTip = _("The first argument of subst() isn't an equation or a list of "
-                      "equations. Most probably it was lacking an \"=\".");
+        SetToolTip(_("The first argument of subst() isn't an equation or a list of "
+                     "equations. Most probably it was lacking an \"=\"."));
       else
-        m_toolTip = _("The argument of a function was of the wrong type. Most probably "
-                      "an equation was expected but was lacking an \"=\".");
+        SetToolTip(_("The argument of a function was of the wrong type. Most probably "
+                     "an equation was expected but was lacking an \"=\"."));
     }
   }
   m_alt = m_altJs = false;
@@ -411,7 +423,7 @@ void TextCell::RecalculateWidths(int fontsize)
       if(m_textStyle == TS_USERLABEL)
       {
         text = wxT("(") + m_userDefinedLabel + wxT(")");
-        m_unescapeRegEx.ReplaceAll(&text,wxT("\\1"));
+        StringMatchers::Unescape(text);
       }
 
       wxFont font = dc->GetFont();
@@ -516,7 +528,7 @@ void TextCell::Draw(wxPoint point)
           {
             wxString text = m_userDefinedLabel;
             SetToolTip(m_text);
-            m_unescapeRegEx.ReplaceAll(&text,wxT("\\1"));
+            StringMatchers::Unescape(text);
             dc->DrawText(wxT("(") + text + wxT(")"),
                          point.x + MC_TEXT_PADDING,
                          point.y - m_realCenter + MC_TEXT_PADDING);
@@ -680,8 +692,8 @@ bool TextCell::IsOperator()
 wxString TextCell::ToString()
 {
   wxString text;
-  if (m_altCopyText != wxEmptyString)
-    text = m_altCopyText;
+  if (GetAltCopyText() != wxEmptyString)
+    text = GetAltCopyText();
   else
   {
     text = m_text;
@@ -758,8 +770,8 @@ wxString TextCell::ToString()
 wxString TextCell::ToMatlab()
 {
 	wxString text;
-	if (m_altCopyText != wxEmptyString)
-	  text = m_altCopyText;
+	if (GetAltCopyText() != wxEmptyString)
+	  text = GetAltCopyText();
 	else
 	{
 	  text = m_text;
@@ -1485,8 +1497,8 @@ wxString TextCell::ToXML()
   if(m_userDefinedLabel != wxEmptyString)
     flags += wxT(" userdefinedlabel=\"") + XMLescape(m_userDefinedLabel) + wxT("\"");
 
-  if(m_toolTip != wxEmptyString)
-    flags += wxT(" tooltip=\"") + XMLescape(m_toolTip) + wxT("\"");
+  if(GetLocalToolTip() != wxEmptyString)
+    flags += wxT(" tooltip=\"") + XMLescape(GetLocalToolTip()) + wxT("\"");
 
   return wxT("<") + tag + flags + wxT(">") + xmlstring + wxT("</") + tag + wxT(">");
 }
@@ -1868,9 +1880,5 @@ wxString TextCell::GetSymbolTeX()
 }
 
 
-// RegExes all TextCells share.
-wxRegEx TextCell::m_unescapeRegEx(wxT("\\\\(.)"));
-wxRegEx TextCell::m_roundingErrorRegEx1(wxT("\\.000000000000[0-9]+$"));
-wxRegEx TextCell::m_roundingErrorRegEx2(wxT("\\.999999999999[0-9]+$"));
-wxRegEx TextCell::m_roundingErrorRegEx3(wxT("\\.000000000000[0-9]+e"));
-wxRegEx TextCell::m_roundingErrorRegEx4(wxT("\\.999999999999[0-9]+e"));
+TextCell::TextInfoCache TextCell::m_textInfoCache;
+wxCriticalSection TextCell::m_textInfoCacheLock;
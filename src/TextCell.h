@@ -24,6 +24,8 @@
 #define TEXTCELL_H
 
 #include "wx/regex.h"
+#include "wx/hashmap.h"
+#include "wx/thread.h"
 #include "Cell.h"
 
 /*! A Text cell
@@ -39,12 +41,17 @@ private:
 public:
   TextCell(Cell *parent, Configuration **config, CellPointers *cellPointers, wxString text = wxEmptyString, TextStyle style = TS_DEFAULT);
 
-  std::list<Cell *> GetInnerCells();
+  //! This cell doesn't contain other cells
+  int GetInnerCellCount(){return 0;}
+  Cell *GetInnerCell(int WXUNUSED(index)){return NULL;}
   
   ~TextCell();
   
   Cell *Copy();
 
+  size_t SizeInBytes()
+  { return sizeof(*this); }
+
   virtual void SetStyle(TextStyle style);
   
   //! Set the text contained in this cell
@@ -106,11 +113,29 @@ protected:
   void SetFontSizeForLabel(wxDC *dc);
 
   bool NeedsRecalculation();
-  static wxRegEx m_unescapeRegEx;
-  static wxRegEx m_roundingErrorRegEx1;
-  static wxRegEx m_roundingErrorRegEx2;
-  static wxRegEx m_roundingErrorRegEx3;
-  static wxRegEx m_roundingErrorRegEx4;
+  /*! What SetValue() has found out about a string maxima has sent us
+
+    Maxima's output repeats the same variable names, operators, labels and
+    numbers over and over again. The result of analyzing a string is therefore
+    kept in a per-session table and is re-used by every cell that contains the
+    same string.
+   */
+  struct TextInfo
+  {
+    //! The text with arrows and similar replaced by their unicode equivalent
+    wxString m_text;
+    //! true = The text is a number that looks like it contains a rounding error
+    bool m_roundingError;
+  };
+  WX_DECLARE_STRING_HASH_MAP(TextInfo, TextInfoCache);
+  //! Returns the analysis of a string, from the cache if possible
+  static TextInfo GetTextInfo(const wxString &text);
+  //! The analysis of all strings SetValue() has seen in this session
+  static TextInfoCache m_textInfoCache;
+  //! Cells might be created by more than one thread
+  static wxCriticalSection m_textInfoCacheLock;
+  //! Above this number of entries the cache is emptied
+  static const size_t m_maxTextInfoCacheSize = 65536;
 
   //! The text we keep inside this cell
   wxString m_text;
@@ -137,8 +162,6 @@ protected:
   double m_fontSizeLabel;
   double m_lastZoomFactor;
 private:
-  //! Produces a text sample that determines the label width
-  wxString m_initialToolTip;
   //! The number of digits we did display the last time we displayed a number.
   int m_displayedDigits_old;
 
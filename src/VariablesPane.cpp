@@ -265,9 +265,13 @@ void Variablespane::OnTextChange(wxGridEvent &event)
 
 void Variablespane::VariableValue(wxString var, wxString val)
 {
+  wxString name = UnescapeVarname(var);
   for(int i = 0; i < GetNumberRows(); i++)
-    if(GetCellValue(i,0) == UnescapeVarname(var))
+    if(GetCellValue(i,0) == name)
     {
+      // Don't re-render values that haven't changed
+      if((GetCellValue(i,1) == val) && (GetCellTextColour(i,1) == *wxBLACK))
+        continue;
       SetCellTextColour(i,1,*wxBLACK);
       SetCellValue(i,1,val);
       RefreshAttr(i, 1);
@@ -46,6 +46,7 @@
 #include "ImgCell.h"
 #include "MarkDown.h"
 #include "ConfigDialogue.h"
+#include "FindReplaceEngine.h"
 
 #include <wx/clipbrd.h>
 #include <wx/caret.h>
@@ -65,6 +66,9 @@
 #include <wx/filesys.h>
 #include <wx/fs_mem.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <map>
+#include <typeinfo>
 
 //! This class represents the worksheet shown in the middle of the wxMaxima window.
 Worksheet::Worksheet(wxWindow *parent, int id, wxPoint position, wxSize size) :
@@ -85,7 +89,7 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint position, wxSize size) :
   }
   #endif
   SetMinClientSize(wxSize(100,100));
-  // This is somehow needed for wxAutoBufferedPaintDC
+  // We draw the background ourselves => don't let it flicker.
   SetBackgroundStyle(wxBG_STYLE_PAINT);
   SetBackgroundColour(*wxWHITE);
   m_virtualWidth_Last = -1;
@@ -103,7 +107,8 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint position, wxSize size) :
   m_pointer_y = -1;
   m_recalculateStart = NULL;
   m_mouseMotionWas = false;
-  m_rectToRefresh = wxRect(-1,-1,-1,-1);
+  m_overlayRectToRefresh = wxRect(-1,-1,-1,-1);
+  m_memoryValid = false;
   m_notificationMessage = NULL;
   m_configuration = &m_configurationTopInstance;
   m_configuration->SetBackgroundBrush(
@@ -114,8 +119,19 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint position, wxSize size) :
   m_autocomplete  = new AutoComplete(m_configuration);
   m_configuration->SetWorkSheet(this);
   m_configuration->ReadConfig();
-  m_redrawStart = NULL;
+  m_redrawStartY = -1;
   m_redrawRequested = false;
+  m_frameTimer.SetOwner(this, FRAME_TIMER_ID);
+  m_outputFlushTimer.SetOwner(this, OUTPUT_FLUSH_TIMER_ID);
+  m_groupWithBufferedOutput = NULL;
+  m_lastFrameTime = 0;
+  m_lastFrameDuration = 0;
+  m_framesDrawn = 0;
+  m_framesDeferred = 0;
+  m_frameTimeSum = 0;
+  m_slowestFrame = 0;
+  m_totalLayoutTime = 0;
+  m_totalDrawTime = 0;
   m_autocompletePopup = NULL;
 
   m_wxmFormat = wxDataFormat(wxT("text/x-wxmaxima-batch"));
@@ -190,7 +206,19 @@ bool Worksheet::RedrawIfRequested()
 {
   bool redrawIssued = false;
 
-  RecalculateIfNeeded();
+  // Nobody will ever see the worksheet => there is nothing to lay out or draw.
+  if (m_configuration->Headless())
+  {
+    m_redrawRequested = false;
+    m_regionToRefresh.Clear();
+    m_mouseMotionWas = false;
+    return false;
+  }
+
+  wxLongLong layoutStart = wxGetLocalTimeMillis();
+  bool layoutChanged = RecalculateIfNeeded();
+  long layoutTime = (wxGetLocalTimeMillis() - layoutStart).ToLong();
+  m_totalLayoutTime += layoutTime;
 
   if(m_mouseMotionWas)
   {
@@ -281,50 +309,87 @@ bool Worksheet::RedrawIfRequested()
     m_mouseMotionWas = false;
     redrawIssued = true;
   }
-  if (m_redrawRequested)
+  if(m_overlayRectToRefresh.GetLeft()>=0)
   {
-    Refresh();
-    m_redrawRequested = false;
-    m_redrawStart = NULL;
+    // Only the caret has changed => Bypass our Refresh() that would
+    // tell the backbuffer that its contents is outdated.
+    CalcScrolledPosition(m_overlayRectToRefresh.x, m_overlayRectToRefresh.y,
+                         &m_overlayRectToRefresh.x, &m_overlayRectToRefresh.y);
+    wxScrolled<wxWindow>::Refresh(false, &m_overlayRectToRefresh);
     redrawIssued = true;
-    m_rectToRefresh = wxRect(-1, -1, -1, -1);
   }
+  m_overlayRectToRefresh = wxRect(-1, -1, -1, -1);
+
+  if ((!m_redrawRequested) && m_regionToRefresh.IsEmpty())
+    return redrawIssued;
+
+  // Wait for the next frame. If drawing is slow we space the frames so that
+  // we draw at most half of the time.
+  long sinceLastFrame = (wxGetLocalTimeMillis() - m_lastFrameTime).ToLong();
+  long frameInterval = wxMax(m_frameInterval, 2 * m_lastFrameDuration);
+  // If the layout alone took longer than a frame the cells change faster than
+  // we can display them => skip this frame and let the layout catch up.
+  if (layoutChanged && (layoutTime > m_frameInterval))
+    frameInterval = wxMax(frameInterval, sinceLastFrame + m_frameInterval);
+  frameInterval = wxMin(frameInterval, m_maxFrameInterval);
+  if (sinceLastFrame < frameInterval)
+  {
+    m_framesDeferred++;
+    if (!m_frameTimer.IsRunning())
+      m_frameTimer.StartOnce(frameInterval - sinceLastFrame);
+    return redrawIssued;
+  }
+  m_lastFrameTime = wxGetLocalTimeMillis();
+
+  if (m_redrawRequested)
+  {
+    if (m_redrawStartY < 0)
+      m_regionToRefresh.Clear();
+    else
+    {
+      // Everything below the first cell that has changed might have moved.
+      int width, height, viewX, viewY, virtualWidth, virtualHeight;
+      GetClientSize(&width, &height);
+      CalcUnscrolledPosition(0, 0, &viewX, &viewY);
+      GetVirtualSize(&virtualWidth, &virtualHeight);
+      width = wxMax(virtualWidth, viewX + width);
+      height = wxMax(virtualHeight, viewY + height);
+      m_regionToRefresh.Union(wxRect(0, m_redrawStartY, width, height - m_redrawStartY));
+    }
+  }
+  if (m_redrawRequested && (m_redrawStartY < 0))
+    Refresh();
   else
   {
-    if(m_rectToRefresh.GetLeft()>=0)
+    for (wxRegionIterator it(m_regionToRefresh); it; ++it)
     {
-      CalcScrolledPosition(m_rectToRefresh.x, m_rectToRefresh.y, &m_rectToRefresh.x, &m_rectToRefresh.y);
-      RefreshRect(m_rectToRefresh);
-      redrawIssued = true;
+      wxRect rect = it.GetRect();
+      CalcScrolledPosition(rect.x, rect.y, &rect.x, &rect.y);
+      RefreshRect(rect);
     }
   }
-  m_rectToRefresh = wxRect(-1, -1, -1, -1);
+  m_redrawRequested = false;
+  m_redrawStartY = -1;
+  m_regionToRefresh.Clear();
 
-  return redrawIssued;
+  return true;
 }
 
 void Worksheet::RequestRedraw(GroupCell *start)
 {
-  m_redrawRequested = true;
+  // No need to waste time avoiding to waste time in a refresh when we don't
+  // know our cell's position.
+  long startY = -1;
+  if ((start != NULL) && (start != m_tree) && (start->GetCurrentPoint().y >= 0))
+    startY = wxMax(0, start->GetRect().GetTop() - m_configuration->GetGroupSkip());
 
-  if (start == 0)
-    m_redrawStart = m_tree;
+  if (!m_redrawRequested)
+    m_redrawStartY = startY;
+  else if ((startY < 0) || (m_redrawStartY < 0))
+    m_redrawStartY = -1;
   else
-  {
-    if (m_redrawStart != NULL)
-    {
-      // No need to waste time avoiding to waste time in a refresh when we don't
-      // know our cell's position.
-      if ((start->GetCurrentPoint().y < 0) || (m_redrawStart->GetCurrentPoint().y < 0))
-      {
-        m_redrawStart = m_tree;
-      }
-      else if (start->GetCurrentPoint().y < m_redrawStart->GetCurrentPoint().y)
-        m_redrawStart = start;
-    }
-    else
-      m_redrawStart = start;
-  }
+    m_redrawStartY = wxMin(m_redrawStartY, startY);
+  m_redrawRequested = true;
 
   // Make sure there is a timeout for the redraw
   if (!m_caretTimer.IsRunning())
@@ -351,187 +416,105 @@ Worksheet::~Worksheet()
   m_dc = NULL;
 }
 
-#if wxCHECK_VERSION(3, 1, 2)
-#define WORKING_DC_CLEAR 1
-#else
-#ifndef __WXGTK3__
-#define WORKING_DC_CLEAR 1
-#endif
-#endif
-
-#define WORKING_DC_CLEAR 1
-
-#ifdef __WXGTK__
-#if wxCHECK_VERSION(3, 1, 0)
-#else
-#define ANTIALIASSING_DC_NOT_CORRECTLY_SCROLLED 1
-#endif
-#endif    
-
-#define WORKING_AUTO_BUFFER 1
+void Worksheet::Refresh(bool eraseBackground, const wxRect *rect)
+{
+  // Everything that asks for a refresh has changed the worksheet's contents
+  // => the backbuffer no more matches the worksheet in this area.
+  if (rect == NULL)
+    m_memoryValid = false;
+  else
+  {
+    wxRect invalid(*rect);
+    CalcUnscrolledPosition(invalid.x, invalid.y, &invalid.x, &invalid.y);
+    m_memoryInvalid.Union(invalid);
+  }
+  wxScrolled<wxWindow>::Refresh(eraseBackground, rect);
+}
 
-void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
-{    
-  wxAutoBufferedPaintDC dc(this);
-  if(!dc.IsOk())
-    return;
-  
-  PrepareDC(dc);
+void Worksheet::PrepareBackbufferDC(wxDC &dc)
+{
+  double scale = wxWindow::GetContentScaleFactor();
+  dc.SetUserScale(scale, scale);
+  dc.SetLogicalOrigin(m_memoryOrigin.x, m_memoryOrigin.y);
+}
 
-  #if wxUSE_ACCESSIBILITY
-  if(m_accessibilityInfo != NULL)
-    m_accessibilityInfo->NotifyEvent(0, this, wxOBJID_CLIENT, wxOBJID_CLIENT);
-  #endif
-  // Don't attempt to refresh the screen as long as the result will
-  // end up on a printed page instead.
-  if ((!m_configuration->ClipToDrawRegion()) || (m_configuration->GetPrinting()))
+void Worksheet::ScrollBackbuffer(wxPoint viewOrigin)
+{
+  if ((!m_memoryScrolled.IsOk()) || (m_memoryScrolled.GetSize() != m_memory.GetSize()))
+    m_memoryScrolled = wxBitmap(m_memory.GetWidth(), m_memory.GetHeight(), wxBITMAP_SCREEN_DEPTH);
+  if (!m_memoryScrolled.IsOk())
   {
-    wxLogMessage(_("Suppressing a redraw during printing/export"));
-    RequestRedraw();
+    m_memoryValid = false;
     return;
   }
 
-  // Don't attempt to draw on a screen of the size 0.
-  if( (GetClientSize().x < 1) || (GetClientSize().y < 1))
-    return;
-
-  // Inform all cells how wide our display is
-  m_configuration->SetCanvasSize(GetClientSize());
+  wxSize size = GetClientSize();
+  {
+    // Overlapping blits within the same bitmap aren't portable => we copy the
+    // part that stays visible to a second bitmap and then swap both bitmaps.
+    wxMemoryDC source;
+    source.SelectObject(m_memory);
+    wxMemoryDC target;
+    target.SelectObject(m_memoryScrolled);
+    if ((!source.IsOk()) || (!target.IsOk()))
+    {
+      m_memoryValid = false;
+      return;
+    }
+    PrepareBackbufferDC(source);
+    PrepareBackbufferDC(target);
+    target.SetLogicalOrigin(viewOrigin.x, viewOrigin.y);
+    target.Blit(m_memoryOrigin.x, m_memoryOrigin.y, size.x, size.y,
+                &source, m_memoryOrigin.x, m_memoryOrigin.y);
+  }
+  wxBitmap oldMemory = m_memory;
+  m_memory = m_memoryScrolled;
+  m_memoryScrolled = oldMemory;
 
-  // Prepare data
-  wxRect rect = GetUpdateRegion().GetBox();
-  wxSize sz = GetSize();
-  int xstart, xend, top, bottom;
-  CalcUnscrolledPosition(rect.GetLeft(), rect.GetTop(), &xstart, &top);
-  CalcUnscrolledPosition(rect.GetRight(), rect.GetBottom(), &xend, &bottom);
-  wxRect updateRegion;
-  updateRegion.SetLeft(xstart);
-  updateRegion.SetRight(xend);
-  updateRegion.SetTop(top);
-  updateRegion.SetBottom(bottom);
-  m_configuration->SetUpdateRegion(updateRegion);
+  // Only the part that has just been scrolled into view needs to be drawn.
+  wxRegion exposed(wxRect(viewOrigin, size));
+  exposed.Subtract(wxRect(m_memoryOrigin, size));
+  m_memoryInvalid.Union(exposed);
+  m_memoryOrigin = viewOrigin;
+}
 
-#ifdef WORKING_AUTO_BUFFER
+void Worksheet::DrawBackbuffer(wxDC &dc, wxDC &antiAliassingDC, wxRect updateRegion)
+{
   m_configuration->SetContext(dc);
+  m_configuration->SetUpdateRegion(updateRegion);
+  dc.SetClippingRegion(updateRegion);
 
-  if ((sz.x < 1) || (sz.y < 1))
-    return;
-
-  // We might be triggered after someone changed the worksheet and before the idle
-  // loop caused it to be recalculated => Ensure all sizes and positions to be known
-  // before we proceed.
-  RecalculateIfNeeded();
-
-  // Create a graphics context that supports antialiassing, but on MSW
-  // only supports fonts that come in the Right Format.
-  wxGCDC antiAliassingDC(dc);
-  #else
-  wxMemoryDC dcm;
-  // Test if m_memory is NULL or of the wrong size
-  #ifdef __WXMAC__
-  if ((!m_memory.IsOk()) || (m_memory.GetSize() != sz))
-    m_memory = wxBitmap(sz*wxWindow::GetContentScaleFactor(),
-                        wxBITMAP_SCREEN_DEPTH,
-                        wxWindow::GetContentScaleFactor());
-  #else
-  if ((!m_memory.IsOk()) || (m_memory.GetSize() != sz))
-    m_memory = wxBitmap(sz*wxWindow::GetContentScaleFactor(), wxBITMAP_SCREEN_DEPTH);
-  #endif
-  if(!m_memory.IsOk())
-  {
-    m_configuration->SetContext(*m_dc);
-    return;
-  }
-  dcm.SetUserScale(wxWindow::GetContentScaleFactor(),wxWindow::GetContentScaleFactor());
-  dcm.SelectObject(m_memory);
-  if(!dcm.IsOk())
-  {
-    m_configuration->SetContext(*m_dc);
-    return;
-  }
-  DoPrepareDC(dcm);
-//  dcm.SetBackgroundMode(wxTRANSPARENT);
-  m_configuration->SetContext(dcm);
-  // Create a graphics context that supports antialiassing, but on MSW
-  // only supports fonts that come in the Right Format.
-  wxGCDC antiAliassingDC(dcm);
-  #endif
-  
   SetBackgroundColour(m_configuration->DefaultBackgroundColor());
 
-  // Clear the drawing area
-  m_configuration->GetDC()->SetBackground(m_configuration->GetBackgroundBrush());
-  m_configuration->GetDC()->SetBrush(m_configuration->GetBackgroundBrush());
-  m_configuration->GetDC()->SetPen(*wxTRANSPARENT_PEN);
-  m_configuration->GetDC()->SetLogicalFunction(wxCOPY);
-  // Clear the drawing area
-#if WORKING_DC_CLEAR
-  m_configuration->GetDC()->Clear();
-#else
-  m_configuration->GetDC()->DrawRectangle(updateRegion);
-#endif
+  // Clear the drawing area. Clear() would clear the whole bitmap including the
+  // parts that are still up-to-date.
+  dc.SetBackground(m_configuration->GetBackgroundBrush());
+  dc.SetBrush(m_configuration->GetBackgroundBrush());
+  dc.SetPen(*wxTRANSPARENT_PEN);
+  dc.SetLogicalFunction(wxCOPY);
+  dc.DrawRectangle(updateRegion);
 
-  //
-  // Draw the horizontal caret
-  //
-  if ((m_hCaretActive) &&
-      (m_hCaretPositionStart == NULL) &&
-      (m_hCaretBlinkVisible) &&
-      (m_hasFocus) &&
-      (m_hCaretPosition != NULL))
-  {
-    m_configuration->GetDC()->SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_CURSOR), 1, wxPENSTYLE_SOLID)));
-    m_configuration->GetDC()->SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
-    
-    wxRect currentGCRect = m_hCaretPosition->GetRect();
-    int caretY = ((int) m_configuration->GetGroupSkip()) / 2 + currentGCRect.GetBottom() + 1;
-    m_configuration->GetDC()->DrawRectangle(xstart + m_configuration->GetBaseIndent(),
-                     caretY - m_configuration->GetCursorWidth() / 2,
-                     MC_HCARET_WIDTH, m_configuration->GetCursorWidth());
-  }
-  
-  if ((m_hCaretActive) && (m_hCaretPositionStart == NULL) && (m_hasFocus) && (m_hCaretPosition == NULL))
-  {
-    if (!m_hCaretBlinkVisible)
-    {
-      m_configuration->GetDC()->SetBrush(m_configuration->GetBackgroundBrush());
-      m_configuration->GetDC()->SetPen(*wxThePenList->FindOrCreatePen(GetBackgroundColour(), m_configuration->Scale_Px(1)));
-    }
-    else
-    {
-      m_configuration->GetDC()->SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_CURSOR), m_configuration->Scale_Px(1), wxPENSTYLE_SOLID)));
-      m_configuration->GetDC()->SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
-    }
-    
-    wxRect cursor = wxRect(xstart + m_configuration->GetCellBracketWidth(),
-                           (m_configuration->GetBaseIndent() - m_configuration->GetCursorWidth()) / 2,
-                           MC_HCARET_WIDTH, m_configuration->GetCursorWidth());
-    m_configuration->GetDC()->DrawRectangle(cursor);
-  }
-  
   if (m_tree == NULL)
   {
-    m_configuration->SetContext(*m_dc);
+    dc.DestroyClippingRegion();
     return;
   }
-  
+
   if(antiAliassingDC.IsOk())
   {
-#ifdef ANTIALIASSING_DC_NOT_CORRECTLY_SCROLLED
-    PrepareDC(antiAliassingDC);
-#endif    
+    antiAliassingDC.SetClippingRegion(updateRegion);
     m_configuration->SetAntialiassingDC(antiAliassingDC);
   }
-  
+
   //
   // Draw the selection marks
   //
   if (CellsSelected())
   {
     Cell *tmp = m_cellPointers.m_selectionStart;
-    m_configuration->GetDC()->SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_SELECTION), 1, wxPENSTYLE_SOLID)));
-    m_configuration->GetDC()->SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_SELECTION))));
-    
+    dc.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_SELECTION), 1, wxPENSTYLE_SOLID)));
+    dc.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_SELECTION))));
+
     // Draw the marker that tells us which output cells are selected -
     // if output cells are selected, that is.
     if (m_cellPointers.m_selectionStart->GetType() != MC_TYPE_GROUP)
@@ -548,8 +531,8 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   }
 
   // Don't fill the text background with the background color
-  m_configuration->GetDC()->SetMapMode(wxMM_TEXT);
-  
+  dc.SetMapMode(wxMM_TEXT);
+
   //
   // Draw the cell contents
   //
@@ -558,12 +541,26 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   point.y = m_configuration->GetBaseIndent() + m_tree->GetMaxCenter();
   // Draw tree
   GroupCell *tmp = m_tree;
-  
-  m_configuration->GetDC()->SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_DEFAULT), 1, wxPENSTYLE_SOLID)));
-  m_configuration->GetDC()->SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_DEFAULT))));
-  
+
+  dc.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_DEFAULT), 1, wxPENSTYLE_SOLID)));
+  dc.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_DEFAULT))));
+
   bool recalculateNecessaryWas = false;
-  
+
+  int top = updateRegion.GetTop();
+  int bottom = updateRegion.GetBottom();
+  int width;
+  int height;
+  GetClientSize(&width, &height);
+
+  wxPoint upperLeftScreenCorner;
+  CalcScrolledPosition(0, 0,
+                       &upperLeftScreenCorner.x, &upperLeftScreenCorner.y);
+  (m_configuration)->SetVisibleRegion(wxRect(upperLeftScreenCorner,
+                                             upperLeftScreenCorner + wxPoint(width,height)));
+  (m_configuration)->SetWorksheetPosition(GetPosition());
+
+  m_configuration->CacheOutput(true);
   while (tmp != NULL)
   {
     if(
@@ -576,19 +573,9 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
       tmp->Recalculate();
       recalculateNecessaryWas = true;
     }
-    
+
     wxRect cellRect = tmp->GetRect();
-    
-    int width;
-    int height;
-    GetClientSize(&width, &height);
-    
-    wxPoint upperLeftScreenCorner;
-    CalcScrolledPosition(0, 0,
-                         &upperLeftScreenCorner.x, &upperLeftScreenCorner.y);
-    (m_configuration)->SetVisibleRegion(wxRect(upperLeftScreenCorner,
-                                               upperLeftScreenCorner + wxPoint(width,height)));
-    (m_configuration)->SetWorksheetPosition(GetPosition());
+
     // Clear the image cache of all cells above or below the viewport.
     if ((cellRect.GetTop() >= bottom) || (cellRect.GetBottom() <= top))
     {
@@ -601,7 +588,7 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
           tmp->GetOutput()->ClearCacheList();
       }
     }
-    
+
     tmp->SetCurrentPoint(point);
     if (tmp->DrawThisCell(point))
     {
@@ -616,21 +603,180 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
       point = tmp->GetCurrentPoint();
     }
   }
-  
+
+  m_configuration->CacheOutput(false);
+
   if(recalculateNecessaryWas)
     wxLogMessage(_("Cell wasn't recalculated on draw!"));
-  
-  #ifndef WORKING_AUTO_BUFFER
-  // Blit the memory image to the window
-  dcm.SetDeviceOrigin(0, 0);
-  dc.Blit(0, rect.GetTop(), sz.x, rect.GetBottom() - rect.GetTop() + 1, &dcm,
-          0, rect.GetTop());
+
+  m_configuration->UnsetAntialiassingDC();
+  if(antiAliassingDC.IsOk())
+    antiAliassingDC.DestroyClippingRegion();
+  dc.DestroyClippingRegion();
+}
+
+void Worksheet::DrawOverlay(wxDC &dc, wxPoint viewOrigin)
+{
+  m_configuration->SetContext(dc);
+
+  //
+  // Draw the horizontal caret
+  //
+  if ((m_hCaretActive) &&
+      (m_hCaretPositionStart == NULL) &&
+      (m_hCaretBlinkVisible) &&
+      (m_hasFocus) &&
+      (m_hCaretPosition != NULL))
+  {
+    dc.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_CURSOR), 1, wxPENSTYLE_SOLID)));
+    dc.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
+
+    wxRect currentGCRect = m_hCaretPosition->GetRect();
+    int caretY = ((int) m_configuration->GetGroupSkip()) / 2 + currentGCRect.GetBottom() + 1;
+    dc.DrawRectangle(viewOrigin.x + m_configuration->GetBaseIndent(),
+                     caretY - m_configuration->GetCursorWidth() / 2,
+                     MC_HCARET_WIDTH, m_configuration->GetCursorWidth());
+  }
+
+  if ((m_hCaretActive) && (m_hCaretPositionStart == NULL) && (m_hasFocus) &&
+      (m_hCaretPosition == NULL) && (m_hCaretBlinkVisible))
+  {
+    dc.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_CURSOR), m_configuration->Scale_Px(1), wxPENSTYLE_SOLID)));
+    dc.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_CURSOR), wxBRUSHSTYLE_SOLID)));
+
+    wxRect cursor = wxRect(viewOrigin.x + m_configuration->GetCellBracketWidth(),
+                           (m_configuration->GetBaseIndent() - m_configuration->GetCursorWidth()) / 2,
+                           MC_HCARET_WIDTH, m_configuration->GetCursorWidth());
+    dc.DrawRectangle(cursor);
+  }
+
+  //
+  // Draw the vertical caret
+  //
+  if (GetActiveCell() != NULL)
+    GetActiveCell()->DrawCaret();
+}
+
+void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
+{
+  // The backbuffer already is a buffer => no need to buffer the window, too.
+  wxPaintDC dc(this);
+  if(!dc.IsOk())
+    return;
+
+  PrepareDC(dc);
+
+  #if wxUSE_ACCESSIBILITY
+  if(m_accessibilityInfo != NULL)
+    m_accessibilityInfo->NotifyEvent(0, this, wxOBJID_CLIENT, wxOBJID_CLIENT);
   #endif
-  
+  // Don't attempt to refresh the screen as long as the result will
+  // end up on a printed page instead.
+  if ((!m_configuration->ClipToDrawRegion()) || (m_configuration->GetPrinting()))
+  {
+    wxLogMessage(_("Suppressing a redraw during printing/export"));
+    RequestRedraw();
+    return;
+  }
+
+  // Don't attempt to draw on a screen of the size 0.
+  wxSize sz = GetClientSize();
+  if( (sz.x < 1) || (sz.y < 1))
+    return;
+
+  // Inform all cells how wide our display is
+  m_configuration->SetCanvasSize(sz);
+
+  // We might be triggered after someone changed the worksheet and before the idle
+  // loop caused it to be recalculated => Ensure all sizes and positions to be known
+  // before we proceed.
+  RecalculateIfNeeded();
+
+  // The part of the window we were asked to update, in worksheet coordinates
+  wxRect rect = GetUpdateRegion().GetBox();
+  wxRect updateRegion(rect);
+  CalcUnscrolledPosition(rect.GetLeft(), rect.GetTop(), &updateRegion.x, &updateRegion.y);
+  wxPoint viewOrigin;
+  CalcUnscrolledPosition(0, 0, &viewOrigin.x, &viewOrigin.y);
+  wxRect visibleRegion(viewOrigin, sz);
+
+  //
+  // Bring the backbuffer up to date
+  //
+  double scale = wxWindow::GetContentScaleFactor();
+  wxSize bufferSize((int) (sz.x * scale), (int) (sz.y * scale));
+  if ((!m_memory.IsOk()) || (m_memory.GetSize() != bufferSize))
+  {
+    #ifdef __WXMAC__
+    // On retina displays the bitmap needs to know its scale factor.
+    m_memory = wxBitmap(sz * scale, wxBITMAP_SCREEN_DEPTH, scale);
+    #else
+    m_memory = wxBitmap(bufferSize.x, bufferSize.y, wxBITMAP_SCREEN_DEPTH);
+    #endif
+    m_memoryValid = false;
+  }
+  if(!m_memory.IsOk())
+  {
+    m_configuration->SetContext(*m_dc);
+    return;
+  }
+  if (m_memoryValid && (viewOrigin != m_memoryOrigin))
+    ScrollBackbuffer(viewOrigin);
+  if (!m_memoryValid)
+  {
+    m_memoryInvalid = wxRegion(visibleRegion);
+    m_memoryOrigin = viewOrigin;
+    m_memoryValid = true;
+  }
+  m_memoryInvalid.Intersect(visibleRegion);
+
+  wxMemoryDC dcm;
+  dcm.SelectObject(m_memory);
+  if(!dcm.IsOk())
+  {
+    m_configuration->SetContext(*m_dc);
+    return;
+  }
+  PrepareBackbufferDC(dcm);
+
+  if (!m_memoryInvalid.IsEmpty())
+  {
+    wxLongLong frameStart = wxGetLocalTimeMillis();
+
+    // Create a graphics context that supports antialiassing, but on MSW
+    // only supports fonts that come in the Right Format.
+    wxGCDC antiAliassingDC(dcm);
+    if(antiAliassingDC.IsOk())
+      PrepareBackbufferDC(antiAliassingDC);
+
+    // Drawing each rectangle of the invalid region separately means iterating
+    // over all GroupCells once per rectangle => only worth it for a few of them.
+    std::vector<wxRect> invalidRects;
+    for (wxRegionIterator it(m_memoryInvalid); it; ++it)
+      invalidRects.push_back(it.GetRect());
+    if (invalidRects.size() > m_maxRectsPerFrame)
+    {
+      invalidRects.clear();
+      invalidRects.push_back(m_memoryInvalid.GetBox());
+    }
+    for (std::vector<wxRect>::iterator it = invalidRects.begin(); it != invalidRects.end(); ++it)
+      DrawBackbuffer(dcm, antiAliassingDC, *it);
+    m_memoryInvalid.Clear();
+
+    FrameDrawn((wxGetLocalTimeMillis() - frameStart).ToLong());
+  }
+
+  //
+  // Copy the cell contents to the window and add the caret on top of them
+  //
+  dc.Blit(updateRegion.x, updateRegion.y, updateRegion.width, updateRegion.height,
+          &dcm, updateRegion.x, updateRegion.y);
+  DrawOverlay(dc, viewOrigin);
+
   m_configuration->SetContext(*m_dc);
   m_configuration->UnsetAntialiassingDC();
-  m_lastTop = top;
-  m_lastBottom = bottom;
+  m_lastTop = updateRegion.GetTop();
+  m_lastBottom = updateRegion.GetBottom();
 }
 
 GroupCell *Worksheet::InsertGroupCells(GroupCell *cells, GroupCell *where)
@@ -808,23 +954,15 @@ void Worksheet::InsertLine(Cell *newCell, bool forceNewLine)
   if (m_tree->Contains(tmp))
   {
     newCell->ForceBreakLine(forceNewLine);
-    newCell->SetGroupList(tmp);
-
-    tmp->AppendOutput(newCell);
 
-    UpdateConfigurationClientSize();
+    // Output that is meant for another cell has to be displayed first.
+    if (m_groupWithBufferedOutput != tmp)
+      FlushBufferedOutput();
 
-    tmp->RecalculateAppended();
-
-    if (FollowEvaluation())
-    {
-      SetSelection(NULL);
-      if (GCContainsCurrentQuestion(tmp))
-        OpenQuestionCaret();
-      else
-        ScrollToCaret();
-    }
-    RequestRedraw(tmp);
+    tmp->BufferOutput(newCell);
+    m_groupWithBufferedOutput = tmp;
+    if (!m_outputFlushTimer.IsRunning())
+      m_outputFlushTimer.StartOnce(m_frameInterval);
   }
   else
   {
@@ -832,6 +970,50 @@ void Worksheet::InsertLine(Cell *newCell, bool forceNewLine)
   }
 }
 
+void Worksheet::OutputCellChanged(Cell *cell)
+{
+  GroupCell *group = dynamic_cast<GroupCell *>(cell->GetGroup());
+  if (group == NULL)
+    return;
+
+  if (m_groupWithBufferedOutput != group)
+    FlushBufferedOutput();
+
+  group->BufferOutputChange(cell);
+  m_groupWithBufferedOutput = group;
+  if (!m_outputFlushTimer.IsRunning())
+    m_outputFlushTimer.StartOnce(m_frameInterval);
+}
+
+void Worksheet::FlushBufferedOutput()
+{
+  m_outputFlushTimer.Stop();
+  GroupCell *group = m_groupWithBufferedOutput;
+  m_groupWithBufferedOutput = NULL;
+
+  // The cell might have been deleted while the output was waiting.
+  if ((group == NULL) || (m_tree == NULL) || (!m_tree->Contains(group)))
+    return;
+
+  // If the user looks at the caret the new output mustn't push it out of sight.
+  bool scrollToCaret = (!FollowEvaluation()) && CaretVisibleIs();
+  UpdateConfigurationClientSize();
+  if (!group->FlushBufferedOutput())
+    return;
+
+  if (FollowEvaluation())
+  {
+    SetSelection(NULL);
+    if (GCContainsCurrentQuestion(group))
+      OpenQuestionCaret();
+    else
+      ScrollToCaret();
+  }
+  else if (scrollToCaret)
+    ScrollToCaret();
+  RequestRedraw(group);
+}
+
 void Worksheet::SetZoomFactor(double newzoom, bool recalc)
 {
   // Restrict zoom factors to tenths
@@ -888,6 +1070,12 @@ bool Worksheet::RecalculateIfNeeded()
   if(m_dc == NULL)
     recalculate = false;
 
+  if(m_configuration->Headless())
+  {
+    m_recalculateStart = NULL;
+    return false;
+  }
+
   if(!recalculate)
   {
     if(m_configuration->AdjustWorksheetSize())
@@ -1668,6 +1856,12 @@ void Worksheet::OnMouseRightDown(wxMouseEvent &event)
             popupMenu->Append(popid_fold,
                               _("Hide contents"), wxEmptyString, wxITEM_NORMAL);
       }
+      if (group->IsFoldable())
+      {
+        popupMenu->AppendCheckItem(popid_independent, _("Independent of the Rest of the Worksheet"),
+                                   _("Allow evaluating this part of the worksheet in an additional maxima process"));
+        popupMenu->Check(popid_independent, group->Independent());
+      }
     }
   }
   // create menu if we have any items
@@ -2942,6 +3136,9 @@ void Worksheet::OpenQuestionCaret(wxString txt)
   if(group == NULL)
     return;
 
+  // The answer has to be placed below the question.
+  FlushBufferedOutput();
+
   // We are leaving the input part of the current cell in this step.
   TreeUndo_CellLeft();
 
@@ -4466,6 +4663,14 @@ void Worksheet::OnTimer(wxTimerEvent &event)
       m_timer.Start(50, true);
     }
     break;
+  case OUTPUT_FLUSH_TIMER_ID:
+    FlushBufferedOutput();
+    break;
+  case FRAME_TIMER_ID:
+    // A redraw request has waited for this frame => make sure the idle loop
+    // that issues it runs.
+    wxWakeUpIdle();
+    break;
   case CARET_TIMER_ID:
     {
       int virtualsize_x;
@@ -4499,7 +4704,7 @@ void Worksheet::OnTimer(wxTimerEvent &event)
         }
         rect.SetLeft(0);
         rect.SetRight(virtualsize_x + m_configuration->Scale_Px(10));
-        RequestRedraw(rect);
+        RequestOverlayRedraw(rect);
       }
 
       // We only blink the cursor if we have the focus => If we loose the focus
@@ -4551,10 +4756,85 @@ void Worksheet::OnTimer(wxTimerEvent &event)
 
 void Worksheet::RequestRedraw(wxRect rect)
 {
-  if(m_rectToRefresh.IsEmpty())
-    m_rectToRefresh = rect;
+  m_regionToRefresh.Union(rect);
+
+  // Many small rectangles would make iterating over the region more expensive
+  // than redrawing the area between them.
+  size_t rects = 0;
+  for (wxRegionIterator it(m_regionToRefresh); it; ++it)
+    rects++;
+  if (rects > m_maxRectsPerFrame)
+    m_regionToRefresh = wxRegion(m_regionToRefresh.GetBox());
+}
+
+void Worksheet::FrameDrawn(long duration)
+{
+  m_lastFrameDuration = duration;
+  m_framesDrawn++;
+  m_frameTimeSum += duration;
+  m_totalDrawTime += duration;
+  if (duration > m_slowestFrame)
+    m_slowestFrame = duration;
+
+  if (m_framesDrawn >= m_framesPerStatistics)
+  {
+    wxLogDebug(wxString::Format(_("Drew %li frames in %li ms (slowest: %li ms). %li redraw requests waited for the next frame."),
+                                m_framesDrawn, m_frameTimeSum, m_slowestFrame, m_framesDeferred));
+    m_framesDrawn = 0;
+    m_framesDeferred = 0;
+    m_frameTimeSum = 0;
+    m_slowestFrame = 0;
+  }
+}
+
+void Worksheet::RequestOverlayRedraw(wxRect rect)
+{
+  if(m_overlayRectToRefresh.IsEmpty())
+    m_overlayRectToRefresh = rect;
   else
-    m_rectToRefresh = m_rectToRefresh.Union(rect);
+    m_overlayRectToRefresh = m_overlayRectToRefresh.Union(rect);
+}
+
+//! Adds the cells in a list of cells and all cells they contain to a memory report
+static void CountCellMemory(Cell *cell, std::map<wxString, long> &cells,
+                            std::map<wxString, size_t> &bytes)
+{
+  while (cell != NULL)
+  {
+    // Compilers decorate the class name: g++ prefixes it with its length and
+    // MSVC with "class ".
+    wxString type = wxString(typeid(*cell).name()).AfterLast(wxT(' '));
+    while ((type.Length() > 1) && (wxIsdigit(type[0])))
+      type = type.Mid(1);
+
+    cells[type]++;
+    bytes[type] += cell->SizeInBytes();
+    for (int i = 0; i < cell->GetInnerCellCount(); i++)
+      CountCellMemory(cell->GetInnerCell(i), cells, bytes);
+    cell = cell->m_next;
+  }
+}
+
+wxString Worksheet::MemoryReport()
+{
+  std::map<wxString, long> cells;
+  std::map<wxString, size_t> bytes;
+  CountCellMemory(m_tree, cells, bytes);
+
+  long totalCells = 0;
+  size_t totalBytes = 0;
+  wxString report = _("Memory used by the cells of the worksheet:\n");
+  for (std::map<wxString, long>::iterator it = cells.begin(); it != cells.end(); ++it)
+  {
+    report += wxString::Format(_("  %s: %li cells, %lu bytes\n"),
+                               it->first, it->second, (unsigned long) bytes[it->first]);
+    totalCells += it->second;
+    totalBytes += bytes[it->first];
+  }
+  report += wxString::Format(_("  Total: %li cells, %lu bytes. The cell pool has reserved %lu bytes."),
+                             totalCells, (unsigned long) totalBytes,
+                             (unsigned long) CellPool::BytesReserved());
+  return report;
 }
 
 /***
@@ -4566,6 +4846,7 @@ void Worksheet::DestroyTree()
   SetHCaret(NULL);
   TreeUndo_ClearUndoActionList();
   TreeUndo_ClearRedoActionList();
+  m_groupWithBufferedOutput = NULL;
   wxDELETE(m_tree);
   m_tree = m_last = NULL;
 }
@@ -6952,6 +7233,185 @@ void Worksheet::AddEntireDocumentToEvaluationQueue()
   SetHCaret(m_last);
 }
 
+void Worksheet::AddStaleCellsToEvaluationQueue()
+{
+  FollowEvaluation(true);
+  SymbolGenerations definedSymbols;
+  unsigned long unpredictableGeneration = 0;
+  AddStaleCellsToEvaluationQueue(m_tree, definedSymbols, unpredictableGeneration);
+}
+
+void Worksheet::AddStaleCellsToEvaluationQueue(GroupCell *start, SymbolGenerations &definedSymbols,
+                                               unsigned long &unpredictableGeneration)
+{
+  for (GroupCell *tmp = start; tmp != NULL; tmp = dynamic_cast<GroupCell *>(tmp->m_next))
+  {
+    if (tmp->GetGroupType() == GC_TYPE_CODE)
+    {
+      wxArrayString defines;
+      wxArrayString uses;
+      bool predictable = tmp->GetDependencies(defines, uses);
+      unsigned long generation = tmp->GetEvaluationGeneration();
+
+      bool stale = (generation < unpredictableGeneration) || tmp->InputChanged() ||
+                   m_cellPointers.m_errorList.Contains(tmp);
+      // Did a cell above define a symbol we use after we have been evaluated?
+      for (size_t i = 0; (i < uses.GetCount()) && (!stale); i++)
+      {
+        SymbolGenerations::iterator it = definedSymbols.find(uses[i]);
+        if ((it != definedSymbols.end()) && (it->second > generation))
+          stale = true;
+      }
+      // If a cell above is about to change a symbol we define our definition
+      // has to be repeated for the cells below us.
+      for (size_t i = 0; (i < defines.GetCount()) && (!stale); i++)
+      {
+        SymbolGenerations::iterator it = definedSymbols.find(defines[i]);
+        if ((it != definedSymbols.end()) && (it->second == ULONG_MAX))
+          stale = true;
+      }
+
+      if (stale)
+      {
+        AddToEvaluationQueue(tmp);
+        generation = ULONG_MAX;
+      }
+      for (size_t i = 0; i < defines.GetCount(); i++)
+        definedSymbols[defines[i]] = generation;
+      if ((!predictable) && (generation > unpredictableGeneration))
+        unpredictableGeneration = generation;
+    }
+    if (tmp->GetHiddenTree() != NULL)
+      AddStaleCellsToEvaluationQueue(tmp->GetHiddenTree(), definedSymbols, unpredictableGeneration);
+  }
+}
+
+//! A FNV-1a hash of a string
+static wxString HashString(const wxString &str)
+{
+  wxScopedCharBuffer const data = str.utf8_str();
+  wxUint64 hash = wxULL(14695981039346656037);
+  for (size_t i = 0; i < data.length(); i++)
+  {
+    hash ^= (unsigned char) data.data()[i];
+    hash *= wxULL(1099511628211);
+  }
+  return wxString::Format(wxT("%016") wxLongLongFmtSpec wxT("x"), hash);
+}
+
+/*! Does a cell call only functions whose results depend on nothing but their arguments?
+
+  Functions like depends(), tellsimp(), infix() or set_random_state() don't
+  assign anything but still change what maxima answers to the cells below
+  them. Functions the user has defined might do anything.
+ */
+static bool CallsOnlyPureFunctions(GroupCell *cell)
+{
+  static const wxString pureFunctions[] = {
+    wxT("sin"), wxT("cos"), wxT("tan"), wxT("cot"), wxT("sec"), wxT("csc"),
+    wxT("asin"), wxT("acos"), wxT("atan"), wxT("atan2"),
+    wxT("sinh"), wxT("cosh"), wxT("tanh"), wxT("asinh"), wxT("acosh"), wxT("atanh"),
+    wxT("exp"), wxT("log"), wxT("sqrt"), wxT("abs"), wxT("signum"),
+    wxT("floor"), wxT("ceiling"), wxT("round"), wxT("truncate"), wxT("mod"),
+    wxT("max"), wxT("min"), wxT("gcd"), wxT("lcm"), wxT("factorial"),
+    wxT("binomial"), wxT("gamma"), wxT("beta"), wxT("erf"),
+    wxT("realpart"), wxT("imagpart"), wxT("conjugate"), wxT("cabs"), wxT("carg"),
+    wxT("rectform"), wxT("polarform"),
+    wxT("float"), wxT("bfloat"), wxT("rat"), wxT("ratsimp"), wxT("fullratsimp"),
+    wxT("radcan"), wxT("expand"), wxT("factor"), wxT("gfactor"), wxT("partfrac"),
+    wxT("trigsimp"), wxT("trigexpand"), wxT("trigreduce"), wxT("logcontract"),
+    wxT("num"), wxT("denom"), wxT("coeff"), wxT("hipow"), wxT("lopow"),
+    wxT("lhs"), wxT("rhs"), wxT("part"), wxT("subst"), wxT("ratsubst"),
+    wxT("diff"), wxT("integrate"), wxT("limit"), wxT("taylor"), wxT("sum"),
+    wxT("product"), wxT("solve"), wxT("linsolve"), wxT("algsys"),
+    wxT("allroots"), wxT("realroots"), wxT("divide"), wxT("quotient"),
+    wxT("remainder"), wxT("primep"), wxT("ifactors"), wxT("divisors"),
+    wxT("matrix"), wxT("determinant"), wxT("invert"), wxT("transpose"),
+    wxT("rank"), wxT("eigenvalues"), wxT("eigenvectors"), wxT("ident"),
+    wxT("zeromatrix"), wxT("row"), wxT("col"),
+    wxT("length"), wxT("first"), wxT("second"), wxT("third"), wxT("last"),
+    wxT("rest"), wxT("append"), wxT("cons"), wxT("endcons"), wxT("reverse"),
+    wxT("sort"), wxT("unique"), wxT("makelist"), wxT("create_list"),
+    wxT("flatten"), wxT("sublist"), wxT("member"), wxT("listp"), wxT("numberp"),
+    wxT("integerp"), wxT("stringp"), wxT("atom"), wxT("freeof"), wxT("is"),
+    wxT("equal"), wxT("notequal"), wxT("string"), wxT("concat"), wxT("sconcat"),
+    wxT("print"), wxT("display"), wxT("ldisplay"), wxT("disp"), wxT("ldisp"),
+    wxT("if"), wxT("then"), wxT("else"), wxT("elseif"), wxT("and"), wxT("or"),
+    wxT("not"), wxT("for"), wxT("do"), wxT("while"), wxT("unless"),
+    wxT("thru"), wxT("step"), wxT("in")
+  };
+  static const size_t pureFunctionCount = sizeof(pureFunctions) / sizeof(pureFunctions[0]);
+
+  std::vector<MaximaTokenizer::Token *> tokens = cell->GetCodeTokens();
+  for (size_t i = 0; i < tokens.size(); i++)
+  {
+    if (tokens[i]->GetStyle() != TS_CODE_FUNCTION)
+      continue;
+    bool pure = false;
+    for (size_t j = 0; (j < pureFunctionCount) && (!pure); j++)
+      if (tokens[i]->GetText() == pureFunctions[j])
+        pure = true;
+    if (!pure)
+      return false;
+  }
+  return true;
+}
+
+void Worksheet::UpdateInputKeys()
+{
+  SymbolKeys symbolKeys;
+  wxString barrier;
+  UpdateInputKeys(m_tree, symbolKeys, barrier);
+}
+
+void Worksheet::UpdateInputKeys(GroupCell *start, SymbolKeys &symbolKeys, wxString &barrier)
+{
+  for (GroupCell *tmp = start; tmp != NULL; tmp = dynamic_cast<GroupCell *>(tmp->m_next))
+  {
+    if ((tmp->GetGroupType() == GC_TYPE_CODE) && (tmp->GetEditable() != NULL))
+    {
+      wxArrayString defines;
+      wxArrayString uses;
+      size_t unattributedAssignments = 0;
+      bool predictable = tmp->GetDependencies(defines, uses, &unattributedAssignments);
+      // Whatever else a function does is as unpredictable as a kill() is.
+      if (!CallsOnlyPureFunctions(tmp))
+        predictable = false;
+      uses.Sort();
+
+      wxString key = tmp->GetEditable()->GetValue() + wxT('\x1f') + barrier;
+      // A cell that assigns anything can only be skipped if we know what it
+      // assigns to. As cells that define something aren't cached, either, this
+      // means: Only cells without :, ::, := or ::= are cacheable.
+      bool cacheable = predictable && defines.IsEmpty() && (unattributedAssignments == 0);
+      for (size_t i = 0; i < uses.GetCount(); i++)
+      {
+        // Output labels change their meaning if cells are skipped.
+        if ((uses[i] == wxT("%")) || (uses[i] == wxT("%%")) ||
+            (uses[i] == wxT("_")) || (uses[i] == wxT("__")) ||
+            uses[i].StartsWith(wxT("%o")) || uses[i].StartsWith(wxT("%i")) ||
+            uses[i].StartsWith(wxT("%th")))
+          cacheable = false;
+        SymbolKeys::iterator definition = symbolKeys.find(uses[i]);
+        if (definition != symbolKeys.end())
+          key += wxT('\x1f') + uses[i] + wxT('=') + definition->second;
+      }
+      key = HashString(key);
+
+      if (cacheable)
+        tmp->InputKey(key);
+      else
+        tmp->InputKey(wxEmptyString);
+      for (size_t i = 0; i < defines.GetCount(); i++)
+        symbolKeys[defines[i]] = key;
+      if (!predictable)
+        barrier = key;
+    }
+    if (tmp->GetHiddenTree() != NULL)
+      UpdateInputKeys(tmp->GetHiddenTree(), symbolKeys, barrier);
+  }
+}
+
 void Worksheet::AddSectionToEvaluationQueue(GroupCell *start)
 {
   // Find the begin of the current section
@@ -6962,6 +7422,32 @@ void Worksheet::AddSectionToEvaluationQueue(GroupCell *start)
   AddSelectionToEvaluationQueue(start, end);
 }
 
+void Worksheet::GetIndependentSections(std::list<std::list<GroupCell *> > &sections)
+{
+  GroupCell *tmp = m_tree;
+  while (tmp != NULL)
+  {
+    if (!(tmp->IsFoldable() && tmp->Independent()))
+    {
+      tmp = dynamic_cast<GroupCell *>(tmp->m_next);
+      continue;
+    }
+
+    int sectionType = tmp->GetGroupType();
+    std::list<GroupCell *> section;
+    tmp = dynamic_cast<GroupCell *>(tmp->m_next);
+    while ((tmp != NULL) && IsLesserGCType(tmp->GetGroupType(), sectionType))
+    {
+      if ((tmp->GetGroupType() == GC_TYPE_CODE) && (tmp->GetEditable() != NULL) &&
+          (!tmp->GetEditable()->GetValue().IsEmpty()))
+        section.push_back(tmp);
+      tmp = dynamic_cast<GroupCell *>(tmp->m_next);
+    }
+    if (!section.empty())
+      sections.push_back(section);
+  }
+}
+
 void Worksheet::AddRestToEvaluationQueue()
 {
   GroupCell *start = NULL;
@@ -7315,6 +7801,10 @@ bool Worksheet::TreeUndoTextChange(std::list<TreeUndoAction *> *sourcelist, std:
       return TreeUndo(sourcelist, undoForThisOperation);
     }
 
+    // Maxima already has been sent commands from this cell.
+    if (m_evaluationQueue.IsSentAhead(action->m_start))
+      return false;
+
     // Document the old state of this cell so the next action can be undone.
     TreeUndoAction *undoAction = new TreeUndoAction;
     undoAction->m_start = action->m_start;
@@ -7399,6 +7889,12 @@ void Worksheet::SetActiveCell(EditorCell *cell, bool callRefresh)
   if(GetActiveCell() == cell)
     return;
 
+  // Maxima already has been sent commands from this cell => it mustn't be
+  // edited until it has been evaluated.
+  if ((cell != NULL) &&
+      m_evaluationQueue.IsSentAhead(dynamic_cast<GroupCell *>(cell->GetGroup())))
+    return;
+
   if (GetActiveCell() != NULL)
     TreeUndo_CellLeft();
 
@@ -8142,11 +8638,15 @@ bool Worksheet::FindIncremental(wxString str, bool down, bool ignoreCase)
     return true;
 }
 
-bool Worksheet::FindNext(wxString str, bool down, bool ignoreCase, bool warn)
+bool Worksheet::FindNext(wxString str, bool down, bool ignoreCase, bool warn, bool regex)
 {
   if (m_tree == NULL)
     return false;
 
+  wxRegEx searchRegex;
+  if (regex && !searchRegex.Compile(str, FindReplaceEngine::RegexFlags(ignoreCase)))
+    return false;
+
   GroupCell *pos;
   int starty;
   if (down)
@@ -8216,7 +8716,11 @@ bool Worksheet::FindNext(wxString str, bool down, bool ignoreCase, bool warn)
 
     if (editor != NULL)
     {
-      bool found = editor->FindNext(str, down, ignoreCase);
+      bool found;
+      if (regex)
+        found = editor->FindNext(searchRegex, down);
+      else
+        found = editor->FindNext(str, down, ignoreCase);
 
       if (found)
       {
@@ -8325,10 +8829,28 @@ void Worksheet::ScrollToCaret()
   }
 }
 
-void Worksheet::Replace(wxString oldString, wxString newString, bool ignoreCase)
+void Worksheet::Replace(wxString oldString, wxString newString, bool ignoreCase, bool regex)
 {
   if (GetActiveCell() != NULL)
   {
+    if (regex)
+    {
+      // The regex has to match the whole selection. If it does we replace the
+      // selection by its literal replacement.
+      wxRegEx searchRegex;
+      if (!searchRegex.Compile(oldString, FindReplaceEngine::RegexFlags(ignoreCase)))
+        return;
+      wxString selection = GetActiveCell()->GetSelectionString();
+      size_t start, length;
+      if ((!searchRegex.Matches(selection)) || (!searchRegex.GetMatch(&start, &length)) ||
+          (start != 0) || (length != selection.Length()))
+        return;
+      oldString = selection;
+      searchRegex.Replace(&selection, newString, 1);
+      newString = selection;
+      ignoreCase = false;
+    }
+
     if (GetActiveCell()->ReplaceSelection(oldString, newString, false, ignoreCase))
     {
       m_saved = false;
@@ -8343,37 +8865,70 @@ void Worksheet::Replace(wxString oldString, wxString newString, bool ignoreCase)
   }
 }
 
-int Worksheet::ReplaceAll(wxString oldString, wxString newString, bool ignoreCase)
+int Worksheet::ReplaceAll(wxString oldString, wxString newString, bool ignoreCase, bool regex)
 {
   m_cellPointers.ResetSearchStart();
 
   if (m_tree == NULL)
     return 0;
 
-  int count = 0;
+  FindReplaceEngine engine(oldString, newString, ignoreCase, regex);
+  if (!engine.IsOk())
+    return 0;
 
+  // The search runs in background threads that mustn't access the cells
+  // => we hand them deep copies of the cell contents.
+  std::vector<EditorCell *> editors;
+  std::vector<wxString> texts;
   GroupCell *tmp = m_tree;
-
   while (tmp != NULL)
   {
     EditorCell *editor = dynamic_cast<EditorCell *>(tmp->GetEditable());
-
     if (editor != NULL)
     {
-      int replaced = editor->ReplaceAll(oldString, newString, ignoreCase);
-      if (replaced > 0)
-      {
-        count += replaced;
-        tmp->ResetInputLabel();
-        tmp->ResetSize();
-      }
+      wxString text = editor->GetValue().Clone();
+      text.Replace(wxT("\r"), wxT(" "));
+      editors.push_back(editor);
+      texts.push_back(text);
     }
-
     tmp = dynamic_cast<GroupCell *>(tmp->m_next);
   }
 
+  std::vector<wxString> newTexts;
+  std::vector<int> matches = engine.ReplaceAll(texts, newTexts);
+
+  // Remember pending edits of the active cell before we change it.
+  TreeUndo_CellLeft();
+
+  // Apply the changes as one atomic undo action
+  int count = 0;
+  for (size_t i = 0; i < editors.size(); i++)
+  {
+    if (matches[i] <= 0)
+      continue;
+
+    GroupCell *group = dynamic_cast<GroupCell *>(editors[i]->GetGroup());
+    if (m_evaluationQueue.IsSentAhead(group))
+      continue;
+    TreeUndoAction *undoAction = new TreeUndoAction;
+    undoAction->m_start = group;
+    undoAction->m_oldText = editors[i]->GetValue();
+    if (count > 0)
+      TreeUndo_AppendAction();
+    treeUndoActions.push_front(undoAction);
+
+    editors[i]->SetValueFromReplaceAll(newTexts[i]);
+    if (editors[i] == GetActiveCell())
+      m_treeUndo_ActiveCellOldText = newTexts[i];
+    group->ResetInputLabel();
+    group->ResetSize();
+    count += matches[i];
+  }
+
   if (count > 0)
   {
+    TreeUndo_LimitUndoBuffer();
+    TreeUndo_ClearRedoActionList();
     m_saved = false;
     Recalculate();
     RequestRedraw();
@@ -8895,7 +9450,7 @@ wxAccStatus Worksheet::AccessibilityInfo::GetChild (int childId, wxAccessible **
   }
   else
   {
-    *child = cell;
+    *child = cell->GetAccessible();
     return wxACC_OK;
   }
 }
@@ -8956,7 +9511,7 @@ wxAccStatus Worksheet::AccessibilityInfo::GetFocus (int *childId, wxAccessible *
            if(childId != NULL)
              *childId = id;
            if(child != NULL)
-             *child = cell;
+             *child = cell->GetAccessible();
            return wxACC_OK;
          }
       cell = dynamic_cast<GroupCell *>(cell->m_next);
@@ -9013,12 +9568,13 @@ wxAccStatus Worksheet::AccessibilityInfo::HitTest (const wxPoint &pt,
     {
       id++;
       cell = dynamic_cast<GroupCell *>(cell->m_next);
-      if((cell != NULL) && (cell->HitTest(pt, childId,(Cell **) childObject) == wxACC_OK))
+      Cell *hit = NULL;
+      if((cell != NULL) && (cell->HitTest(pt, childId, &hit) == wxACC_OK))
       {
         if(childId != NULL)
           *childId = id;
         if(childObject != NULL)
-          *childObject = cell;
+          *childObject = hit->GetAccessible();
         return wxACC_OK;
       }
     }
@@ -88,8 +88,13 @@ private:
   bool m_windowActive;
   //! The configuration storage
   Configuration m_configurationTopInstance;
-  //! The rectangle we need to refresh. -1 as "left" coordinate means: No rectangle
-  wxRect m_rectToRefresh;
+  //! The parts of the worksheet we need to refresh, in worksheet coordinates
+  wxRegion m_regionToRefresh;
+  /*! The rectangle only the caret layer needs to be refreshed in
+
+    -1 as "left" coordinate means: No rectangle
+   */
+  wxRect m_overlayRectToRefresh;
   /*! The size of a scroll step
 
     Defines the size of a
@@ -102,8 +107,12 @@ private:
     Drawing is done from a wxPaintDC in OnPaint() instead.
   */
   wxDC *m_dc;
-  //! Where do we need to start the repainting of the worksheet?
-  GroupCell *m_redrawStart;
+  /*! Where do we need to start the repainting of the worksheet?
+
+    The y coordinate of the first GroupCell that has changed. Everything below
+    it might have moved, as well. -1 means: Redraw the whole worksheet.
+   */
+  long m_redrawStartY;
   //! Do we need to redraw the worksheet?
   bool m_redrawRequested;
   //! The clipboard format "mathML"
@@ -392,7 +401,9 @@ private:
   enum TimerIDs
   {
     TIMER_ID,
-    CARET_TIMER_ID
+    CARET_TIMER_ID,
+    FRAME_TIMER_ID,
+    OUTPUT_FLUSH_TIMER_ID
   };
 
   //! Add a line to a file.
@@ -522,6 +533,33 @@ private:
   //! Finds the end of the current chapter/section/...
   GroupCell *EndOfSectioningUnit(GroupCell *start);
 
+  //! Maps symbols to the evaluation generation of the cell that has defined them last
+  WX_DECLARE_STRING_HASH_MAP(unsigned long, SymbolGenerations);
+
+  /*! Adds the stale cells from a list of cells to the evaluation queue
+
+    \param start The first cell of the list
+    \param definedSymbols The symbols the cells above define and the
+    GroupCell::GetEvaluationGeneration() of the cell that defines them last.
+    Cells that are about to be evaluated count as having the generation
+    ULONG_MAX.
+    \param unpredictableGeneration The highest generation of the cells above
+    whose effects GroupCell::GetDependencies() cannot find out
+   */
+  void AddStaleCellsToEvaluationQueue(GroupCell *start, SymbolGenerations &definedSymbols,
+                                      unsigned long &unpredictableGeneration);
+
+  //! Maps symbols to the key of the cell that has defined them
+  WX_DECLARE_STRING_HASH_MAP(wxString, SymbolKeys);
+
+  /*! Calculates the input keys for a list of cells
+
+    \param start The first cell of the list
+    \param symbolKeys The keys of the cells that have defined each symbol
+    \param barrier The key of the last cell whose effects we don't know
+   */
+  void UpdateInputKeys(GroupCell *start, SymbolKeys &symbolKeys, wxString &barrier);
+
   //! Is called if a action from the autocomplete menu is selected
   void OnComplete(wxCommandEvent &event);
 
@@ -700,7 +738,7 @@ public:
   //! Request the worksheet to be redrawn
   void MarkRefreshAsDone()
   {
-    m_redrawStart = NULL;
+    m_redrawStartY = -1;
     m_redrawRequested = false;
   }
 
@@ -710,6 +748,14 @@ public:
    */
   bool RedrawIfRequested();
 
+  //! The time the worksheet has spent laying out cells since it was created [ms]
+  long TotalLayoutTime()
+  { return m_totalLayoutTime; }
+
+  //! The time the worksheet has spent drawing frames since it was created [ms]
+  long TotalDrawTime()
+  { return m_totalDrawTime; }
+
   /*! Request the worksheet to be redrawn
 
     \param start Which cell do we need to start the redraw in? Subsequent calls to
@@ -734,16 +780,34 @@ public:
    */
   void RequestRedraw(wxRect rect);
 
+  /*! Request a part of the caret layer to be redrawn
+
+    The caret isn't part of the backbuffer the cells are drawn to. This means
+    that a blinking caret can be drawn without redrawing any cells.
+   */
+  void RequestOverlayRedraw(wxRect rect);
+
+  /*! Request a part of the window to be repainted
+
+    Overrides wxWindow::Refresh() in order to mark the area as outdated in
+    the backbuffer, as well. RefreshRect() and Refresh() without parameter
+    are routed through this function, too.
+   */
+  virtual void Refresh(bool eraseBackground = true, const wxRect *rect = NULL);
+
   //! Redraw the window now and mark any pending redraw request as "handled".
   void ForceRedraw()
   {
     RequestRedraw();
+    // Don't wait for the next frame.
+    m_lastFrameTime = 0;
     RedrawIfRequested();
   }
 
   //! Is a Redraw requested?
   bool RedrawRequested()
-    { return (m_redrawRequested || m_mouseMotionWas || (m_rectToRefresh.GetLeft() != -1)); }
+    { return (m_redrawRequested || m_mouseMotionWas || (!m_regionToRefresh.IsEmpty()) ||
+              (m_overlayRectToRefresh.GetLeft() != -1)); }
 
   //! To be called after enabling or disabling the visibility of code cells
   void CodeCellVisibilityChanged();
@@ -863,6 +927,7 @@ public:
     popid_insert_heading5,
     popid_insert_heading6,
     popid_auto_answer,
+    popid_independent,
     popid_popup_gnuplot,
     menu_zoom_in,
     menu_zoom_out,
@@ -886,6 +951,13 @@ public:
   //! Copies the worksheet's entire contents
   GroupCell *CopyTree();
 
+  /*! A human-readable report on how much memory the worksheet's cells occupy
+
+    Lists the number of cells and the bytes the cell objects themselves occupy
+    for every type of cell.
+   */
+  wxString MemoryReport();
+
   /*! Insert group cells into the worksheet
 
     \param cells The list of cells that has to be inserted
@@ -913,9 +985,22 @@ public:
 
     If maxima isn't currently evaluating and therefore there is no working group
     the line is appended to m_last, instead.
+
+    The line is buffered and only is added to the worksheet by FlushBufferedOutput()
+    which is called by a timer once per frame and on receiving a prompt.
   */
   void InsertLine(Cell *newLine, bool forceNewLine = false);
 
+  /*! A cell of maxima's output has changed its contents
+
+    Like the lines InsertLine() adds the change is laid out by
+    FlushBufferedOutput().
+   */
+  void OutputCellChanged(Cell *cell);
+
+  //! Add all lines InsertLine() has buffered to the worksheet
+  void FlushBufferedOutput();
+
   // Actually recalculate the worksheet.
   bool RecalculateIfNeeded();
 
@@ -1325,6 +1410,36 @@ public:
   //! Schedule all cells in the document for evaluation
   void AddEntireDocumentToEvaluationQueue();
 
+  /*! Schedule the cells that have changed and the cells that depend on them
+
+    A cell needs to be evaluated if its input has changed since maxima has
+    evaluated it, if it has caused an error or if it uses a symbol that a cell
+    above it has defined after the cell has been evaluated, or that is about to
+    be defined again. A cell that defines a symbol that is about to be defined
+    again is evaluated, too, so the cells below it still see its value. If a
+    cell has effects GroupCell::GetDependencies() cannot find out all cells
+    below it that have been evaluated before it are stale.
+   */
+  void AddStaleCellsToEvaluationQueue();
+
+  /*! Calculates the keys the output of the code cells would be cached under
+
+    Only cells that don't define anything, don't refer to output labels and
+    call nothing but functions whose result depends only on their arguments
+    get a key: These are the only cells that can be skipped without
+    maxima missing anything. Every other function call might have side
+    effects like depends() or tellsimp() have and therefore changes the keys
+    of all cells below it.
+   */
+  void UpdateInputKeys();
+
+  //! Mark all cells as never having been evaluated, for example after maxima has been restarted
+  void ForgetEvaluatedInputs()
+  {
+    if (m_tree)
+      m_tree->ForgetEvaluatedInputList();
+  }
+
   //! Schedule all cells stopping with the one the caret is in for evaluation
   void AddDocumentTillHereToEvaluationQueue();
 
@@ -1334,6 +1449,13 @@ public:
   //! Adds a chapter, a section or a subsection to the evaluation queue
   void AddSectionToEvaluationQueue(GroupCell *start);
 
+  /*! Collects the code cells of all sections that are marked as independent
+
+    Each entry of sections contains the code cells of one independent section.
+    Sections inside an independent section belong to it.
+   */
+  void GetIndependentSections(std::list<std::list<GroupCell *> > &sections);
+
   //! Schedule all cells in the selection to be evaluated
   void AddSelectionToEvaluationQueue();
 
@@ -1380,20 +1502,28 @@ public:
   /*! Find the next ocourrence of a string
 
     Used by the find dialog.
+
+    \param regex true = str is a regular expression
    */
-  bool FindNext(wxString str, bool down, bool ignoreCase, bool warn = true);
+  bool FindNext(wxString str, bool down, bool ignoreCase, bool warn = true, bool regex = false);
 
   /*! Replace the current ocourrence of a string
 
     Used by the find dialog.
+
+    \param regex true = oldString is a regular expression that has to match
+    the whole selection.
    */
-  void Replace(wxString oldString, wxString newString, bool ignoreCase);
+  void Replace(wxString oldString, wxString newString, bool ignoreCase, bool regex = false);
 
   /*! Replace all ocourrences of a string
 
-    Used by the find dialog.
+    Used by the find dialog. The search runs on a pool of worker threads, the
+    changes are then applied as one single action the undo command can revert.
+
+    \param regex true = oldString is a regular expression
    */
-  int ReplaceAll(wxString oldString, wxString newString, bool ignoreCase);
+  int ReplaceAll(wxString oldString, wxString newString, bool ignoreCase, bool regex = false);
 
   wxString GetInputAboveCaret();
 
@@ -1498,8 +1628,69 @@ public:
 protected:
   int m_virtualWidth_Last;
   int m_virtualHeight_Last;
-  //! A memory we can manually buffer the contents of the area that is to be redrawn in
+  /*! The backbuffer: The visible part of the worksheet without the caret
+
+    Is kept between paint events so only the parts that have changed and the
+    parts that were scrolled into view have to be drawn.
+   */
   wxBitmap m_memory;
+  //! A second bitmap of the size of m_memory we can scroll m_memory's contents to
+  wxBitmap m_memoryScrolled;
+  //! The worksheet coordinates of the top left corner of m_memory
+  wxPoint m_memoryOrigin;
+  //! false = m_memory doesn't contain anything we can reuse
+  bool m_memoryValid;
+  //! The parts of m_memory that are outdated, in worksheet coordinates
+  wxRegion m_memoryInvalid;
+  //! Set the scale and the origin of a DC that draws to the backbuffer
+  void PrepareBackbufferDC(wxDC &dc);
+  //! Move the contents of the backbuffer to follow a scroll of the worksheet
+  void ScrollBackbuffer(wxPoint viewOrigin);
+  //! Draw all cells in a region of the worksheet to the backbuffer
+  void DrawBackbuffer(wxDC &dc, wxDC &antiAliassingDC, wxRect updateRegion);
+  //! Draw the caret on top of the cells
+  void DrawOverlay(wxDC &dc, wxPoint viewOrigin);
+  /*! \defgroup FrameScheduler The frame scheduler
+
+    Redraw requests are collected and issued as one frame at most every
+    m_frameInterval milliseconds. If drawing a frame takes longer than that
+    the frames are spaced further apart so drawing never takes up more than
+    about half of the CPU time while maxima is flooding us with output.
+    @{
+  */
+  //! The minimum time between two frames [ms] = 25 frames per second
+  static const long m_frameInterval = 40;
+  //! Even if we are lagging behind we want to update the screen at least this often [ms]
+  static const long m_maxFrameInterval = 1000;
+  //! The maximum number of rectangles a frame draws separately, not as their bounding box
+  static const size_t m_maxRectsPerFrame = 4;
+  //! The number of frames we collect the frame time statistics for before we log them
+  static const long m_framesPerStatistics = 1000;
+  //! Issues the next frame if a redraw request had to wait for the frame budget
+  wxTimer m_frameTimer;
+  //! When did we issue the last frame?
+  wxLongLong m_lastFrameTime;
+  //! How long did drawing the last frame take [ms]?
+  long m_lastFrameDuration;
+  //! The number of frames that were drawn since the statistics were last logged
+  long m_framesDrawn;
+  //! The number of times a redraw request had to wait for the next frame
+  long m_framesDeferred;
+  //! The time the frames in m_framesDrawn took to draw [ms]
+  long m_frameTimeSum;
+  //! The time the slowest frame in m_framesDrawn took to draw [ms]
+  long m_slowestFrame;
+  //! The time all layout passes took, for the evaluation profiler [ms]
+  long m_totalLayoutTime;
+  //! The time all frames took to draw, for the evaluation profiler [ms]
+  long m_totalDrawTime;
+  //! Adds the output InsertLine() has buffered to the worksheet
+  wxTimer m_outputFlushTimer;
+  //! The GroupCell InsertLine() has buffered output for. NULL = none.
+  GroupCell *m_groupWithBufferedOutput;
+  //! Add a frame that took duration milliseconds to draw to the statistics
+  void FrameDrawn(long duration);
+  /*! @} */
   virtual wxSize DoGetBestClientSize() const;
 #if wxUSE_ACCESSIBILITY
   AccessibilityInfo *m_accessibilityInfo;
@@ -34,6 +34,7 @@
 #include <wx/cmdline.h>
 #include <wx/fileconf.h>
 #include <wx/sysopt.h>
+#include <wx/thread.h>
 #include "Dirstructure.h"
 #include <iostream>
 
@@ -53,6 +54,10 @@ FORCE_LINK(gnome_print)
 
 IMPLEMENT_APP(MyApp)
 std::list<wxMaxima *> MyApp::m_topLevelWindows;
+bool MyApp::m_headless = false;
+std::list<wxString> MyApp::m_headlessFiles;
+long MyApp::m_headlessJobs = 1;
+long MyApp::m_headlessFailures = 0;
 
 
 bool MyApp::OnInit()
@@ -170,6 +175,10 @@ bool MyApp::OnInit()
                    "evaluate the file after opening it.", wxCMD_LINE_VAL_NONE , 0},
                   {wxCMD_LINE_SWITCH, "b", "batch",
                    "run the file and exit afterwards. Halts on questions and stops on errors.",  wxCMD_LINE_VAL_NONE, 0},
+                  {wxCMD_LINE_SWITCH, NULL, "headless",
+                   "run the files without displaying them, save them and exit afterwards. Fails on questions and errors.",  wxCMD_LINE_VAL_NONE, 0},
+                  {wxCMD_LINE_OPTION, "j", "jobs",
+                   "the number of files --headless evaluates at the same time. Defaults to the number of CPUs.",  wxCMD_LINE_VAL_NUMBER, 0},
                   { wxCMD_LINE_OPTION, "f", "ini", "allows to specify a file to store the configuration in", wxCMD_LINE_VAL_STRING , 0},
                   { wxCMD_LINE_OPTION, "m", "maxima", "allows to specify the location of the maxima binary", wxCMD_LINE_VAL_STRING , 0},
                   {wxCMD_LINE_PARAM, NULL, NULL, "input file", wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL | wxCMD_LINE_PARAM_MULTIPLE},
@@ -273,6 +282,38 @@ bool MyApp::OnInit()
     exit(0);
   }
 
+  if (cmdLineParser.Found(wxT("headless")))
+  {
+    m_headless = true;
+    m_headlessJobs = wxThread::GetCPUCount();
+    cmdLineParser.Found(wxT("j"), &m_headlessJobs);
+    if (m_headlessJobs < 1)
+      m_headlessJobs = 1;
+
+    // Nobody would close a dialog => log to stderr instead and only report
+    // what went wrong.
+    delete wxLog::SetActiveTarget(new wxLogStderr);
+    wxLog::SetLogLevel(wxLOG_Warning);
+
+    if (cmdLineParser.Found(wxT("o"), &file))
+      m_headlessFiles.push_back(file);
+    for (unsigned int i = 0; i < cmdLineParser.GetParamCount(); i++)
+      m_headlessFiles.push_back(cmdLineParser.GetParam(i));
+    if (m_headlessFiles.empty())
+    {
+      std::cerr << "--headless needs at least one file to evaluate.\n";
+      return false;
+    }
+    for (std::list<wxString>::iterator it = m_headlessFiles.begin(); it != m_headlessFiles.end(); ++it)
+    {
+      wxFileName FileName = *it;
+      FileName.MakeAbsolute();
+      *it = FileName.GetFullPath();
+    }
+    StartHeadlessJobs();
+    return true;
+  }
+
   if (cmdLineParser.Found(wxT("b")))
   {
     evalOnStartup = true;
@@ -308,6 +349,14 @@ bool MyApp::OnInit()
   return true;
 }
 
+int MyApp::OnRun()
+{
+  int retval = wxApp::OnRun();
+  if (m_headlessFailures > 0)
+    return 1;
+  return retval;
+}
+
 int MyApp::OnExit()
 {
   wxDELETE(m_dirstruct);
@@ -340,6 +389,40 @@ void MyApp::NewWindow(wxString file, bool evalOnStartup, bool exitAfterEval)
   frame->ShowTip(false);
 }
 
+void MyApp::NewHeadlessWindow(wxString file)
+{
+  wxMaxima *frame = new wxMaxima((wxFrame *) NULL, -1, file);
+  frame->Headless(true);
+  frame->SetOpenFile(file);
+  frame->ExitAfterEval(true);
+  frame->EvalOnStartup(true);
+  m_topLevelWindows.push_back(frame);
+  // The window is never shown: It only lives until its file is evaluated.
+  frame->InitSession();
+}
+
+void MyApp::StartHeadlessJobs()
+{
+  while (((long) m_topLevelWindows.size() < m_headlessJobs) && !m_headlessFiles.empty())
+  {
+    wxString file = m_headlessFiles.front();
+    m_headlessFiles.pop_front();
+    NewHeadlessWindow(file);
+  }
+}
+
+void MyApp::HeadlessJobFinished(wxString file, bool success)
+{
+  if (success)
+    std::cout << file.utf8_str() << ": OK\n";
+  else
+  {
+    std::cout << file.utf8_str() << ": FAILED\n";
+    m_headlessFailures++;
+  }
+  std::cout.flush();
+}
+
 void MyApp::OnFileMenu(wxCommandEvent &ev)
 {
   switch (ev.GetId())
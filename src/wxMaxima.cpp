@@ -95,6 +95,7 @@
 #include <wx/url.h>
 #include <wx/sstream.h>
 #include <list>
+#include <algorithm>
 
 #if defined __WXOSX__
 #define MACPREFIX "wxMaxima.app/Contents/Resources/"
@@ -127,59 +128,73 @@ void wxMaxima::ConfigChanged()
   m_worksheet->RecalculateForce();
   m_worksheet->RequestRedraw();
 
+  wxLogMessage(_("Sending configuration data to maxima."));
+  m_configCommands += ConfigCommands();
+
+  if (m_worksheet->m_currentFile != wxEmptyString)
+  {
+    wxString filename(m_worksheet->m_currentFile);
+
+    SetCWD(filename);
+  }
+}
+
+wxString wxMaxima::ConfigCommands()
+{
+  wxConfigBase *config = wxConfig::Get();
+  wxString commands;
+
 #if defined (__WXOSX__)
   bool usepngCairo = false;
 #else
   bool usepngCairo=true;
 #endif
-  wxLogMessage(_("Sending configuration data to maxima."));
   config->Read(wxT("usepngCairo"), &usepngCairo);
   if (usepngCairo)
-    m_configCommands += wxT(":lisp-quiet (setq $wxplot_pngcairo t)\n");
+    commands += wxT(":lisp-quiet (setq $wxplot_pngcairo t)\n");
   else
-    m_configCommands += wxT(":lisp-quiet (setq $wxplot_pngcairo nil)\n");
+    commands += wxT(":lisp-quiet (setq $wxplot_pngcairo nil)\n");
 
-  m_configCommands += wxT(":lisp-quiet (setq $wxsubscripts ") +
-             m_worksheet->m_configuration->GetAutosubscript_string() +
-             wxT(")\n");
+  commands += wxT(":lisp-quiet (setq $wxsubscripts ") +
+    m_worksheet->m_configuration->GetAutosubscript_string() +
+    wxT(")\n");
 
   // A few variables for additional debug info in wxbuild_info();
-  m_configCommands += wxString::Format(wxT(":lisp-quiet (setq wxUserConfDir \"%s\")\n"),
-                                       EscapeForLisp(Dirstructure::Get()->UserConfDir()));
-  m_configCommands += wxString::Format(wxT(":lisp-quiet (setq wxHelpDir \"%s\")\n"),
-                              EscapeForLisp(Dirstructure::Get()->HelpDir()));
+  commands += wxString::Format(wxT(":lisp-quiet (setq wxUserConfDir \"%s\")\n"),
+                               EscapeForLisp(Dirstructure::Get()->UserConfDir()));
+  commands += wxString::Format(wxT(":lisp-quiet (setq wxHelpDir \"%s\")\n"),
+                               EscapeForLisp(Dirstructure::Get()->HelpDir()));
 
   int defaultPlotWidth = 600;
   config->Read(wxT("defaultPlotWidth"), &defaultPlotWidth);
   int defaultPlotHeight = 400;
   config->Read(wxT("defaultPlotHeight"), &defaultPlotHeight);
-  m_configCommands += wxString::Format(wxT(":lisp-quiet (setq $wxplot_size '((mlist simp) %i %i))\n"),
-                              defaultPlotWidth,
-                              defaultPlotHeight);
-
-  if (m_worksheet->m_currentFile != wxEmptyString)
-  {
-    wxString filename(m_worksheet->m_currentFile);
-
-    SetCWD(filename);
-  }
+  commands += wxString::Format(wxT(":lisp-quiet (setq $wxplot_size '((mlist simp) %i %i))\n"),
+                               defaultPlotWidth,
+                               defaultPlotHeight);
+  return commands;
 }
 
 wxMaxima::wxMaxima(wxWindow *parent, int id, const wxString title,
                    const wxPoint pos, const wxSize size) :
   wxMaximaFrame(parent, id, title, pos, size, wxDEFAULT_FRAME_STYLE,
-                MyApp::m_topLevelWindows.empty())
+                MyApp::m_topLevelWindows.empty() && !MyApp::m_headless)
 {
-  m_isLogTarget = MyApp::m_topLevelWindows.empty();
+  // In headless mode the log is written to stderr instead of a log pane.
+  m_isLogTarget = MyApp::m_topLevelWindows.empty() && !MyApp::m_headless;
   // Suppress window updates until this window has fully been created.
   // Not redrawing the window whilst constructing it hopefully speeds up
   // everything.
   wxWindowUpdateLocker noUpdates(this);
   m_maximaBusy = true;
   m_evalOnStartup = false;
+  m_headless = false;
+  m_headlessError = false;
+  m_headlessCompleted = false;
   m_dataFromMaximaIs = false;
   m_gnuplotProcess = NULL;
   m_openInitialFileError = false;
+  m_queryAllVariableValues = true;
   m_maximaJiffies_old = 0;
   m_cpuTotalJiffies_old = 0;
 
@@ -253,10 +268,6 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, const wxString title,
 
   StatusMaximaBusy(disconnected);
 
-  /// RegEx for function definitions
-  wxASSERT(m_funRegEx.Compile(wxT("^ *([[:alnum:]%_]+) *\\(([[:alnum:]%_,[[.].] ]*)\\) *:=")));
-  // RegEx for variable definitions
-  wxASSERT(m_varRegEx.Compile(wxT("^ *([[:alnum:]%_]+) *:")));
   // RegEx for blank statement removal
   wxASSERT(m_blankStatementRegEx.Compile(wxT("(^;)|((^|;)(((\\/\\*.*\\*\\/)?([[:space:]]*))+;)+)")));
   wxASSERT(m_sbclCompilationRegEx.Compile(wxT("; compiling (.* \\.*)")));
@@ -266,16 +277,29 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, const wxString title,
                                                   NULL, this);
   m_clientStream = NULL;
   m_clientTextStream = NULL;
+  m_standby = NULL;
+  m_frameState = frame_none;
+  m_frameBytesLeft = 0;
   m_parser = new MathParser (&m_worksheet->m_configuration, &m_worksheet->m_cellPointers);
 }
 
 wxMaxima::~wxMaxima()
 {
+  KillWorkers();
+  wxDELETE(m_standby);
   KillMaxima(false);
   wxDELETE(m_printData);m_printData = NULL;
   delete(m_parser);
   m_parser = NULL;
   MyApp::m_topLevelWindows.remove(this);
+  if(m_headless)
+  {
+    wxString file = m_worksheet->m_currentFile;
+    if(file.IsEmpty())
+      file = m_openFile;
+    MyApp::HeadlessJobFinished(file, m_headlessCompleted && !m_headlessError);
+    wxGetApp().StartHeadlessJobs();
+  }
   if(MyApp::m_topLevelWindows.empty())
      wxExit();
   else
@@ -359,14 +383,24 @@ void wxMaxima::InitSession()
     }
   }
 
+  bool started = false;
   if (!server)
     LeftStatusText(_("Starting server failed"));
-  else if (!StartMaxima())
+  else if (!(started = StartMaxima()))
     LeftStatusText(_("Starting Maxima process failed"));
 
+  // Nobody would ever close a headless window that has nothing to do.
+  if (m_headless && !started)
+  {
+    wxLogError(wxString::Format(_("%s: Cannot start maxima"), m_openFile));
+    m_headlessError = true;
+    Close();
+    return;
+  }
+
   Refresh();
   m_worksheet->SetFocus();
-  if (m_worksheet->m_configuration->AutoSaveMiliseconds() > 0)
+  if ((m_worksheet->m_configuration->AutoSaveMiliseconds() > 0) && !m_headless)
     m_autoSaveTimer.StartOnce(m_worksheet->m_configuration->AutoSaveMiliseconds());
 }
 
@@ -461,11 +495,14 @@ TextCell *wxMaxima::ConsoleAppend(wxString s, CellType type, wxString userLabel)
           DoRawConsoleAppend(pre, MC_TYPE_DEFAULT);
 
         // If the math tag ends inside this string we add the whole tag.
-        int end = s.Find(wxT("</mth>"));
+        wxString mthEnd = wxT("</mth>");
+        if (s.Mid(start).StartsWith(wxT("<mthc>")))
+          mthEnd = wxT("</mthc>");
+        int end = s.Find(mthEnd);
         if (end == wxNOT_FOUND)
           end = s.Length();
         else
-          end += 5;
+          end += mthEnd.Length() - 1;
         wxString rest = s.SubString(start, end);
 
         DoConsoleAppend(wxT("<span>") + rest +
@@ -528,7 +565,9 @@ void wxMaxima::DoConsoleAppend(wxString s, CellType type, bool newLine,
   s.Replace(wxT("\n"), wxT(" "), true);
 
   m_parser->SetUserLabel(userLabel);
+  wxLongLong parseStart = wxGetUTCTimeUSec();
   cell = m_parser->ParseLine(s, type);
+  m_profiler->ParseTime((wxGetUTCTimeUSec() - parseStart).ToLong());
 
   wxASSERT_MSG(cell != NULL, _("There was an error in generated XML!\n\n"
                                        "Please report this as a bug."));
@@ -553,8 +592,8 @@ TextCell *wxMaxima::DoRawConsoleAppend(wxString s, CellType type)
   if (s.IsEmpty())
     return NULL;
 
-  bool scrollToCaret = (!m_worksheet->FollowEvaluation() && m_worksheet->CaretVisibleIs());
-
+  // InsertLine() and OutputCellChanged() only buffer the output: It is laid out
+  // and displayed once per frame by Worksheet::FlushBufferedOutput().
   if (type == MC_TYPE_MAIN_PROMPT)
   {
     cell = new TextCell(m_worksheet->GetTree(), &(m_worksheet->m_configuration), &m_worksheet->m_cellPointers, s);
@@ -584,12 +623,9 @@ TextCell *wxMaxima::DoRawConsoleAppend(wxString s, CellType type)
       }
 
       incompleteTextCell->SetValue(newVal);
+      m_worksheet->OutputCellChanged(incompleteTextCell);
       if(s == wxEmptyString)
-      {
-        dynamic_cast<GroupCell *>(incompleteTextCell->GetGroup())->ResetSize();
-        dynamic_cast<GroupCell *>(incompleteTextCell->GetGroup())->Recalculate();
         return incompleteTextCell;
-      }
     }
 
     wxStringTokenizer tokens(s, wxT("\n"));
@@ -630,12 +666,6 @@ TextCell *wxMaxima::DoRawConsoleAppend(wxString s, CellType type)
     m_worksheet->InsertLine(tmp, true);
   }
 
-  if(cell)
-  {
-    m_worksheet->Recalculate(cell->GetGroup());
-    if (scrollToCaret)
-      m_worksheet->ScrollToCaret();
-  }
   return cell;
 }
 
@@ -699,43 +729,6 @@ void wxMaxima::SendMaxima(wxString s, bool addToHistory)
     s.Trim(true);
     s.Append(wxT("\n"));
 
-    /// Check for function/variable definitions
-    wxStringTokenizer commands(s, wxT(";$"));
-    while (commands.HasMoreTokens())
-    {
-      wxString line = commands.GetNextToken();
-      if (m_varRegEx.Matches(line))
-        m_worksheet->AddSymbol(m_varRegEx.GetMatch(line, 1));
-
-      if (m_funRegEx.Matches(line))
-      {
-        wxString funName = m_funRegEx.GetMatch(line, 1);
-        m_worksheet->AddSymbol(funName);
-
-        /// Create a template from the input
-        wxString args = m_funRegEx.GetMatch(line, 2);
-        wxStringTokenizer argTokens(args, wxT(","));
-        funName << wxT("(");
-        int count = 0;
-        while (argTokens.HasMoreTokens())
-        {
-          if (count > 0)
-            funName << wxT(",");
-          wxString a = argTokens.GetNextToken().Trim().Trim(false);
-          if (a != wxEmptyString)
-          {
-            if (a[0] == '[')
-              funName << wxT("[<") << a.SubString(1, a.Length() - 2) << wxT(">]");
-            else
-              funName << wxT("<") << a << wxT(">");
-            count++;
-          }
-        }
-        funName << wxT(")");
-        m_worksheet->AddSymbol(funName, AutoComplete::tmplte);
-      }
-    }
-
     if ((m_client) && (s.Length() >= 1))
     {
       // If there is no working group and we still are trying to send something
@@ -745,27 +738,12 @@ void wxMaxima::SendMaxima(wxString s, bool addToHistory)
         StatusMaximaBusy(calculating);
       else
         StatusMaximaBusy(waiting);
+      // The GUI mustn't wait for maxima to read its input => we only queue
+      // the data here. m_sendBuffer sends what the socket accepts now and
+      // the rest as soon as the socket informs us that it can take more.
       wxScopedCharBuffer const data_raw = s.utf8_str();
-      const void *buf = data_raw.data();
-      wxUint32 len = data_raw.length();
-      wxUint32 last;
-      while (1) {
-        if (!m_client->WaitForWrite()) {
-          DoRawConsoleAppend(_("Timeout waiting for Maxima socket to be writable"), MC_TYPE_ERROR);
-          return;
-        }
-        m_client->Write(buf, len);        
-        if (m_client->Error()) {
-          DoRawConsoleAppend(_("Error writing to Maxima"), MC_TYPE_ERROR);
-          return;
-        }
-        last = m_client->LastWriteCount();
-        if (last == len)
-          break;
-        buf = (const void*)((uintptr_t)buf + last);
-        len -= last;
-      }
-      m_statusBar->NetworkStatus(StatusBar::transmit);
+      bool written = m_sendBuffer.Write(m_client, data_raw.data(), data_raw.length());
+      SendBufferFlushed(written);
     }
   }
   else
@@ -785,6 +763,41 @@ void wxMaxima::SendMaxima(wxString s, bool addToHistory)
 ///  Socket stuff
 ///--------------------------------------------------------------------------------
 
+void wxMaxima::FlushSendBuffer()
+{
+  SendBufferFlushed(m_sendBuffer.Flush(m_client));
+}
+
+void wxMaxima::SendBufferFlushed(bool success)
+{
+  if (!success)
+  {
+    m_statusBar->SendBacklog(0);
+    DoRawConsoleAppend(_("Error writing to Maxima"), MC_TYPE_ERROR);
+    return;
+  }
+  if (m_sendBuffer.LastWriteCount() > 0)
+    m_statusBar->NetworkStatus(StatusBar::transmit);
+  m_statusBar->SendBacklog(m_sendBuffer.Pending());
+}
+
+//! The number of bytes a char occupies in UTF-8
+static long UTF8Length(wxChar chr)
+{
+  wxUint32 code = chr;
+  if(code < 0x80)
+    return 1;
+  if(code < 0x800)
+    return 2;
+  // Where wxChar is 16 bits wide each half of a surrogate pair makes up half
+  // of the 4 bytes of the char.
+  if((code >= 0xD800) && (code <= 0xDFFF))
+    return 2;
+  if(code < 0x10000)
+    return 3;
+  return 4;
+}
+
 void wxMaxima::ClientEvent(wxSocketEvent &event)
 {
   switch (event.GetSocketEvent())
@@ -809,19 +822,28 @@ void wxMaxima::ClientEvent(wxSocketEvent &event)
 
     // Read all new lines of text we received.
     wxChar chr;
+    bool frameComplete = false;
+    long bytes = 0;
 
     while((m_client->IsData()) && (!m_clientStream->Eof()))
       {
         chr = m_clientTextStream->GetChar();
         if(chr == wxEOT)
           break;
+        bytes += UTF8Length(chr);
         if(chr != '\0')
-          m_newCharsFromMaxima += chr;
+          frameComplete |= AddCharFromMaxima(chr);
       }
+    m_profiler->DataReceived(bytes);
 
     m_bytesFromMaxima += m_newCharsFromMaxima.Length();
-    
-    if(m_newCharsFromMaxima.EndsWith("\n") || m_newCharsFromMaxima.EndsWith(m_promptSuffix))
+
+    if(m_frameState == frame_payload)
+      // We know that the rest of the message is still to come => there is no
+      // need to look at the incomplete data, yet, or to guess if it is complete.
+      m_waitForStringEndTimer.Stop();
+    else if(frameComplete ||
+            m_newCharsFromMaxima.EndsWith("\n") || m_newCharsFromMaxima.EndsWith(m_promptSuffix))
     {
       m_waitForStringEndTimer.Stop();
       InterpretDataFromMaxima();
@@ -831,11 +853,77 @@ void wxMaxima::ClientEvent(wxSocketEvent &event)
 
     break;
     }
+  case wxSOCKET_OUTPUT:
+    // Maxima has read enough of its input that we can send more.
+    FlushSendBuffer();
+    break;
   default:
     break;
   }
 }
 
+bool wxMaxima::AddCharFromMaxima(wxChar chr)
+{
+  switch(m_frameState)
+  {
+  case frame_none:
+    if(chr == wxT('\x02'))
+      m_frameState = frame_type;
+    else
+      m_newCharsFromMaxima += chr;
+    return false;
+
+  case frame_type:
+    m_frameBytesLeft = 0;
+    m_frameState = frame_length;
+    return false;
+
+  case frame_length:
+    if((chr >= wxT('0')) && (chr <= wxT('9')))
+    {
+      m_frameBytesLeft = 10 * m_frameBytesLeft + (chr - wxT('0'));
+      return false;
+    }
+    if(chr == wxT(':'))
+    {
+      if(m_frameBytesLeft <= 0)
+      {
+        m_frameState = frame_none;
+        return true;
+      }
+      // Large messages can be received without re-allocating the string again
+      // and again.
+      m_newCharsFromMaxima.reserve(m_newCharsFromMaxima.Length() + m_frameBytesLeft);
+      m_frameState = frame_payload;
+      return false;
+    }
+    // Not a valid header => fall back to handling the data as plain text.
+    wxLogMessage(_("Received an invalid message header from maxima"));
+    m_frameState = frame_none;
+    m_newCharsFromMaxima += chr;
+    return false;
+
+  case frame_payload:
+    if(chr == wxT('\x02'))
+    {
+      // Our byte count and maxima's one disagree, for example because
+      // something maxima has written to the socket isn't inside a frame. The
+      // STX tells where the next frame starts => we resynchronize there and
+      // interpret what we have got so far as plain text.
+      wxLogMessage(_("A message from maxima was shorter than announced"));
+      m_frameState = frame_type;
+      return true;
+    }
+    m_newCharsFromMaxima += chr;
+    m_frameBytesLeft -= UTF8Length(chr);
+    if(m_frameBytesLeft > 0)
+      return false;
+    m_frameState = frame_none;
+    return true;
+  }
+  return false;
+}
+
 /*!
  * ServerEvent is triggered when maxima connects to the socket server.
  */
@@ -859,13 +947,14 @@ void wxMaxima::ServerEvent(wxSocketEvent &event)
       m_statusBar->NetworkStatus(StatusBar::idle);
       m_worksheet->QuestionAnswered();
       m_currentOutput = wxEmptyString;
+      m_frameState = frame_none;
       m_isConnected = true;
       m_client = m_server->Accept(false);
       m_clientStream = new wxSocketInputStream(*m_client);
       m_clientTextStream = new wxTextInputStream(*m_clientStream, wxT('\t'),
                                                  wxConvUTF8);
       m_client->SetEventHandler(*this, socket_client_id);
-      m_client->SetNotify(wxSOCKET_INPUT_FLAG);
+      m_client->SetNotify(wxSOCKET_INPUT_FLAG | wxSOCKET_OUTPUT_FLAG);
       m_client->Notify(true);
       m_client->SetFlags(wxSOCKET_NOWAIT);
       m_client->SetTimeout(15);
@@ -958,11 +1047,15 @@ bool wxMaxima::StartMaxima(bool force)
     m_closing = true;
     if(m_process != NULL)
       KillMaxima();
+    // A new maxima doesn't know anything the old one has been told.
+    m_worksheet->ForgetEvaluatedInputs();
     m_maximaStdoutPollTimer.StartOnce(MAXIMAPOLLMSECS);
 
     wxString command = GetCommand();
 
-    if (command.Length() > 0)
+    if ((command.Length() > 0) && UseStandby(command))
+      StatusMaximaBusy(wait_for_start);
+    else if (command.Length() > 0)
     {
 
       command.Append(wxString::Format(wxT(" -s %d "), m_port));
@@ -993,6 +1086,8 @@ bool wxMaxima::StartMaxima(bool force)
       }
       m_maximaStdout = m_process->GetInputStream();
       m_maximaStderr = m_process->GetErrorStream();
+      m_maximaStdoutPending.SetDataLen(0);
+      m_maximaStderrPending.SetDataLen(0);
       m_lastPrompt = wxT("(%i1) ");
       StatusMaximaBusy(wait_for_start);
     }
@@ -1010,6 +1105,82 @@ bool wxMaxima::StartMaxima(bool force)
   return true;
 }
 
+void wxMaxima::StartStandby()
+{
+  if ((m_standby != NULL) || m_headless ||
+      (!m_worksheet->m_configuration->KeepStandbyMaxima()))
+    return;
+
+  wxString command = GetCommand();
+  if (command.IsEmpty())
+    return;
+
+  m_standby = new MaximaStandby(this, maxima_process_id);
+  if (!m_standby->Start(command, m_port + 1, SetupCommands()))
+  {
+    wxLogMessage(_("Cannot start a standby maxima."));
+    wxDELETE(m_standby);
+  }
+}
+
+bool wxMaxima::UseStandby(wxString command)
+{
+  if (m_standby == NULL)
+    return false;
+
+  wxString initialFolder;
+  wxGetEnv(wxT("MAXIMA_INITIAL_FOLDER"), &initialFolder);
+  if ((!m_standby->IsReady()) ||
+      (m_standby->GetCommand() != command) ||
+      (m_standby->GetInitialFolder() != initialFolder) ||
+      (m_standby->GetSetup() != SetupCommands()))
+  {
+    // A standby that still starts up or has been started with other settings
+    // is of no use. A new one is started as soon as the new maxima is up.
+    wxLogMessage(_("The standby maxima cannot be used for this start of maxima."));
+    wxDELETE(m_standby);
+    return false;
+  }
+
+  wxLogMessage(_("Taking over the standby maxima."));
+  wxString data;
+  m_standby->HandOver(m_process, m_client, data);
+  wxDELETE(m_standby);
+
+  m_maximaStdout = m_process->GetInputStream();
+  m_maximaStderr = m_process->GetErrorStream();
+  m_maximaStdoutPending.SetDataLen(0);
+  m_maximaStderrPending.SetDataLen(0);
+  m_first = true;
+  m_pid = -1;
+  m_lastPrompt = wxT("(%i1) ");
+
+  // The same as ServerEvent() does for a maxima that has just connected
+  m_statusBar->NetworkStatus(StatusBar::idle);
+  m_worksheet->QuestionAnswered();
+  m_currentOutput = wxEmptyString;
+  m_frameState = frame_none;
+  m_isConnected = true;
+  m_clientStream = new wxSocketInputStream(*m_client);
+  m_clientTextStream = new wxTextInputStream(*m_clientStream, wxT('\t'),
+                                             wxConvUTF8);
+  m_client->SetEventHandler(*this, socket_client_id);
+  m_client->SetNotify(wxSOCKET_INPUT_FLAG | wxSOCKET_OUTPUT_FLAG);
+  m_client->Notify(true);
+  m_client->SetFlags(wxSOCKET_NOWAIT);
+  m_client->SetTimeout(15);
+
+  // The standby already has been sent SetupCommands(). But the configuration
+  // might have changed since.
+  wxLogMessage(_("Updating maxima's configuration"));
+  ConfigChanged();
+
+  // Maxima's banner and its first prompt have already been read by the
+  // standby. OnIdle() interprets them.
+  m_dataFromStandby = data;
+  return true;
+}
+
 
 void wxMaxima::Interrupt(wxCommandEvent& WXUNUSED(event))
 {
@@ -1166,6 +1337,7 @@ void wxMaxima::KillMaxima(bool logMessage)
 {
   m_worksheet->m_variablesPane->ResetValues();
   m_varNamesToQuery = m_worksheet->m_variablesPane->GetEscapedVarnames();
+  m_queryAllVariableValues = true;
   if((m_pid > 0) && (m_client == NULL))
     return;
 
@@ -1179,6 +1351,9 @@ void wxMaxima::KillMaxima(bool logMessage)
 
   m_worksheet->m_cellPointers.SetWorkingGroup(NULL);
   m_worksheet->m_evaluationQueue.Clear();
+  // The commands the old maxima was working on won't send a prompt any more.
+  m_worksheet->m_evaluationQueue.ResetCommandsSent();
+  m_profiler->Abort();
   EvaluationQueueLength(0);
 
   // We start checking for maximas output again as soon as we send some data to the program.
@@ -1186,6 +1361,7 @@ void wxMaxima::KillMaxima(bool logMessage)
   m_CWD = wxEmptyString;
   m_worksheet->QuestionAnswered();
   m_currentOutput = wxEmptyString;
+  m_dataFromStandby = wxEmptyString;
   // If we did close maxima by hand we already might have a new process
   // and therefore invalidate the wrong process in this step
   if (m_process)
@@ -1198,6 +1374,10 @@ void wxMaxima::KillMaxima(bool logMessage)
   //  wxDELETE(m_clientStream);
   m_clientStream = NULL;
 
+  // The commands that haven't been sent yet are of no use to the new maxima.
+  m_sendBuffer.Clear();
+  m_statusBar->SendBacklog(0);
+
   if(m_client)
   {
     // Make wxWidgets close the connection only after we have sent the close command.
@@ -1210,6 +1390,7 @@ void wxMaxima::KillMaxima(bool logMessage)
 
     // The following command should close maxima, as well.
     m_client->Close(); m_client = NULL;
+    m_sendBuffer.Clear();
   }
 
   // Just to be absolutely sure: Additionally try to kill maxima
@@ -1252,10 +1433,27 @@ void wxMaxima::OnGnuplotClose(wxProcessEvent& WXUNUSED(event))
   wxLogMessage(_("Gnuplot has closed."));
 }
 
-void wxMaxima::OnProcessEvent(wxProcessEvent& WXUNUSED(event))
+void wxMaxima::OnProcessEvent(wxProcessEvent& event)
 {
+  // We are informed about the end of the standby maxima, too.
+  if ((m_standby != NULL) && (event.GetPid() == m_standby->GetProcessPid()))
+  {
+    m_standby->ProcessEnded();
+    wxDELETE(m_standby);
+    return;
+  }
+
   wxLogMessage(_("Maxima has terminated."));
   m_statusBar->NetworkStatus(StatusBar::offline);
+  if (m_headless && !m_closing)
+  {
+    wxLogError(wxString::Format(_("%s: Maxima has terminated during the evaluation"),
+                                m_worksheet->m_currentFile));
+    m_headlessError = true;
+    m_process = NULL;
+    Close();
+    return;
+  }
   if (!m_closing)
   {
     RightStatusText(_("Maxima process terminated."));
@@ -1346,6 +1544,8 @@ void wxMaxima::ReadFirstPrompt(wxString &data)
                                 prompt_compact));
 
   wxLogMessage(wxString::Format(_("Maxima's PID is %li"),(long)m_pid));
+  // Now that maxima is up the next restart can be prepared for.
+  StartStandby();
   // Remove the first prompt from Maxima's answer.
   data = data.Right(data.Length() - end - m_firstPrompt.Length());
 
@@ -1368,7 +1568,11 @@ void wxMaxima::ReadFirstPrompt(wxString &data)
         m_worksheet->OpenNextOrCreateCell();
     }
     if (m_exitAfterEval && m_worksheet->m_evaluationQueue.Empty())
+    {
+      // A document without anything to evaluate has been evaluated successfully.
+      m_headlessCompleted = m_isNamed && !m_openInitialFileError;
       Close();
+    }
   }
   else
     TriggerEvaluation();
@@ -1377,7 +1581,8 @@ void wxMaxima::ReadFirstPrompt(wxString &data)
 int wxMaxima::GetMiscTextEnd(const wxString &data)
 {
   // These tests are redundant with later tests. But they are faster.
-  if(data.StartsWith("<mth>"))
+  // "<mth" matches both <mth> and the compact <mthc>.
+  if(data.StartsWith("<mth"))
     return 0;
   if(data.StartsWith("<lbl>"))
     return 0;
@@ -1394,7 +1599,7 @@ int wxMaxima::GetMiscTextEnd(const wxString &data)
   if(data.StartsWith(m_suppressOutputPrefix))
     return 0;
 
-  int mthpos = data.Find("<mth>");
+  int mthpos = data.Find("<mth");
   int lblpos = data.Find("<lbl>");
   int statpos = data.Find("<statusbar>");
   int prmptpos = data.Find(m_promptPrefix);
@@ -1579,15 +1784,19 @@ void wxMaxima::ReadStatusBar(wxString &data)
  */
 void wxMaxima::ReadMath(wxString &data)
 {
-  wxString mthstart = wxT("<mth>");
-  if (!data.StartsWith(mthstart))
+  // Math in the compact encoding is enclosed in <mthc> and </mthc> instead.
+  wxString mthend;
+  if (data.StartsWith(wxT("<mth>")))
+    mthend = wxT("</mth>");
+  else if (data.StartsWith(wxT("<mthc>")))
+    mthend = wxT("</mthc>");
+  else
     return;
 
   m_worksheet->m_cellPointers.m_currentTextCell = NULL;
 
   // Append everything from the "beginning of math" to the "end of math" marker
   // to the console and remove it from the data we got.
-  wxString mthend = wxT("</mth>");
   int end;
   if ((end = FindTagEnd(data,mthend)) != wxNOT_FOUND)
   {
@@ -1812,9 +2021,17 @@ bool wxMaxima::QueryVariableValue()
   
   if(m_varNamesToQuery.GetCount() > 0)
   {
-    SendMaxima(wxT(":lisp-quiet (wx-query-variable \"") +
-               m_varNamesToQuery.Last()+wxT("\")\n"));
-    m_varNamesToQuery.RemoveAt(m_varNamesToQuery.GetCount()-1);
+    wxString cmd = wxT(":lisp-quiet (wx-query-variables ");
+    if(m_queryAllVariableValues)
+      cmd += wxT("nil");
+    else
+      cmd += wxT("t");
+    for(size_t i = 0; i < m_varNamesToQuery.GetCount(); i++)
+      cmd += wxT(" \"") + m_varNamesToQuery[i] + wxT("\"");
+    cmd += wxT(")\n");
+    SendMaxima(cmd);
+    m_varNamesToQuery.Clear();
+    m_queryAllVariableValues = false;
     return true;
   }
   else
@@ -1834,6 +2051,8 @@ void wxMaxima::ReadPrompt(wxString &data)
   if (!data.StartsWith(m_promptPrefix))
     return;
 
+  // All output that belongs to the last command has to be visible now.
+  m_worksheet->FlushBufferedOutput();
   m_worksheet->m_cellPointers.m_currentTextCell = NULL;
 
   // Assume we don't have a question prompt
@@ -1862,7 +2081,7 @@ void wxMaxima::ReadPrompt(wxString &data)
   // Depending on ibase the digits of the number might lie between 'A' and 'Z',
   // too. Input prompts also begin with a "(". Questions (hopefully)
   // don't do that; Lisp prompts look like question prompts.
-  if (
+  bool mainPrompt = (
     (
       (o.Length() > 2) &&
       o.StartsWith("(%") &&
@@ -1876,12 +2095,32 @@ void wxMaxima::ReadPrompt(wxString &data)
       m_worksheet->m_configuration->InLispMode() ||
     (o.StartsWith(wxT("MAXIMA>"))) ||
     (o.StartsWith(wxT("\nMAXIMA>")))
-    )
+    );
+
+  if (mainPrompt)
+    m_profiler->PromptReceived();
+
+  // Maxima still executes the commands that had been sent before the
+  // evaluation was aborted. Their prompts mustn't end a command of the queue.
+  bool orphanFinished = mainPrompt && m_worksheet->m_evaluationQueue.OrphanedCommandFinished();
+  if (orphanFinished && (m_worksheet->m_evaluationQueue.OrphanedCommands() > 0))
+  {
+    // The output of the commands that follow doesn't belong to the cell that
+    // has caused the abort.
+    m_worksheet->m_cellPointers.SetWorkingGroup(NULL);
+    m_worksheet->QuestionAnswered();
+    m_lastPrompt = o;
+    m_maximaBusy = true;
+  }
+  else if (mainPrompt)
   {
     // Maxima displayed a new main prompt => We don't have a question
     m_worksheet->QuestionAnswered();
-    // And we can remove one command from the evaluation queue.
-    m_worksheet->m_evaluationQueue.RemoveFirst();
+    // And we can remove one command from the evaluation queue. If this was the
+    // prompt of the last orphaned command maxima hasn't been sent the first
+    // command of the queue, yet.
+    if (m_worksheet->m_evaluationQueue.CommandSent())
+      m_worksheet->m_evaluationQueue.RemoveFirst();
 
     //m_lastPrompt = o.Mid(1,o.Length()-1);
     //m_lastPrompt.Replace(wxT(")"), wxT(":"), false);
@@ -1904,11 +2143,13 @@ void wxMaxima::ReadPrompt(wxString &data)
       m_worksheet->FollowEvaluation(false);
       if (m_exitAfterEval)
       {
-        SaveFile(false);
+        m_headlessCompleted = SaveFile(false);
         Close();
       }
       // Inform the user that the evaluation queue is empty.
       EvaluationQueueLength(0);
+      if (m_worksheet->m_evaluationQueue.GetCell() != NULL)
+        m_worksheet->m_evaluationQueue.GetCell()->OutputComplete();
       m_worksheet->m_cellPointers.SetWorkingGroup(NULL);
       m_worksheet->m_evaluationQueue.RemoveFirst();
       m_worksheet->RequestRedraw();
@@ -1935,11 +2176,28 @@ void wxMaxima::ReadPrompt(wxString &data)
   }
   else
   {  // We have a question
+    if (m_worksheet->m_evaluationQueue.CommandsSent() > 1)
+      wxLogMessage(_("Maxima asks a question, but has already been sent the next commands. "
+                     "It might read them as the answer."));
     m_worksheet->QuestionAnswered();
     m_worksheet->QuestionPending(true);
     // If the user answers a question additional output might be required even
     // if the question has been preceded by many lines.
     m_outputCellsFromCurrentCommand = 0;
+    // Nobody can answer a question in headless mode.
+    if (m_headless &&
+        ((m_worksheet->GetWorkingGroup() == NULL) ||
+         !m_worksheet->GetWorkingGroup()->AutoAnswer() ||
+         m_worksheet->m_evaluationQueue.AnswersEmpty()))
+    {
+      wxLogError(wxString::Format(_("%s: Maxima has asked a question no answer is known for: %s"),
+                                  m_worksheet->m_currentFile, o));
+      m_headlessError = true;
+      m_worksheet->m_evaluationQueue.Clear();
+      m_headlessCompleted = SaveFile(false);
+      Close();
+      return;
+    }
     if((m_worksheet->GetWorkingGroup() == NULL) ||
        ((m_worksheet->GetWorkingGroup()->m_knownAnswers.empty()) &&
         m_worksheet->GetWorkingGroup()->AutoAnswer()))
@@ -1949,11 +2207,13 @@ void wxMaxima::ReadPrompt(wxString &data)
       m_worksheet->m_configuration->SetDefaultCellToolTip(
         _("Most questions can be avoided using the assume() "
           "and the declare() command"));
-      if (o.Find(wxT("<mth>")) > -1)
+      if (o.Find(wxT("<mth")) > -1)
         DoConsoleAppend(o, MC_TYPE_PROMPT);
       else
         DoRawConsoleAppend(o, MC_TYPE_PROMPT);
       m_worksheet->m_configuration->SetDefaultCellToolTip(wxEmptyString);
+      // The question caret is placed after the question.
+      m_worksheet->FlushBufferedOutput();
   }
     if (m_worksheet->ScrolledAwayFromEvaluation())
     {
@@ -2015,14 +2275,7 @@ void wxMaxima::SetCWD(wxString file)
   if (workingDirectory != GetCWD())
   {
     wxLogMessage(_("Telling maxima about the new working directory."));
-    m_configCommands += wxT(":lisp-quiet (setf $wxfilename \"") +
-      filenamestring +
-      wxT("\")\n");
-    m_configCommands += wxT(":lisp-quiet (setf $wxdirname \"") +
-      dirname +
-      wxT("\")\n");
-
-    m_configCommands += wxT(":lisp-quiet (wx-cd \"") + filenamestring + wxT("\")\n");
+    m_configCommands += CWDCommands(filenamestring, dirname);
     if (m_ready)
     {
       if (m_worksheet->m_evaluationQueue.Empty())
@@ -2032,6 +2285,13 @@ void wxMaxima::SetCWD(wxString file)
   }
 }
 
+wxString wxMaxima::CWDCommands(wxString filename, wxString dirname)
+{
+  return wxT(":lisp-quiet (setf $wxfilename \"") + filename + wxT("\")\n") +
+    wxT(":lisp-quiet (setf $wxdirname \"") + dirname + wxT("\")\n") +
+    wxT(":lisp-quiet (wx-cd \"") + filename + wxT("\")\n");
+}
+
 wxString wxMaxima::ReadMacContents(wxString file)
 {
   bool xMaximaFile = file.Lower().EndsWith(wxT(".out"));
@@ -2771,15 +3031,26 @@ wxString wxMaxima::EscapeForLisp(wxString str)
 void wxMaxima::SetupVariables()
 {
   wxLogMessage(_("Setting a few prerequisites for wxMaxima"));
-  SendMaxima(wxT(":lisp-quiet (progn (setf *prompt-suffix* \"") +
-             m_promptSuffix +
-             wxT("\") (setf *prompt-prefix* \"") +
-             m_promptPrefix +
-             wxT("\") (setf $in_netmath nil) (setf $show_openplot t))\n"));
+  wxArrayString commands = SetupCommands();
+  for (size_t i = 0; i < commands.GetCount(); i++)
+    SendMaxima(commands[i]);
+
+  wxLogMessage(_("Updating maxima's configuration"));
+  ConfigChanged();
+}
 
-  wxLogMessage(_("Sending maxima the info how to express 2d maths as XML"));
+wxArrayString wxMaxima::SetupCommands()
+{
+  wxArrayString commands;
+  commands.Add(wxT(":lisp-quiet (progn (setf *prompt-suffix* \"") +
+               m_promptSuffix +
+               wxT("\") (setf *prompt-prefix* \"") +
+               m_promptPrefix +
+               wxT("\") (setf $in_netmath nil) (setf $show_openplot t))\n"));
+
+  // The info how to express 2d maths as XML
   wxMathML wxmathml;
-  SendMaxima(wxmathml.GetCmd());
+  commands.Add(wxmathml.GetCmd());
   wxString cmd;
 
 #if defined (__WXOSX__)
@@ -2788,24 +3059,26 @@ void wxMaxima::SetupVariables()
     cmd += wxT("\n:lisp-quiet (setf $gnuplot_command \"") + gnuplotbin + wxT("\")\n");
 #endif
   cmd.Replace(wxT("\\"),wxT("/"));
-  SendMaxima(cmd);
+  if(!cmd.IsEmpty())
+    commands.Add(cmd);
 
   wxString wxmaximaversion_lisp(wxT(GITVERSION));
   wxmaximaversion_lisp.Replace("\\","\\\\");
   wxmaximaversion_lisp.Replace("\"","\\\"");
 
-  wxLogMessage(_("Updating maxima's configuration"));
-
-  SendMaxima(wxString(wxT(":lisp-quiet (progn (setq $wxmaximaversion \"")) +
-             wxString(wxmaximaversion_lisp) +
-             wxT("\") ($put \'$wxmaxima (read-wxmaxima-version \"" +
-             wxString(wxmaximaversion_lisp) +
-             wxT("\") '$version) (setq $wxwidgetsversion \"")) + wxString(wxVERSION_STRING) +
-             wxT("\")   (if (boundp $maxima_frontend_version) (setq $maxima_frontend_version \"" +
-                 wxmaximaversion_lisp + "\")) (ignore-errors (setf (symbol-value '*lisp-quiet-suppressed-prompt*) \"" + m_promptPrefix + "(%i1)" + m_promptSuffix + "\")))\n")
+  commands.Add(wxString(wxT(":lisp-quiet (progn (setq $wxmaximaversion \"")) +
+               wxString(wxmaximaversion_lisp) +
+               wxT("\") ($put \'$wxmaxima (read-wxmaxima-version \"" +
+               wxString(wxmaximaversion_lisp) +
+               wxT("\") '$version) (setq $wxwidgetsversion \"")) + wxString(wxVERSION_STRING) +
+               wxT("\") (setq $wxframedprotocol ") +
+               (m_worksheet->m_configuration->FramedProtocol() ? wxT("t") : wxT("nil")) +
+               wxT(") (setq $wxcompactxml ") +
+               (m_worksheet->m_configuration->CompactXml() ? wxT("t") : wxT("nil")) +
+               wxT(")   (if (boundp $maxima_frontend_version) (setq $maxima_frontend_version \"" +
+                   wxmaximaversion_lisp + "\")) (ignore-errors (setf (symbol-value '*lisp-quiet-suppressed-prompt*) \"" + m_promptPrefix + "(%i1)" + m_promptSuffix + "\")))\n")
     );
-
-  ConfigChanged();
+  return commands;
 }
 
 ///--------------------------------------------------------------------------------
@@ -3197,6 +3470,18 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
     return;
   }
 
+  // The banner and the first prompt of a standby maxima we have taken over are
+  // interpreted only after StartMaxima() has returned: The same way as the
+  // ones of a maxima that has just been started.
+  if (!m_dataFromStandby.IsEmpty())
+  {
+    m_newCharsFromMaxima += m_dataFromStandby;
+    m_dataFromStandby = wxEmptyString;
+    InterpretDataFromMaxima();
+    event.RequestMore();
+    return;
+  }
+
   // Update the info what maxima is currently doing
   UpdateStatusMaximaBusy();
 
@@ -3276,7 +3561,10 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
 
       bool incrementalSearch = true;
         wxConfig::Get()->Read("incrementalSearch", &incrementalSearch);
-        if ((incrementalSearch) && (m_worksheet->m_findDialog != NULL))
+        // Incomplete regular expressions typed in so far are most probably
+        // invalid => no incremental search for them.
+        if ((incrementalSearch) && (m_worksheet->m_findDialog != NULL) &&
+            !(m_findData.GetFlags() & FR_REGEX))
         {
           m_worksheet->FindIncremental(m_findData.GetFindString(),
                                      m_findData.GetFlags() & wxFR_DOWN,
@@ -3372,14 +3660,33 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
   if((m_xmlInspector != NULL) && (m_xmlInspector->UpdateNeeded()))
     m_xmlInspector->Update();
 
+  m_profiler->UpdateFrontendTimes(m_worksheet->TotalLayoutTime(), m_worksheet->TotalDrawTime());
+  if(m_profiler->UpdateNeeded())
+    m_profiler->Update();
+
   UpdateDrawPane();
-  
+
+  // Add the definitions from the cells maxima has been sent to the
+  // autocompletion. One cell at a time keeps the GUI responsive.
+  std::list<Cell *> &groupsToHarvest = m_worksheet->m_cellPointers.m_groupsToHarvest;
+  if (!groupsToHarvest.empty())
+  {
+    GroupCell *group = dynamic_cast<GroupCell *>(groupsToHarvest.front());
+    groupsToHarvest.pop_front();
+    HarvestSymbols(group);
+    if (!groupsToHarvest.empty())
+      event.RequestMore();
+  }
+
   // On MS Windows sometimes we don't get a wxSOCKET_INPUT event on input.
   // Let's trigger interpretation of new input if we don't have anything
   // else to do just to make sure that wxMaxima will eventually restart
   // receiving data.
   wxSocketEvent dummy(wxSOCKET_INPUT);
   ClientEvent(dummy);
+  // For the same reason we don't rely on being informed about the socket
+  // being able to accept more data, either.
+  FlushSendBuffer();
 
   // Tell wxWidgets it can process its own idle commands, as well.
   event.Skip();
@@ -3926,7 +4233,59 @@ bool wxMaxima::SaveFile(bool forceSave)
   return true;
 }
 
-void wxMaxima::ReadStdErr()
+wxString wxMaxima::ReadPipe(wxInputStream *stream, wxMemoryBuffer &pending, bool &moreData)
+{
+  char buf[4096];
+  size_t bytesRead = 0;
+  while (stream->CanRead())
+  {
+    if (bytesRead >= MAXIMAPIPEMAXBYTES)
+    {
+      moreData = true;
+      break;
+    }
+    stream->Read(buf, sizeof(buf));
+    size_t len = stream->LastRead();
+    if (len == 0)
+      break;
+    pending.AppendData(buf, len);
+    bytesRead += len;
+  }
+
+  // Don't convert the start of a multi-byte character whose rest hasn't
+  // arrived yet.
+  const unsigned char *data = (const unsigned char *) pending.GetData();
+  size_t len = pending.GetDataLen();
+  size_t complete = len;
+  for (size_t i = 1; (i <= 4) && (i <= len); i++)
+  {
+    unsigned char ch = data[len - i];
+    if ((ch & 0xC0) == 0x80)
+      continue;
+    size_t charLen = 1;
+    if ((ch & 0xE0) == 0xC0)
+      charLen = 2;
+    else if ((ch & 0xF0) == 0xE0)
+      charLen = 3;
+    else if ((ch & 0xF8) == 0xF0)
+      charLen = 4;
+    if (charLen > i)
+      complete = len - i;
+    break;
+  }
+
+  wxString retval = wxString::FromUTF8((const char *) data, complete);
+  // Not everything maxima's lisp prints is valid UTF-8
+  if (retval.IsEmpty() && (complete > 0))
+    retval = wxString((const char *) data, wxConvISO8859_1, complete);
+
+  wxMemoryBuffer rest;
+  rest.AppendData(data + complete, len - complete);
+  pending = rest;
+  return retval;
+}
+
+bool wxMaxima::ReadStdErr()
 {
   SuppressErrorDialogs blocker;
   // Maxima will never send us any data via stderr after it has finished
@@ -3936,20 +4295,13 @@ void wxMaxima::ReadStdErr()
   // If something is severely broken this might not be true, though, and we want
   // to inform the user about it.
 
-  if (m_process == NULL) return;
+  if (m_process == NULL) return false;
 
+  bool moreData = false;
   if (m_process->IsInputAvailable())
   {
     wxASSERT_MSG(m_maximaStdout != NULL, wxT("Bug: Trying to read from maxima but don't have a input stream"));
-    wxTextInputStream istrm(*m_maximaStdout, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-    wxString o;
-    wxChar ch;
-    int len = 0;
-    while (((ch = istrm.GetChar()) != wxT('\0')) && (m_maximaStdout->CanRead()))
-    {
-      o += ch;
-      len++;
-    }
+    wxString o = ReadPipe(m_maximaStdout, m_maximaStdoutPending, moreData);
 
     wxString o_trimmed = o;
     o_trimmed.Trim();
@@ -3962,15 +4314,7 @@ void wxMaxima::ReadStdErr()
   if (m_process->IsErrorAvailable())
   {
     wxASSERT_MSG(m_maximaStderr != NULL, wxT("Bug: Trying to read from maxima but don't have a error input stream"));
-    wxTextInputStream istrm(*m_maximaStderr, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-    wxString o;
-    wxChar ch;
-    int len = 0;
-    while (((ch = istrm.GetChar()) != wxT('\0')) && (m_maximaStderr->CanRead()))
-    {
-      o += ch;
-      len++;
-    }
+    wxString o = ReadPipe(m_maximaStderr, m_maximaStderrPending, moreData);
 
     wxString o_trimmed = o;
     o_trimmed.Trim();
@@ -3989,6 +4333,12 @@ void wxMaxima::ReadStdErr()
     else
       DoRawConsoleAppend(o, MC_TYPE_DEFAULT);
   }
+
+  // Read the rest of a flood of data soon, but give the GUI the chance to
+  // react to the user in between.
+  if (moreData)
+    m_maximaStdoutPollTimer.StartOnce(MAXIMAPIPEDRAINMSECS);
+  return moreData;
 }
 
 bool wxMaxima::AbortOnError()
@@ -3996,7 +4346,15 @@ bool wxMaxima::AbortOnError()
   // Maxima encountered an error.
   // The question is now if we want to try to send it something new to evaluate.
 
-  ExitAfterEval(false);
+  // In headless mode nobody can look at the error => save the document and
+  // exit anyway, but report the error.
+  if (m_headless)
+  {
+    wxLogError(wxString::Format(_("%s: Maxima has issued an error"), m_worksheet->m_currentFile));
+    m_headlessError = true;
+  }
+  else
+    ExitAfterEval(false);
   EvalOnStartup(false);
 
   if (m_worksheet->m_notificationMessage != NULL)
@@ -4007,9 +4365,10 @@ bool wxMaxima::AbortOnError()
     m_worksheet->m_notificationMessage->m_errorNotificationCell = m_worksheet->GetWorkingGroup(true);
   }
   
-  m_exitAfterEval = false;
   if (m_worksheet->m_configuration->GetAbortOnError())
   {
+    // Commands that have been sent ahead cannot be taken back: Maxima still
+    // executes them, but their output no more goes to the cells they came from.
     m_worksheet->m_evaluationQueue.Clear();
     // Inform the user that the evaluation queue is empty.
     EvaluationQueueLength(0);
@@ -4158,9 +4517,10 @@ void wxMaxima::OnTimerEvent(wxTimerEvent &event)
       wxLogMessage(_("String from maxima apparently didn't end in a newline"));
       break;
     case MAXIMA_STDOUT_POLL_ID:
-      ReadStdErr();
+    {
+      bool moreData = ReadStdErr();
 
-      if (m_process != NULL)
+      if ((m_process != NULL) && (!moreData))
       {
         // The atexit() of maxima informs us if the process dies. But it sometimes doesn't do
         // so if it dies due to an out of memory => Periodically check if it really lives.
@@ -4180,6 +4540,7 @@ void wxMaxima::OnTimerEvent(wxTimerEvent &event)
       }
 
       break;
+    }
     case KEYBOARD_INACTIVITY_TIMER_ID:
     case AUTO_SAVE_TIMER_ID:
       if ((!m_worksheet->m_keyboardInactiveTimer.IsRunning()) && (!m_autoSaveTimer.IsRunning()))
@@ -4762,7 +5123,9 @@ void wxMaxima::OnFind(wxFindDialogEvent &event)
 {
   if (!m_worksheet->FindNext(event.GetFindString(),
                            event.GetFlags() & wxFR_DOWN,
-                           !(event.GetFlags() & wxFR_MATCHCASE)))
+                           !(event.GetFlags() & wxFR_MATCHCASE),
+                           true,
+                           event.GetFlags() & FR_REGEX))
     wxMessageBox(_("No matches found!"));
 }
 
@@ -4778,12 +5141,15 @@ void wxMaxima::OnReplace(wxFindDialogEvent &event)
 {
   m_worksheet->Replace(event.GetFindString(),
                      event.GetReplaceString(),
-                     !(event.GetFlags() & wxFR_MATCHCASE)
+                     !(event.GetFlags() & wxFR_MATCHCASE),
+                     event.GetFlags() & FR_REGEX
   );
 
   if (!m_worksheet->FindNext(event.GetFindString(),
                            event.GetFlags() & wxFR_DOWN,
-                           !(event.GetFlags() & wxFR_MATCHCASE)
+                           !(event.GetFlags() & wxFR_MATCHCASE),
+                           true,
+                           event.GetFlags() & FR_REGEX
   )
           )
     wxMessageBox(_("No matches found!"));
@@ -4796,7 +5162,8 @@ void wxMaxima::OnReplaceAll(wxFindDialogEvent &event)
   int count = m_worksheet->ReplaceAll(
           event.GetFindString(),
           event.GetReplaceString(),
-          !(event.GetFlags() & wxFR_MATCHCASE)
+          !(event.GetFlags() & wxFR_MATCHCASE),
+          event.GetFlags() & FR_REGEX
   );
 
   wxMessageBox(wxString::Format(_("Replaced %d occurrences."), count));
@@ -4919,6 +5286,19 @@ void wxMaxima::MaximaMenu(wxCommandEvent &event)
       TriggerEvaluation();
     }
       break;
+    case menu_evaluate_stale:
+    {
+      m_worksheet->m_evaluationQueue.Clear();
+      EvaluationQueueLength(0);
+      m_worksheet->AddStaleCellsToEvaluationQueue();
+      // Inform the user about the length of the evaluation queue.
+      EvaluationQueueLength(m_worksheet->m_evaluationQueue.Size(), m_worksheet->m_evaluationQueue.CommandsLeftInCell());
+      TriggerEvaluation();
+    }
+      break;
+    case menu_evaluate_independent:
+      EvaluateIndependentSections();
+      break;
     case ToolBar::tb_evaltillhere:
     {
       m_worksheet->m_evaluationQueue.Clear();
@@ -6955,6 +7335,11 @@ void wxMaxima::HelpMenu(wxCommandEvent &event)
       MenuCommand(wxT("wxbuild_info()$"));
       break;
 
+    case menu_memory_report:
+      // Walks the whole worksheet => is only done on request.
+      wxLogMessage(m_worksheet->MemoryReport());
+      break;
+
     case menu_bug_report:
       MenuCommand(wxT("wxbug_report()$"));
       break;
@@ -7224,7 +7609,9 @@ void wxMaxima::OnClose(wxCloseEvent &event)
   if(event.GetEventType() == wxEVT_END_SESSION)
     KillMaxima();;
   
-  if (SaveNecessary())
+  // Headless windows save their document themselves if the evaluation has
+  // worked and must never wait for an answer from the user.
+  if (SaveNecessary() && !m_headless)
   {
     // If autosave is on we automatically save the file on closing.
     if(m_isNamed && (m_worksheet->m_configuration->AutoSaveMiliseconds() > 0))
@@ -7833,6 +8220,7 @@ void wxMaxima::VarAddAllEvent(wxCommandEvent &WXUNUSED(event))
 void wxMaxima::VarReadEvent(wxCommandEvent &WXUNUSED(event))
 {
   m_varNamesToQuery = m_worksheet->m_variablesPane->GetEscapedVarnames();
+  m_queryAllVariableValues = true;
   QueryVariableValue();
 }
 
@@ -7878,6 +8266,8 @@ void wxMaxima::EvaluateEvent(wxCommandEvent &WXUNUSED(event))
     else
     { // normally just add to queue (and mark the cell as no more containing an error message)
       m_worksheet->m_cellPointers.m_errorList.Remove(cell);
+      // Evaluating a single cell explicitly always recalculates it.
+      cell->DiscardOutputKey();
       m_worksheet->AddCellToEvaluationQueue(cell);
     }
   }
@@ -8013,6 +8403,30 @@ void wxMaxima::TriggerEvaluation()
 
   // Maxima is connected. Let's test if the evaluation queue is empty.
   GroupCell *tmp = dynamic_cast<GroupCell *>(m_worksheet->m_evaluationQueue.GetCell());
+
+  // Cells whose output still is what maxima would answer don't need to be
+  // sent to maxima again.
+  if ((tmp != NULL) && m_worksheet->m_configuration->ReuseOutput() &&
+      m_worksheet->m_evaluationQueue.m_workingGroupChanged &&
+      !m_worksheet->m_evaluationQueue.CommandSent())
+  {
+    if (!m_worksheet->m_evaluationQueue.InputKeysValid())
+    {
+      m_worksheet->UpdateInputKeys();
+      m_worksheet->m_evaluationQueue.InputKeysValid(true);
+    }
+    while ((tmp != NULL) && tmp->OutputCached())
+    {
+      tmp->OutputFromCache(true);
+      tmp->GetInput()->ContainsChanges(false);
+      tmp->InEvaluationQueue(false);
+      tmp->LastInEvaluationQueue(false);
+      m_worksheet->m_evaluationQueue.SkipCell();
+      m_worksheet->RequestRedraw();
+      tmp = dynamic_cast<GroupCell *>(m_worksheet->m_evaluationQueue.GetCell());
+    }
+  }
+
   if (tmp == NULL)
   {
     // Maxima is no more busy.
@@ -8074,7 +8488,10 @@ void wxMaxima::TriggerEvaluation()
         m_worksheet->SetSelection(NULL, NULL);
     }
     tmp->RemoveOutput();
+    tmp->InputEvaluated();
     m_worksheet->RequestRedraw();
+    // Finding out what the cell defines can wait until its commands are sent.
+    HarvestSymbolsLater(tmp);
   }
 
   wxString text = m_worksheet->m_evaluationQueue.GetCommand();
@@ -8098,11 +8515,18 @@ void wxMaxima::TriggerEvaluation()
       m_worksheet->m_cellPointers.SetWorkingGroup(tmp);
       tmp->GetPrompt()->SetValue(m_lastPrompt);
 
-      SendMaxima(m_configCommands + text, true);
+      // In the pipelined mode maxima might already work on this command.
+      if (!m_worksheet->m_evaluationQueue.CommandSent())
+      {
+        SendMaxima(m_configCommands + text, true);
+        m_profiler->CommandSent(text, tmp);
+        m_worksheet->m_evaluationQueue.MarkCommandSent();
+        m_configCommands = wxEmptyString;
+      }
+      SendCommandsAhead();
       m_maximaBusy = true;
       // Now that we have sent a command we need to query all variable values anew
       m_varNamesToQuery = m_worksheet->m_variablesPane->GetEscapedVarnames();
-      m_configCommands = wxEmptyString;
 
       EvaluationQueueLength(m_worksheet->m_evaluationQueue.Size(),
                             m_worksheet->m_evaluationQueue.CommandsLeftInCell()
@@ -8158,6 +8582,8 @@ void wxMaxima::TriggerEvaluation()
   }
   else
   {
+    // All commands of this cell have been answered.
+    tmp->OutputComplete();
     m_outputCellsFromCurrentCommand = 0;
     m_worksheet->m_evaluationQueue.RemoveFirst();
     TriggerEvaluation();
@@ -8166,6 +8592,329 @@ void wxMaxima::TriggerEvaluation()
 
 }
 
+void wxMaxima::SendCommandsAhead()
+{
+  if (!m_worksheet->m_configuration->PipelineCommands())
+    return;
+  if (m_worksheet->m_configuration->InLispMode())
+    return;
+
+  wxString text;
+  GroupCell *cell;
+  while ((m_worksheet->m_evaluationQueue.CommandsSent() < MAXIMAPIPELINEDEPTH) &&
+         m_worksheet->m_evaluationQueue.GetCommandAhead(text, cell))
+  {
+    // Commands maxima might not answer by a prompt (like :lisp), commands
+    // whose ending is added only when they are evaluated and commands from
+    // cells that are known to ask questions have to wait for their turn.
+    if (text.StartsWith(wxT(":")) ||
+        (text == wxT(";")) || (text == wxT("$")) ||
+        (!text.EndsWith(wxT(";")) && !text.EndsWith(wxT("$"))) ||
+        !cell->m_knownAnswers.empty())
+      return;
+
+    int index;
+    if ((cell != m_worksheet->m_evaluationQueue.GetCell()) &&
+        !m_worksheet->m_evaluationQueue.IsSentAhead(cell))
+    {
+      // Maxima wouldn't see changes the user makes to a cell that is being
+      // edited after its commands have been sent. The other cells are kept
+      // from being edited until they are evaluated.
+      EditorCell *active = m_worksheet->GetActiveCell();
+      if ((active != NULL) && (active->GetGroup() == cell))
+        return;
+      // TriggerEvaluation() refuses to evaluate a cell with unmatched
+      // parenthesis => none of its commands may be sent ahead.
+      if (GetUnmatchedParenthesisState(cell->GetEditable()->ToString(true), index) != wxEmptyString)
+        return;
+    }
+    if (GetUnmatchedParenthesisState(text, index) != wxEmptyString)
+      return;
+
+    SendMaxima(text, true);
+    m_profiler->CommandSent(text, cell);
+    m_worksheet->m_evaluationQueue.MarkCommandAheadSent(cell);
+  }
+}
+
+void wxMaxima::HarvestSymbolsLater(GroupCell *group)
+{
+  // A cell might be evaluated again before wxMaxima has been idle.
+  std::list<Cell *> &groupsToHarvest = m_worksheet->m_cellPointers.m_groupsToHarvest;
+  if ((group == NULL) || (std::find(groupsToHarvest.begin(), groupsToHarvest.end(), group) !=
+                          groupsToHarvest.end()))
+    return;
+  groupsToHarvest.push_back(group);
+}
+
+void wxMaxima::HarvestSymbols(GroupCell *group)
+{
+  if ((group == NULL) || (group->GetEditable() == NULL))
+    return;
+
+  wxArrayString defines;
+  wxArrayString uses;
+  group->GetDependencies(defines, uses);
+  std::vector<MaximaTokenizer::Token *> tokens = group->GetCodeTokens();
+
+  // GetDependencies() reports the assignments to the local variables of a
+  // block([x, y:1], x:2) as definitions, too. They vanish as soon as the
+  // block is left => don't offer them. If the same cell assigns a value to a
+  // global variable of the same name this errs on the side of not offering it.
+  wxArrayString locals;
+  for (size_t i = 0; i + 2 < tokens.size(); i++)
+  {
+    if ((tokens[i]->GetText() != wxT("block")) ||
+        (tokens[i + 1]->GetText() != wxT("(")) ||
+        (tokens[i + 2]->GetText() != wxT("[")))
+      continue;
+
+    // The names in the list are the ones at its top level that start an element.
+    int depth = 0;
+    bool startOfElement = true;
+    for (size_t next = i + 3; next < tokens.size(); next++)
+    {
+      wxString text = tokens[next]->GetText();
+      if ((text == wxT("]")) && (depth == 0))
+        break;
+      if ((text == wxT("(")) || (text == wxT("[")))
+        depth++;
+      else if ((text == wxT(")")) || (text == wxT("]")))
+        depth--;
+      else if ((depth == 0) && (text == wxT(",")))
+      {
+        startOfElement = true;
+        continue;
+      }
+      if (startOfElement && (depth == 0) && (tokens[next]->GetStyle() == TS_CODE_VARIABLE))
+        locals.Add(text);
+      startOfElement = false;
+      if (tokens[next]->GetStyle() == TS_CODE_ENDOFLINE)
+        break;
+    }
+  }
+
+  for (size_t i = 0; i < defines.GetCount(); i++)
+    if (locals.Index(defines[i]) == wxNOT_FOUND)
+      m_worksheet->AddSymbol(defines[i]);
+
+  // For function definitions of the form name(arg1, [arg2]) := body we also
+  // offer a template that lists the arguments.
+  for (size_t i = 0; i + 1 < tokens.size(); i++)
+  {
+    if ((tokens[i]->GetStyle() != TS_CODE_FUNCTION) ||
+        (tokens[i + 1]->GetText() != wxT("(")))
+      continue;
+    wxString name = tokens[i]->GetText();
+    if ((defines.Index(name) == wxNOT_FOUND) || (locals.Index(name) != wxNOT_FOUND))
+      continue;
+
+    wxArrayString args;
+    wxString arg;
+    size_t next;
+    bool simpleArgs = true;
+    for (next = i + 2; (next < tokens.size()) && (tokens[next]->GetText() != wxT(")")); next++)
+    {
+      wxString text = tokens[next]->GetText();
+      if (text == wxT(","))
+      {
+        args.Add(arg);
+        arg = wxEmptyString;
+      }
+      else if ((text == wxT("(")) || (tokens[next]->GetStyle() == TS_CODE_ENDOFLINE))
+        simpleArgs = false;
+      else
+        arg += text;
+    }
+    args.Add(arg);
+    if ((!simpleArgs) || (next + 2 >= tokens.size()) ||
+        (tokens[next + 1]->GetText() != wxT(":")) ||
+        (tokens[next + 2]->GetText() != wxT("=")))
+      continue;
+
+    // Create a template from the input
+    wxString funName = name + wxT("(");
+    int count = 0;
+    for (size_t j = 0; j < args.GetCount(); j++)
+    {
+      if (count > 0)
+        funName << wxT(",");
+      wxString a = args[j];
+      if (a != wxEmptyString)
+      {
+        if (a[0] == '[')
+          funName << wxT("[<") << a.SubString(1, a.Length() - 2) << wxT(">]");
+        else
+          funName << wxT("<") << a << wxT(">");
+        count++;
+      }
+    }
+    funName << wxT(")");
+    m_worksheet->AddSymbol(funName, AutoComplete::tmplte);
+  }
+}
+
+void wxMaxima::EvaluateIndependentSections()
+{
+  std::list<std::list<GroupCell *> > sections;
+  m_worksheet->GetIndependentSections(sections);
+  if (sections.empty())
+  {
+    RightStatusText(_("No section is marked as independent of the rest of the worksheet."));
+    return;
+  }
+
+  for (std::list<std::list<GroupCell *> >::iterator section = sections.begin();
+       section != sections.end(); ++section)
+  {
+    for (std::list<GroupCell *>::iterator group = section->begin();
+         group != section->end(); ++group)
+    {
+      // A cell that still waits for a worker mustn't be handed out twice.
+      if (std::find(m_worksheet->m_cellPointers.m_groupsInWorkers.begin(),
+                    m_worksheet->m_cellPointers.m_groupsInWorkers.end(),
+                    *group) != m_worksheet->m_cellPointers.m_groupsInWorkers.end())
+      {
+        RightStatusText(_("The independent sections are still being evaluated."));
+        return;
+      }
+    }
+  }
+
+  for (std::list<std::list<GroupCell *> >::iterator section = sections.begin();
+       section != sections.end(); ++section)
+  {
+    for (std::list<GroupCell *>::iterator group = section->begin();
+         group != section->end(); ++group)
+    {
+      (*group)->RemoveOutput();
+      m_worksheet->m_cellPointers.m_groupsInWorkers.push_back(*group);
+      // These cells don't pass the evaluation queue which normally does this.
+      HarvestSymbolsLater(*group);
+    }
+    m_independentSections.push_back(*section);
+  }
+  m_worksheet->Recalculate();
+  m_worksheet->RequestRedraw();
+  DispatchToWorkers();
+}
+
+void wxMaxima::DispatchToWorkers()
+{
+  // Start as many workers as we are allowed to and have sections for
+  int busyWorkers = 0;
+  for (std::vector<MaximaWorker *>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    if (!(*it)->IsIdle())
+      busyWorkers++;
+  while ((m_workers.size() < (size_t) wxMax(1, m_worksheet->m_configuration->MaximaWorkers())) &&
+         ((size_t) busyWorkers < m_independentSections.size()))
+  {
+    MaximaWorker *worker = new MaximaWorker(this, maxima_worker_id, m_promptPrefix, m_promptSuffix);
+    // The workers have to see the same settings and the same working
+    // directory the main maxima sees.
+    wxArrayString setup = SetupCommands();
+    setup.Add(ConfigCommands());
+    if (!GetCWD().IsEmpty())
+    {
+      wxString filename = m_worksheet->m_currentFile;
+      wxString dirname = GetCWD();
+#if defined (__WXMSW__)
+      filename.Replace(wxT("\\"), wxT("/"));
+      dirname.Replace(wxT("\\"), wxT("/"));
+#endif
+      setup.Add(CWDCommands(filename, dirname));
+    }
+    if (!worker->Start(GetCommand(), m_port + 1, setup))
+    {
+      delete worker;
+      if (m_workers.empty())
+      {
+        RightStatusText(_("Cannot start an additional maxima process."));
+        m_independentSections.clear();
+        m_worksheet->m_cellPointers.m_groupsInWorkers.clear();
+      }
+      break;
+    }
+    m_workers.push_back(worker);
+    busyWorkers++;
+  }
+
+  // Hand the sections to the workers that are ready. The ones that still
+  // start up will ask for work as soon as they are.
+  for (std::vector<MaximaWorker *>::iterator it = m_workers.begin();
+       (it != m_workers.end()) && !m_independentSections.empty(); ++it)
+  {
+    if ((*it)->IsIdle())
+    {
+      std::list<GroupCell *> section = m_independentSections.front();
+      m_independentSections.pop_front();
+      (*it)->Evaluate(section);
+    }
+  }
+}
+
+void wxMaxima::OnWorkerEvent(wxCommandEvent &event)
+{
+  MaximaWorker *worker = dynamic_cast<MaximaWorker *>(event.GetEventObject());
+  if (worker == NULL)
+    return;
+
+  std::list<Cell *> &groupsInWorkers = m_worksheet->m_cellPointers.m_groupsInWorkers;
+  GroupCell *group = worker->GetGroup();
+  // The cell might have been deleted since the worker started working on it.
+  bool groupExists = (group != NULL) &&
+    (std::find(groupsInWorkers.begin(), groupsInWorkers.end(), group) != groupsInWorkers.end());
+
+  switch (event.GetInt())
+  {
+  case MaximaWorker::worker_command_done:
+  case MaximaWorker::worker_failed:
+    if (groupExists)
+    {
+      // Temporarily redirect the output to the cell the worker is working on.
+      m_worksheet->FlushBufferedOutput();
+      Cell *workingGroup = m_worksheet->m_cellPointers.m_workingGroup;
+      Cell *lastWorkingGroup = m_worksheet->m_cellPointers.m_lastWorkingGroup;
+      Cell *currentTextCell = m_worksheet->m_cellPointers.m_currentTextCell;
+      int outputCellsFromCurrentCommand = m_outputCellsFromCurrentCommand;
+      m_worksheet->m_cellPointers.SetWorkingGroup(group);
+      m_worksheet->m_cellPointers.m_currentTextCell = NULL;
+      m_outputCellsFromCurrentCommand = 0;
+
+      group->GetPrompt()->SetValue(worker->GetPrompt());
+      ConsoleAppend(worker->GetOutput(), MC_TYPE_DEFAULT);
+      if (event.GetInt() == MaximaWorker::worker_failed)
+        groupsInWorkers.remove(group);
+      m_worksheet->FlushBufferedOutput();
+
+      m_worksheet->m_cellPointers.m_workingGroup = workingGroup;
+      m_worksheet->m_cellPointers.m_lastWorkingGroup = lastWorkingGroup;
+      m_worksheet->m_cellPointers.m_currentTextCell = currentTextCell;
+      m_outputCellsFromCurrentCommand = outputCellsFromCurrentCommand;
+      if (!m_maximaBusy)
+        StatusMaximaBusy(waiting);
+    }
+    break;
+  case MaximaWorker::worker_group_done:
+  case MaximaWorker::worker_group_dropped:
+    if (groupExists)
+      groupsInWorkers.remove(group);
+    break;
+  case MaximaWorker::worker_idle:
+    DispatchToWorkers();
+    break;
+  }
+}
+
+void wxMaxima::KillWorkers()
+{
+  for (std::vector<MaximaWorker *>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    delete *it;
+  m_workers.clear();
+  m_independentSections.clear();
+  m_worksheet->m_cellPointers.m_groupsInWorkers.clear();
+}
+
 void wxMaxima::InsertMenu(wxCommandEvent &event)
 {
   if(m_worksheet != NULL)
@@ -8197,6 +8946,19 @@ void wxMaxima::InsertMenu(wxCommandEvent &event)
       m_worksheet->RequestRedraw();
       return;
       break;
+    case Worksheet::popid_independent:
+      if((m_worksheet->GetSelectionStart() != NULL) &&
+         (m_worksheet->GetSelectionStart()->GetType() == MC_TYPE_GROUP))
+      {
+        GroupCell *gc = dynamic_cast<GroupCell *>(m_worksheet->GetSelectionStart());
+        if(gc->IsFoldable())
+        {
+          gc->Independent(event.IsChecked());
+          m_fileSaved = false;
+        }
+      }
+      return;
+      break;
     case Worksheet::popid_add_watch:
       if(m_worksheet->GetActiveCell())
       {
@@ -8832,6 +9594,7 @@ BEGIN_EVENT_TABLE(wxMaxima, wxFrame)
                 EVT_MENU(menu_help_tutorials, wxMaxima::HelpMenu)
                 EVT_MENU(menu_bug_report, wxMaxima::HelpMenu)
                 EVT_MENU(menu_build_info, wxMaxima::HelpMenu)
+                EVT_MENU(menu_memory_report, wxMaxima::HelpMenu)
                 EVT_MENU(menu_interrupt_id, wxMaxima::Interrupt)
                 EVT_MENU(menu_open_id, wxMaxima::FileMenu)
                 EVT_MENU(menu_batch_id, wxMaxima::FileMenu)
@@ -9079,6 +9842,9 @@ EVT_UPDATE_UI(menu_show_toolbar, wxMaxima::UpdateMenus)
                 EVT_MENU(Worksheet::popid_unfold, wxMaxima::PopupMenu)
                 EVT_MENU(menu_evaluate_all_visible, wxMaxima::MaximaMenu)
                 EVT_MENU(menu_evaluate_all, wxMaxima::MaximaMenu)
+                EVT_MENU(menu_evaluate_stale, wxMaxima::MaximaMenu)
+                EVT_MENU(menu_evaluate_independent, wxMaxima::MaximaMenu)
+                EVT_MENU(maxima_worker_id, wxMaxima::OnWorkerEvent)
                 EVT_MENU(ToolBar::tb_evaltillhere, wxMaxima::MaximaMenu)
                 EVT_MENU(menu_list_create_from_elements,wxMaxima::ListMenu)
                 EVT_MENU(menu_list_create_from_rule,wxMaxima::ListMenu)
@@ -9145,6 +9911,7 @@ EVT_UPDATE_UI(menu_show_toolbar, wxMaxima::UpdateMenus)
                 EVT_MENU_RANGE(menu_pane_hideall, menu_pane_stats, wxMaxima::ShowPane)
                 EVT_MENU(menu_show_toolbar, wxMaxima::EditMenu)
                 EVT_MENU(Worksheet::popid_auto_answer, wxMaxima::InsertMenu)
+                EVT_MENU(Worksheet::popid_independent, wxMaxima::InsertMenu)
                 EVT_LISTBOX_DCLICK(history_ctrl_id, wxMaxima::HistoryDClick)
                 EVT_LIST_ITEM_ACTIVATED(structure_ctrl_id, wxMaxima::TableOfContentsSelection)
                 EVT_BUTTON(menu_stats_histogram, wxMaxima::StatsMenu)
@@ -34,6 +34,9 @@
 #include "wxMaximaFrame.h"
 #include "MathParser.h"
 #include "Dirstructure.h"
+#include "MaximaStandby.h"
+#include "MaximaWorker.h"
+#include "SocketWriter.h"
 
 #include <wx/socket.h>
 #include <wx/config.h>
@@ -44,6 +47,7 @@
 #include <wx/txtstrm.h>
 #include <wx/sckstrm.h>
 #include <wx/buffer.h>
+#include <vector>
 #ifdef __WXMSW__
 #include <windows.h>
 #endif
@@ -74,6 +78,12 @@
 
 //! How many miliseconds should we wait between polling for stdout+cpu power?
 #define MAXIMAPOLLMSECS 2000
+//! How many bytes do we read from each of maxima's pipes per poll, at most?
+#define MAXIMAPIPEMAXBYTES 65536
+//! How many miliseconds to wait before reading the rest of a flood of stdout/stderr data?
+#define MAXIMAPIPEDRAINMSECS 100
+//! How many commands may maxima have been sent ahead in the pipelined mode, at most?
+#define MAXIMAPIPELINEDEPTH 16
 
 #ifndef __WXGTK__
 
@@ -172,6 +182,18 @@ public:
     {
       m_exitAfterEval = exitaftereval;
     }
+
+  /*! Evaluate the document without ever displaying it?
+
+    A headless window evaluates its file, saves it and closes even if maxima
+    has issued an error or asked a question no answer is known for. Its cells
+    are never laid out or drawn.
+   */
+  void Headless(bool headless)
+    {
+      m_headless = headless;
+      m_worksheet->m_configuration->Headless(headless);
+    }
   
   void StripLispComments(wxString &s);
 
@@ -189,12 +211,31 @@ public:
   void LoadImage(wxString file)
   { m_worksheet->OpenHCaret(file, GC_TYPE_IMAGE); }
 
-  //! Query the value of a new maxima variable
+  /*! Query the values of all variables in m_varNamesToQuery
+
+    All values are requested in one single command that maxima answers with
+    one single \<variables\> message.
+   */
   bool QueryVariableValue();
 
 private:
   //! The variable names to query for the variables pane
   wxArrayString m_varNamesToQuery;
+  /*! Do we need the values of all variables, even the ones that haven't changed?
+
+    Maxima remembers the values it has sent and by default only sends the values
+    that have changed since. But if the watch list has changed we need to know
+    all values again.
+   */
+  bool m_queryAllVariableValues;
+  //! The additional maxima processes that evaluate independent sections
+  std::vector<MaximaWorker *> m_workers;
+  //! The maxima that takes over on the next restart. NULL = none.
+  MaximaStandby *m_standby;
+  //! The output of a standby maxima we have taken over that waits for being interpreted
+  wxString m_dataFromStandby;
+  //! The code cells of the independent sections no worker has started on yet
+  std::list<std::list<GroupCell *> > m_independentSections;
   bool m_isLogTarget;
   //! Is true if opening the file from the command line failed before updating the statusbar.
   bool m_openInitialFileError;
@@ -237,6 +278,12 @@ private:
   bool m_evalOnStartup;
   //! Do we want to exit the program after the evaluation was successful?
   bool m_exitAfterEval;
+  //! Is this window never shown, see Headless()?
+  bool m_headless;
+  //! Has evaluating the document in headless mode failed?
+  bool m_headlessError;
+  //! Has the document been evaluated and saved in headless mode?
+  bool m_headlessCompleted;
   //! Can we display the "ready" prompt right now?
   bool m_ready;
 
@@ -259,6 +306,8 @@ protected:
   void OnMinimize(wxIconizeEvent &event);
   //! Is called on start and whenever the configuration changes
   void ConfigChanged();
+  //! The commands that tell maxima about the current configuration
+  wxString ConfigCommands();
   //! Called when the "Scroll to last error" button is pressed.
   void OnJumpToError(wxCommandEvent &event);
 
@@ -360,6 +409,20 @@ protected:
     m_currentOutput until we got a full line we can display.
    */
   void ClientEvent(wxSocketEvent &event);
+  /*! Sends maxima as much of the data SendMaxima() has queued as the socket accepts
+
+    The rest is sent on the next wxSOCKET_OUTPUT event => the GUI never waits
+    for maxima to read its input.
+   */
+  void FlushSendBuffer();
+  //! Updates the status bar after m_sendBuffer has tried to send data
+  void SendBufferFlushed(bool success);
+  /*! Adds a char from maxima to m_newCharsFromMaxima, handling the framed protocol
+
+    \return true, if this char was the last one of a framed message or if it
+    has started a new frame before the current one was complete.
+   */
+  bool AddCharFromMaxima(wxChar chr);
   //! Triggered when we get new chars from maxima.
   void OnNewChars();
 
@@ -418,6 +481,38 @@ protected:
   //! Try to evaluate the next command for maxima that is in the evaluation queue
   void TriggerEvaluation();
 
+  /*! Sends the commands that follow the current one in the pipelined mode
+
+    Stops at the first command that might need an answer from the user or
+    might not be answered by a prompt, at a cell the user is editing and at a
+    cell TriggerEvaluation() would refuse to send. The cells commands have been
+    sent from cannot be edited until they are evaluated.
+   */
+  void SendCommandsAhead();
+
+  //! Hands all sections marked as independent to additional maxima processes
+  void EvaluateIndependentSections();
+
+  //! Hands the independent sections that wait for evaluation to idle workers
+  void DispatchToWorkers();
+
+  //! Displays the output of an additional maxima process or hands it new work
+  void OnWorkerEvent(wxCommandEvent &event);
+
+  //! Stops all additional maxima processes
+  void KillWorkers();
+
+  //! Queues a cell maxima has been sent for HarvestSymbols()
+  void HarvestSymbolsLater(GroupCell *group);
+
+  /*! Adds the variables and functions a cell defines to the autocompletion
+
+    The symbols are the ones GroupCell::GetDependencies() finds. This uses the
+    tokens the syntax highlighting has split the cell into => this can be done
+    after the cell has been sent to maxima, when wxMaxima is idle.
+   */
+  void HarvestSymbols(GroupCell *group);
+
   void TryUpdateInspector();
 
   void UpdateDrawPane();
@@ -438,12 +533,37 @@ protected:
    */
   bool StartMaxima(bool force = false);
 
+  //! Starts a maxima that waits in the background for the next restart, if needed
+  void StartStandby();
+
+  /*! Takes over the maxima that has been kept on standby, if it is ready
+
+    \param command The command line a new maxima would be started with
+    \return false, if a new maxima process has to be started instead.
+   */
+  bool UseStandby(wxString command);
+
   void OnClose(wxCloseEvent &event);               //!< close wxMaxima window
   wxString GetCommand(bool params = true);         //!< returns the command to start maxima
   //    (uses guessConfiguration)
 
-  //! Polls the stderr and stdout of maxima for input.
-  void ReadStdErr();
+  /*! Polls the stderr and stdout of maxima for input.
+
+    \return true, if there is more data waiting than we have read this time.
+   */
+  bool ReadStdErr();
+
+  /*! Reads the data that is available from one of maxima's pipes
+
+    Reads in blocks and doesn't read more than MAXIMAPIPEMAXBYTES so a flood
+    of output cannot freeze the GUI.
+    \param stream The pipe to read from
+    \param pending The bytes of an incomplete UTF-8 character that were left
+           over from the last call
+    \param moreData Is set to true, if we stopped reading before the pipe was
+           empty.
+   */
+  static wxString ReadPipe(wxInputStream *stream, wxMemoryBuffer &pending, bool &moreData);
 
   /*! Determines the process id of maxima from its initial output
 
@@ -556,6 +676,9 @@ protected:
  */
   void SetupVariables();
 
+  //! The commands SetupVariables() sends, except for the configuration
+  wxArrayString SetupCommands();
+
   void KillMaxima(bool logMessage = true);                 //!< kills the maxima process
   /*! Update the title
 
@@ -607,6 +730,13 @@ protected:
   //! Set the current working directory file I/O from maxima is relative to.
   void SetCWD(wxString file);
 
+  /*! The commands that tell maxima which file it works on
+
+    \param filename The file name, with forward slashes
+    \param dirname The directory the file is in, with forward slashes
+   */
+  wxString CWDCommands(wxString filename, wxString dirname);
+
   //! Get the current working directory file I/O from maxima is relative to.
   wxString GetCWD()
   {
@@ -626,9 +756,31 @@ protected:
   wxInputStream *m_maximaStdout;
   //! The stderr of the maxima process
   wxInputStream *m_maximaStderr;
+  //! The start of an UTF-8 character we have only read half of from maxima's stdout
+  wxMemoryBuffer m_maximaStdoutPending;
+  //! The start of an UTF-8 character we have only read half of from maxima's stderr
+  wxMemoryBuffer m_maximaStderrPending;
+  //! The data that waits for maxima to accept it
+  SocketWriter m_sendBuffer;
   int m_port;
   //! All chars from maxima that still aren't part of m_currentOutput
   wxString m_newCharsFromMaxima;
+  /*! Where in a framed message are we?
+
+    If the framed protocol is active wxMathML.lisp precedes each XML message by
+    STX, a char telling the message type, the length of the message in bytes
+    and a colon. Data outside a frame is handled as in the text protocol.
+  */
+  enum frameState
+  {
+    frame_none,    //!< We are not inside a framed message
+    frame_type,    //!< The next char tells the message type
+    frame_length,  //!< We are reading the length of the message
+    frame_payload  //!< We are reading the message itself
+  };
+  frameState m_frameState;
+  //! How many bytes of the current framed message have yet to arrive?
+  long m_frameBytesLeft;
   /*! The end of maxima's current uninterpreted output, see m_currentOutput.
    
     If we just want to look if maxima's current output contains an ending tag
@@ -688,8 +840,6 @@ protected:
 #endif
   wxHtmlHelpController m_htmlhelpCtrl;
   wxFindReplaceData m_findData;
-  wxRegEx m_funRegEx;
-  wxRegEx m_varRegEx;
   wxRegEx m_blankStatementRegEx;
   wxRegEx m_sbclCompilationRegEx;
   MathParser *m_parser;
@@ -742,13 +892,37 @@ public:
   
   static std::list<wxMaxima *> m_topLevelWindows;
 
+  /*! Open hidden windows for the files in m_headlessFiles
+
+    Opens windows until m_headlessJobs windows are evaluating files at the
+    same time or there are no more files to evaluate.
+   */
+  void StartHeadlessJobs();
+
+  //! Records that a file has been evaluated in headless mode
+  static void HeadlessJobFinished(wxString file, bool success);
+
+  //! Do we evaluate files without displaying them?
+  static bool m_headless;
+
   void OnFileMenu(wxCommandEvent &ev);
 
   virtual void MacNewFile();
   void BecomeLogTarget();
 
   virtual void MacOpenFile(const wxString &file);
+  //! Returns 1 if any of the files evaluated in headless mode has failed
+  virtual int OnRun();
 private:
+  //! Opens a hidden window that evaluates file
+  void NewHeadlessWindow(wxString file);
+
+  //! The files that wait for being evaluated in headless mode
+  static std::list<wxString> m_headlessFiles;
+  //! How many files may be evaluated at the same time in headless mode?
+  static long m_headlessJobs;
+  //! The number of files whose evaluation in headless mode has failed
+  static long m_headlessFailures;
   //! The name of the config file. Empty = Use the default one.
   wxString m_configFileName;
   Dirstructure *m_dirstruct;
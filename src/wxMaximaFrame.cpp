@@ -154,6 +154,7 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
   m_worksheet->m_tableOfContents = new TableOfContents(this, -1, &m_worksheet->m_configuration);
 
   m_xmlInspector = new XmlInspector(this, -1);
+  m_profiler = new EvaluationProfiler(this, -1);
   SetupMenu();
 
   m_statusBar = new StatusBar(this, -1);
@@ -224,6 +225,16 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
                             PaneBorder(true).
                             Right());
 
+  m_manager.AddPane(m_profiler,
+                    wxAuiPaneInfo().Name(wxT("profiler")).
+                            Show(false).CloseButton(true).PinButton().
+                            TopDockable(true).
+                            BottomDockable(true).
+                            LeftDockable(true).
+                            RightDockable(true).
+                            PaneBorder(true).
+                            Bottom());
+
   m_manager.AddPane(CreateStatPane(),
                     wxAuiPaneInfo().Name(wxT("stats")).
                             Show(false).CloseButton(true).PinButton().
@@ -423,6 +434,8 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
     CloseButton(true).PinButton().Resizable();
   m_manager.GetPane(wxT("XmlInspector")) =
     m_manager.GetPane(wxT("XmlInspector")).Caption(_("Raw XML monitor")).CloseButton(true).PinButton().Resizable();
+  m_manager.GetPane(wxT("profiler")) =
+    m_manager.GetPane(wxT("profiler")).Caption(_("Evaluation Profiler")).CloseButton(true).PinButton().Resizable();
   // The XML inspector scares many users and displaying long XML responses there slows
   // down wxMaxima => disable the XML inspector on startup.
   m_manager.GetPane(wxT("XmlInspector")).Show(false);
@@ -713,6 +726,7 @@ void wxMaximaFrame::SetupMenu()
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_log,   _("Debug messages"));
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_variables,   _("Variables"));
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_xmlInspector, _("Raw XML Monitor"));
+  m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_profiler, _("Evaluation Profiler"));
   m_Maxima_Panes_Sub->AppendSeparator();
   m_Maxima_Panes_Sub->AppendCheckItem(ToolBar::tb_hideCode, _("Hide Code Cells\tAlt+Ctrl+H"));
   m_Maxima_Panes_Sub->Append(menu_pane_hideall, _("Hide All Toolbars\tAlt+Shift+-"), _("Hide all panes"),
@@ -768,6 +782,12 @@ void wxMaximaFrame::SetupMenu()
                      _("Evaluate all visible cells in the document"), wxITEM_NORMAL);
   m_CellMenu->Append(menu_evaluate_all, _("Evaluate All Cells\tCtrl+Shift+R"),
                      _("Evaluate all cells in the document"), wxITEM_NORMAL);
+  m_CellMenu->Append(menu_evaluate_stale, _("Evaluate Changed Cells"),
+                     _("Evaluate the cells that have changed since maxima has evaluated them and the cells that depend on them"),
+                     wxITEM_NORMAL);
+  m_CellMenu->Append(menu_evaluate_independent, _("Evaluate Independent Sections in Parallel"),
+                     _("Evaluate the sections marked as independent using additional maxima processes"),
+                     wxITEM_NORMAL);
   m_CellMenu->Append(ToolBar::tb_evaltillhere, _("Evaluate Cells Above\tCtrl+Shift+P"),
                      _("Re-evaluate all cells above the one the cursor is in"), wxITEM_NORMAL);
   m_CellMenu->Append(ToolBar::tb_evaluate_rest, _("Evaluate Cells Below"),
@@ -1262,6 +1282,8 @@ m_listMenu->AppendSeparator();
   m_HelpMenu->AppendSeparator();
   m_HelpMenu->Append(menu_build_info, _("Build &Info"),
                      _("Info about Maxima build"), wxITEM_NORMAL);
+  m_HelpMenu->Append(menu_memory_report, _("&Memory Report"),
+                     _("Log how much memory the cells of the worksheet occupy"), wxITEM_NORMAL);
   m_HelpMenu->Append(menu_bug_report, _("&Bug Report"),
                      _("Report bug"), wxITEM_NORMAL);
   m_HelpMenu->AppendSeparator();
@@ -1463,6 +1485,9 @@ bool wxMaximaFrame::IsPaneDisplayed(Event id)
     case menu_pane_xmlInspector:
       displayed = m_manager.GetPane(wxT("XmlInspector")).IsShown();
       break;
+    case menu_pane_profiler:
+      displayed = m_manager.GetPane(wxT("profiler")).IsShown();
+      break;
     case menu_pane_stats:
       displayed = m_manager.GetPane(wxT("stats")).IsShown();
       break;
@@ -1509,6 +1534,9 @@ void wxMaximaFrame::ShowPane(Event id, bool show)
     case menu_pane_xmlInspector:
       m_manager.GetPane(wxT("XmlInspector")).Show(show);
       break;
+    case menu_pane_profiler:
+      m_manager.GetPane(wxT("profiler")).Show(show);
+      break;
     case menu_pane_stats:
       m_manager.GetPane(wxT("stats")).Show(show);
       break;
@@ -1535,6 +1563,7 @@ void wxMaximaFrame::ShowPane(Event id, bool show)
       m_manager.GetPane(wxT("history")).Show(false);
       m_manager.GetPane(wxT("structure")).Show(false);
       m_manager.GetPane(wxT("XmlInspector")).Show(false);
+      m_manager.GetPane(wxT("profiler")).Show(false);
       m_manager.GetPane(wxT("stats")).Show(false);
       m_manager.GetPane(wxT("greek")).Show(false);
       m_manager.GetPane(wxT("log")).Show(false);
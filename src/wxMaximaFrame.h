@@ -47,6 +47,7 @@ surrounding the worksheet.
 #include "History.h"
 #include "ToolBar.h"
 #include "XmlInspector.h"
+#include "EvaluationProfiler.h"
 #include "StatusBar.h"
 #include "LogPane.h"
 #include <list>
@@ -107,6 +108,7 @@ public:
     menu_pane_variables, //!< Both the "toggle the variables pane" command and the "variables" pane
     menu_pane_draw,      //!< Both the "toggle the draw pane" command for the "draw" pane
     menu_pane_symbols,   //!< Both the "toggle the symbols pane" command for the "symbols" pane
+    menu_pane_profiler,  //!< Both the "toggle the profiler" command and the "profiler" pane
     /*! Both used as the "toggle the stats pane" command and as the ID of the stats pane
 
       Since this enum is also used for iterating over the panes it is vital 
@@ -264,10 +266,13 @@ public:
     menu_soft_restart,
     menu_plot_format,
     menu_build_info,
+    menu_memory_report,
     menu_bug_report,
     menu_add_path,
     menu_evaluate_all_visible,
     menu_evaluate_all,
+    menu_evaluate_stale,
+    menu_evaluate_independent,
     menu_show_tip,
     menu_copy_from_worksheet,
 	menu_copy_matlab_from_worksheet,
@@ -488,7 +493,8 @@ public:
     socket_client_id,
     socket_server_id,
     maxima_process_id,
-    gnuplot_process_id
+    gnuplot_process_id,
+    maxima_worker_id
   };
 
   /*! Update the recent documents list
@@ -740,6 +746,8 @@ protected:
   wxAuiManager m_manager;
   //! A XmlInspector-like xml monitor
   XmlInspector *m_xmlInspector;
+  //! The pane that shows how long each command took
+  EvaluationProfiler *m_profiler;
   //! true=force an update of the status bar at the next call of StatusMaximaBusy()
   bool m_forceStatusbarUpdate;
   //! The panel the log and debug messages will appear on
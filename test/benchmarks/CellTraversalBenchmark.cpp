@@ -0,0 +1,163 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  A benchmark for iterating over the cells a cell contains
+
+  Builds a list of nested fractions, powers and parenthesis like maxima's
+  output of long formulas contains and measures how many heap allocations and
+  how much time ResetData(), CellsInListRecursive() and RecalculateList()
+  need for it. Cells themselves are allocated from the CellPool and therefore
+  aren't counted.
+ */
+
+#include <wx/wx.h>
+#include <wx/dcmemory.h>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "Configuration.h"
+#include "TextCell.h"
+#include "FracCell.h"
+#include "ExptCell.h"
+#include "ParenCell.h"
+
+//! The number of heap allocations made since the program has started
+static unsigned long allocations = 0;
+
+void *operator new(size_t size)
+{
+  allocations++;
+  void *memory = malloc(size > 0 ? size : 1);
+  if (memory == NULL)
+    throw std::bad_alloc();
+  return memory;
+}
+
+void operator delete(void *memory) throw()
+{
+  free(memory);
+}
+
+//! Builds a formula with 2^depth leaves
+static Cell *Formula(Configuration **config, Cell::CellPointers *cellPointers, int depth)
+{
+  if (depth == 0)
+    return new TextCell(NULL, config, cellPointers, wxT("x"));
+
+  ExptCell *expt = new ExptCell(NULL, config, cellPointers);
+  expt->SetBase(new TextCell(NULL, config, cellPointers, wxT("y")));
+  expt->SetPower(Formula(config, cellPointers, depth - 1));
+
+  FracCell *frac = new FracCell(NULL, config, cellPointers);
+  frac->SetNum(Formula(config, cellPointers, depth - 1));
+  frac->SetDenom(expt);
+  frac->SetupBreakUps();
+
+  ParenCell *paren = new ParenCell(NULL, config, cellPointers);
+  paren->SetInner(frac, MC_TYPE_DEFAULT);
+  return paren;
+}
+
+//! Runs a test repeatedly and prints how many allocations and how much time each run needed
+class Measurement
+{
+public:
+  Measurement(const char *name, int runs) : m_name(name), m_runs(runs)
+  {
+    m_allocations = allocations;
+    m_start = wxGetUTCTimeUSec();
+  }
+  ~Measurement()
+  {
+    wxLongLong time = wxGetUTCTimeUSec() - m_start;
+    printf("%-24s %10.1f allocations/run %10.1f us/run\n", m_name,
+           (double) (allocations - m_allocations) / m_runs,
+           time.ToDouble() / m_runs);
+  }
+private:
+  const char *m_name;
+  int m_runs;
+  unsigned long m_allocations;
+  wxLongLong m_start;
+};
+
+int main(int argc, char **argv)
+{
+  // Cells are drawn on a worksheet, which needs the GUI to be initialized.
+  wxApp::SetInstance(new wxApp());
+  if (!wxEntryStart(argc, argv))
+  {
+    fprintf(stderr, "Cannot initialize wxWidgets\n");
+    return 1;
+  }
+  // Cells that don't belong to a GroupCell complain about it.
+  wxSetAssertHandler(NULL);
+
+  {
+    wxBitmap bitmap(800, 600);
+    wxMemoryDC dc(bitmap);
+    Configuration *configuration = new Configuration(&dc);
+    Cell::CellPointers cellPointers(NULL);
+
+    const int formulas = 100;
+    const int runs = 100;
+    Cell *list = NULL;
+    Cell *last = NULL;
+    for (int i = 0; i < formulas; i++)
+    {
+      Cell *formula = Formula(&configuration, &cellPointers, 6);
+      if (list == NULL)
+        list = formula;
+      else
+        last->AppendCell(formula);
+      last = formula;
+    }
+
+    printf("%i cells\n", list->CellsInListRecursive());
+    {
+      Measurement measurement("ResetData()", runs);
+      for (int run = 0; run < runs; run++)
+        for (Cell *tmp = list; tmp != NULL; tmp = tmp->m_next)
+          tmp->ResetData();
+    }
+    {
+      Measurement measurement("CellsInListRecursive()", runs);
+      for (int run = 0; run < runs; run++)
+        list->CellsInListRecursive();
+    }
+    {
+      Measurement measurement("RecalculateList()", runs);
+      for (int run = 0; run < runs; run++)
+      {
+        for (Cell *tmp = list; tmp != NULL; tmp = tmp->m_next)
+          tmp->ResetData();
+        list->RecalculateList(configuration->GetDefaultFontSize());
+      }
+    }
+
+    wxDELETE(list);
+    wxDELETE(configuration);
+  }
+
+  wxEntryCleanup();
+  return 0;
+}
@@ -0,0 +1,239 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2019 Gunter Königsmann <wxMaxima@physikbuch.de>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  A benchmark that compares the scanners in StringMatchers with the regular
+  expressions they replace
+
+  Each scanner is run on strings like the ones TextCell, MathParser and Image
+  see while maxima's output is parsed. The benchmark prints the time per
+  string and counts the strings the scanner and the regular expression
+  disagree on.
+ */
+
+#include <wx/init.h>
+#include <wx/regex.h>
+#include <wx/time.h>
+#include <cstdio>
+#include "StringMatchers.h"
+
+//! How often each list of strings is processed
+static const int runs = 10000;
+
+//! Prints the time a scanner and the regex it replaces needed per string
+static void Report(const char *name, wxLongLong scannerTime, wxLongLong regexTime,
+                   size_t strings, int mismatches)
+{
+  double count = (double) runs * strings;
+  printf("%-24s scanner: %8.3f us/string   regex: %8.3f us/string   mismatches: %i\n",
+         name, scannerTime.ToDouble() / count, regexTime.ToDouble() / count, mismatches);
+}
+
+static void RoundingErrors()
+{
+  const wxString numbers[] = {
+    wxT("1"), wxT("42"), wxT("3.14159"), wxT("0.30000000000000004"),
+    wxT("0.9999999999999999"), wxT("1.0000000000000002e-5"), wxT("x"),
+    wxT("2.718281828459045"), wxT("1.5e10"), wxT("123456789")
+  };
+  const size_t count = sizeof(numbers) / sizeof(numbers[0]);
+  wxRegEx regex1(wxT("\\.000000000000[0-9]+$"));
+  wxRegEx regex2(wxT("\\.999999999999[0-9]+$"));
+  wxRegEx regex3(wxT("\\.000000000000[0-9]+e"));
+  wxRegEx regex4(wxT("\\.999999999999[0-9]+e"));
+
+  int mismatches = 0;
+  for (size_t i = 0; i < count; i++)
+    if (StringMatchers::LooksLikeRoundingError(numbers[i]) !=
+        (regex1.Matches(numbers[i]) || regex2.Matches(numbers[i]) ||
+         regex3.Matches(numbers[i]) || regex4.Matches(numbers[i])))
+      mismatches++;
+
+  volatile bool found;
+  wxLongLong start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+      found = StringMatchers::LooksLikeRoundingError(numbers[i]);
+  wxLongLong scannerTime = wxGetUTCTimeUSec() - start;
+
+  start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+      found = regex1.Matches(numbers[i]) || regex2.Matches(numbers[i]) ||
+              regex3.Matches(numbers[i]) || regex4.Matches(numbers[i]);
+  wxLongLong regexTime = wxGetUTCTimeUSec() - start;
+
+  Report("LooksLikeRoundingError", scannerTime, regexTime, count, mismatches);
+}
+
+static void Unescape()
+{
+  const wxString labels[] = {
+    wxT("(%o1)"), wxT("(eq1)"), wxT("(a\\_b)"), wxT("(\\\\x)"), wxT("(very_long_label_name)")
+  };
+  const size_t count = sizeof(labels) / sizeof(labels[0]);
+  wxRegEx regex(wxT("\\\\(.)"));
+
+  int mismatches = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    wxString scanned = labels[i];
+    StringMatchers::Unescape(scanned);
+    wxString replaced = labels[i];
+    regex.ReplaceAll(&replaced, wxT("\\1"));
+    if (scanned != replaced)
+      mismatches++;
+  }
+
+  wxLongLong start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = labels[i];
+      StringMatchers::Unescape(text);
+    }
+  wxLongLong scannerTime = wxGetUTCTimeUSec() - start;
+
+  start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = labels[i];
+      regex.ReplaceAll(&text, wxT("\\1"));
+    }
+  wxLongLong regexTime = wxGetUTCTimeUSec() - start;
+
+  Report("Unescape", scannerTime, regexTime, count, mismatches);
+}
+
+static void ReplaceControlChars()
+{
+  // The regex also replaced tabs and line breaks, which XML allows and the
+  // scanner keeps => the lines contain none of them and both have to agree.
+  const wxString lines[] = {
+    wxT("<mth><mi>x</mi><mo>+</mo><mn>1</mn></mth>"),
+    wxT("(%o1) a line of maxima's output without any control characters"),
+    wxT("a bell \x07 and an escape \x1b[0m"),
+    wxT("<mth><mfrac><mi>a</mi><mi>b</mi></mfrac></mth>")
+  };
+  const size_t count = sizeof(lines) / sizeof(lines[0]);
+  wxRegEx regex(wxT("[[:cntrl:]]"));
+
+  int mismatches = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    wxString scanned = lines[i];
+    StringMatchers::ReplaceControlChars(scanned);
+    wxString replaced = lines[i];
+    regex.Replace(&replaced, wxT("\xFFFD"));
+    if (scanned != replaced)
+      mismatches++;
+  }
+
+  wxLongLong start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = lines[i];
+      StringMatchers::ReplaceControlChars(text);
+    }
+  wxLongLong scannerTime = wxGetUTCTimeUSec() - start;
+
+  start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = lines[i];
+      regex.Replace(&text, wxT("\xFFFD"));
+    }
+  wxLongLong regexTime = wxGetUTCTimeUSec() - start;
+
+  Report("ReplaceControlChars", scannerTime, regexTime, count, mismatches);
+}
+
+static void ReplaceDataFileNames()
+{
+  const wxString lines[] = {
+    wxT("set title ''"),
+    wxT("set xrange [-5.0:5.0]"),
+    wxT("plot '/tmp/maxout_1234_1.data' index 0 with lines lt 1"),
+    wxT("set terminal pngcairo size 600,400 font \",12\""),
+    wxT("splot 'C:/Users/a/maxout_99_12.data' with pm3d")
+  };
+  const size_t count = sizeof(lines) / sizeof(lines[0]);
+  const wxString placeholder(wxT("'<DATAFILENAME>'"));
+
+  int mismatches = 0;
+  {
+    wxRegEx regex(wxT("'[^']*maxout_[^']*_[0-9]*\\.data'"));
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString scanned = lines[i];
+      StringMatchers::ReplaceDataFileNames(scanned, placeholder);
+      wxString replaced = lines[i];
+      if (regex.Matches(replaced))
+        regex.Replace(&replaced, placeholder);
+      if (scanned != replaced)
+        mismatches++;
+    }
+  }
+
+  wxLongLong start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = lines[i];
+      StringMatchers::ReplaceDataFileNames(text, placeholder);
+    }
+  wxLongLong scannerTime = wxGetUTCTimeUSec() - start;
+
+  // Image::CompressGnuplotFile() used to compile the regex once per file.
+  start = wxGetUTCTimeUSec();
+  for (int run = 0; run < runs; run++)
+  {
+    wxRegEx regex(wxT("'[^']*maxout_[^']*_[0-9]*\\.data'"));
+    for (size_t i = 0; i < count; i++)
+    {
+      wxString text = lines[i];
+      if (regex.Matches(text))
+        regex.Replace(&text, placeholder);
+    }
+  }
+  wxLongLong regexTime = wxGetUTCTimeUSec() - start;
+
+  Report("ReplaceDataFileNames", scannerTime, regexTime, count, mismatches);
+}
+
+int main(int argc, char **argv)
+{
+  wxInitializer initializer(argc, argv);
+  if (!initializer.IsOk())
+  {
+    fprintf(stderr, "Cannot initialize wxWidgets\n");
+    return 1;
+  }
+
+  RoundingErrors();
+  Unescape();
+  ReplaceControlChars();
+  ReplaceDataFileNames();
+  return 0;
+}